@@ -844,6 +844,13 @@ int mbedtls_mpi_mod_int( mbedtls_mpi_uint *r, const mbedtls_mpi *A,
  *                 will assume that \p prec_RR holds the helper value set by a
  *                 previous call to mbedtls_mpi_exp_mod(), and reuse it.
  *
+ * \note           The common RSA public exponent \p E = 65537 is detected
+ *                 and handled with a dedicated chain of 16 squarings and one
+ *                 multiplication, without precomputing a window table.
+ *                 Likewise, the base \p A = 2 used by the standard
+ *                 Diffie-Hellman groups is handled with modular doublings
+ *                 instead of multiplications by a precomputed table.
+ *
  * \return         \c 0 if successful.
  * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
  * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \c N is negative or
@@ -128,6 +128,10 @@
 #error "MBEDTLS_ECDSA_DETERMINISTIC defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ECDSA_PRESIG_POOL) && !defined(MBEDTLS_ECDSA_C)
+#error "MBEDTLS_ECDSA_PRESIG_POOL defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ECP_C) && ( !defined(MBEDTLS_BIGNUM_C) || (    \
     !defined(MBEDTLS_ECP_DP_SECP192R1_ENABLED) &&                  \
     !defined(MBEDTLS_ECP_DP_SECP224R1_ENABLED) &&                  \
@@ -581,11 +585,70 @@
 #error "MBEDTLS_PSA_INJECT_ENTROPY is not compatible with MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG"
 #endif
 
+#if defined(MBEDTLS_PSA_ASYNC_C) &&                 \
+    !( defined(MBEDTLS_PSA_CRYPTO_C) &&             \
+       defined(MBEDTLS_THREADING_C) &&              \
+       defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_PSA_ASYNC_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG) &&   \
+    !( defined(MBEDTLS_PSA_CRYPTO_C) &&             \
+       defined(MBEDTLS_THREADING_C) &&              \
+       defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG) &&   \
+    defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+#error "MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG is not compatible with MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG"
+#endif
+
+#if defined(MBEDTLS_RSA_GEN_KEY_THREADED) &&   \
+    !( defined(MBEDTLS_RSA_C) &&                \
+       defined(MBEDTLS_GENPRIME) &&             \
+       defined(MBEDTLS_THREADING_C) &&          \
+       defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_RSA_GEN_KEY_THREADED defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION) && \
+    !defined(MBEDTLS_PSA_CRYPTO_C)
+#error "MBEDTLS_PSA_CRYPTO_INSTRUMENTATION defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION) &&  \
+    defined(MBEDTLS_PSA_STATS_MAX_ENTRIES) &&       \
+    MBEDTLS_PSA_STATS_MAX_ENTRIES < 2
+#error "MBEDTLS_PSA_STATS_MAX_ENTRIES must be at least 2"
+#endif
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC) &&       \
+    defined(MBEDTLS_PSA_KEY_SLOT_COUNT) &&          \
+    MBEDTLS_PSA_KEY_SLOT_COUNT > 8192
+#error "MBEDTLS_PSA_KEY_SLOT_COUNT is too large for MBEDTLS_PSA_KEY_STORE_DYNAMIC"
+#endif
+
 #if defined(MBEDTLS_PSA_ITS_FILE_C) && \
     !defined(MBEDTLS_FS_IO)
 #error "MBEDTLS_PSA_ITS_FILE_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_PSA_ITS_LOG_C) && \
+    !defined(MBEDTLS_FS_IO)
+#error "MBEDTLS_PSA_ITS_LOG_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_ITS_LOG_C) && \
+    defined(MBEDTLS_PSA_ITS_FILE_C)
+#error "MBEDTLS_PSA_ITS_LOG_C is not compatible with MBEDTLS_PSA_ITS_FILE_C"
+#endif
+
+#if defined(MBEDTLS_PSA_SIMD_DRIVER_C) &&                           \
+    !( defined(MBEDTLS_PSA_CRYPTO_C) && defined(MBEDTLS_PSA_CRYPTO_DRIVERS) )
+#error "MBEDTLS_PSA_SIMD_DRIVER_C defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_RSA_C) && ( !defined(MBEDTLS_BIGNUM_C) ||         \
     !defined(MBEDTLS_OID_C) )
 #error "MBEDTLS_RSA_C defined, but not all prerequisites"
@@ -714,6 +777,10 @@
 #error "MBEDTLS_SSL_TICKET_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_SSL_ECDHE_POOL_C) && !defined(MBEDTLS_ECP_C)
+#error "MBEDTLS_SSL_ECDHE_POOL_C defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_SSL_SERVER_NAME_INDICATION) && \
         !defined(MBEDTLS_X509_CRT_PARSE_C)
 #error "MBEDTLS_SSL_SERVER_NAME_INDICATION defined, but not all prerequisites"
@@ -795,6 +862,26 @@
 #error "MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_SSL_READ_AHEAD) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_READ_AHEAD defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_WRITE_COALESCING defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_KTLS) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_KTLS defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT) && !defined(MBEDTLS_SSL_READ_AHEAD)
+#error "MBEDTLS_SSL_BATCH_DECRYPT defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_IDLE_BUFFER_RELEASE defined, but not all prerequisites"
+#endif
+
 
 
 /* Reject attempts to enable options that have been removed and that could
@@ -91,6 +91,35 @@
 /** Setting the modulus and generator failed. */
 #define MBEDTLS_ERR_DHM_SET_GROUP_FAILED                  -0x3580
 
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in mbedtls_config.h, or define them using the compiler command line.
+ * \{
+ */
+
+#if !defined(MBEDTLS_DHM_FIXED_BASE_OPTIM)
+/*
+ * Trade code size for speed on key generation with the RFC 7919 groups.
+ *
+ * This speeds up the computation of G^X in mbedtls_dhm_make_params() and
+ * mbedtls_dhm_make_public() by a factor of about 2 when the context uses
+ * one of the ffdhe2048 to ffdhe8192 groups, by using precomputed tables
+ * for their generator 2. The group is detected automatically, for example
+ * after mbedtls_dhm_set_group(). Secret exponents shorter than half the
+ * size of the modulus do not use the tables, as they are faster without.
+ *
+ * This adds 2 * n bytes of read-only data for each n-bit group (the
+ * modulus and 15 table entries), about 46 KiB in total.
+ *
+ * Change this value to 0 to reduce code size.
+ */
+#define MBEDTLS_DHM_FIXED_BASE_OPTIM  1   /**< Enable fixed-base speed-up. */
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM */
+
+/** \} name SECTION: Module settings */
+
 /** Which parameter to access in mbedtls_dhm_get_value(). */
 typedef enum
 {
@@ -449,6 +449,24 @@ int mbedtls_ecdh_calc_secret( mbedtls_ecdh_context *ctx, size_t *olen,
  * \param ctx       The ECDH context to use. This must be initialized.
  */
 void mbedtls_ecdh_enable_restart( mbedtls_ecdh_context *ctx );
+
+/**
+ * \brief           This function sets the maximum number of basic operations
+ *                  done in a row by restartable computations on this
+ *                  context, overriding the value set with
+ *                  mbedtls_ecp_set_max_ops().
+ *
+ * \see             \c mbedtls_ecp_restart_set_max_ops()
+ *
+ * \note            Setting up the context, for example with
+ *                  mbedtls_ecdh_setup() or mbedtls_ecdh_read_params(),
+ *                  resets the budget: call this function afterwards.
+ *
+ * \param ctx       The ECDH context to use. This must be initialized.
+ * \param max_ops   Maximum number of basic operations done in a row,
+ *                  or \c 0 to use the global value instead.
+ */
+void mbedtls_ecdh_set_max_ops( mbedtls_ecdh_context *ctx, unsigned max_ops );
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
 #ifdef __cplusplus
@@ -36,6 +36,10 @@
 #include "mbedtls/ecp.h"
 #include "mbedtls/md.h"
 
+#if defined(MBEDTLS_ECDSA_PRESIG_POOL) && defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /**
  * \brief           Maximum ECDSA signature size for a given curve bit size
  *
@@ -120,6 +124,39 @@ typedef void mbedtls_ecdsa_restart_ctx;
 
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
+#if defined(MBEDTLS_ECDSA_PRESIG_POOL)
+/**
+ * \brief           A precomputed ECDSA presignature
+ *
+ *                  For a nonce k and a blinding value t, this holds
+ *                  r = (kG).x mod n and u = (kt)^-1 mod n, so that the
+ *                  signature of e is s = u * t * (e + r * d) mod n.
+ */
+typedef struct mbedtls_ecdsa_presig
+{
+    mbedtls_mpi MBEDTLS_PRIVATE(r);          /*!<  r part of the signature   */
+    mbedtls_mpi MBEDTLS_PRIVATE(t);          /*!<  blinding value            */
+    mbedtls_mpi MBEDTLS_PRIVATE(u);          /*!<  inverse of k * t          */
+} mbedtls_ecdsa_presig;
+
+/**
+ * \brief           Pool of single-use ECDSA presignatures for one group
+ */
+typedef struct mbedtls_ecdsa_presig_pool
+{
+    mbedtls_ecp_group_id MBEDTLS_PRIVATE(grp_id);    /*!<  group of the pool     */
+    mbedtls_ecdsa_presig *MBEDTLS_PRIVATE(entries);  /*!<  ring of presignatures */
+    size_t MBEDTLS_PRIVATE(capacity);                /*!<  size of the ring      */
+    size_t MBEDTLS_PRIVATE(head);                    /*!<  oldest entry          */
+    size_t MBEDTLS_PRIVATE(count);                   /*!<  number of entries     */
+    int (*MBEDTLS_PRIVATE(f_rng))(void *, unsigned char *, size_t);
+    void *MBEDTLS_PRIVATE(p_rng);                    /*!<  RNG context           */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);
+#endif
+} mbedtls_ecdsa_presig_pool;
+#endif /* MBEDTLS_ECDSA_PRESIG_POOL */
+
 /**
  * \brief          This function checks whether a given group can be used
  *                 for ECDSA.
@@ -359,6 +396,142 @@ int mbedtls_ecdsa_write_signature_restartable( mbedtls_ecdsa_context *ctx,
                            void *p_rng,
                            mbedtls_ecdsa_restart_ctx *rs_ctx );
 
+#if defined(MBEDTLS_ECDSA_PRESIG_POOL)
+/**
+ * \brief           This function initializes a presignature pool.
+ *
+ * \param pool      The pool to initialize. This must not be \c NULL.
+ */
+void mbedtls_ecdsa_presig_pool_init( mbedtls_ecdsa_presig_pool *pool );
+
+/**
+ * \brief           This function prepares an empty presignature pool.
+ *
+ * \param pool      The pool to set up. This must be initialized.
+ * \param gid       The group the presignatures are computed for.
+ * \param capacity  The maximum number of presignatures kept.
+ * \param f_rng     The RNG function used for nonces and blinding. It is
+ *                  called from mbedtls_ecdsa_presig_pool_refill() and must
+ *                  be thread-safe if that runs concurrently with other
+ *                  users of the RNG.
+ * \param p_rng     The RNG context to be passed to \p f_rng.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if a parameter is invalid.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED on allocation failure.
+ */
+int mbedtls_ecdsa_presig_pool_setup( mbedtls_ecdsa_presig_pool *pool,
+                                     mbedtls_ecp_group_id gid,
+                                     size_t capacity,
+                                     int (*f_rng)(void *, unsigned char *, size_t),
+                                     void *p_rng );
+
+/**
+ * \brief           This function computes presignatures until the pool is
+ *                  full or \p max presignatures have been added.
+ *                  (Thread-safe if MBEDTLS_THREADING_C is enabled)
+ *
+ * \note            This does the expensive part of signing (one scalar
+ *                  multiplication and one inversion per presignature) and
+ *                  is meant to run off the critical path, for example from
+ *                  a background thread or an idle loop.
+ *
+ * \param pool      The pool to refill. This must be set up.
+ * \param max       The maximum number of presignatures to compute,
+ *                  or \c 0 to fill the pool.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_ERR_MPI_XXX
+ *                  error code on failure.
+ */
+int mbedtls_ecdsa_presig_pool_refill( mbedtls_ecdsa_presig_pool *pool,
+                                      size_t max );
+
+/**
+ * \brief           This function frees a presignature pool, wiping all
+ *                  unused presignatures.
+ *
+ * \param pool      The pool to free. This may be \c NULL.
+ */
+void mbedtls_ecdsa_presig_pool_free( mbedtls_ecdsa_presig_pool *pool );
+
+/**
+ * \brief           This function computes the ECDSA signature of a
+ *                  previously-hashed message using a presignature.
+ *                  (Thread-safe if MBEDTLS_THREADING_C is enabled)
+ *
+ *                  A presignature is taken from \p pool and wiped, so it
+ *                  is never used twice. If the pool is empty, or was set up
+ *                  for another group, this falls back to mbedtls_ecdsa_sign().
+ *
+ * \param grp       The context for the elliptic curve to use.
+ * \param r         The MPI context in which to store the first part
+ *                  the signature. This must be initialized.
+ * \param s         The MPI context in which to store the second part
+ *                  the signature. This must be initialized.
+ * \param d         The private signing key. This must be initialized.
+ * \param buf       The content to be signed. This is usually the hash of
+ *                  the original data to be signed. This must be a readable
+ *                  buffer of length \p blen Bytes.
+ * \param blen      The length of \p buf in Bytes.
+ * \param pool      The presignature pool to use. This must be set up.
+ * \param f_rng     The RNG function used if the pool is empty.
+ *                  This must not be \c NULL.
+ * \param p_rng     The RNG context to be passed to \p f_rng.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_ERR_MPI_XXX
+ *                  error code on failure.
+ */
+int mbedtls_ecdsa_sign_presig( mbedtls_ecp_group *grp, mbedtls_mpi *r,
+                               mbedtls_mpi *s, const mbedtls_mpi *d,
+                               const unsigned char *buf, size_t blen,
+                               mbedtls_ecdsa_presig_pool *pool,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng );
+
+/**
+ * \brief           This function computes the ECDSA signature using a
+ *                  presignature and writes it to a buffer, as
+ *                  mbedtls_ecdsa_write_signature() does.
+ *                  (Thread-safe if MBEDTLS_THREADING_C is enabled)
+ *
+ * \note            This is suitable for use from the TLS asynchronous
+ *                  private key callbacks set with
+ *                  mbedtls_ssl_conf_async_private_cb(), so that a server's
+ *                  ECDSA handshake signatures use precomputed nonces.
+ *                  If the pool is empty, the signature is computed with
+ *                  a fresh random nonce as in mbedtls_ecdsa_sign().
+ *
+ * \param ctx       The ECDSA context to use. This must be initialized
+ *                  and have a group and private key bound to it.
+ * \param md_alg    The message digest that was used to hash the message.
+ * \param hash      The message hash to be signed. This must be a readable
+ *                  buffer of length \p hlen Bytes.
+ * \param hlen      The length of the hash \p hash in Bytes.
+ * \param sig       The buffer to which to write the signature. A buffer
+ *                  length of #MBEDTLS_ECDSA_MAX_LEN is always safe.
+ * \param sig_size  The size of the \p sig buffer in bytes.
+ * \param slen      The address at which to store the actual length of
+ *                  the signature written. Must not be \c NULL.
+ * \param pool      The presignature pool to use. This must be set up.
+ * \param f_rng     The RNG function used if the pool is empty.
+ *                  This must not be \c NULL.
+ * \param p_rng     The RNG context to be passed to \p f_rng.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX, \c MBEDTLS_ERR_MPI_XXX or
+ *                  \c MBEDTLS_ERR_ASN1_XXX error code on failure.
+ */
+int mbedtls_ecdsa_write_signature_presig( mbedtls_ecdsa_context *ctx,
+                           mbedtls_md_type_t md_alg,
+                           const unsigned char *hash, size_t hlen,
+                           unsigned char *sig, size_t sig_size, size_t *slen,
+                           mbedtls_ecdsa_presig_pool *pool,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng );
+#endif /* MBEDTLS_ECDSA_PRESIG_POOL */
+
 /**
  * \brief           This function reads and verifies an ECDSA signature.
  *
@@ -39,6 +39,10 @@
 
 #include "mbedtls/bignum.h"
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /*
  * ECP error codes
  */
@@ -369,6 +373,7 @@ typedef struct
 {
     unsigned MBEDTLS_PRIVATE(ops_done);                  /*!<  current ops count             */
     unsigned MBEDTLS_PRIVATE(depth);                     /*!<  call depth (0 = top-level)    */
+    unsigned MBEDTLS_PRIVATE(max_ops);                   /*!<  budget, 0 = global setting    */
     mbedtls_ecp_restart_mul_ctx *MBEDTLS_PRIVATE(rsm);   /*!<  ecp_mul_comb() sub-context    */
     mbedtls_ecp_restart_muladd_ctx *MBEDTLS_PRIVATE(ma); /*!<  ecp_muladd() sub-context      */
 } mbedtls_ecp_restart_ctx;
@@ -396,6 +401,22 @@ int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
                               mbedtls_ecp_restart_ctx *rs_ctx,
                               unsigned ops );
 
+/**
+ * \brief           Internal; for restartable functions in other modules.
+ *                  Get the effective ops budget of a restart context.
+ *
+ * \param rs_ctx    Restart context, or \c NULL
+ *
+ * \return          The budget set with mbedtls_ecp_restart_set_max_ops()
+ *                  if any, otherwise the one set for the calling thread
+ *                  with mbedtls_ecp_set_thread_max_ops() if any, otherwise
+ *                  the one set with mbedtls_ecp_set_max_ops(). \c 0 means
+ *                  that restart is disabled for this context, which is
+ *                  always the case if \p rs_ctx is \c NULL: callers may
+ *                  then use faster code paths that cannot yield.
+ */
+unsigned mbedtls_ecp_restart_get_max_ops( const mbedtls_ecp_restart_ctx *rs_ctx );
+
 /* Utility macro for checking and updating ops budget */
 #define MBEDTLS_ECP_BUDGET( ops )   \
     MBEDTLS_MPI_CHK( mbedtls_ecp_check_budget( grp, rs_ctx, \
@@ -426,6 +447,38 @@ typedef struct mbedtls_ecp_keypair
 }
 mbedtls_ecp_keypair;
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/**
+ * \brief    Precomputed table for one public key
+ */
+typedef struct mbedtls_ecp_precomp_entry
+{
+    mbedtls_ecp_group_id MBEDTLS_PRIVATE(grp_id);        /*!< curve of the key    */
+    unsigned char MBEDTLS_PRIVATE(key)[MBEDTLS_ECP_MAX_PT_LEN]; /*!< encoded key */
+    size_t MBEDTLS_PRIVATE(key_len);                     /*!< length of key       */
+    mbedtls_ecp_point *MBEDTLS_PRIVATE(T);               /*!< table of multiples  */
+    unsigned char MBEDTLS_PRIVATE(T_size);               /*!< number of points    */
+    unsigned char MBEDTLS_PRIVATE(w);                    /*!< window size         */
+    unsigned MBEDTLS_PRIVATE(refs);                      /*!< users of the table  */
+    unsigned long MBEDTLS_PRIVATE(last_use);             /*!< for LRU eviction    */
+}
+mbedtls_ecp_precomp_entry;
+
+/**
+ * \brief    Cache of precomputed tables for public keys
+ */
+typedef struct mbedtls_ecp_precomp_cache
+{
+    mbedtls_ecp_precomp_entry *MBEDTLS_PRIVATE(entries); /*!< capacity entries    */
+    size_t MBEDTLS_PRIVATE(capacity);                    /*!< maximum entries     */
+    unsigned long MBEDTLS_PRIVATE(clock);                /*!< use counter         */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);    /*!< mutex               */
+#endif
+}
+mbedtls_ecp_precomp_cache;
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /*
  * Point formats, from RFC 4492's enum ECPointFormat
  */
@@ -497,13 +550,65 @@ mbedtls_ecp_keypair;
  */
 void mbedtls_ecp_set_max_ops( unsigned max_ops );
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
 /**
- * \brief           Check if restart is enabled (max_ops != 0)
+ * \brief           Set the maximum number of basic operations done in a row
+ *                  by the restartable operations of the calling thread,
+ *                  overriding the value set with mbedtls_ecp_set_max_ops().
+ *
+ *                  This lets each worker thread of a server, for example,
+ *                  use its own default, while the budget of a restart
+ *                  context set with mbedtls_ecp_restart_set_max_ops()
+ *                  still takes precedence.
+ *
+ * \note            The remarks on very low values in the documentation
+ *                  of mbedtls_ecp_set_max_ops() apply here too.
+ *
+ * \param max_ops   Maximum number of basic operations done in a row,
+ *                  or \c 0 to use the process-wide value again.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED if the thread-specific
+ *                  storage could not be set up.
+ */
+int mbedtls_ecp_set_thread_max_ops( unsigned max_ops );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+/**
+ * \brief           Check if restart is enabled (max_ops != 0) for the
+ *                  calling thread, by mbedtls_ecp_set_thread_max_ops() or
+ *                  mbedtls_ecp_set_max_ops()
  *
  * \return          \c 0 if \c max_ops == 0 (restart disabled)
  * \return          \c 1 otherwise (restart enabled)
  */
 int mbedtls_ecp_restart_is_enabled( void );
+
+/**
+ * \brief           Set the maximum number of basic operations done in a row
+ *                  by operations using this restart context, overriding the
+ *                  value set with mbedtls_ecp_set_max_ops().
+ *
+ *                  This lets each restartable operation, for example each
+ *                  connection handled by an event loop, be given its own
+ *                  time slice: expensive operations on large curves then
+ *                  cannot delay unrelated operations by more than their
+ *                  own budget.
+ *
+ * \note            The budget is a setting of the context: it is kept by
+ *                  mbedtls_ecp_restart_free() and only reset by
+ *                  mbedtls_ecp_restart_init(). It takes precedence over
+ *                  mbedtls_ecp_set_thread_max_ops(). The remarks on very low
+ *                  values in the documentation of mbedtls_ecp_set_max_ops()
+ *                  apply here too.
+ *
+ * \param ctx       The restart context. This must be initialized.
+ * \param max_ops   Maximum number of basic operations done in a row,
+ *                  or \c 0 to use the value of the calling thread or the
+ *                  global value instead.
+ */
+void mbedtls_ecp_restart_set_max_ops( mbedtls_ecp_restart_ctx *ctx,
+                                      unsigned max_ops );
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
 /*
@@ -1062,6 +1167,103 @@ int mbedtls_ecp_muladd_restartable(
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
              const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
              mbedtls_ecp_restart_ctx *rs_ctx );
+
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/**
+ * \brief           Initialize a public key precomputation cache.
+ *
+ * \param cache     The cache to initialize.
+ */
+void mbedtls_ecp_precomp_cache_init( mbedtls_ecp_precomp_cache *cache );
+
+/**
+ * \brief           Prepare a public key precomputation cache for use.
+ *
+ * \note            Each entry holds a table of at most
+ *                  2^(MBEDTLS_ECP_WINDOW_SIZE - 1) points, that is 8 points
+ *                  with the default settings.
+ *
+ * \param cache     The cache to set up. This must be initialized.
+ * \param capacity  The maximum number of public keys kept. When the cache
+ *                  is full, the least recently used key is evicted.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if \p capacity is \c 0
+ *                  or the cache was already set up.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED on memory-allocation failure.
+ */
+int mbedtls_ecp_precomp_cache_setup( mbedtls_ecp_precomp_cache *cache,
+                                     size_t capacity );
+
+/**
+ * \brief           Free the tables in a public key precomputation cache
+ *                  and clear memory.
+ *
+ * \warning         The cache must not be in use, in particular it must
+ *                  not be installed with mbedtls_ecp_set_precomp_cache().
+ *
+ * \param cache     The cache to free. This may be \c NULL.
+ */
+void mbedtls_ecp_precomp_cache_free( mbedtls_ecp_precomp_cache *cache );
+
+/**
+ * \brief           Install the public key precomputation cache used by
+ *                  mbedtls_ecp_muladd_cached(), and hence by ECDSA
+ *                  verification.
+ *
+ *                  This is a process-wide setting, like
+ *                  mbedtls_ecp_set_max_ops(). It should be done once at
+ *                  startup, before other threads use the library. The cache
+ *                  itself is thread-safe if MBEDTLS_THREADING_C is enabled.
+ *
+ * \param cache     The cache to use, set up with
+ *                  mbedtls_ecp_precomp_cache_setup(), or \c NULL to stop
+ *                  caching (the default).
+ */
+void mbedtls_ecp_set_precomp_cache( mbedtls_ecp_precomp_cache *cache );
+
+/**
+ * \brief           This function computes \p R = \p m * G + \p n * \p Q,
+ *                  G being the base point of the group, keeping the table
+ *                  of multiples of \p Q in the installed precomputation
+ *                  cache so that it is reused on the next call with the
+ *                  same \p Q.
+ *
+ *                  Without an installed cache, or for a point or group the
+ *                  cache does not handle, this is the same as
+ *                  mbedtls_ecp_muladd().
+ *
+ * \note            The cache is keyed by the value of \p Q: it is best
+ *                  used with long-lived public keys.
+ *
+ * \note            As mbedtls_ecp_muladd(), this function is not
+ *                  constant-time, and is meant for public values.
+ *
+ * \param grp       The ECP group to use.
+ *                  This must be initialized and have group parameters
+ *                  set, for example through mbedtls_ecp_group_load().
+ * \param R         The point in which to store the result of the calculation.
+ *                  This must be initialized.
+ * \param m         The integer by which to multiply the base point.
+ *                  This must be initialized.
+ * \param n         The integer by which to multiply \p Q.
+ *                  This must be initialized.
+ * \param Q         The point to be multiplied by \p n.
+ *                  This must be initialized.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_INVALID_KEY if \p m or \p n are not
+ *                  valid private keys, or \p Q is not a valid public key.
+ * \return          #MBEDTLS_ERR_MPI_ALLOC_FAILED on memory-allocation failure.
+ * \return          #MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE if \p grp does not
+ *                  designate a short Weierstrass curve.
+ * \return          Another negative error code on other kinds of failure.
+ */
+int mbedtls_ecp_muladd_cached( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                               const mbedtls_mpi *m,
+                               const mbedtls_mpi *n,
+                               const mbedtls_ecp_point *Q );
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
 /**
@@ -668,6 +668,40 @@
  */
 #define MBEDTLS_ECP_NIST_OPTIM
 
+/**
+ * \def MBEDTLS_ECP_COMPLETE_FORMULAS
+ *
+ * Enable an alternative core for scalar multiplication on short Weierstrass
+ * curves that have no specific 'modulo p' routine, such as the Brainpool
+ * curves. It works on fixed-width field elements in Montgomery
+ * representation, without allocating memory in the inner loop, and uses
+ * complete addition formulas. It is several times faster than the generic
+ * code on these curves.
+ *
+ * Restartable operations (see MBEDTLS_ECP_RESTARTABLE) always use the
+ * generic code.
+ *
+ * Comment this macro to reduce code size at the expense of performance.
+ */
+#define MBEDTLS_ECP_COMPLETE_FORMULAS
+
+/**
+ * \def MBEDTLS_ECP_PRECOMP_CACHE
+ *
+ * Enable caches of precomputed tables for public keys, see
+ * mbedtls_ecp_precomp_cache_setup(). Once a cache is installed with
+ * mbedtls_ecp_set_precomp_cache(), ECDSA verification reuses the table of
+ * multiples of the public key from one signature to the next, instead of
+ * recomputing it each time. This helps servers and verifiers that check
+ * many signatures made with a small set of keys.
+ *
+ * Nothing is cached unless a cache is installed, so this only costs code
+ * size.
+ *
+ * Comment this macro to disable public key precomputation caches.
+ */
+#define MBEDTLS_ECP_PRECOMP_CACHE
+
 /**
  * \def MBEDTLS_ECP_RESTARTABLE
  *
@@ -706,6 +740,22 @@
  */
 #define MBEDTLS_ECDSA_DETERMINISTIC
 
+/**
+ * \def MBEDTLS_ECDSA_PRESIG_POOL
+ *
+ * Enable pools of precomputed ECDSA presignatures, see
+ * mbedtls_ecdsa_presig_pool_setup(). Signing with a presignature only
+ * costs a few modular multiplications, the scalar multiplication and
+ * inversion having been done ahead of time.
+ *
+ * Presignatures use random nonces, not RFC 6979 deterministic ones.
+ *
+ * Requires: MBEDTLS_ECDSA_C
+ *
+ * Comment this macro to disable ECDSA presignature pools.
+ */
+#define MBEDTLS_ECDSA_PRESIG_POOL
+
 /**
  * \def MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
  *
@@ -1222,6 +1272,47 @@
  */
 //#define MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG
 
+/** \def MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG
+ *
+ * Give each thread that calls the PSA random generator its own DRBG
+ * instance, instead of sharing one DRBG between all threads.
+ *
+ * Each per-thread DRBG is seeded from the shared entropy context the first
+ * time its thread needs random data, and reseeds from it as usual. Random
+ * generation itself does not take any lock, so psa_generate_random() and
+ * mbedtls_psa_get_random() do not serialize across threads. Each thread's
+ * DRBG is freed when the thread exits or when mbedtls_psa_crypto_free()
+ * is called.
+ *
+ * Module:  library/psa_crypto.c
+ * Requires: MBEDTLS_PSA_CRYPTO_C, MBEDTLS_THREADING_C,
+ *           MBEDTLS_THREADING_PTHREAD
+ *
+ * This option is not compatible with MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG.
+ */
+//#define MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG
+
+/** \def MBEDTLS_PSA_CRYPTO_INSTRUMENTATION
+ *
+ * Keep statistics about the cryptographic operations performed through the
+ * PSA API: for each combination of operation type, algorithm and driver,
+ * the number of calls, the number of failed calls, the number of input
+ * bytes processed, and a histogram of the call latency.
+ *
+ * The statistics are read with mbedtls_psa_get_op_stats() and cleared with
+ * mbedtls_psa_reset_op_stats(). Recording a call reads a monotonic clock
+ * twice and briefly takes a mutex if #MBEDTLS_THREADING_C is enabled.
+ * On platforms without a known monotonic clock, latencies are not recorded.
+ *
+ * See also #MBEDTLS_PSA_STATS_MAX_ENTRIES.
+ *
+ * Module:  library/psa_crypto_stats.c
+ * Requires: MBEDTLS_PSA_CRYPTO_C
+ *
+ * Uncomment this macro to enable the PSA operation statistics.
+ */
+//#define MBEDTLS_PSA_CRYPTO_INSTRUMENTATION
+
 /**
  * \def MBEDTLS_PSA_CRYPTO_SPM
  *
@@ -1249,6 +1340,44 @@
  */
 //#define MBEDTLS_PSA_INJECT_ENTROPY
 
+/**
+ * \def MBEDTLS_PSA_KEY_STORE_DYNAMIC
+ *
+ * Let the PSA key store grow as more keys are created, instead of holding
+ * a fixed number of #MBEDTLS_PSA_KEY_SLOT_COUNT keys. Key slots are
+ * allocated in blocks, each twice as large as the previous one, so that the
+ * store can hold up to 65535 times #MBEDTLS_PSA_KEY_SLOT_COUNT keys. Keys
+ * are found by identifier in constant time, whether they are volatile or
+ * persistent.
+ *
+ * Comment this macro to use a fixed-size key store, which does not call
+ * mbedtls_calloc() when creating a key slot.
+ *
+ * Module:  library/psa_crypto_slot_management.c
+ */
+#define MBEDTLS_PSA_KEY_STORE_DYNAMIC
+
+/**
+ * \def MBEDTLS_RSA_GEN_KEY_THREADED
+ *
+ * Search for the two primes in mbedtls_rsa_gen_key() concurrently: the
+ * calling thread looks for P while a temporary worker thread, created for
+ * each key, looks for Q.
+ *
+ * The RNG function passed to mbedtls_rsa_gen_key() is then also called from
+ * the worker thread. Calls to it are serialized, but their order is not
+ * deterministic, so the same RNG output may give a different key. Do not
+ * enable this option if the RNG must only be called from the thread that
+ * generates the key.
+ *
+ * Module:  library/rsa.c
+ * Requires: MBEDTLS_RSA_C, MBEDTLS_GENPRIME, MBEDTLS_THREADING_C,
+ *           MBEDTLS_THREADING_PTHREAD
+ *
+ * Uncomment this macro to search for the RSA primes on two threads.
+ */
+//#define MBEDTLS_RSA_GEN_KEY_THREADED
+
 /**
  * \def MBEDTLS_RSA_NO_CRT
  *
@@ -1660,6 +1789,96 @@
  */
 //#define MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH
 
+/**
+ * \def MBEDTLS_SSL_READ_AHEAD
+ *
+ * Enable support for read-ahead on stream (TLS) connections.
+ *
+ * When read-ahead is enabled with mbedtls_ssl_conf_read_ahead(), each call
+ * to the receive callback asks for as much data as fits in the input buffer
+ * rather than for exactly the next record header or body, and the records
+ * that arrive together are then processed from the buffer without further
+ * calls to the receive callback.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this to enable support for read-ahead in TLS.
+ */
+//#define MBEDTLS_SSL_READ_AHEAD
+
+/**
+ * \def MBEDTLS_SSL_WRITE_COALESCING
+ *
+ * Enable support for coalescing application data writes on stream (TLS)
+ * connections.
+ *
+ * This adds mbedtls_ssl_cork() and mbedtls_ssl_uncork(), which hold back
+ * the data passed to mbedtls_ssl_write() until a full record is available
+ * or the application uncorks the connection, and
+ * mbedtls_ssl_conf_write_coalescing(), which does the same automatically
+ * for writes smaller than a given size.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this to enable support for write coalescing in TLS.
+ */
+//#define MBEDTLS_SSL_WRITE_COALESCING
+
+/**
+ * \def MBEDTLS_SSL_KTLS
+ *
+ * Enable support for offloading the record protection of established TLS
+ * connections to the operating system kernel (kernel TLS).
+ *
+ * This adds mbedtls_ssl_get_ktls_info(), which exports the traffic keys,
+ * IVs and sequence numbers of a connection using AES-GCM or
+ * ChaCha20-Poly1305, and mbedtls_ssl_set_ktls(), which makes the record
+ * layer pass plaintext to the underlying transport from then on. If
+ * MBEDTLS_NET_C is also enabled, mbedtls_net_ktls_enable() does both for
+ * a connection over a mbedtls_net_context on Linux.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this to enable support for kernel TLS offload.
+ */
+//#define MBEDTLS_SSL_KTLS
+
+/**
+ * \def MBEDTLS_SSL_BATCH_DECRYPT
+ *
+ * Enable support for decrypting several read-ahead records at once on
+ * stream (TLS) connections.
+ *
+ * When batch decryption is enabled with mbedtls_ssl_conf_batch_decrypt(),
+ * the application data records that are complete in the input buffer are
+ * decrypted together with the record that is being read, and their contents
+ * are returned by mbedtls_ssl_read() as one piece of data.
+ *
+ * Requires: MBEDTLS_SSL_READ_AHEAD
+ *
+ * Uncomment this to enable support for batch decryption in TLS.
+ */
+//#define MBEDTLS_SSL_BATCH_DECRYPT
+
+/**
+ * \def MBEDTLS_SSL_IDLE_BUFFER_RELEASE
+ *
+ * Enable support for releasing the input and output buffers of idle
+ * connections.
+ *
+ * This adds mbedtls_ssl_release_buffers(), which frees both buffers of a
+ * connection that has no data in flight, and
+ * mbedtls_ssl_conf_idle_buffer_release(), which does the same
+ * automatically when a read finds no data or a write completes. The
+ * buffers are allocated again when the connection is next used. This saves
+ * memory for applications that hold many mostly idle connections.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this to enable support for releasing idle buffers.
+ */
+//#define MBEDTLS_SSL_IDLE_BUFFER_RELEASE
+
 /**
  * \def MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN
  *
@@ -2616,6 +2835,22 @@
  */
 #define MBEDTLS_POLY1305_C
 
+/**
+ * \def MBEDTLS_PSA_ASYNC_C
+ *
+ * Enable a queue that runs PSA cryptography operations on a pool of worker
+ * threads and reports their completion through polling or a callback.
+ * Consecutive operations on the same key are run as a batch by one worker.
+ *
+ * Module:  library/psa_async.c
+ *
+ * Requires: MBEDTLS_PSA_CRYPTO_C, MBEDTLS_THREADING_C,
+ *           MBEDTLS_THREADING_PTHREAD
+ *
+ * Uncomment this macro to enable the asynchronous operation queue.
+ */
+//#define MBEDTLS_PSA_ASYNC_C
+
 /**
  * \def MBEDTLS_PSA_CRYPTO_C
  *
@@ -2654,8 +2889,8 @@
  * Module:  library/psa_crypto_storage.c
  *
  * Requires: MBEDTLS_PSA_CRYPTO_C,
- *           either MBEDTLS_PSA_ITS_FILE_C or a native implementation of
- *           the PSA ITS interface
+ *           either MBEDTLS_PSA_ITS_FILE_C, MBEDTLS_PSA_ITS_LOG_C or a native
+ *           implementation of the PSA ITS interface
  */
 #define MBEDTLS_PSA_CRYPTO_STORAGE_C
 
@@ -2671,6 +2906,58 @@
  */
 #define MBEDTLS_PSA_ITS_FILE_C
 
+/**
+ * \def MBEDTLS_PSA_ITS_LOG_C
+ *
+ * Enable the emulation of the Platform Security Architecture
+ * Internal Trusted Storage (PSA ITS) over a single append-only log file.
+ *
+ * This is an alternative to MBEDTLS_PSA_ITS_FILE_C for applications that
+ * store many persistent keys. All the entries are kept in one file, which
+ * is read once to build an index in memory. Writing or removing an entry
+ * appends a record to the file, and the file is compacted when obsolete
+ * records take up more than half of it. Removing an entry also overwrites
+ * its data in the file with zeros, so that the removed data does not stay
+ * in the file. A last record that was not
+ * completely written when the system went down is detected and discarded.
+ * Damage anywhere else in the file makes ITS calls fail with
+ * #PSA_ERROR_DATA_CORRUPT, rather than losing the records after it.
+ *
+ * The log file must only be accessed by one process at a time.
+ *
+ * Module:  library/psa_its_log.c
+ *
+ * Requires: MBEDTLS_FS_IO
+ *
+ * This module is not compatible with MBEDTLS_PSA_ITS_FILE_C.
+ */
+//#define MBEDTLS_PSA_ITS_LOG_C
+
+/**
+ * \def MBEDTLS_PSA_SIMD_DRIVER_C
+ *
+ * Enable the in-tree SIMD transparent driver for PSA Crypto.
+ *
+ * The driver is called through the PSA driver wrappers before the built-in
+ * implementation, and provides:
+ * - SHA-224 and SHA-256 using the x86 SHA extensions;
+ * - one-shot AES-CTR encryption and decryption using AES-NI, unless
+ *   MBEDTLS_AES_ALT or MBEDTLS_AES_SETKEY_ENC_ALT is enabled;
+ * - one-shot ChaCha20 encryption and decryption using SSE2.
+ *
+ * The kernels are only built for x86-64 with GCC 5 or later or Clang, and
+ * are only used if CPUID reports the instructions they need. In all other
+ * cases, and for all other algorithms, the driver reports that it does not
+ * support the operation and the built-in implementation is used.
+ *
+ * Module:  library/psa_crypto_simd.c
+ *
+ * Requires: MBEDTLS_PSA_CRYPTO_C, MBEDTLS_PSA_CRYPTO_DRIVERS
+ *
+ * Uncomment to enable the SIMD driver.
+ */
+//#define MBEDTLS_PSA_SIMD_DRIVER_C
+
 /**
  * \def MBEDTLS_RIPEMD160_C
  *
@@ -2812,6 +3099,19 @@
  */
 #define MBEDTLS_SSL_COOKIE_C
 
+/**
+ * \def MBEDTLS_SSL_ECDHE_POOL_C
+ *
+ * Enable a pool of pregenerated ephemeral ECDHE keys for TLS servers,
+ * see mbedtls_ssl_conf_ecdhe_pool().
+ *
+ * Module:  library/ssl_ecdhe_pool.c
+ * Caller:
+ *
+ * Requires: MBEDTLS_ECP_C
+ */
+#define MBEDTLS_SSL_ECDHE_POOL_C
+
 /**
  * \def MBEDTLS_SSL_TICKET_C
  *
@@ -3055,6 +3355,9 @@
 //#define MBEDTLS_HMAC_DRBG_MAX_REQUEST        1024 /**< Maximum number of requested bytes per call */
 //#define MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT      384 /**< Maximum size of (re)seed buffer */
 
+/* DHM options */
+//#define MBEDTLS_DHM_FIXED_BASE_OPTIM       1 /**< Enable fixed-base speed-up */
+
 /* ECP options */
 //#define MBEDTLS_ECP_WINDOW_SIZE            4 /**< Maximum window size used */
 //#define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
@@ -3140,15 +3443,54 @@
  * volatile key, or a persistent key which is loaded temporarily by the
  * library as part of a crypto operation in flight.
  *
+ * With #MBEDTLS_PSA_KEY_STORE_DYNAMIC, this is instead the number of key
+ * slots allocated at first, and it may be at most 8192.
+ *
  * If this option is unset, the library will fall back to a default value of
  * 32 keys.
  */
 //#define MBEDTLS_PSA_KEY_SLOT_COUNT 32
 
+/** \def MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL
+ * With #MBEDTLS_PSA_ITS_LOG_C, the number of records appended to the log
+ * between two synchronizations of the log file to stable storage. Records
+ * that have not been synchronized yet may be lost on a power failure, but
+ * the log remains consistent. Set this to 1 to synchronize after every
+ * write, or to 0 to only synchronize when compacting or closing the log.
+ * Removals are always synchronized at once.
+ *
+ * If this option is unset, the log is synchronized every 16 records.
+ */
+//#define MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL 16
+
+/** \def MBEDTLS_PSA_ASYNC_BATCH_MAX
+ * With #MBEDTLS_PSA_ASYNC_C, the maximum number of queued operations on the
+ * same key that a worker thread takes from the queue at once. A worker
+ * never takes more than its share of the queued operations, so that
+ * operations on a single key are still spread over all the workers.
+ *
+ * If this option is unset, the library will fall back to a default value of
+ * 8 operations.
+ */
+//#define MBEDTLS_PSA_ASYNC_BATCH_MAX 8
+
+/** \def MBEDTLS_PSA_STATS_MAX_ENTRIES
+ * With #MBEDTLS_PSA_CRYPTO_INSTRUMENTATION, the maximum number of distinct
+ * (operation, algorithm, driver) combinations for which statistics are
+ * kept. Calls beyond that are accounted in a single overflow entry.
+ *
+ * If this option is unset, the library will fall back to a default value of
+ * 64 entries.
+ */
+//#define MBEDTLS_PSA_STATS_MAX_ENTRIES 64
+
 /* SSL Cache options */
 //#define MBEDTLS_SSL_CACHE_DEFAULT_TIMEOUT       86400 /**< 1 day  */
 //#define MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES      50 /**< Maximum entries in cache */
 
+/* SSL ephemeral key pool options */
+//#define MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS           4 /**< Maximum number of groups in an ephemeral ECDHE key pool */
+
 /* SSL options */
 
 /** \def MBEDTLS_SSL_IN_CONTENT_LEN
@@ -283,6 +283,77 @@ int mbedtls_net_send( void *ctx, const unsigned char *buf, size_t len );
 int mbedtls_net_recv_timeout( void *ctx, unsigned char *buf, size_t len,
                       uint32_t timeout );
 
+#if defined(MBEDTLS_SSL_KTLS)
+/**
+ * \brief          Offload the record protection of an established TLS
+ *                 connection to the kernel (Linux kernel TLS).
+ *
+ *                 This passes the traffic secrets of \p ssl to the kernel
+ *                 and calls mbedtls_ssl_set_ktls(). From then on, the
+ *                 kernel encrypts and decrypts the records, and
+ *                 mbedtls_ssl_write() and mbedtls_ssl_read() do plain
+ *                 socket I/O. With #MBEDTLS_SSL_KTLS_TX, the application
+ *                 can also send data with sendfile() on \p ctx->fd.
+ *
+ * \note           This requires the \c tls module of the kernel, and
+ *                 a cipher that the kernel supports.
+ *
+ * \param ctx      The socket of the connection. It must be the I/O
+ *                 context of \p ssl.
+ * \param ssl      The SSL context, after a successful handshake.
+ * \param directions The directions to offload: a combination of
+ *                 #MBEDTLS_SSL_KTLS_TX and #MBEDTLS_SSL_KTLS_RX.
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE if the platform,
+ *                 kernel or cipher does not allow the offload. If a
+ *                 direction was offloaded before another one failed, it
+ *                 stays offloaded, see mbedtls_ssl_get_ktls(). Otherwise
+ *                 the connection can be used as before.
+ * \return         Another error code from mbedtls_ssl_get_ktls_info(),
+ *                 or #MBEDTLS_ERR_NET_BAD_INPUT_DATA if \p ctx is not
+ *                 the I/O context of \p ssl.
+ */
+int mbedtls_net_ktls_enable( mbedtls_net_context *ctx,
+                             mbedtls_ssl_context *ssl,
+                             int directions );
+
+/**
+ * \brief          Send a record of a given content type on a socket with
+ *                 kernel TLS, see mbedtls_ssl_send_record_t.
+ *
+ * \param ctx      Socket
+ * \param type     The record content type
+ * \param buf      The plaintext of the record
+ * \param len      The length of the plaintext
+ *
+ * \return         the number of bytes sent, which may be less than \p len,
+ *                 or a non-zero error code; with a non-blocking socket,
+ *                 MBEDTLS_ERR_SSL_WANT_WRITE indicates sendmsg() would
+ *                 block. The SSL layer keeps track of a partially sent
+ *                 record and sends the rest in a later call.
+ */
+int mbedtls_net_send_record( void *ctx, int type,
+                             const unsigned char *buf, size_t len );
+
+/**
+ * \brief          Receive the plaintext of records on a socket with kernel
+ *                 TLS, see mbedtls_ssl_recv_record_t.
+ *
+ * \param ctx      Socket
+ * \param type     On success, the content type of the received data
+ * \param buf      The buffer to write to
+ * \param len      Maximum length of the buffer
+ *
+ * \return         the number of bytes received, 0 if the connection was
+ *                 closed, or a non-zero error code; with a non-blocking
+ *                 socket, MBEDTLS_ERR_SSL_WANT_READ indicates recvmsg()
+ *                 would block.
+ */
+int mbedtls_net_recv_record( void *ctx, int *type,
+                             unsigned char *buf, size_t len );
+#endif /* MBEDTLS_SSL_KTLS */
+
 /**
  * \brief          Closes down the connection and free associated data
  *
@@ -210,6 +210,7 @@ typedef struct
 {
     const mbedtls_pk_info_t *   MBEDTLS_PRIVATE(pk_info); /**< Public key information         */
     void *                      MBEDTLS_PRIVATE(rs_ctx);  /**< Underlying restart context     */
+    unsigned                    MBEDTLS_PRIVATE(max_ops); /**< Ops budget, 0 = global setting */
 } mbedtls_pk_restart_ctx;
 #else /* MBEDTLS_ECDSA_C && MBEDTLS_ECP_RESTARTABLE */
 /* Now we can declare functions that take a pointer to that */
@@ -302,6 +303,23 @@ void mbedtls_pk_restart_init( mbedtls_pk_restart_ctx *ctx );
  *                  If this is \c NULL, this function does nothing.
  */
 void mbedtls_pk_restart_free( mbedtls_pk_restart_ctx *ctx );
+
+/**
+ * \brief           Set the maximum number of basic ECC operations done in
+ *                  a row by operations using this restart context,
+ *                  overriding the value set with mbedtls_ecp_set_max_ops().
+ *                  See mbedtls_ecp_restart_set_max_ops().
+ *
+ * \note            The budget is kept by mbedtls_pk_restart_free(), so it
+ *                  applies to all the operations done with this context.
+ *                  It only takes effect from the next operation started.
+ *
+ * \param ctx       The context to use. It must have been initialized.
+ * \param max_ops   Maximum number of basic operations done in a row,
+ *                  or \c 0 to use the global value instead.
+ */
+void mbedtls_pk_restart_set_max_ops( mbedtls_pk_restart_ctx *ctx,
+                                     unsigned max_ops );
 #endif /* MBEDTLS_ECDSA_C && MBEDTLS_ECP_RESTARTABLE */
 
 /**
@@ -0,0 +1,340 @@
+/**
+ * \file psa_async.h
+ *
+ * \brief Asynchronous execution of PSA cryptography operations
+ *
+ * A queue owns a pool of worker threads. Operations submitted to the queue
+ * are executed on a worker thread by calling the corresponding PSA function,
+ * for example psa_sign_hash(). The submitter either polls the operation
+ * object or is notified through a callback when the operation completes.
+ *
+ * Consecutive operations on the same key are executed as a batch by the
+ * same worker, in the order in which they were submitted.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_PSA_ASYNC_H
+#define MBEDTLS_PSA_ASYNC_H
+#include "mbedtls/private_access.h"
+
+#include "mbedtls/build_info.h"
+
+#include "psa/crypto.h"
+
+#if defined(MBEDTLS_PSA_ASYNC_C)
+
+#include <pthread.h>
+
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in mbedtls_config.h or define them on the compiler command line.
+ * \{
+ */
+
+#if !defined(MBEDTLS_PSA_ASYNC_BATCH_MAX)
+#define MBEDTLS_PSA_ASYNC_BATCH_MAX     8   /*!< Maximum number of same-key operations a worker takes at once, if there is enough work for the other workers */
+#endif
+
+/** \} name SECTION: Module settings */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Completion callback.
+ *
+ *                 This function is called on a worker thread when an
+ *                 operation that was submitted with a callback completes.
+ *                 The library does not access the operation object after
+ *                 calling this function, so the callback may free or reuse
+ *                 it.
+ *
+ * \param cb_ctx        The context passed when submitting the operation.
+ * \param status        The status returned by the PSA function.
+ * \param output_length The length of the output, or \c 0 for operations
+ *                      without output or on failure.
+ */
+typedef void mbedtls_psa_async_cb_t( void *cb_ctx,
+                                     psa_status_t status,
+                                     size_t output_length );
+
+typedef struct mbedtls_psa_async_queue mbedtls_psa_async_queue;
+
+/**
+ * \brief   An asynchronous operation.
+ *
+ *          The caller owns the memory of the operation object. It must
+ *          remain valid, together with the input and output buffers of the
+ *          operation, until the operation completes.
+ */
+typedef struct mbedtls_psa_async_op
+{
+    int MBEDTLS_PRIVATE(type);                   /*!< PSA function to call  */
+    mbedtls_svc_key_id_t MBEDTLS_PRIVATE(key);
+    psa_algorithm_t MBEDTLS_PRIVATE(alg);
+    const uint8_t *MBEDTLS_PRIVATE(input);       /*!< main input           */
+    size_t MBEDTLS_PRIVATE(input_length);
+    const uint8_t *MBEDTLS_PRIVATE(input2);      /*!< signature, salt,
+                                                      nonce or peer key     */
+    size_t MBEDTLS_PRIVATE(input2_length);
+    const uint8_t *MBEDTLS_PRIVATE(input3);      /*!< additional data      */
+    size_t MBEDTLS_PRIVATE(input3_length);
+    uint8_t *MBEDTLS_PRIVATE(output);
+    size_t MBEDTLS_PRIVATE(output_size);
+    size_t MBEDTLS_PRIVATE(output_length);
+    psa_status_t MBEDTLS_PRIVATE(status);
+    int MBEDTLS_PRIVATE(done);
+    mbedtls_psa_async_cb_t *MBEDTLS_PRIVATE(cb);
+    void *MBEDTLS_PRIVATE(cb_ctx);
+    mbedtls_psa_async_queue *MBEDTLS_PRIVATE(queue);
+    struct mbedtls_psa_async_op *MBEDTLS_PRIVATE(next);
+}
+mbedtls_psa_async_op;
+
+/**
+ * \brief   Asynchronous operation queue and its worker pool
+ */
+struct mbedtls_psa_async_queue
+{
+    pthread_mutex_t MBEDTLS_PRIVATE(mutex);      /*!< protects the fields
+                                                      below and op->done    */
+    pthread_cond_t MBEDTLS_PRIVATE(work);        /*!< new work or stopping */
+    pthread_cond_t MBEDTLS_PRIVATE(done);        /*!< an operation is done */
+    mbedtls_psa_async_op *MBEDTLS_PRIVATE(head); /*!< oldest queued op     */
+    mbedtls_psa_async_op *MBEDTLS_PRIVATE(tail); /*!< newest queued op     */
+    size_t MBEDTLS_PRIVATE(queued);              /*!< number of queued ops */
+    pthread_t *MBEDTLS_PRIVATE(workers);
+    size_t MBEDTLS_PRIVATE(worker_count);
+    int MBEDTLS_PRIVATE(stopping);
+};
+
+/**
+ * \brief          Initialize an operation queue.
+ *
+ * \param queue    The queue to initialize.
+ */
+void mbedtls_psa_async_init( mbedtls_psa_async_queue *queue );
+
+/**
+ * \brief          Start the worker threads of an operation queue.
+ *
+ * \note           The PSA subsystem must be initialized with
+ *                 psa_crypto_init() before operations are submitted, and
+ *                 mbedtls_psa_crypto_free() must not be called until the
+ *                 queue is freed.
+ *
+ * \param queue    The queue to set up. It must have been initialized
+ *                 and not set up yet.
+ * \param workers  The number of worker threads. This must be at least 1.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ *         \p workers is 0.
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The queue is already set up.
+ * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
+ *         Allocating memory or starting a thread failed.
+ */
+psa_status_t mbedtls_psa_async_setup( mbedtls_psa_async_queue *queue,
+                                      size_t workers );
+
+/**
+ * \brief          Finish all the queued operations, stop the worker
+ *                 threads and free the resources of a queue.
+ *
+ * \param queue    The queue to free. No operation may be submitted
+ *                 to it concurrently. If this is \c NULL, this function
+ *                 does nothing.
+ */
+void mbedtls_psa_async_free( mbedtls_psa_async_queue *queue );
+
+/**
+ * \brief          Queue a call to psa_sign_hash().
+ *
+ *                 This function and the other submission functions below
+ *                 take the parameters of the corresponding PSA function,
+ *                 preceded by the queue and the operation object, and
+ *                 followed by an optional callback. The output length is
+ *                 returned on completion.
+ *
+ * \param queue    The queue to submit the operation to.
+ * \param op       The operation object. It must not be in use by another
+ *                 pending operation.
+ * \param key      Identifier of the key to use.
+ * \param alg      A signature algorithm.
+ * \param hash     The hash or message to sign.
+ * \param hash_length Size of \p hash in bytes.
+ * \param signature Buffer where the signature is to be written.
+ * \param signature_size Size of \p signature in bytes.
+ * \param cb       Function to call on completion, or \c NULL to get the
+ *                 result with mbedtls_psa_async_poll() or
+ *                 mbedtls_psa_async_wait() instead.
+ * \param cb_ctx   Context for \p cb.
+ *
+ * \retval #PSA_SUCCESS
+ *         The operation is queued.
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The queue is not set up, or is being freed.
+ */
+psa_status_t mbedtls_psa_async_sign_hash( mbedtls_psa_async_queue *queue,
+                                          mbedtls_psa_async_op *op,
+                                          mbedtls_svc_key_id_t key,
+                                          psa_algorithm_t alg,
+                                          const uint8_t *hash,
+                                          size_t hash_length,
+                                          uint8_t *signature,
+                                          size_t signature_size,
+                                          mbedtls_psa_async_cb_t *cb,
+                                          void *cb_ctx );
+
+/**
+ * \brief          Queue a call to psa_verify_hash().
+ *
+ *                 See mbedtls_psa_async_sign_hash() for the common
+ *                 parameters.
+ */
+psa_status_t mbedtls_psa_async_verify_hash( mbedtls_psa_async_queue *queue,
+                                            mbedtls_psa_async_op *op,
+                                            mbedtls_svc_key_id_t key,
+                                            psa_algorithm_t alg,
+                                            const uint8_t *hash,
+                                            size_t hash_length,
+                                            const uint8_t *signature,
+                                            size_t signature_length,
+                                            mbedtls_psa_async_cb_t *cb,
+                                            void *cb_ctx );
+
+/**
+ * \brief          Queue a call to psa_asymmetric_decrypt().
+ *
+ *                 See mbedtls_psa_async_sign_hash() for the common
+ *                 parameters.
+ */
+psa_status_t mbedtls_psa_async_asymmetric_decrypt(
+    mbedtls_psa_async_queue *queue,
+    mbedtls_psa_async_op *op,
+    mbedtls_svc_key_id_t key,
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    const uint8_t *salt,
+    size_t salt_length,
+    uint8_t *output,
+    size_t output_size,
+    mbedtls_psa_async_cb_t *cb,
+    void *cb_ctx );
+
+/**
+ * \brief          Queue a call to psa_raw_key_agreement().
+ *
+ *                 See mbedtls_psa_async_sign_hash() for the common
+ *                 parameters.
+ */
+psa_status_t mbedtls_psa_async_raw_key_agreement(
+    mbedtls_psa_async_queue *queue,
+    mbedtls_psa_async_op *op,
+    psa_algorithm_t alg,
+    mbedtls_svc_key_id_t private_key,
+    const uint8_t *peer_key,
+    size_t peer_key_length,
+    uint8_t *output,
+    size_t output_size,
+    mbedtls_psa_async_cb_t *cb,
+    void *cb_ctx );
+
+/**
+ * \brief          Queue a call to psa_aead_encrypt().
+ *
+ *                 See mbedtls_psa_async_sign_hash() for the common
+ *                 parameters.
+ */
+psa_status_t mbedtls_psa_async_aead_encrypt( mbedtls_psa_async_queue *queue,
+                                             mbedtls_psa_async_op *op,
+                                             mbedtls_svc_key_id_t key,
+                                             psa_algorithm_t alg,
+                                             const uint8_t *nonce,
+                                             size_t nonce_length,
+                                             const uint8_t *additional_data,
+                                             size_t additional_data_length,
+                                             const uint8_t *plaintext,
+                                             size_t plaintext_length,
+                                             uint8_t *ciphertext,
+                                             size_t ciphertext_size,
+                                             mbedtls_psa_async_cb_t *cb,
+                                             void *cb_ctx );
+
+/**
+ * \brief          Queue a call to psa_aead_decrypt().
+ *
+ *                 See mbedtls_psa_async_sign_hash() for the common
+ *                 parameters.
+ */
+psa_status_t mbedtls_psa_async_aead_decrypt( mbedtls_psa_async_queue *queue,
+                                             mbedtls_psa_async_op *op,
+                                             mbedtls_svc_key_id_t key,
+                                             psa_algorithm_t alg,
+                                             const uint8_t *nonce,
+                                             size_t nonce_length,
+                                             const uint8_t *additional_data,
+                                             size_t additional_data_length,
+                                             const uint8_t *ciphertext,
+                                             size_t ciphertext_length,
+                                             uint8_t *plaintext,
+                                             size_t plaintext_size,
+                                             mbedtls_psa_async_cb_t *cb,
+                                             void *cb_ctx );
+
+/**
+ * \brief          Check whether an operation submitted without a callback
+ *                 has completed.
+ *
+ * \param op            The operation.
+ * \param status        On completion, the status returned by the PSA
+ *                      function.
+ * \param output_length On completion, the length of the output. This may
+ *                      be \c NULL.
+ *
+ * \return         \c 1 if the operation has completed, \c 0 if it is
+ *                 still pending.
+ */
+int mbedtls_psa_async_poll( mbedtls_psa_async_op *op,
+                            psa_status_t *status,
+                            size_t *output_length );
+
+/**
+ * \brief          Wait until an operation submitted without a callback
+ *                 completes.
+ *
+ * \param op            The operation.
+ * \param output_length On return, the length of the output. This may
+ *                      be \c NULL.
+ *
+ * \return         The status returned by the PSA function.
+ */
+psa_status_t mbedtls_psa_async_wait( mbedtls_psa_async_op *op,
+                                     size_t *output_length );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_PSA_ASYNC_C */
+
+#endif /* psa_async.h */
@@ -293,7 +293,8 @@ static inline psa_key_type_t mbedtls_psa_parse_tls_ecc_group(
  */
 typedef int mbedtls_f_rng_t( void *p_rng, unsigned char *output, size_t output_size );
 
-#if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+#if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) || \
+    defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
 
 /** The random generator function for the PSA subsystem.
  *
@@ -346,7 +347,7 @@ int mbedtls_psa_get_random( void *p_rng,
  */
 #define MBEDTLS_PSA_RANDOM_STATE NULL
 
-#else /* !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) */
+#else /* !MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG && !MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
 
 #if defined(MBEDTLS_CTR_DRBG_C)
 #include "mbedtls/ctr_drbg.h"
@@ -361,7 +362,7 @@ extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
 
 #define MBEDTLS_PSA_RANDOM_STATE mbedtls_psa_random_state
 
-#endif /* !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) */
+#endif /* !MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG && !MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
 
 #endif /* defined(MBEDTLS_USE_PSA_CRYPTO) || defined(MBEDTLS_SSL_PROTO_TLS1_3) */
 
@@ -427,6 +427,13 @@ size_t mbedtls_rsa_get_len( const mbedtls_rsa_context *ctx );
  * \note           mbedtls_rsa_init() must be called before this function,
  *                 to set up the RSA context.
  *
+ * \note           If #MBEDTLS_RSA_GEN_KEY_THREADED is enabled, the primes
+ *                 P and Q are searched for concurrently, on the calling
+ *                 thread and on a temporary worker thread. Calls to
+ *                 \p f_rng are serialized, so it does not need to be
+ *                 thread-safe, but their order is not deterministic: the
+ *                 same RNG output may give a different key.
+ *
  * \param ctx      The initialized RSA context used to hold the key.
  * \param f_rng    The RNG function to be used for key generation.
  *                 This is mandatory and must not be \c NULL.
@@ -297,6 +297,18 @@
 #define MBEDTLS_SSL_ANTI_REPLAY_DISABLED        0
 #define MBEDTLS_SSL_ANTI_REPLAY_ENABLED         1
 
+#define MBEDTLS_SSL_READ_AHEAD_DISABLED         0
+#define MBEDTLS_SSL_READ_AHEAD_ENABLED          1
+
+#define MBEDTLS_SSL_BATCH_DECRYPT_DISABLED      0
+#define MBEDTLS_SSL_BATCH_DECRYPT_ENABLED       1
+
+#define MBEDTLS_SSL_IDLE_BUFFER_RELEASE_DISABLED 0
+#define MBEDTLS_SSL_IDLE_BUFFER_RELEASE_ENABLED  1
+
+#define MBEDTLS_SSL_KTLS_TX                     1
+#define MBEDTLS_SSL_KTLS_RX                     2
+
 #define MBEDTLS_SSL_RENEGOTIATION_NOT_ENFORCED  -1
 #define MBEDTLS_SSL_RENEGO_MAX_RECORDS_DEFAULT  16
 
@@ -650,6 +662,17 @@ typedef enum
 }
 mbedtls_ssl_states;
 
+/**
+ * \brief          A buffer of a scatter/gather list, for
+ *                 mbedtls_ssl_readv() and mbedtls_ssl_writev().
+ */
+typedef struct mbedtls_ssl_iovec
+{
+    void *base;         /*!< Start of the buffer */
+    size_t len;         /*!< Length of the buffer in bytes */
+}
+mbedtls_ssl_iovec;
+
 /**
  * \brief          Callback type: send data on the network.
  *
@@ -721,6 +744,85 @@ typedef int mbedtls_ssl_recv_timeout_t( void *ctx,
                                         unsigned char *buf,
                                         size_t len,
                                         uint32_t timeout );
+
+#if defined(MBEDTLS_SSL_KTLS)
+/**
+ * \brief          Callback type: send a record of a given content type
+ *                 on a connection whose record protection is offloaded,
+ *                 see mbedtls_ssl_set_ktls().
+ *
+ * \param ctx      Context for the callback (the I/O context of the SSL
+ *                 context)
+ * \param type     The record content type, for example
+ *                 #MBEDTLS_SSL_MSG_ALERT
+ * \param buf      The plaintext of the record, or of the rest of it
+ * \param len      Length of the plaintext
+ *
+ * \return         The positive number of bytes of plaintext sent. If this
+ *                 is less than \p len, the SSL layer calls the callback
+ *                 again later with the rest of the plaintext and the same
+ *                 \p type, in the same way as for a partial write with
+ *                 mbedtls_ssl_send_t.
+ * \return         #MBEDTLS_ERR_SSL_WANT_WRITE if nothing was sent because
+ *                 the operation would block.
+ * \return         Another negative error code on other kinds of failures.
+ */
+typedef int mbedtls_ssl_send_record_t( void *ctx,
+                                       int type,
+                                       const unsigned char *buf,
+                                       size_t len );
+
+/**
+ * \brief          Callback type: receive the plaintext of records on a
+ *                 connection whose record protection is offloaded, see
+ *                 mbedtls_ssl_set_ktls().
+ *
+ * \param ctx      Context for the callback (the I/O context of the SSL
+ *                 context)
+ * \param type     On success, the content type of the data received
+ * \param buf      Buffer to write the received data to
+ * \param len      Length of the receive buffer
+ *
+ * \returns        If data has been received, the positive number of bytes
+ *                 received. This may span several records, but they must
+ *                 all have the content type written to \p type, and a
+ *                 record other than application data must be received
+ *                 whole.
+ * \returns        \c 0 if the connection has been closed.
+ * \returns        If performing non-blocking I/O,
+ *                 #MBEDTLS_ERR_SSL_WANT_READ must be returned when the
+ *                 operation would block.
+ * \returns        Another negative error code on other kinds of failures.
+ */
+typedef int mbedtls_ssl_recv_record_t( void *ctx,
+                                       int *type,
+                                       unsigned char *buf,
+                                       size_t len );
+
+/**
+ * \brief          The traffic secrets of one direction of a connection,
+ *                 for the record protection to be offloaded to an
+ *                 implementation outside of the library, typically the
+ *                 operating system kernel.
+ */
+typedef struct mbedtls_ssl_ktls_info
+{
+    uint16_t tls_version;           /*!< Protocol version in wire format,
+                                         e.g. 0x0303 for TLS 1.2 */
+    mbedtls_cipher_type_t cipher;   /*!< The AEAD: AES-128-GCM, AES-256-GCM
+                                         or ChaCha20-Poly1305 */
+    unsigned char key[32];          /*!< The traffic key */
+    size_t key_len;                 /*!< Length of the key in bytes */
+    unsigned char iv[12];           /*!< The implicit part of the nonce:
+                                         the 4-byte salt for AES-GCM with
+                                         TLS 1.2, the 12-byte static IV
+                                         otherwise */
+    size_t iv_len;                  /*!< Length of the IV in bytes */
+    unsigned char rec_seq[8];       /*!< Sequence number of the next
+                                         record, big-endian */
+}
+mbedtls_ssl_ktls_info;
+#endif /* MBEDTLS_SSL_KTLS */
 /**
  * \brief          Callback type: set a pair of timers/delays to watch
  *
@@ -826,6 +928,31 @@ typedef int mbedtls_ssl_cache_set_t( void *data,
                                      size_t session_id_len,
                                      const mbedtls_ssl_session *session );
 
+#if defined(MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED)
+/**
+ * \brief          Callback type: server-side ephemeral ECDHE key source
+ *
+ *                 This callback hands out a pregenerated ephemeral key
+ *                 pair for \p grp_id, which the server then uses instead
+ *                 of generating one during the handshake. A key pair
+ *                 returned by this callback must never be returned again.
+ *
+ * \param p_pool          The key pool to take the key pair from.
+ * \param grp_id          The group the key pair must belong to.
+ * \param key             The key pair to populate. It is initialized
+ *                        with mbedtls_ecp_keypair_init() and is freed by
+ *                        the caller independent of the return code.
+ *
+ * \return                \c 0 on success
+ * \return                A non-zero return value if no key pair is
+ *                        available, in which case the server generates
+ *                        a fresh one.
+ */
+typedef int mbedtls_ssl_ecdhe_take_t( void *p_pool,
+                                      mbedtls_ecp_group_id grp_id,
+                                      mbedtls_ecp_keypair *key );
+#endif /* MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED */
+
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
 /**
@@ -1269,6 +1396,15 @@ struct mbedtls_ssl_config
 #if defined(MBEDTLS_SSL_DTLS_ANTI_REPLAY)
     uint8_t MBEDTLS_PRIVATE(anti_replay);   /*!< detect and prevent replay?         */
 #endif
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+    uint8_t MBEDTLS_PRIVATE(read_ahead);    /*!< read more than the next record?    */
+#endif
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    uint8_t MBEDTLS_PRIVATE(batch_decrypt); /*!< decrypt read-ahead records together? */
+#endif
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    uint8_t MBEDTLS_PRIVATE(idle_buffer_release); /*!< release idle buffers?    */
+#endif
 #if defined(MBEDTLS_SSL_RENEGOTIATION)
     uint8_t MBEDTLS_PRIVATE(disable_renegotiation); /*!< disable renegotiation?     */
 #endif
@@ -1318,6 +1454,12 @@ struct mbedtls_ssl_config
     mbedtls_ssl_cache_set_t *MBEDTLS_PRIVATE(f_set_cache);
     void *MBEDTLS_PRIVATE(p_cache);                  /*!< context for cache callbacks        */
 
+#if defined(MBEDTLS_SSL_SRV_C) && defined(MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED)
+    /** Callback to take a pregenerated ephemeral ECDHE key                 */
+    mbedtls_ssl_ecdhe_take_t *MBEDTLS_PRIVATE(f_ecdhe_take);
+    void *MBEDTLS_PRIVATE(p_ecdhe_pool);             /*!< context for the key pool callback  */
+#endif
+
 #if defined(MBEDTLS_SSL_SERVER_NAME_INDICATION)
     /** Callback for setting cert according to SNI extension                */
     int (*MBEDTLS_PRIVATE(f_sni))(void *, mbedtls_ssl_context *, const unsigned char *, size_t);
@@ -1469,6 +1611,17 @@ struct mbedtls_ssl_config
     unsigned int MBEDTLS_PRIVATE(dhm_min_bitlen);    /*!< min. bit length of the DHM prime   */
 #endif
 
+#if defined(MBEDTLS_ECP_RESTARTABLE) && defined(MBEDTLS_SSL_CLI_C)
+    unsigned int MBEDTLS_PRIVATE(ecp_max_ops);       /*!< restartable ECC budget, 0 = global */
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    size_t MBEDTLS_PRIVATE(coalesce_threshold);      /*!< size that ends automatic
+                                         write coalescing, 0 = disabled     */
+    uint32_t MBEDTLS_PRIVATE(coalesce_timeout);      /*!< longest time in ms to hold
+                                         back data, 0 = no limit            */
+#endif
+
     /** User data pointer or handle.
      *
      * The library sets this to \p 0 when creating a context and does not
@@ -1583,9 +1736,18 @@ struct mbedtls_ssl_context
 #endif
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     uint16_t MBEDTLS_PRIVATE(in_epoch);          /*!< DTLS epoch for incoming records  */
-    size_t MBEDTLS_PRIVATE(next_record_offset);  /*!< offset of the next record in datagram
-                                     (equal to in_left if none)       */
 #endif /* MBEDTLS_SSL_PROTO_DTLS */
+#if defined(MBEDTLS_SSL_PROTO_DTLS) || defined(MBEDTLS_SSL_READ_AHEAD)
+    size_t MBEDTLS_PRIVATE(next_record_offset);  /*!< offset of the next record in datagram
+                                     or read-ahead data (equal to in_left
+                                     if none)                         */
+#endif /* MBEDTLS_SSL_PROTO_DTLS || MBEDTLS_SSL_READ_AHEAD */
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    int MBEDTLS_PRIVATE(in_batch);               /*!< state of the record at
+                                     next_record_offset: 0 (not processed),
+                                     1 (decrypted by a batch) or an error
+                                     from its decryption              */
+#endif /* MBEDTLS_SSL_BATCH_DECRYPT */
 #if defined(MBEDTLS_SSL_DTLS_ANTI_REPLAY)
     uint64_t MBEDTLS_PRIVATE(in_window_top);     /*!< last validated record seq_num    */
     uint64_t MBEDTLS_PRIVATE(in_window);         /*!< bitmask for replay detection     */
@@ -1633,11 +1795,29 @@ struct mbedtls_ssl_context
     int MBEDTLS_PRIVATE(out_msgtype);            /*!< record header: message type      */
     size_t MBEDTLS_PRIVATE(out_msglen);          /*!< record header: message length    */
     size_t MBEDTLS_PRIVATE(out_left);            /*!< amount of data not yet written   */
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    size_t MBEDTLS_PRIVATE(out_coalesced);       /*!< application data held back
+                                     in out_msg                       */
+    uint8_t MBEDTLS_PRIVATE(out_corked);         /*!< hold back application data?      */
+    uint8_t MBEDTLS_PRIVATE(out_coalesce_timer); /*!< timer runs for held back data?   */
+#endif
 #if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
     size_t MBEDTLS_PRIVATE(out_buf_len);         /*!< length of output buffer          */
 #endif
 
     unsigned char MBEDTLS_PRIVATE(cur_out_ctr)[MBEDTLS_SSL_SEQUENCE_NUMBER_LEN]; /*!<  Outgoing record sequence  number. */
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    unsigned char MBEDTLS_PRIVATE(idle_in_ctr)[MBEDTLS_SSL_SEQUENCE_NUMBER_LEN]; /*!< Incoming record sequence
+                                     number while the buffers are released */
+#endif
+
+#if defined(MBEDTLS_SSL_KTLS)
+    int MBEDTLS_PRIVATE(ktls);                   /*!< offloaded directions         */
+    mbedtls_ssl_send_record_t *MBEDTLS_PRIVATE(f_send_record); /*!< Callback for
+                                     offloaded record send            */
+    mbedtls_ssl_recv_record_t *MBEDTLS_PRIVATE(f_recv_record); /*!< Callback for
+                                     offloaded record receive         */
+#endif /* MBEDTLS_SSL_KTLS */
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     uint16_t MBEDTLS_PRIVATE(mtu);               /*!< path mtu, used to fragment outgoing messages */
@@ -2661,6 +2841,167 @@ int mbedtls_ssl_set_client_transport_id( mbedtls_ssl_context *ssl,
 void mbedtls_ssl_conf_dtls_anti_replay( mbedtls_ssl_config *conf, char mode );
 #endif /* MBEDTLS_SSL_DTLS_ANTI_REPLAY */
 
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+/**
+ * \brief          Enable or disable read-ahead for TLS.
+ *                 (TLS only, no effect on DTLS.)
+ *                 Default: disabled.
+ *
+ *                 Without read-ahead, each record is received with at
+ *                 least two calls to the receive callback: one for the
+ *                 record header and one for the rest of the record. With
+ *                 read-ahead, each call asks for as much data as fits in
+ *                 the input buffer, and records that arrived together are
+ *                 then processed without calling the receive callback
+ *                 again. This saves system calls when the peer sends many
+ *                 small records.
+ *
+ * \param conf     SSL configuration
+ * \param mode     MBEDTLS_SSL_READ_AHEAD_ENABLED or
+ *                 MBEDTLS_SSL_READ_AHEAD_DISABLED.
+ *
+ * \note           With read-ahead, records may be waiting in the input
+ *                 buffer while the underlying transport has no data. An
+ *                 application that waits for the transport to become
+ *                 readable (e.g. with select()) must call
+ *                 mbedtls_ssl_check_pending() first.
+ *
+ * \warning        Data that the peer sends after the TLS connection (for
+ *                 example after a close_notify alert) may be read into the
+ *                 input buffer and lost to the application. Do not enable
+ *                 read-ahead if the transport is reused after the TLS
+ *                 connection is closed.
+ */
+void mbedtls_ssl_conf_read_ahead( mbedtls_ssl_config *conf, char mode );
+#endif /* MBEDTLS_SSL_READ_AHEAD */
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+/**
+ * \brief          Enable or disable batch decryption for TLS.
+ *                 (TLS only, no effect on DTLS.)
+ *                 Default: disabled.
+ *
+ *                 With batch decryption, when an application data record
+ *                 is received, the following application data records
+ *                 that have already been read ahead completely are
+ *                 decrypted right away, in place, and their contents are
+ *                 appended to the contents of the first record. This
+ *                 saves the processing that the record layer otherwise
+ *                 does for each record when the peer sends many small
+ *                 records.
+ *
+ * \param conf     SSL configuration
+ * \param mode     MBEDTLS_SSL_BATCH_DECRYPT_ENABLED or
+ *                 MBEDTLS_SSL_BATCH_DECRYPT_DISABLED.
+ *
+ * \note           This only has an effect if read-ahead is enabled with
+ *                 mbedtls_ssl_conf_read_ahead().
+ *
+ * \note           With batch decryption, a single call to
+ *                 mbedtls_ssl_read() may return the contents of several
+ *                 records. If a record of a batch fails to decrypt, the
+ *                 error is returned after the contents of the records
+ *                 before it have been read.
+ */
+void mbedtls_ssl_conf_batch_decrypt( mbedtls_ssl_config *conf, char mode );
+#endif /* MBEDTLS_SSL_BATCH_DECRYPT */
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+/**
+ * \brief          Enable or disable the automatic release of the buffers
+ *                 of idle connections.
+ *                 Default: disabled.
+ *
+ *                 When enabled, mbedtls_ssl_release_buffers() is called
+ *                 whenever mbedtls_ssl_read() (or a related read function)
+ *                 returns #MBEDTLS_ERR_SSL_WANT_READ and whenever
+ *                 mbedtls_ssl_write() (or a related write function)
+ *                 has sent all its data. The buffers are only released if
+ *                 the connection is idle at that point.
+ *
+ * \param conf     SSL configuration
+ * \param mode     MBEDTLS_SSL_IDLE_BUFFER_RELEASE_ENABLED or
+ *                 MBEDTLS_SSL_IDLE_BUFFER_RELEASE_DISABLED.
+ *
+ * \note           Each read that finds no data then allocates and frees
+ *                 the buffers. Use a fast allocator or a pool (see
+ *                 mbedtls_platform_set_calloc_free()) if connections are
+ *                 polled often.
+ *
+ * \warning        With this option, the buffer returned by
+ *                 mbedtls_ssl_write_get() may be freed by any other call
+ *                 on the context, so call mbedtls_ssl_write_commit() first.
+ */
+void mbedtls_ssl_conf_idle_buffer_release( mbedtls_ssl_config *conf,
+                                           char mode );
+#endif /* MBEDTLS_SSL_IDLE_BUFFER_RELEASE */
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+/**
+ * \brief          Set the size below which application data writes are
+ *                 coalesced automatically. (TLS only, no effect on DTLS.)
+ *                 Default: 0 (disabled).
+ *
+ *                 When this is set, \c mbedtls_ssl_write() copies the data
+ *                 into the current record and only encrypts and sends the
+ *                 record once it holds at least \p threshold bytes (or the
+ *                 maximum record payload, if that is smaller). Data held
+ *                 back is sent by \c mbedtls_ssl_uncork(), and before
+ *                 \c mbedtls_ssl_read() reads anything, so that a request
+ *                 is never held back while its sender waits for the
+ *                 response.
+ *
+ * \param conf     SSL configuration
+ * \param threshold The number of bytes of application data that causes
+ *                 a record to be sent, or 0 to disable automatic
+ *                 coalescing.
+ *
+ * \warning        By default there is no time limit: after a write that
+ *                 leaves data below the threshold, that data stays in the
+ *                 context until the next call to \c mbedtls_ssl_write(),
+ *                 \c mbedtls_ssl_read(), \c mbedtls_ssl_uncork() or
+ *                 \c mbedtls_ssl_close_notify(). An application that does
+ *                 not read after its last write, for example one that
+ *                 streams data to the peer, must either call
+ *                 \c mbedtls_ssl_uncork() when it has nothing more to send
+ *                 for now, or set a deadline with
+ *                 \c mbedtls_ssl_conf_write_coalescing_timeout().
+ *
+ * \note           This setting must not be changed while a connection that
+ *                 uses the configuration holds back data.
+ */
+void mbedtls_ssl_conf_write_coalescing( mbedtls_ssl_config *conf,
+                                        size_t threshold );
+
+/**
+ * \brief          Set the longest time that automatic write coalescing
+ *                 holds back application data. (TLS only.)
+ *                 Default: 0 (no limit).
+ *
+ *                 When data is first held back, the timer of the context
+ *                 (see \c mbedtls_ssl_set_timer_cb()) is started with this
+ *                 timeout. Once it has expired, the next call to
+ *                 \c mbedtls_ssl_write() sends the data held back before
+ *                 taking new data. An event loop that is not about to write
+ *                 again should call \c mbedtls_ssl_uncork() when the timer
+ *                 expires.
+ *
+ * \param conf     SSL configuration
+ * \param timeout  The timeout in milliseconds, or 0 for no limit.
+ *
+ * \note           If the context has no timer callbacks, or if its timer
+ *                 is already running for the read timeout of a pending
+ *                 \c mbedtls_ssl_read(), data is sent right away instead
+ *                 of being held back without a deadline.
+ *
+ * \note           This does not apply to data held back after
+ *                 \c mbedtls_ssl_cork(), which is only sent when the
+ *                 application asks for it.
+ */
+void mbedtls_ssl_conf_write_coalescing_timeout( mbedtls_ssl_config *conf,
+                                                uint32_t timeout );
+#endif /* MBEDTLS_SSL_WRITE_COALESCING */
+
 /**
  * \brief          Set a limit on the number of records with a bad MAC
  *                 before terminating the connection.
@@ -2795,6 +3136,28 @@ void mbedtls_ssl_conf_session_cache( mbedtls_ssl_config *conf,
                                      void *p_cache,
                                      mbedtls_ssl_cache_get_t *f_get_cache,
                                      mbedtls_ssl_cache_set_t *f_set_cache );
+
+#if defined(MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED)
+/**
+ * \brief          Set a source of pregenerated ephemeral ECDHE keys
+ *                 (server-side only, TLS 1.2 ECDHE key exchanges).
+ *
+ *                 When set, the server first asks \p f_ecdhe_take for a
+ *                 key pair on the negotiated group and only generates a
+ *                 fresh one if none is available. This moves the
+ *                 fixed-base scalar multiplication off the handshake
+ *                 path when the pool is refilled in the background, see
+ *                 mbedtls_ssl_ecdhe_pool_refill().
+ *
+ * \param conf           SSL configuration
+ * \param f_ecdhe_take   key pool callback, e.g. mbedtls_ssl_ecdhe_pool_take(),
+ *                       or NULL to disable
+ * \param p_ecdhe_pool   parameter (context) for the callback
+ */
+void mbedtls_ssl_conf_ecdhe_pool( mbedtls_ssl_config *conf,
+                                  mbedtls_ssl_ecdhe_take_t *f_ecdhe_take,
+                                  void *p_ecdhe_pool );
+#endif /* MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED */
 #endif /* MBEDTLS_SSL_SRV_C */
 
 #if defined(MBEDTLS_SSL_CLI_C)
@@ -3381,6 +3744,40 @@ void mbedtls_ssl_conf_dhm_min_bitlen( mbedtls_ssl_config *conf,
                                       unsigned int bitlen );
 #endif /* MBEDTLS_DHM_C && MBEDTLS_SSL_CLI_C */
 
+#if defined(MBEDTLS_ECP_RESTARTABLE) && defined(MBEDTLS_SSL_CLI_C)
+/**
+ * \brief          Set the maximum number of basic ECC operations done in a
+ *                 row by the restartable operations of each handshake using
+ *                 this configuration, overriding the values set with
+ *                 mbedtls_ecp_set_thread_max_ops() and
+ *                 mbedtls_ecp_set_max_ops().
+ *                 (Client-side only.)
+ *                 (Default: 0, use the value of the calling thread or the
+ *                 process-wide value.)
+ *
+ *                 This gives each connection its own time slice, so that an
+ *                 event loop can interleave many handshakes fairly.
+ *
+ * \note           This applies to the same operations as
+ *                 mbedtls_ecp_set_max_ops(): certificate chain
+ *                 verification, ECDHE and client authentication in
+ *                 ECDHE-ECDSA handshakes.
+ *
+ * \note           Servers do not run restartable ECC operations, so this
+ *                 setting has no server-side counterpart. To keep a
+ *                 server's event loop responsive, offload the private key
+ *                 operations with mbedtls_ssl_conf_async_private_cb()
+ *                 (see #MBEDTLS_SSL_ASYNC_PRIVATE).
+ *
+ * \param conf     SSL configuration
+ * \param max_ops  Maximum number of basic operations done in a row,
+ *                 or 0 to use the value of the calling thread or the
+ *                 process-wide value.
+ */
+void mbedtls_ssl_conf_ecp_max_ops( mbedtls_ssl_config *conf,
+                                   unsigned int max_ops );
+#endif /* MBEDTLS_ECP_RESTARTABLE && MBEDTLS_SSL_CLI_C */
+
 #if defined(MBEDTLS_ECP_C)
 #if !defined(MBEDTLS_DEPRECATED_REMOVED)
 /**
@@ -4078,7 +4475,10 @@ void mbedtls_ssl_conf_renegotiation_period( mbedtls_ssl_config *conf,
  *                 also signal pending data, but the converse does
  *                 not hold. For example, in DTLS there might be
  *                 further records waiting to be processed from
- *                 the current underlying transport's datagram.
+ *                 the current underlying transport's datagram,
+ *                 and in TLS with read-ahead enabled (see
+ *                 \c mbedtls_ssl_conf_read_ahead) there might be
+ *                 further complete records in the input buffer.
  *
  * \note           If this function returns 1 (data pending), this
  *                 does not imply that a subsequent call to
@@ -4116,6 +4516,13 @@ int mbedtls_ssl_check_pending( const mbedtls_ssl_context *ssl );
  *                 in case \c mbedtls_ssl_read has written the maximal
  *                 amount of data fitting into the input buffer.
  *
+ * \note           Only the decrypted application data of the current
+ *                 record (and, with \c mbedtls_ssl_conf_batch_decrypt,
+ *                 of the records decrypted together with it) is
+ *                 counted. Records that have been read ahead but not
+ *                 yet processed are not; use
+ *                 \c mbedtls_ssl_check_pending to detect them.
+ *
  */
 size_t mbedtls_ssl_get_bytes_avail( const mbedtls_ssl_context *ssl );
 
@@ -4485,6 +4892,76 @@ int mbedtls_ssl_renegotiate( mbedtls_ssl_context *ssl );
  */
 int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len );
 
+/**
+ * \brief          Read at most 'len' application data bytes, where 'len'
+ *                 is the total length of a list of buffers, and scatter
+ *                 them across the buffers in order.
+ *
+ *                 This behaves like \c mbedtls_ssl_read() on a buffer made
+ *                 of the concatenation of the buffers of \p iov, without
+ *                 the need for the application to copy the data out of
+ *                 such a staging buffer.
+ *
+ * \param ssl      SSL context
+ * \param iov      The buffers to fill. Buffers of length 0 are skipped.
+ * \param iovcnt   The number of entries in \p iov.
+ *
+ * \return         The same values as \c mbedtls_ssl_read(). On success,
+ *                 the number of bytes read, filling the buffers of \p iov
+ *                 in order.
+ */
+int mbedtls_ssl_readv( mbedtls_ssl_context *ssl,
+                       const mbedtls_ssl_iovec *iov, size_t iovcnt );
+
+/**
+ * \brief          Get a pointer to the application data of the current
+ *                 record, decrypted in place in the input buffer, without
+ *                 copying it.
+ *
+ *                 This reads and processes records like
+ *                 \c mbedtls_ssl_read() until application data is
+ *                 available. The data then stays in the input buffer until
+ *                 it is released with \c mbedtls_ssl_read_commit().
+ *
+ * \param ssl      SSL context
+ * \param buf      On success, the address of the application data that
+ *                 has not been read yet. This is only valid until the
+ *                 next call to \c mbedtls_ssl_read_commit() or to any
+ *                 other function on \p ssl.
+ * \param buflen   On success, the length of the data at \p *buf. This
+ *                 is the remaining length of the current record, which
+ *                 may be 0 if the peer sent an empty record.
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_CONN_EOF if the underlying transport
+ *                 was closed, where \c mbedtls_ssl_read() would return 0.
+ * \return         Otherwise, the same error codes as
+ *                 \c mbedtls_ssl_read(), with the same meaning.
+ *
+ * \note           Data obtained this way that is not released is
+ *                 returned again by the next call to this function or to
+ *                 \c mbedtls_ssl_read().
+ */
+int mbedtls_ssl_read_get( mbedtls_ssl_context *ssl,
+                          const unsigned char **buf, size_t *buflen );
+
+/**
+ * \brief          Release application data obtained with
+ *                 \c mbedtls_ssl_read_get().
+ *
+ * \param ssl      SSL context
+ * \param len      The number of bytes that the application has consumed,
+ *                 from the start of the data returned by
+ *                 \c mbedtls_ssl_read_get(). This must not exceed the
+ *                 length that it returned. The rest of the record, if
+ *                 any, stays available for later reads.
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if \p len is larger
+ *                 than the data available.
+ */
+int mbedtls_ssl_read_commit( mbedtls_ssl_context *ssl, size_t len );
+
 /**
  * \brief          Try to write exactly 'len' application data bytes
  *
@@ -4547,6 +5024,252 @@ int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
  */
 int mbedtls_ssl_write( mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len );
 
+/**
+ * \brief          Write the application data held in a list of buffers,
+ *                 gathering them directly into the record.
+ *
+ *                 This behaves like \c mbedtls_ssl_write() on a buffer made
+ *                 of the concatenation of the buffers of \p iov, without
+ *                 the need for the application to copy the data into such
+ *                 a staging buffer.
+ *
+ * \param ssl      SSL context
+ * \param iov      The buffers holding the data. This function only reads
+ *                 from them. Buffers of length 0 are skipped.
+ * \param iovcnt   The number of entries in \p iov.
+ *
+ * \return         The same values as \c mbedtls_ssl_write(), where the
+ *                 length of the data is the total length of the buffers.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the total length
+ *                 overflows.
+ *
+ * \warning        As with \c mbedtls_ssl_write(), this function may write
+ *                 only part of the data. In that case, call it again with
+ *                 a list describing the remaining data, which starts
+ *                 the returned number of bytes into the original list.
+ *
+ * \note           When this function returns #MBEDTLS_ERR_SSL_WANT_WRITE or
+ *                 #MBEDTLS_ERR_SSL_WANT_READ, it must be called later with
+ *                 the same data, but the list itself does not need to be
+ *                 the same.
+ */
+int mbedtls_ssl_writev( mbedtls_ssl_context *ssl,
+                        const mbedtls_ssl_iovec *iov, size_t iovcnt );
+
+/**
+ * \brief          Get a buffer in which to write the application data of
+ *                 the next record, so that it can be encrypted in place
+ *                 without copying it.
+ *
+ *                 This completes the handshake if necessary, like
+ *                 \c mbedtls_ssl_write(), and sends any data that is
+ *                 still pending in the output buffer. Fill the buffer,
+ *                 then send it with \c mbedtls_ssl_write_commit().
+ *
+ * \param ssl      SSL context
+ * \param buf      On success, the address of the buffer to fill. This is
+ *                 only valid until the next call to
+ *                 \c mbedtls_ssl_write_commit() or to any other function
+ *                 on \p ssl.
+ * \param buflen   On success, the size of the buffer at \p *buf, which
+ *                 is the maximum record payload, see
+ *                 \c mbedtls_ssl_get_max_out_record_payload().
+ *
+ * \return         0 if successful.
+ * \return         Otherwise, the same error codes as
+ *                 \c mbedtls_ssl_write(), with the same meaning. In
+ *                 particular, on #MBEDTLS_ERR_SSL_WANT_READ or
+ *                 #MBEDTLS_ERR_SSL_WANT_WRITE, call this function again
+ *                 when the underlying transport is ready.
+ *
+ * \note           With #MBEDTLS_SSL_WRITE_COALESCING, application data
+ *                 held back by earlier calls to \c mbedtls_ssl_write() is
+ *                 sent first. Records written with this function are never
+ *                 held back.
+ */
+int mbedtls_ssl_write_get( mbedtls_ssl_context *ssl,
+                           unsigned char **buf, size_t *buflen );
+
+/**
+ * \brief          Encrypt and send the application data written in the
+ *                 buffer obtained with \c mbedtls_ssl_write_get().
+ *
+ * \param ssl      SSL context
+ * \param len      The number of bytes written at the start of the
+ *                 buffer. This must not exceed the size returned by
+ *                 \c mbedtls_ssl_write_get(). If it is 0, an empty
+ *                 application data record is sent.
+ *
+ * \return         0 if successful. All \p len bytes have then been sent.
+ * \return         #MBEDTLS_ERR_SSL_WANT_WRITE if the record could not be
+ *                 sent completely. In this case, the record is already
+ *                 encrypted: call this function again, with the same
+ *                 \p len and without refilling the buffer, when the
+ *                 underlying transport is ready.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if \p len is too large
+ *                 or the handshake is not complete.
+ * \return         Another SSL error code - in this case you must stop
+ *                 using the context, as with \c mbedtls_ssl_write().
+ */
+int mbedtls_ssl_write_commit( mbedtls_ssl_context *ssl, size_t len );
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+/**
+ * \brief          Hold back application data written with
+ *                 \c mbedtls_ssl_write() until a full record is available
+ *                 or \c mbedtls_ssl_uncork() is called. (TLS only.)
+ *
+ *                 While the connection is corked, consecutive writes are
+ *                 copied into the same record, so that many small writes
+ *                 result in few records and few calls to the send
+ *                 callback.
+ *
+ * \param ssl      SSL context
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the context uses
+ *                 DTLS.
+ *
+ * \note           While data is held back, \c mbedtls_ssl_write() returns
+ *                 the number of bytes it has copied, and only returns
+ *                 #MBEDTLS_ERR_SSL_WANT_WRITE when it could not copy
+ *                 anything because a previous record is still being sent.
+ *
+ * \note           Do not call this function between a call to
+ *                 \c mbedtls_ssl_write() that returned
+ *                 #MBEDTLS_ERR_SSL_WANT_WRITE and the repeated call.
+ *
+ * \note           \c mbedtls_ssl_read(), \c mbedtls_ssl_close_notify()
+ *                 and \c mbedtls_ssl_renegotiate() send the data held back
+ *                 before doing anything else, but leave the connection
+ *                 corked.
+ */
+int mbedtls_ssl_cork( mbedtls_ssl_context *ssl );
+
+/**
+ * \brief          Send the application data held back by
+ *                 \c mbedtls_ssl_cork() or by automatic write coalescing
+ *                 (see \c mbedtls_ssl_conf_write_coalescing()), and stop
+ *                 holding back data after \c mbedtls_ssl_cork().
+ *
+ *                 All the data held back goes out in a single record.
+ *
+ * \param ssl      SSL context
+ *
+ * \return         0 if all the data held back has been sent.
+ * \return         #MBEDTLS_ERR_SSL_WANT_WRITE if the data could not be sent
+ *                 completely - in this case you must call this function
+ *                 again when the underlying transport is ready. The
+ *                 connection stays corked until this function returns 0.
+ * \return         Another SSL error code - in this case you must stop using
+ *                 the context.
+ */
+int mbedtls_ssl_uncork( mbedtls_ssl_context *ssl );
+#endif /* MBEDTLS_SSL_WRITE_COALESCING */
+
+#if defined(MBEDTLS_SSL_KTLS)
+/**
+ * \brief          Export the traffic secrets of an established TLS
+ *                 connection, for its record protection to be offloaded.
+ *
+ * \param ssl      SSL context
+ * \param direction #MBEDTLS_SSL_KTLS_TX for the records that \p ssl sends,
+ *                 #MBEDTLS_SSL_KTLS_RX for the records that it receives.
+ * \param info     The structure to fill. It holds secrets: the caller
+ *                 should zeroize it after use.
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE if the connection
+ *                 uses a cipher other than AES-GCM with a 16-byte tag or
+ *                 ChaCha20-Poly1305.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the handshake is not
+ *                 complete, if the connection uses DTLS, or if the
+ *                 direction can't be offloaded now: there are buffered
+ *                 records that have not been processed (with
+ *                 #MBEDTLS_SSL_KTLS_RX, see mbedtls_ssl_check_pending()) or
+ *                 data that has not been sent (with #MBEDTLS_SSL_KTLS_TX,
+ *                 see mbedtls_ssl_flush_output()).
+ */
+int mbedtls_ssl_get_ktls_info( const mbedtls_ssl_context *ssl,
+                               int direction,
+                               mbedtls_ssl_ktls_info *info );
+
+/**
+ * \brief          Declare that the record protection of some directions
+ *                 of an established connection is now done by the
+ *                 underlying transport, with the secrets exported by
+ *                 mbedtls_ssl_get_ktls_info().
+ *
+ *                 After this, mbedtls_ssl_write() passes application data
+ *                 unprotected to the send callback set with
+ *                 mbedtls_ssl_set_bio(), and other records, such as
+ *                 alerts, to \p f_send_record. mbedtls_ssl_read() takes
+ *                 the plaintext of all records from \p f_recv_record and
+ *                 handles alerts as usual. Renegotiation is refused.
+ *
+ * \note           mbedtls_net_ktls_enable() sets up the kernel and calls
+ *                 this function for a connection over a
+ *                 mbedtls_net_context on Linux.
+ *
+ * \note           The transport keeps the secrets after the connection is
+ *                 closed or the SSL context is reset: do not reuse it for
+ *                 a new connection.
+ *
+ * \param ssl      SSL context
+ * \param directions The directions that are now offloaded: a combination
+ *                 of #MBEDTLS_SSL_KTLS_TX and #MBEDTLS_SSL_KTLS_RX.
+ *                 Directions that are already offloaded stay so.
+ * \param f_send_record The callback to send records other than
+ *                 application data. Required with #MBEDTLS_SSL_KTLS_TX.
+ * \param f_recv_record The callback to receive records. Required with
+ *                 #MBEDTLS_SSL_KTLS_RX.
+ *
+ * \return         0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if a required callback
+ *                 is missing or if mbedtls_ssl_get_ktls_info() would fail
+ *                 for one of the directions.
+ */
+int mbedtls_ssl_set_ktls( mbedtls_ssl_context *ssl,
+                          int directions,
+                          mbedtls_ssl_send_record_t *f_send_record,
+                          mbedtls_ssl_recv_record_t *f_recv_record );
+
+/**
+ * \brief          Return the directions of a connection whose record
+ *                 protection is offloaded.
+ *
+ * \param ssl      SSL context
+ *
+ * \return         A combination of #MBEDTLS_SSL_KTLS_TX and
+ *                 #MBEDTLS_SSL_KTLS_RX, or 0 if there is no offload.
+ */
+int mbedtls_ssl_get_ktls( const mbedtls_ssl_context *ssl );
+#endif /* MBEDTLS_SSL_KTLS */
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+/**
+ * \brief          Free the input and output buffers of an idle connection.
+ *
+ *                 A connection is idle when its handshake is complete and
+ *                 it holds no data in flight: no unread application data,
+ *                 no partially received or read-ahead record, and no
+ *                 unsent or held back output. The buffers are allocated
+ *                 again with mbedtls_calloc() when the connection is next
+ *                 used, e.g. by mbedtls_ssl_read(), mbedtls_ssl_write(),
+ *                 mbedtls_ssl_close_notify() or mbedtls_ssl_session_reset().
+ *                 Those functions return #MBEDTLS_ERR_SSL_ALLOC_FAILED if
+ *                 this allocation fails, and can be called again later.
+ *
+ * \param ssl      SSL context
+ *
+ * \return         0 if the buffers have been released or were already
+ *                 released.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the connection is
+ *                 not idle. The buffers are kept.
+ */
+int mbedtls_ssl_release_buffers( mbedtls_ssl_context *ssl );
+#endif /* MBEDTLS_SSL_IDLE_BUFFER_RELEASE */
+
 /**
  * \brief           Send an alert message
  *
@@ -0,0 +1,224 @@
+/**
+ * \file ssl_ecdhe_pool.h
+ *
+ * \brief Pool of pregenerated ephemeral ECDHE keys for TLS servers
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_SSL_ECDHE_POOL_H
+#define MBEDTLS_SSL_ECDHE_POOL_H
+#include "mbedtls/private_access.h"
+
+#include "mbedtls/build_info.h"
+
+#include "mbedtls/ecp.h"
+
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in mbedtls_config.h or define them on the compiler command line.
+ * \{
+ */
+
+#if !defined(MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS)
+#define MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS       4   /*!< Maximum number of groups in a pool */
+#endif
+
+/** \} name SECTION: Module settings */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief   A single pregenerated ephemeral key pair
+ */
+typedef struct mbedtls_ssl_ecdhe_pool_slot
+{
+    mbedtls_mpi MBEDTLS_PRIVATE(d);              /*!< private value      */
+    mbedtls_ecp_point MBEDTLS_PRIVATE(Q);        /*!< public value       */
+}
+mbedtls_ssl_ecdhe_pool_slot;
+
+/**
+ * \brief   Ring of pregenerated key pairs for one group
+ */
+typedef struct mbedtls_ssl_ecdhe_pool_ring
+{
+    mbedtls_ecp_group_id MBEDTLS_PRIVATE(grp_id);        /*!< group of the keys  */
+    mbedtls_ssl_ecdhe_pool_slot *MBEDTLS_PRIVATE(slots); /*!< capacity slots     */
+    size_t MBEDTLS_PRIVATE(head);                /*!< oldest key         */
+    size_t MBEDTLS_PRIVATE(count);               /*!< number of keys     */
+}
+mbedtls_ssl_ecdhe_pool_ring;
+
+/**
+ * \brief   Ephemeral ECDHE key pool context
+ */
+typedef struct mbedtls_ssl_ecdhe_pool
+{
+    mbedtls_ssl_ecdhe_pool_ring MBEDTLS_PRIVATE(rings)[MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS];
+    size_t MBEDTLS_PRIVATE(ring_count);          /*!< groups in use      */
+    size_t MBEDTLS_PRIVATE(capacity);            /*!< keys per group     */
+
+    int (*MBEDTLS_PRIVATE(f_rng))(void *, unsigned char *, size_t);
+    void *MBEDTLS_PRIVATE(p_rng);                /*!< context for RNG    */
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);    /*!< mutex      */
+#endif
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_t MBEDTLS_PRIVATE(refill_thread);    /*!< refill thread      */
+    pthread_mutex_t MBEDTLS_PRIVATE(refill_lock);   /*!< guards flags below */
+    pthread_cond_t MBEDTLS_PRIVATE(refill_cond); /*!< wakes the thread   */
+    int MBEDTLS_PRIVATE(refill_pending);         /*!< a key was taken    */
+    int MBEDTLS_PRIVATE(refill_stop);            /*!< thread must exit   */
+    int MBEDTLS_PRIVATE(refill_ret);             /*!< thread exit status */
+    int MBEDTLS_PRIVATE(refill_running);         /*!< under pool mutex   */
+#endif
+}
+mbedtls_ssl_ecdhe_pool;
+
+/**
+ * \brief          Initialize an ephemeral key pool
+ *
+ * \param pool     Pool to initialize
+ */
+void mbedtls_ssl_ecdhe_pool_init( mbedtls_ssl_ecdhe_pool *pool );
+
+/**
+ * \brief          Prepare a pool for use. The pool starts out empty,
+ *                 call mbedtls_ssl_ecdhe_pool_refill() to fill it.
+ *
+ * \param pool     Pool to set up
+ * \param f_rng    RNG callback used to generate the keys.
+ *                 It must be thread-safe if mbedtls_ssl_ecdhe_pool_refill()
+ *                 runs concurrently with other users of the RNG.
+ * \param p_rng    RNG context
+ * \param groups   List of groups to pregenerate keys for, terminated
+ *                 by MBEDTLS_ECP_DP_NONE. At most
+ *                 MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS groups.
+ * \param capacity Maximum number of keys kept for each group
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_SSL_BAD_INPUT_DATA if a parameter is invalid,
+ *                 MBEDTLS_ERR_SSL_ALLOC_FAILED on allocation failure.
+ */
+int mbedtls_ssl_ecdhe_pool_setup( mbedtls_ssl_ecdhe_pool *pool,
+                                  int (*f_rng)(void *, unsigned char *, size_t),
+                                  void *p_rng,
+                                  const mbedtls_ecp_group_id *groups,
+                                  size_t capacity );
+
+/**
+ * \brief          Generate keys until every group's ring is full, or
+ *                 until \p max_keys keys have been generated.
+ *                 (Thread-safe if MBEDTLS_THREADING_C is enabled)
+ *
+ *                 This is meant to be called off the handshake path, for
+ *                 example from a dedicated low-priority thread or from
+ *                 the idle branch of an event loop. Groups are filled in
+ *                 the order given to mbedtls_ssl_ecdhe_pool_setup().
+ *                 With MBEDTLS_THREADING_PTHREAD, the library can run
+ *                 such a thread itself, see
+ *                 mbedtls_ssl_ecdhe_pool_start_refill().
+ *
+ * \param pool     Pool to refill
+ * \param max_keys Maximum number of keys to generate, or 0 for no limit
+ *
+ * \return         0 if successful, or an ECP or RNG error code.
+ */
+int mbedtls_ssl_ecdhe_pool_refill( mbedtls_ssl_ecdhe_pool *pool,
+                                   size_t max_keys );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief          Start a background thread that keeps the pool full.
+ *
+ *                 The thread calls mbedtls_ssl_ecdhe_pool_refill() until
+ *                 every group's ring is full, then sleeps until a key is
+ *                 taken from the pool. It exits if a refill fails; the
+ *                 error is returned by mbedtls_ssl_ecdhe_pool_stop_refill().
+ *
+ * \note           The RNG given to mbedtls_ssl_ecdhe_pool_setup() is
+ *                 called from the new thread, so it must be thread-safe
+ *                 if it is also used elsewhere.
+ *
+ * \param pool     Pool to refill. It must have been set up with
+ *                 mbedtls_ssl_ecdhe_pool_setup().
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the pool is not set up
+ *                 or a refill thread is already running,
+ *                 MBEDTLS_ERR_SSL_ALLOC_FAILED if the thread could not be
+ *                 created.
+ */
+int mbedtls_ssl_ecdhe_pool_start_refill( mbedtls_ssl_ecdhe_pool *pool );
+
+/**
+ * \brief          Stop the thread started by
+ *                 mbedtls_ssl_ecdhe_pool_start_refill() and wait for it
+ *                 to exit. A refill in progress is completed first.
+ *
+ * \param pool     Pool whose refill thread to stop
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_SSL_BAD_INPUT_DATA if no refill thread is
+ *                 running, or the error that made the thread exit early.
+ */
+int mbedtls_ssl_ecdhe_pool_stop_refill( mbedtls_ssl_ecdhe_pool *pool );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+/**
+ * \brief          Key pool take callback implementation, to be passed to
+ *                 mbedtls_ssl_conf_ecdhe_pool().
+ *                 (Thread-safe if MBEDTLS_THREADING_C is enabled)
+ *
+ *                 The key is removed from the pool, so each pregenerated
+ *                 key is handed out at most once.
+ *
+ * \param p_pool   The ephemeral key pool (mbedtls_ssl_ecdhe_pool *)
+ * \param grp_id   Group of the wanted key
+ * \param key      Key pair to fill, initialized by the caller
+ *
+ * \return         0 if a key was taken from the pool,
+ *                 1 if no key is available for \p grp_id,
+ *                 or another error code on failure.
+ */
+int mbedtls_ssl_ecdhe_pool_take( void *p_pool,
+                                 mbedtls_ecp_group_id grp_id,
+                                 mbedtls_ecp_keypair *key );
+
+/**
+ * \brief          Free referenced items in a pool and clear memory.
+ *                 A running refill thread is stopped first.
+ *
+ * \param pool     Pool to free
+ */
+void mbedtls_ssl_ecdhe_pool_free( mbedtls_ssl_ecdhe_pool *pool );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ssl_ecdhe_pool.h */
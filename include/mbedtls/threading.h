@@ -109,6 +109,34 @@ extern mbedtls_threading_mutex_t mbedtls_threading_readdir_mutex;
 extern mbedtls_threading_mutex_t mbedtls_threading_gmtime_mutex;
 #endif /* MBEDTLS_HAVE_TIME_DATE && !MBEDTLS_PLATFORM_GMTIME_R_ALT */
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#if !defined(MBEDTLS_THREADING_PTHREAD)
+/* This mutex protects the PSA key store: the list of key slots, the index
+ * of key identifiers, and the state and lock counter of each key slot.
+ * With MBEDTLS_THREADING_PTHREAD, the key store uses a reader-writer lock
+ * instead. */
+extern mbedtls_threading_mutex_t mbedtls_threading_key_slot_mutex;
+#endif /* !MBEDTLS_THREADING_PTHREAD */
+/* This mutex serializes the loading of persistent and built-in PSA keys
+ * into the key store. */
+extern mbedtls_threading_mutex_t mbedtls_threading_key_load_mutex;
+#endif /* MBEDTLS_PSA_CRYPTO_C */
+
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+/* This mutex protects the list of per-thread PSA DRBG instances. */
+extern mbedtls_threading_mutex_t mbedtls_threading_psa_rngdata_mutex;
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+/* This mutex protects the PSA ITS log file and its in-memory index. */
+extern mbedtls_threading_mutex_t mbedtls_threading_psa_its_mutex;
+#endif /* MBEDTLS_PSA_ITS_LOG_C */
+
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+/* This mutex protects the table of PSA operation statistics. */
+extern mbedtls_threading_mutex_t mbedtls_threading_psa_stats_mutex;
+#endif /* MBEDTLS_PSA_CRYPTO_INSTRUMENTATION */
+
 #endif /* MBEDTLS_THREADING_C */
 
 #ifdef __cplusplus
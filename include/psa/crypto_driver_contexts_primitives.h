@@ -38,6 +38,9 @@
 /* Include the context structure definitions for the Mbed TLS software drivers */
 #include "psa/crypto_builtin_primitives.h"
 
+/* Include the context structure definitions for the in-tree SIMD driver */
+#include "psa/crypto_simd_driver_primitives.h"
+
 /* Include the context structure definitions for those drivers that were
  * declared during the autogeneration process. */
 
@@ -102,6 +105,9 @@ typedef union {
 #if defined(PSA_CRYPTO_DRIVER_TEST)
     mbedtls_transparent_test_driver_hash_operation_t test_driver_ctx;
 #endif
+#if defined(MBEDTLS_PSA_SIMD_DRIVER_C)
+    mbedtls_psa_simd_hash_operation_t simd_ctx;
+#endif
 } psa_driver_hash_context_t;
 
 typedef union {
@@ -46,6 +46,11 @@ extern "C" {
 #define MBEDTLS_PSA_KEY_SLOT_COUNT 32
 #endif
 
+/* See mbedtls_config.h for definition */
+#if !defined(MBEDTLS_PSA_STATS_MAX_ENTRIES)
+#define MBEDTLS_PSA_STATS_MAX_ENTRIES 64
+#endif
+
 /** \addtogroup attributes
  * @{
  */
@@ -256,6 +261,138 @@ typedef struct mbedtls_psa_stats_s
  */
 void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats );
 
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+
+/** Kinds of operation accounted by the PSA operation statistics.
+ *
+ * Multipart operations are accounted per step: the setup and abort steps
+ * are not recorded, and the bytes of an update step are the bytes of input
+ * passed to it. Operations that the library performs through the PSA API on
+ * its own behalf, such as the hash steps of the built-in HMAC, are accounted
+ * as well.
+ */
+typedef uint8_t mbedtls_psa_stats_op_t;
+
+#define MBEDTLS_PSA_STATS_HASH_COMPUTE          ((mbedtls_psa_stats_op_t) 1)
+#define MBEDTLS_PSA_STATS_HASH_UPDATE           ((mbedtls_psa_stats_op_t) 2)
+#define MBEDTLS_PSA_STATS_HASH_FINISH           ((mbedtls_psa_stats_op_t) 3)
+#define MBEDTLS_PSA_STATS_MAC_COMPUTE           ((mbedtls_psa_stats_op_t) 4)
+#define MBEDTLS_PSA_STATS_MAC_VERIFY            ((mbedtls_psa_stats_op_t) 5)
+#define MBEDTLS_PSA_STATS_MAC_UPDATE            ((mbedtls_psa_stats_op_t) 6)
+#define MBEDTLS_PSA_STATS_MAC_FINISH            ((mbedtls_psa_stats_op_t) 7)
+#define MBEDTLS_PSA_STATS_CIPHER_ENCRYPT        ((mbedtls_psa_stats_op_t) 8)
+#define MBEDTLS_PSA_STATS_CIPHER_DECRYPT        ((mbedtls_psa_stats_op_t) 9)
+#define MBEDTLS_PSA_STATS_CIPHER_UPDATE         ((mbedtls_psa_stats_op_t) 10)
+#define MBEDTLS_PSA_STATS_AEAD_ENCRYPT          ((mbedtls_psa_stats_op_t) 11)
+#define MBEDTLS_PSA_STATS_AEAD_DECRYPT          ((mbedtls_psa_stats_op_t) 12)
+#define MBEDTLS_PSA_STATS_AEAD_UPDATE           ((mbedtls_psa_stats_op_t) 13)
+#define MBEDTLS_PSA_STATS_SIGN_HASH             ((mbedtls_psa_stats_op_t) 14)
+#define MBEDTLS_PSA_STATS_VERIFY_HASH           ((mbedtls_psa_stats_op_t) 15)
+#define MBEDTLS_PSA_STATS_SIGN_MESSAGE          ((mbedtls_psa_stats_op_t) 16)
+#define MBEDTLS_PSA_STATS_VERIFY_MESSAGE        ((mbedtls_psa_stats_op_t) 17)
+#define MBEDTLS_PSA_STATS_ASYMMETRIC_ENCRYPT    ((mbedtls_psa_stats_op_t) 18)
+#define MBEDTLS_PSA_STATS_ASYMMETRIC_DECRYPT    ((mbedtls_psa_stats_op_t) 19)
+#define MBEDTLS_PSA_STATS_KEY_AGREEMENT         ((mbedtls_psa_stats_op_t) 20)
+#define MBEDTLS_PSA_STATS_GENERATE_KEY          ((mbedtls_psa_stats_op_t) 21)
+#define MBEDTLS_PSA_STATS_GENERATE_RANDOM       ((mbedtls_psa_stats_op_t) 22)
+#define MBEDTLS_PSA_STATS_CIPHER_FINISH         ((mbedtls_psa_stats_op_t) 23)
+#define MBEDTLS_PSA_STATS_AEAD_FINISH           ((mbedtls_psa_stats_op_t) 24)
+#define MBEDTLS_PSA_STATS_AEAD_VERIFY           ((mbedtls_psa_stats_op_t) 25)
+/** Calls that could not be given an entry of their own because
+ * #MBEDTLS_PSA_STATS_MAX_ENTRIES entries were already in use. The
+ * algorithm and driver of this entry are 0. */
+#define MBEDTLS_PSA_STATS_OVERFLOW              ((mbedtls_psa_stats_op_t) 0xff)
+
+/** Number of buckets of the latency histogram of an operation. */
+#define MBEDTLS_PSA_STATS_LATENCY_BUCKETS 121
+
+/** \brief Statistics about one kind of PSA operation.
+ *
+ * Each entry accounts the calls of one operation type with one algorithm
+ * handled by one driver.
+ *
+ * \note The content of this structure is not part of the stable API and ABI
+ *       of Mbed TLS and may change arbitrarily from version to version.
+ */
+typedef struct
+{
+    mbedtls_psa_stats_op_t op;  /*!< The kind of operation */
+    psa_algorithm_t alg;        /*!< The algorithm of the operation. For
+                                     key generation, this is the permitted
+                                     algorithm of the key. */
+    unsigned int driver;        /*!< The identifier of the driver that
+                                     handled the operation, as assigned by
+                                     the driver wrappers, or 0 if it is not
+                                     known. Only multipart steps report a
+                                     driver. */
+    uint64_t calls;             /*!< Number of calls */
+    uint64_t failures;          /*!< Number of calls that did not return
+                                     #PSA_SUCCESS */
+    uint64_t bytes;             /*!< Number of input bytes of all calls */
+    /** Latency histogram: the number of calls whose duration in
+     * nanoseconds was below mbedtls_psa_op_stats_bucket_limit() of that
+     * bucket and at least the limit of the previous bucket. The counts
+     * saturate at UINT32_MAX. */
+    uint32_t latency[MBEDTLS_PSA_STATS_LATENCY_BUCKETS];
+} mbedtls_psa_op_stats_t;
+
+/** \brief Get a snapshot of the PSA operation statistics.
+ *
+ * The snapshot is consistent: no call is partially accounted in it, even if
+ * other threads are performing cryptographic operations.
+ *
+ * \param[out] stats         Array where the entries in use are copied.
+ * \param stats_size         Number of elements of \p stats.
+ * \param[out] stats_length  On success or #PSA_ERROR_BUFFER_TOO_SMALL,
+ *                           the number of entries written to \p stats.
+ *
+ * \retval #PSA_SUCCESS
+ *         All the entries in use were copied.
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ *         More than \p stats_size entries are in use. The first
+ *         \p stats_size entries were copied. An array of
+ *         #MBEDTLS_PSA_STATS_MAX_ENTRIES elements is always large enough.
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The statistics could not be locked.
+ */
+psa_status_t mbedtls_psa_get_op_stats( mbedtls_psa_op_stats_t *stats,
+                                       size_t stats_size,
+                                       size_t *stats_length );
+
+/** \brief Clear all the PSA operation statistics. */
+void mbedtls_psa_reset_op_stats( void );
+
+/** \brief Get the upper bound of a latency histogram bucket.
+ *
+ * Bucket 0 counts the calls that took less than 64 nanoseconds. Above
+ * that, each power of two is divided into four buckets of equal width, so
+ * that the bounds of a bucket are within 25% of each other.
+ *
+ * \param bucket    The index of a bucket, less than
+ *                  #MBEDTLS_PSA_STATS_LATENCY_BUCKETS.
+ *
+ * \return          The exclusive upper bound of the bucket in nanoseconds.
+ *                  This is \c UINT64_MAX for the last bucket, which also
+ *                  counts all longer calls.
+ */
+uint64_t mbedtls_psa_op_stats_bucket_limit( size_t bucket );
+
+/** \brief Estimate a percentile of the latency of an operation.
+ *
+ * \param[in] stats     An entry obtained from mbedtls_psa_get_op_stats().
+ * \param permille      The percentile to estimate, in thousandths: for
+ *                      example, 500 for the median and 999 for the 99.9th
+ *                      percentile. Values above 1000 are treated as 1000.
+ *
+ * \return              The upper bound in nanoseconds of the bucket that
+ *                      contains the requested percentile, or 0 if no
+ *                      latency was recorded for \p stats.
+ */
+uint64_t mbedtls_psa_op_stats_percentile( const mbedtls_psa_op_stats_t *stats,
+                                          unsigned permille );
+
+#endif /* MBEDTLS_PSA_CRYPTO_INSTRUMENTATION */
+
 /**
  * \brief Inject an initial entropy seed for the random generator into
  *        secure storage.
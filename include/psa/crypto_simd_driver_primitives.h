@@ -0,0 +1,50 @@
+/*
+ *  Context structure declaration of the in-tree SIMD driver
+ *
+ *  This file contains the context structure of the multipart operations
+ *  implemented by the SIMD transparent driver (MBEDTLS_PSA_SIMD_DRIVER_C).
+ *  It is included from crypto_driver_contexts_primitives.h so that the
+ *  structure can be part of the driver context unions.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PSA_CRYPTO_SIMD_DRIVER_PRIMITIVES_H
+#define PSA_CRYPTO_SIMD_DRIVER_PRIMITIVES_H
+#include "mbedtls/private_access.h"
+
+#include <psa/crypto_driver_common.h>
+
+#if defined(MBEDTLS_PSA_SIMD_DRIVER_C)
+
+/*
+ * Hash multi-part operation definitions.
+ */
+
+typedef struct
+{
+    psa_algorithm_t MBEDTLS_PRIVATE(alg);
+    uint32_t MBEDTLS_PRIVATE(state)[8];     /*!< SHA-224/SHA-256 state */
+    uint64_t MBEDTLS_PRIVATE(total);        /*!< Bytes processed so far */
+    uint8_t MBEDTLS_PRIVATE(buffer)[64];    /*!< Pending partial block */
+} mbedtls_psa_simd_hash_operation_t;
+
+#define MBEDTLS_PSA_SIMD_HASH_OPERATION_INIT { 0, { 0 }, 0, { 0 } }
+
+#endif /* MBEDTLS_PSA_SIMD_DRIVER_C */
+
+#endif /* PSA_CRYPTO_SIMD_DRIVER_PRIMITIVES_H */
@@ -89,9 +89,16 @@ struct psa_hash_operation_s
      * any driver (i.e. the driver context is not active, in use). */
     unsigned int MBEDTLS_PRIVATE(id);
     psa_driver_hash_context_t MBEDTLS_PRIVATE(ctx);
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+    psa_algorithm_t MBEDTLS_PRIVATE(stats_alg);
+#endif
 };
 
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+#define PSA_HASH_OPERATION_INIT { 0, { 0 }, 0 }
+#else
 #define PSA_HASH_OPERATION_INIT { 0, { 0 } }
+#endif
 static inline struct psa_hash_operation_s psa_hash_operation_init( void )
 {
     const struct psa_hash_operation_s v = PSA_HASH_OPERATION_INIT;
@@ -114,9 +121,16 @@ struct psa_cipher_operation_s
     uint8_t MBEDTLS_PRIVATE(default_iv_length);
 
     psa_driver_cipher_context_t MBEDTLS_PRIVATE(ctx);
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+    psa_algorithm_t MBEDTLS_PRIVATE(stats_alg);
+#endif
 };
 
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+#define PSA_CIPHER_OPERATION_INIT { 0, 0, 0, 0, { 0 }, 0 }
+#else
 #define PSA_CIPHER_OPERATION_INIT { 0, 0, 0, 0, { 0 } }
+#endif
 static inline struct psa_cipher_operation_s psa_cipher_operation_init( void )
 {
     const struct psa_cipher_operation_s v = PSA_CIPHER_OPERATION_INIT;
@@ -139,9 +153,16 @@ struct psa_mac_operation_s
     uint8_t MBEDTLS_PRIVATE(mac_size);
     unsigned int MBEDTLS_PRIVATE(is_sign) : 1;
     psa_driver_mac_context_t MBEDTLS_PRIVATE(ctx);
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+    psa_algorithm_t MBEDTLS_PRIVATE(stats_alg);
+#endif
 };
 
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+#define PSA_MAC_OPERATION_INIT { 0, 0, 0, { 0 }, 0 }
+#else
 #define PSA_MAC_OPERATION_INIT { 0, 0, 0, { 0 } }
+#endif
 static inline struct psa_mac_operation_s psa_mac_operation_init( void )
 {
     const struct psa_mac_operation_s v = PSA_MAC_OPERATION_INIT;
@@ -42,6 +42,7 @@
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
 #include "constant_time_internal.h"
+#include "bignum_internal.h"
 
 #include <limits.h>
 #include <string.h>
@@ -2001,6 +2002,37 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Modular doubling: D = 2 * X mod N, where X < N has N->n limbs and D has
+ * at least N->n limbs. T is used as temporary storage and must have at
+ * least N->n limbs.
+ */
+static void mpi_mod_double( mbedtls_mpi_uint *D, const mbedtls_mpi_uint *X,
+                            const mbedtls_mpi *N, const mbedtls_mpi *T )
+{
+    size_t i, n = N->n;
+    mbedtls_mpi_uint c = 0, t;
+
+    for( i = 0; i < n; i++ )
+    {
+        t = X[i];
+        D[i] = ( t << 1 ) | c;
+        c = t >> ( biL - 1 );
+    }
+
+    /* 2 * X < 2 * N, so at most one subtraction of N is needed. It is
+     * needed if 2 * X overflowed n limbs or if D >= N. */
+    c |= mpi_sub_hlp( n, T->p, D, N->p ) ^ 1;
+    mbedtls_ct_mpi_uint_cond_assign( n, D, T->p, (unsigned char) c );
+}
+
+/*
+ * The public exponent F4 = 2^16 + 1, which gets a dedicated code path
+ * in mbedtls_mpi_exp_mod()
+ */
+#define MPI_EXP_F4_BITS     16
+#define MPI_EXP_F4          ( ( 1 << MPI_EXP_F4_BITS ) + 1 )
+
 /*
  * Sliding-window exponentiation: X = A^E mod N  (HAC 14.85)
  */
@@ -2014,7 +2046,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
     size_t bufsize, nbits;
     mbedtls_mpi_uint ei, mm, state;
     mbedtls_mpi RR, T, W[ 1 << MBEDTLS_MPI_WINDOW_SIZE ], WW, Apos;
-    int neg;
+    int neg, is_f4, is_two;
 
     MPI_VALIDATE_RET( X != NULL );
     MPI_VALIDATE_RET( A != NULL );
@@ -2042,6 +2074,23 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
 
     i = mbedtls_mpi_bitlen( E );
 
+    /*
+     * E = 65537 is by far the most common RSA public exponent. It is public
+     * by nature, so it is fine to branch on it and use a dedicated chain
+     * of 16 squarings and 1 multiplication without any window table.
+     */
+    is_f4 = ( i == MPI_EXP_F4_BITS + 1 &&
+              mbedtls_mpi_cmp_int( E, MPI_EXP_F4 ) == 0 );
+
+    /*
+     * A = 2 is the generator of all standard Diffie-Hellman groups
+     * (RFC 3526, RFC 7919). Multiplying by it is a modular doubling,
+     * which is much cheaper than a Montgomery multiplication and needs
+     * no window table.
+     */
+    is_two = ( mbedtls_mpi_cmp_int( A, 2 ) == 0 &&
+               mbedtls_mpi_cmp_int( N, 2 ) > 0 );
+
     wsize = ( i > 671 ) ? 6 : ( i > 239 ) ? 5 :
             ( i >  79 ) ? 4 : ( i >  23 ) ? 3 : 1;
 
@@ -2104,12 +2153,47 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
      * (it grew above and was preserved by mbedtls_mpi_copy()). */
     mpi_montmul( &W[1], &RR, N, mm, &T );
 
+    if( is_f4 )
+    {
+        /*
+         * X = W[1]^(2^16) * W[1] R^-1 mod N = A^65537 * R mod N
+         */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &W[1] ) );
+
+        for( i = 0; i < MPI_EXP_F4_BITS; i++ )
+            mpi_montmul( X, X, N, mm, &T );
+
+        mpi_montmul( X, &W[1], N, mm, &T );
+
+        goto reduce;
+    }
+
     /*
      * X = R^2 * R^-1 mod N = R mod N
      */
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &RR ) );
     mpi_montred( X, N, mm, &T );
 
+    if( is_two )
+    {
+        /*
+         * Left-to-right binary exponentiation, where the multiplication
+         * by 2 is always computed and then conditionally kept, so that
+         * the sequence of operations does not depend on the bits of E.
+         */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &WW, N->n + 1 ) );
+
+        for( i = mbedtls_mpi_bitlen( E ); i > 0; i-- )
+        {
+            mpi_montmul( X, X, N, mm, &T );
+            mpi_mod_double( WW.p, X->p, N, &T );
+            mbedtls_ct_mpi_uint_cond_assign( N->n, X->p, WW.p,
+                                (unsigned char) mbedtls_mpi_get_bit( E, i - 1 ) );
+        }
+
+        goto reduce;
+    }
+
     if( wsize > 1 )
     {
         /*
@@ -2213,6 +2297,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
             mpi_montmul( X, &W[1], N, mm, &T );
     }
 
+reduce:
     /*
      * X = A^E * R * R^-1 mod N = A^E mod N
      */
@@ -2238,6 +2323,121 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Fixed-base comb exponentiation: X = G^E mod N, where the table T holds
+ * the products of G^(2^(i*d)) for every non-empty subset of the w rows.
+ */
+int mbedtls_mpi_exp_mod_comb( mbedtls_mpi *X, const mbedtls_mpi *T,
+                              size_t w, size_t d,
+                              const mbedtls_mpi *E, const mbedtls_mpi *N,
+                              mbedtls_mpi *prec_RR )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i, j, idx, T_size;
+    mbedtls_mpi_uint mm;
+    mbedtls_mpi RR, U, WW, W[ 1 << MBEDTLS_MPI_COMB_MAX_WIDTH ];
+
+    MPI_VALIDATE_RET( X != NULL );
+    MPI_VALIDATE_RET( T != NULL );
+    MPI_VALIDATE_RET( E != NULL );
+    MPI_VALIDATE_RET( N != NULL );
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( w == 0 || w > MBEDTLS_MPI_COMB_MAX_WIDTH || d == 0 ||
+        d > MBEDTLS_MPI_MAX_BITS )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 ||
+        mbedtls_mpi_bitlen( E ) > w * d ||
+        mbedtls_mpi_bitlen( N ) > MBEDTLS_MPI_MAX_BITS )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    T_size = (size_t) 1 << w;
+
+    for( i = 1; i < T_size; i++ )
+    {
+        if( T[i - 1].s != 1 || mbedtls_mpi_cmp_mpi( &T[i - 1], N ) >= 0 )
+            return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+    }
+
+    mpi_montg_init( &mm, N );
+    mbedtls_mpi_init( &RR ); mbedtls_mpi_init( &U ); mbedtls_mpi_init( &WW );
+    memset( W, 0, sizeof( W ) );
+
+    /* As in mbedtls_mpi_exp_mod(), X and all W[i] need N->n + 1 limbs for
+     * mpi_montmul() and mpi_montred(). */
+    j = N->n + 1;
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, j ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &WW, j ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &U, j * 2 ) );
+
+    if( prec_RR == NULL || prec_RR->p == NULL )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, N->n * 2 * biL ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
+
+        if( prec_RR != NULL )
+            memcpy( prec_RR, &RR, sizeof( mbedtls_mpi ) );
+    }
+    else
+        memcpy( &RR, prec_RR, sizeof( mbedtls_mpi ) );
+
+    /*
+     * W[0] = R mod N, the Montgomery form of 1, and W[i] = T[i - 1] * R mod N
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[0], j ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[0], &RR ) );
+    mpi_montred( &W[0], N, mm, &U );
+
+    for( i = 1; i < T_size; i++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[i], j ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[i], &T[i - 1] ) );
+        mpi_montmul( &W[i], &RR, N, mm, &U );
+    }
+
+    /*
+     * Column by column from the most significant one: square, then
+     * multiply by the entry indexed by the bits of E in this column.
+     * The entry is selected without leaking its index, and the
+     * multiplication is done even for the entry 1.
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &W[0] ) );
+
+    for( i = d; i > 0; i-- )
+    {
+        mpi_montmul( X, X, N, mm, &U );
+
+        idx = 0;
+        for( j = 0; j < w; j++ )
+            idx |= (size_t) mbedtls_mpi_get_bit( E, j * d + i - 1 ) << j;
+
+        MBEDTLS_MPI_CHK( mpi_select( &WW, W, T_size, idx ) );
+        mpi_montmul( X, &WW, N, mm, &U );
+    }
+
+    /*
+     * X = G^E * R * R^-1 mod N = G^E mod N
+     */
+    mpi_montred( X, N, mm, &U );
+    X->s = 1;
+
+cleanup:
+
+    for( i = 0; i < T_size; i++ )
+        mbedtls_mpi_free( &W[i] );
+
+    mbedtls_mpi_free( &U ); mbedtls_mpi_free( &WW );
+
+    if( prec_RR == NULL || prec_RR->p == NULL )
+        mbedtls_mpi_free( &RR );
+
+    return( ret );
+}
+
 /*
  * Greatest common divisor: G = gcd(A, B)  (HAC 14.54)
  */
@@ -2482,6 +2682,329 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Constant-time modular inversion for odd moduli, using the divstep
+ * iteration of Bernstein and Yang, "Fast constant-time gcd computation and
+ * modular inversion", 2019, batched 30 divsteps at a time as in the
+ * "safegcd" implementation of libsecp256k1.
+ *
+ * The numbers involved are signed and are stored in arrays of int32_t
+ * "signed30" limbs: every limb but the last one holds 30 bits in [0, 2^30),
+ * and the last limb is signed. This relies on signed right shifts being
+ * arithmetic, as is the case with all supported compilers.
+ */
+#define MPI_S30_BITS    30
+#define MPI_S30_MASK    ( (int32_t) ( UINT32_MAX >> 2 ) )
+
+/* Number of signed30 limbs used to hold signed multiples of an nbits modulus */
+#define MPI_S30_LIMBS( nbits ) ( ( ( nbits ) + MPI_S30_BITS - 1 ) / MPI_S30_BITS + 1 )
+
+/*
+ * Convert the n limbs of p (nonnegative) to l signed30 limbs.
+ */
+static void mpi_to_s30( int32_t *r, size_t l, const mbedtls_mpi_uint *p, size_t n )
+{
+    size_t i, pos, idx, off;
+    mbedtls_mpi_uint v;
+
+    for( i = 0; i < l; i++ )
+    {
+        pos = i * MPI_S30_BITS;
+        idx = pos / biL;
+        off = pos % biL;
+
+        v = ( idx < n ) ? p[idx] >> off : 0;
+        if( off + MPI_S30_BITS > biL && idx + 1 < n )
+            v |= p[idx + 1] << ( biL - off );
+
+        r[i] = (int32_t) ( v & (mbedtls_mpi_uint) MPI_S30_MASK );
+    }
+}
+
+/*
+ * Convert l nonnegative, normalized signed30 limbs to n limbs in p.
+ */
+static void mpi_from_s30( mbedtls_mpi_uint *p, size_t n, const int32_t *r, size_t l )
+{
+    size_t i, pos, idx, off;
+    mbedtls_mpi_uint v;
+
+    memset( p, 0, n * ciL );
+
+    for( i = 0; i < l; i++ )
+    {
+        pos = i * MPI_S30_BITS;
+        idx = pos / biL;
+        off = pos % biL;
+        v = (mbedtls_mpi_uint) r[i];
+
+        if( idx < n )
+            p[idx] |= v << off;
+        if( off + MPI_S30_BITS > biL && idx + 1 < n )
+            p[idx + 1] |= v >> ( biL - off );
+    }
+}
+
+/*
+ * Apply 30 divsteps to the 30 least significant bits f0 and g0 of f and g,
+ * starting from delta. Output the transition matrix t = [u, v, q, r] such
+ * that the updated f and g are (u * f + v * g) / 2^30 and
+ * (q * f + r * g) / 2^30, and return the updated delta.
+ *
+ * Each divstep is:
+ *     if delta > 0 and g is odd:
+ *         (delta, f, g) = (1 - delta, g, (g - f) / 2)
+ *     else:
+ *         (delta, f, g) = (1 + delta, f, (g + (g & 1) * f) / 2)
+ *
+ * The entries of the matrix satisfy |u| + |v| <= 2^30 and |q| + |r| <= 2^30.
+ * They are computed modulo 2^32 to avoid undefined behaviour on shifts.
+ */
+static int32_t mpi_divsteps_30( int32_t delta, uint32_t f0, uint32_t g0,
+                                int32_t t[4] )
+{
+    uint32_t u = 1, v = 0, q = 0, r = 1, f = f0, g = g0;
+    uint32_t swap, odd, x;
+    int32_t sdelta;
+    int i;
+
+    for( i = 0; i < MPI_S30_BITS; i++ )
+    {
+        /* (delta, f, g, u, v, q, r) = (-delta, g, -f, q, r, -u, -v)
+         * if delta > 0 and g is odd */
+        swap = ( ( (uint32_t) -delta ) >> 31 ) & g & 1;
+        sdelta = - (int32_t) swap;
+        swap = 0u - swap;
+
+        x = ( f ^ g ) & swap; f ^= x; g ^= x;
+        x = ( u ^ q ) & swap; u ^= x; q ^= x;
+        x = ( v ^ r ) & swap; v ^= x; r ^= x;
+        g = ( g ^ swap ) - swap;
+        q = ( q ^ swap ) - swap;
+        r = ( r ^ swap ) - swap;
+        delta = ( delta ^ sdelta ) - sdelta;
+
+        /* (delta, g, q, r) += (1, (g & 1) * (f, u, v)), then g /= 2 and
+         * (u, v) *= 2 to keep the matrix scaled by 2^(i + 1) */
+        delta++;
+        odd = 0u - ( g & 1 );
+        g += f & odd;
+        q += u & odd;
+        r += v & odd;
+
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+
+    t[0] = (int32_t) u;
+    t[1] = (int32_t) v;
+    t[2] = (int32_t) q;
+    t[3] = (int32_t) r;
+
+    return( delta );
+}
+
+/*
+ * (f, g) = t * (f, g) / 2^30, where the division is exact.
+ */
+static void mpi_update_fg_30( int32_t *f, int32_t *g, size_t l,
+                              const int32_t t[4] )
+{
+    const int64_t u = t[0], v = t[1], q = t[2], r = t[3];
+    int64_t cf, cg;
+    size_t i;
+
+    cf = u * f[0] + v * g[0];
+    cg = q * f[0] + r * g[0];
+    cf >>= MPI_S30_BITS;
+    cg >>= MPI_S30_BITS;
+
+    for( i = 1; i < l; i++ )
+    {
+        cf += u * f[i] + v * g[i];
+        cg += q * f[i] + r * g[i];
+        f[i - 1] = (int32_t) cf & MPI_S30_MASK; cf >>= MPI_S30_BITS;
+        g[i - 1] = (int32_t) cg & MPI_S30_MASK; cg >>= MPI_S30_BITS;
+    }
+
+    f[l - 1] = (int32_t) cf;
+    g[l - 1] = (int32_t) cg;
+}
+
+/*
+ * (d, e) = t * (d, e) / 2^30 mod m, for d and e in (-2m, m), keeping the
+ * outputs in (-2m, m). m_inv is m^-1 mod 2^30.
+ */
+static void mpi_update_de_30( int32_t *d, int32_t *e, size_t l,
+                              const int32_t t[4], const int32_t *m,
+                              uint32_t m_inv )
+{
+    const int32_t u = t[0], v = t[1], q = t[2], r = t[3];
+    int32_t sd, se, md, me;
+    int64_t cd, ce;
+    size_t i;
+
+    /* Start with md, me such that the result is nonnegative, then adjust
+     * them so that t * (d, e) + m * (md, me) is a multiple of 2^30. */
+    sd = d[l - 1] >> 31;
+    se = e[l - 1] >> 31;
+    md = ( u & sd ) + ( v & se );
+    me = ( q & sd ) + ( r & se );
+
+    cd = (int64_t) u * d[0] + (int64_t) v * e[0];
+    ce = (int64_t) q * d[0] + (int64_t) r * e[0];
+
+    md -= (int32_t) ( ( m_inv * (uint32_t) cd + (uint32_t) md ) &
+                      (uint32_t) MPI_S30_MASK );
+    me -= (int32_t) ( ( m_inv * (uint32_t) ce + (uint32_t) me ) &
+                      (uint32_t) MPI_S30_MASK );
+
+    cd += (int64_t) m[0] * md;
+    ce += (int64_t) m[0] * me;
+    cd >>= MPI_S30_BITS;
+    ce >>= MPI_S30_BITS;
+
+    for( i = 1; i < l; i++ )
+    {
+        cd += (int64_t) u * d[i] + (int64_t) v * e[i] + (int64_t) m[i] * md;
+        ce += (int64_t) q * d[i] + (int64_t) r * e[i] + (int64_t) m[i] * me;
+        d[i - 1] = (int32_t) cd & MPI_S30_MASK; cd >>= MPI_S30_BITS;
+        e[i - 1] = (int32_t) ce & MPI_S30_MASK; ce >>= MPI_S30_BITS;
+    }
+
+    d[l - 1] = (int32_t) cd;
+    e[l - 1] = (int32_t) ce;
+}
+
+/*
+ * Bring d from (-2m, m) to [0, m), negating it first if neg is -1.
+ */
+static void mpi_normalize_s30( int32_t *d, size_t l, const int32_t *m,
+                               int32_t neg )
+{
+    int32_t cond;
+    size_t i;
+
+    cond = d[l - 1] >> 31;
+    for( i = 0; i < l; i++ )
+    {
+        d[i] += m[i] & cond;
+        d[i] = ( d[i] ^ neg ) - neg;
+    }
+    for( i = 0; i + 1 < l; i++ )
+    {
+        d[i + 1] += d[i] >> MPI_S30_BITS;
+        d[i] &= MPI_S30_MASK;
+    }
+
+    cond = d[l - 1] >> 31;
+    for( i = 0; i < l; i++ )
+        d[i] += m[i] & cond;
+    for( i = 0; i + 1 < l; i++ )
+    {
+        d[i + 1] += d[i] >> MPI_S30_BITS;
+        d[i] &= MPI_S30_MASK;
+    }
+}
+
+/*
+ * Modular inversion for an odd modulus N, in time depending only on the
+ * size of N.
+ *
+ * The loop maintains f = d * A and g = e * A mod N, starting from f = N,
+ * g = A. After enough divsteps g = 0 and f = +-gcd(A, N).
+ */
+static int mpi_inv_mod_odd( mbedtls_mpi *X, const mbedtls_mpi *A,
+                            const mbedtls_mpi *N )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i, n, l, bits, divsteps;
+    int32_t delta, t[4];
+    int32_t *buf = NULL, *f, *g, *d, *e, *m;
+    uint32_t m_inv;
+    int is_one, is_minus_one;
+    mbedtls_mpi TA;
+
+    mbedtls_mpi_init( &TA );
+
+    bits = mbedtls_mpi_bitlen( N );
+    n = BITS_TO_LIMBS( bits );
+    l = MPI_S30_LIMBS( bits );
+
+    /* Bound from Theorem 11.2 of the paper above */
+    divsteps = ( 49 * bits + ( bits < 46 ? 80 : 57 ) ) / 17;
+
+    if( A->s < 0 || mbedtls_mpi_cmp_abs( A, N ) >= 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &TA, A, N ) );
+        A = &TA;
+    }
+
+    buf = mbedtls_calloc( 5 * l, sizeof( int32_t ) );
+    if( buf == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    f = buf;
+    g = f + l;
+    d = g + l;
+    e = d + l;
+    m = e + l;
+
+    mpi_to_s30( m, l, N->p, n );
+    mpi_to_s30( g, l, A->p, A->n < n ? A->n : n );
+    memcpy( f, m, l * sizeof( int32_t ) );
+    e[0] = 1;
+    delta = 1;
+
+    /* m_inv = m^-1 mod 2^30 by Newton iteration, m * m = 1 mod 8 */
+    m_inv = (uint32_t) m[0];
+    for( i = 0; i < 4; i++ )
+        m_inv *= 2 - (uint32_t) m[0] * m_inv;
+
+    for( i = 0; i < divsteps; i += MPI_S30_BITS )
+    {
+        delta = mpi_divsteps_30( delta, (uint32_t) f[0], (uint32_t) g[0], t );
+        mpi_update_de_30( d, e, l, t, m, m_inv );
+        mpi_update_fg_30( f, g, l, t );
+    }
+
+    /* gcd(A, N) = |f| is public information, no need for constant time */
+    is_one = ( f[0] == 1 && f[l - 1] == 0 );
+    is_minus_one = ( f[0] == MPI_S30_MASK && f[l - 1] == -1 );
+    for( i = 1; i + 1 < l; i++ )
+    {
+        is_one = is_one && f[i] == 0;
+        is_minus_one = is_minus_one && f[i] == MPI_S30_MASK;
+    }
+
+    if( !is_one && !is_minus_one )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    mpi_normalize_s30( d, l, m, - (int32_t) is_minus_one );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, n ) );
+    mpi_from_s30( X->p, n, d, l );
+
+cleanup:
+
+    if( buf != NULL )
+    {
+        mbedtls_platform_zeroize( buf, 5 * l * sizeof( int32_t ) );
+        mbedtls_free( buf );
+    }
+    mbedtls_mpi_free( &TA );
+
+    return( ret );
+}
+
 /*
  * Modular inverse: X = A^-1 mod N  (HAC 14.61 / 14.64)
  */
@@ -2496,6 +3019,10 @@ int mbedtls_mpi_inv_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     if( mbedtls_mpi_cmp_int( N, 1 ) <= 0 )
         return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
+    /* All cryptographic moduli (RSA N, ECC p and n) are odd */
+    if( ( N->p[0] & 1 ) != 0 )
+        return( mpi_inv_mod_odd( X, A, N ) );
+
     mbedtls_mpi_init( &TA ); mbedtls_mpi_init( &TU ); mbedtls_mpi_init( &U1 ); mbedtls_mpi_init( &U2 );
     mbedtls_mpi_init( &G ); mbedtls_mpi_init( &TB ); mbedtls_mpi_init( &TV );
     mbedtls_mpi_init( &V1 ); mbedtls_mpi_init( &V2 );
@@ -2640,6 +3167,54 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Number of consecutive odd candidates examined by one sieving pass of
+ * mbedtls_mpi_gen_prime(), and size in bytes of the matching bitmap.
+ */
+#define MPI_SIEVE_SIZE      512
+#define MPI_SIEVE_BYTES     ( MPI_SIEVE_SIZE / 8 )
+
+/*
+ * Candidates of more than this many bits are larger than every entry of
+ * small_prime, so sieving cannot reject a small prime itself.
+ */
+#define MPI_SIEVE_MIN_BITS  10
+
+/*
+ * Sieve the interval of odd candidates X, X + 2, ..., X + 2 * (MPI_SIEVE_SIZE - 1)
+ * with the small primes table (X must be odd and larger than any small prime)
+ *
+ * On return, bit j of sieve is set if X + 2 * j has a small factor.
+ * Each small prime costs a single reduction of X, instead of one reduction
+ * per candidate as with mpi_check_small_factors().
+ */
+static int mpi_sieve_small_factors( const mbedtls_mpi *X,
+                                    unsigned char sieve[MPI_SIEVE_BYTES] )
+{
+    int ret = 0;
+    size_t i, j, p;
+    mbedtls_mpi_uint r;
+
+    memset( sieve, 0, MPI_SIEVE_BYTES );
+
+    for( i = 0; small_prime[i] > 0; i++ )
+    {
+        p = (size_t) small_prime[i];
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_int( &r, X, small_prime[i] ) );
+
+        /* First j such that X + 2 * j = 0 mod p, that is
+         * j = -r / 2 mod p, and (p + 1) / 2 is the inverse of 2 mod p */
+        j = ( ( p - (size_t) r ) * ( ( p + 1 ) / 2 ) ) % p;
+
+        for( ; j < MPI_SIEVE_SIZE; j += p )
+            sieve[j >> 3] |= (unsigned char) ( 1u << ( j & 7 ) );
+    }
+
+cleanup:
+    return( ret );
+}
+
 /*
  * Miller-Rabin pseudo-primality test  (HAC 4.24)
  */
@@ -2786,10 +3361,11 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
 #define CEIL_MAXUINT_DIV_SQRT2 0xb504f334U
 #endif
     int ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
-    size_t k, n;
+    size_t j, k, n;
     int rounds;
     mbedtls_mpi_uint r;
     mbedtls_mpi Y;
+    unsigned char sieve[MPI_SIEVE_BYTES];
 
     MPI_VALIDATE_RET( X     != NULL );
     MPI_VALIDATE_RET( f_rng != NULL );
@@ -2832,13 +3408,47 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
         if( k > nbits ) MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( X, k - nbits ) );
         X->p[0] |= 1;
 
-        if( ( flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH ) == 0 )
+        if( ( flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH ) == 0 &&
+            nbits <= MPI_SIEVE_MIN_BITS )
         {
             ret = mbedtls_mpi_is_prime_ext( X, rounds, f_rng, p_rng );
 
             if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
                 goto cleanup;
         }
+        else if( ( flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH ) == 0 )
+        {
+            /*
+             * Sieve a whole interval of odd candidates starting at X at
+             * once, and only run Miller-Rabin on the survivors. If the
+             * interval is exhausted or a candidate would exceed nbits,
+             * start over from a fresh random X.
+             */
+            MBEDTLS_MPI_CHK( mpi_sieve_small_factors( X, sieve ) );
+
+            for( j = 0; j < MPI_SIEVE_SIZE; j++ )
+            {
+                if( ( sieve[j >> 3] >> ( j & 7 ) ) & 1 )
+                    continue;
+
+                MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, X ) );
+                MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( &Y, &Y,
+                                                      (mbedtls_mpi_sint) ( 2 * j ) ) );
+                if( mbedtls_mpi_bitlen( &Y ) > nbits )
+                    break;
+
+                ret = mpi_miller_rabin( &Y, rounds, f_rng, p_rng );
+
+                if( ret == 0 )
+                {
+                    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &Y ) );
+                    goto cleanup;
+                }
+
+                if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+                    goto cleanup;
+            }
+        }
         else
         {
             /*
@@ -0,0 +1,68 @@
+/**
+ *  Internal bignum functions
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_BIGNUM_INTERNAL_H
+#define MBEDTLS_BIGNUM_INTERNAL_H
+
+#include "common.h"
+
+#include "mbedtls/bignum.h"
+
+#include <stddef.h>
+
+/** Maximum comb width accepted by mbedtls_mpi_exp_mod_comb(). */
+#define MBEDTLS_MPI_COMB_MAX_WIDTH      6
+
+/**
+ * \brief          Fixed-base modular exponentiation with a precomputed comb
+ *                 table: X = G^E mod N.
+ *
+ *                 The exponent is cut into \p w rows of \p d bits, and
+ *                 each of the \p d columns is handled with one squaring
+ *                 and one multiplication by a table entry, selected in
+ *                 constant time. For a b-bit exponent this costs b / w
+ *                 squarings and b / w multiplications, against b
+ *                 squarings and about b / 6 multiplications for
+ *                 mbedtls_mpi_exp_mod().
+ *
+ * \param X        The destination MPI. This must point to an initialized MPI.
+ * \param T        The comb table for the base G: an array of
+ *                 2^\p w - 1 MPIs, where entry b - 1 is
+ *                 G^( sum of 2^(i * \p d) for each bit i set in b ) mod N.
+ *                 Each entry must be less than \p N.
+ * \param w        The comb width. This must be between 1 and
+ *                 #MBEDTLS_MPI_COMB_MAX_WIDTH.
+ * \param d        The number of exponent bits in each row.
+ * \param E        The exponent. This must be non-negative and have at most
+ *                 \p w * \p d bits.
+ * \param N        The modulus. This must be odd and positive.
+ * \param prec_RR  A helper MPI depending solely on \p N, as for
+ *                 mbedtls_mpi_exp_mod(). This may be \c NULL.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if a parameter is invalid,
+ *                 or if \p E is too large for the table.
+ */
+int mbedtls_mpi_exp_mod_comb( mbedtls_mpi *X, const mbedtls_mpi *T,
+                              size_t w, size_t d,
+                              const mbedtls_mpi *E, const mbedtls_mpi *N,
+                              mbedtls_mpi *prec_RR );
+
+#endif /* MBEDTLS_BIGNUM_INTERNAL_H */
@@ -32,6 +32,8 @@
 #include "mbedtls/dhm.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
+#include "bignum_internal.h"
+#include "bn_mul.h"
 
 #include <string.h>
 
@@ -60,6 +62,6182 @@
 #define DHM_VALIDATE( cond )        \
     MBEDTLS_INTERNAL_VALIDATE( cond )
 
+#if MBEDTLS_DHM_FIXED_BASE_OPTIM == 1
+/*
+ * Fixed-base comb tables for the generator 2 of the RFC 7919 groups,
+ * generated by scripts/dhm_comb_table.py. With d = bitlen(P) / 4, entry
+ * b - 1 of ffdheXXXX_T is 2^( sum of 2^(i * d) for each bit i set in b )
+ * mod P, see mbedtls_mpi_exp_mod_comb().
+ *
+ * Note: the constants are in little-endian order
+ * to be directly usable in MPIs
+ */
+#define DHM_COMB_WIDTH      4
+
+#define DHM_MPI_INIT_ARRAY( x )                                 \
+    { 1, sizeof( x ) / sizeof( mbedtls_mpi_uint ),              \
+      (mbedtls_mpi_uint *) ( x ) }
+
+static const mbedtls_mpi_uint ffdhe2048_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x5C, 0x28, 0x61, 0x38, 0x42, 0x6B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xB6, 0x9F, 0x07, 0xF5, 0x5A, 0xDA, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x93, 0x43, 0xD0, 0xE7, 0x1E, 0xF2, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xB1, 0xE0, 0xF4, 0x2D, 0x3B, 0x65, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xFF, 0x2C, 0x43, 0xEB, 0x9F, 0x09, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x96, 0x17, 0x36, 0xED, 0x8A, 0x19, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xE9, 0x01, 0x20, 0x68, 0x1E, 0xCD, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x4A, 0x0D, 0x1F, 0xDB, 0x1E, 0xBF, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x0F, 0xAA, 0x61, 0x2A, 0x26, 0xD9, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x09, 0x6E, 0x89, 0xC0, 0x5C, 0x24, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x7B, 0xD1, 0xEC, 0x24, 0x9A, 0xCD, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x29, 0x30, 0x23, 0x37, 0x54, 0x66, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x83, 0x02, 0x7B, 0xC0, 0xA4, 0x10, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xCE, 0x32, 0xA0, 0xAF, 0x71, 0x16, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xAD, 0x0B, 0xDC, 0x4D, 0x52, 0x5F, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x7F, 0xC0, 0x8C, 0x4E, 0xE2, 0xA9, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xD5, 0xE7, 0x41, 0xD9, 0x27, 0x4B, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x34, 0x29, 0xDD, 0x17, 0xE7, 0x45, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x2E, 0x78, 0x38, 0x60, 0x5B, 0x31, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x16, 0xD7, 0x24, 0x44, 0xE3, 0xBB, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x3C, 0x20, 0x56, 0x9B, 0x55, 0x7A, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x08, 0x63, 0x9D, 0x84, 0x7C, 0x25, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x8D, 0x12, 0x9B, 0x5E, 0xFF, 0x6A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x96, 0x0C, 0x87, 0x2C, 0x82, 0x62, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xB9, 0xBA, 0x8A, 0x9A, 0x2C, 0x8B, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x49, 0xDD, 0xAC, 0x59, 0x3E, 0x46, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xAF, 0xA4, 0x71, 0x95, 0xF3, 0x2F, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x1D, 0xDB, 0x79, 0x50, 0x0B, 0x97, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x12, 0x90, 0xF2, 0xEC, 0xE0, 0x97, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x03, 0x5D, 0xE8, 0x45, 0xFC, 0xAA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xB5, 0xE7, 0xFA, 0x67, 0x74, 0xD8, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xB1, 0xEA, 0x46, 0x3E, 0x33, 0x13, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA5, 0x67, 0x82, 0xFE, 0x70, 0x7A, 0x09 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_3[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x6C, 0x3F, 0x0F, 0xEA, 0xB5, 0xB4, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x27, 0x87, 0xA0, 0xCF, 0x3D, 0xE4, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x63, 0xC1, 0xE9, 0x5B, 0x76, 0xCA, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xFE, 0x59, 0x86, 0xD6, 0x3F, 0x13, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x2D, 0x2F, 0x6C, 0xDA, 0x15, 0x33, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xD3, 0x03, 0x40, 0xD0, 0x3C, 0x9A, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x95, 0x1A, 0x3E, 0xB6, 0x3D, 0x7E, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x1F, 0x54, 0xC3, 0x54, 0x4C, 0xB2, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x13, 0xDC, 0x12, 0x81, 0xB9, 0x48, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xF7, 0xA2, 0xD9, 0x49, 0x34, 0x9B, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x53, 0x60, 0x46, 0x6E, 0xA8, 0xCC, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x07, 0x05, 0xF6, 0x80, 0x49, 0x21, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x9D, 0x65, 0x40, 0x5F, 0xE3, 0x2C, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x5A, 0x17, 0xB8, 0x9B, 0xA4, 0xBE, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xFF, 0x80, 0x19, 0x9D, 0xC4, 0x53, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xAB, 0xCF, 0x83, 0xB2, 0x4F, 0x96, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x69, 0x52, 0xBA, 0x2F, 0xCE, 0x8B, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x5D, 0xF0, 0x70, 0xC0, 0xB6, 0x62, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x2C, 0xAE, 0x49, 0x88, 0xC6, 0x77, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x78, 0x40, 0xAC, 0x36, 0xAB, 0xF4, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x10, 0xC6, 0x3A, 0x09, 0xF9, 0x4A, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x1B, 0x25, 0x36, 0xBD, 0xFE, 0xD5, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x2D, 0x19, 0x0E, 0x59, 0x04, 0xC5, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x73, 0x75, 0x15, 0x35, 0x59, 0x16, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x93, 0xBA, 0x59, 0xB3, 0x7C, 0x8C, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x5E, 0x49, 0xE3, 0x2A, 0xE7, 0x5F, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x3A, 0xB6, 0xF3, 0xA0, 0x16, 0x2E, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x24, 0x20, 0xE5, 0xD9, 0xC1, 0x2F, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x07, 0xBA, 0xD0, 0x8B, 0xF8, 0x55, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x6B, 0xCF, 0xF5, 0xCF, 0xE8, 0xB0, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x63, 0xD5, 0x8D, 0x7C, 0x66, 0x26, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x4A, 0xCF, 0x04, 0xFD, 0xE1, 0xF4, 0x12 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_4[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xAD, 0x6C, 0xA6, 0x5B, 0xE9, 0xF3, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x7E, 0xA1, 0x30, 0xC1, 0xAB, 0x4C, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x9C, 0x2C, 0xB9, 0xAC, 0xA9, 0x45, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x7E, 0x6B, 0xB8, 0x71, 0x4D, 0x9E, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x85, 0xA7, 0x8E, 0x6A, 0x6A, 0x98, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x75, 0xDF, 0x6F, 0x15, 0x7D, 0x4C, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x5F, 0xA5, 0x8D, 0xBA, 0x17, 0x04, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x33, 0xBC, 0xA1, 0x1C, 0x64, 0x99, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xAA, 0xEE, 0x58, 0x74, 0x6F, 0xCE, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xCB, 0xDA, 0xF8, 0x1E, 0x97, 0x2B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xB6, 0xFB, 0x85, 0x2B, 0xC8, 0xF3, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xE6, 0x68, 0xC5, 0xB7, 0x7D, 0xC2, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xFE, 0x06, 0xAF, 0xD1, 0xE7, 0x31, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xBE, 0x03, 0xF9, 0xA0, 0xF9, 0x8D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x20, 0x37, 0xDE, 0xC5, 0xBF, 0x15, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xDD, 0x47, 0x3C, 0x64, 0x25, 0xA2, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x3F, 0xED, 0x7E, 0x42, 0x84, 0x5D, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x95, 0xEF, 0xD2, 0xDE, 0x5B, 0xF6, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xC0, 0xB2, 0x49, 0xB6, 0x25, 0xA6, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x64, 0x8D, 0xBC, 0xD3, 0xE4, 0x43, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xCF, 0x5E, 0x13, 0x31, 0x21, 0x93, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x9B, 0xFF, 0xDE, 0xE1, 0x70, 0x72, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xD2, 0xFC, 0xCE, 0x2C, 0x79, 0xCC, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xB1, 0x4E, 0xC0, 0x8D, 0xF5, 0xE2, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x6A, 0xEF, 0x63, 0x44, 0x5E, 0xE5, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x22, 0x4D, 0x86, 0x97, 0x64, 0x4F, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xEA, 0x25, 0xBB, 0x5D, 0x31, 0x39, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x07, 0x0C, 0xDF, 0x83, 0x8F, 0xBA, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x26, 0xBB, 0x81, 0xCF, 0x7F, 0x10, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xE2, 0x51, 0x1B, 0xA0, 0xDD, 0x39, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x30, 0x53, 0x9A, 0x7F, 0xF2, 0xBF, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x31, 0x85, 0x10, 0x7D, 0x71, 0xDF, 0xC1 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_5[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x5A, 0xD9, 0x4C, 0xB7, 0xD2, 0xE7, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xA1, 0x1A, 0x00, 0x4A, 0x15, 0x2E, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x48, 0xA6, 0xB0, 0x32, 0x09, 0x98, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x79, 0xC0, 0xF3, 0x5F, 0xA9, 0xAD, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xEB, 0x8C, 0xEE, 0x18, 0xD8, 0x7A, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x3C, 0x4F, 0x93, 0x0F, 0xBF, 0x9A, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x3E, 0x58, 0x2C, 0x42, 0x1D, 0xB9, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xE3, 0xF2, 0x59, 0x9C, 0xC9, 0xBF, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x25, 0xA9, 0x89, 0x1B, 0xDA, 0x68, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xB4, 0xBD, 0x23, 0x5C, 0x31, 0x54, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xFF, 0xEC, 0x1D, 0x8E, 0xE8, 0xDF, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x11, 0x5F, 0x27, 0x88, 0x0D, 0x2E, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xAF, 0xD4, 0x7F, 0xFF, 0x8C, 0x14, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x89, 0x2F, 0x91, 0x8A, 0x18, 0xB1, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x5C, 0xA5, 0x09, 0x40, 0xD6, 0x22, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xBE, 0x6A, 0xC5, 0x45, 0x99, 0x39, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x05, 0xA0, 0xB5, 0x35, 0x3E, 0x0E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x43, 0x31, 0x6F, 0x1C, 0x5F, 0xFB, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x98, 0x75, 0x9F, 0x91, 0xC1, 0xA5, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x3E, 0x34, 0x98, 0x36, 0xBD, 0x38, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xD5, 0x65, 0xA7, 0x03, 0x2F, 0xCF, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x1B, 0x12, 0x80, 0x6E, 0x7C, 0x81, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x36, 0xF3, 0x3E, 0x3A, 0xFD, 0x64, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xFE, 0x9F, 0xAA, 0x45, 0xCC, 0xE6, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x73, 0x1A, 0x19, 0x86, 0x0A, 0x49, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xD0, 0x8D, 0xA9, 0xCB, 0xE5, 0x6E, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x96, 0xB0, 0x51, 0xED, 0xC4, 0xDE, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xDA, 0xB3, 0xA9, 0xC6, 0xE8, 0x93, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x16, 0x49, 0x35, 0x1B, 0x3A, 0x67, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x87, 0x66, 0x0F, 0x20, 0x65, 0x97, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x16, 0xEB, 0x91, 0xA6, 0x90, 0x87, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x62, 0x0A, 0x21, 0xFA, 0xE2, 0xBE, 0x83 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_6[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xE2, 0x6B, 0x8D, 0xE4, 0x50, 0x4E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xDA, 0xC6, 0x46, 0x39, 0x11, 0x73, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x5A, 0x5C, 0xCE, 0xBE, 0x2E, 0xE8, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xA3, 0x2C, 0xD8, 0x8D, 0x58, 0xD3, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xC4, 0x9C, 0xB3, 0xF6, 0xD4, 0x94, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x0D, 0xF7, 0x2F, 0xFC, 0xE7, 0x93, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x50, 0xBB, 0x8D, 0xEB, 0x73, 0xD5, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x6B, 0x3A, 0x78, 0x5B, 0x0E, 0x69, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x5C, 0xC6, 0xE3, 0x12, 0x22, 0x18, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x37, 0x1B, 0xF6, 0x37, 0x1D, 0x1D, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x86, 0x8C, 0xD0, 0xA9, 0x2E, 0x1B, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x7F, 0x92, 0xF4, 0x3E, 0x0A, 0x78, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xE0, 0x78, 0x3E, 0xCC, 0x41, 0xD8, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x77, 0xD9, 0xF8, 0xB8, 0xC5, 0x1E, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x99, 0x49, 0xBB, 0xF6, 0x01, 0x85, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x2F, 0x49, 0xE0, 0xFE, 0x59, 0x2A, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xCD, 0x1E, 0x50, 0x3F, 0x5A, 0x08, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x25, 0xFD, 0x37, 0x81, 0xC3, 0xC2, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x78, 0x75, 0x12, 0x50, 0x97, 0x2A, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x80, 0x00, 0x9A, 0x2E, 0x17, 0x86, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x8A, 0x08, 0xA4, 0xB7, 0x1E, 0xD7, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x65, 0x7F, 0xB6, 0x2F, 0x2E, 0xA9, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xA8, 0x6D, 0x13, 0x6F, 0x32, 0xA0, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x3E, 0x74, 0x3E, 0x02, 0xE0, 0x60, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x0F, 0x71, 0x3B, 0x0F, 0x97, 0xAE, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x62, 0xA2, 0x23, 0xEF, 0xB4, 0x6E, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xCA, 0xEC, 0xC2, 0xDD, 0x45, 0xEB, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xA8, 0x46, 0x77, 0xD6, 0x19, 0x45, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xF5, 0x0A, 0x32, 0x5C, 0x69, 0xF2, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xEB, 0x7E, 0x98, 0x1C, 0x14, 0xBA, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x34, 0xDC, 0xD6, 0xA3, 0xCE, 0x1B, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xD5, 0xA9, 0x59, 0xA3, 0x5D, 0x0D, 0x0A ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_7[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xC5, 0xD7, 0x1A, 0xC9, 0xA1, 0x9C, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xB5, 0x8D, 0x8D, 0x72, 0x22, 0xE6, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xB4, 0xB8, 0x9C, 0x7D, 0x5D, 0xD0, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x46, 0x59, 0xB0, 0x1B, 0xB1, 0xA6, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x89, 0x39, 0x67, 0xED, 0xA9, 0x29, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x1A, 0xEE, 0x5F, 0xF8, 0xCF, 0x27, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xA1, 0x76, 0x1B, 0xD7, 0xE7, 0xAA, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xD6, 0x74, 0xF0, 0xB6, 0x1C, 0xD2, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xB9, 0x8C, 0xC7, 0x25, 0x44, 0x30, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x6F, 0x36, 0xEC, 0x6F, 0x3A, 0x3A, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x0C, 0x19, 0xA1, 0x53, 0x5D, 0x36, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xFE, 0x24, 0xE9, 0x7D, 0x14, 0xF0, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xC0, 0xF1, 0x7C, 0x98, 0x83, 0xB0, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xEE, 0xB2, 0xF1, 0x71, 0x8B, 0x3D, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x33, 0x93, 0x76, 0xED, 0x03, 0x0A, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x5E, 0x92, 0xC0, 0xFD, 0xB3, 0x54, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x9B, 0x3D, 0xA0, 0x7E, 0xB4, 0x10, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x4B, 0xFA, 0x6F, 0x02, 0x87, 0x85, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xF0, 0xEA, 0x24, 0xA0, 0x2E, 0x55, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x00, 0x01, 0x34, 0x5D, 0x2E, 0x0C, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x14, 0x11, 0x48, 0x6F, 0x3D, 0xAE, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xCB, 0xFE, 0x6C, 0x5F, 0x5C, 0x52, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x50, 0xDB, 0x26, 0xDE, 0x64, 0x40, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x7D, 0xE8, 0x7C, 0x04, 0xC0, 0xC1, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x1F, 0xE2, 0x76, 0x1E, 0x2E, 0x5D, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xC4, 0x44, 0x47, 0xDE, 0x69, 0xDD, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x95, 0xD9, 0x85, 0xBB, 0x8B, 0xD6, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x50, 0x8D, 0xEE, 0xAC, 0x33, 0x8A, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xEA, 0x15, 0x64, 0xB8, 0xD2, 0xE4, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xD7, 0xFD, 0x30, 0x39, 0x28, 0x74, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x69, 0xB8, 0xAD, 0x47, 0x9D, 0x37, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xAB, 0x53, 0xB3, 0x46, 0xBB, 0x1A, 0x14 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_8[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x8E, 0x98, 0xF3, 0x7B, 0x06, 0x8A, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xCE, 0xF4, 0xDD, 0xCD, 0x3D, 0xA7, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x7F, 0xA6, 0xAB, 0xE0, 0x11, 0x9D, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xF3, 0x96, 0xE6, 0x75, 0x3D, 0x07, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x86, 0xDF, 0x14, 0xF8, 0x6B, 0x06, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xC9, 0xD6, 0xD4, 0x19, 0x2F, 0xAA, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x0A, 0x91, 0x8E, 0x1C, 0xBB, 0xB0, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x00, 0xF2, 0x17, 0xDB, 0xA6, 0x34, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xC7, 0xE2, 0x81, 0xB6, 0xE4, 0xE5, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x51, 0xB2, 0x15, 0xE2, 0x06, 0xA3, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xBF, 0x0C, 0x87, 0xA0, 0xB1, 0xB3, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xB2, 0x31, 0xF9, 0xD1, 0xFF, 0x42, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xFA, 0xD2, 0x3E, 0x28, 0x5F, 0x4D, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x3D, 0x37, 0x16, 0x2E, 0xB2, 0x72, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xDB, 0x8A, 0xA0, 0x31, 0x8B, 0x06, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x8F, 0x79, 0x22, 0x97, 0x3E, 0xC6, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x4D, 0xE6, 0x83, 0x89, 0xFF, 0x60, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x71, 0x22, 0xD8, 0xEF, 0x4A, 0xEF, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x7B, 0x50, 0xBC, 0x44, 0x0F, 0x0B, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x56, 0x04, 0xA1, 0x19, 0x06, 0xCA, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x69, 0x6B, 0x6D, 0x52, 0xF4, 0x28, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xF7, 0x4C, 0xA1, 0x9B, 0xA1, 0xAA, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xEE, 0xC1, 0xC7, 0xF2, 0x77, 0xE4, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x89, 0x79, 0x2F, 0xBB, 0x9B, 0xFD, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xB1, 0x8A, 0x82, 0x67, 0x4F, 0xC6, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xD4, 0x3E, 0xDF, 0x35, 0xA0, 0xC8, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x87, 0xD5, 0x88, 0x04, 0x56, 0x1D, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xD0, 0x77, 0x2A, 0x69, 0x97, 0x31, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x3E, 0x09, 0x14, 0x4C, 0xE1, 0x41, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xCE, 0x41, 0xE7, 0x07, 0x13, 0x4D, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x06, 0xB7, 0x65, 0x0A, 0x77, 0x02, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xB4, 0xE9, 0x55, 0x03, 0x76, 0xEA, 0xB7 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_9[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1C, 0x31, 0xE7, 0xF7, 0x0C, 0x14, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x3F, 0xC1, 0x5A, 0x63, 0x39, 0xE3, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x0E, 0x9A, 0x95, 0x9A, 0xD9, 0x46, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x63, 0x17, 0x50, 0x68, 0x89, 0x7F, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xEC, 0xFC, 0xFA, 0x33, 0xDB, 0x56, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xE6, 0x3D, 0x5D, 0x18, 0x23, 0x56, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x94, 0x2F, 0x2E, 0x06, 0x64, 0x12, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x7C, 0x5E, 0x46, 0x19, 0x4F, 0xF6, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x60, 0x91, 0xDB, 0x9F, 0xC4, 0x97, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xC0, 0x6C, 0x5D, 0xE2, 0x10, 0x43, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x12, 0x0F, 0x20, 0x78, 0xBB, 0x5F, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA9, 0xF0, 0x8E, 0xBC, 0x11, 0x2F, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xA6, 0x6C, 0x9F, 0xAC, 0x7B, 0x4B, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x85, 0x96, 0xCB, 0xA4, 0x89, 0x7A, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xD2, 0x4C, 0x8E, 0x17, 0x6D, 0x04, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x23, 0xCE, 0x91, 0xAB, 0xCB, 0x81, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x21, 0x92, 0xBF, 0xC3, 0x34, 0x15, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xFC, 0x96, 0x79, 0x3E, 0x3D, 0xED, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x0F, 0xB1, 0x84, 0xAE, 0x94, 0x6F, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x22, 0x22, 0x61, 0xC2, 0xFF, 0x44, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x08, 0x7F, 0x5B, 0x46, 0xD5, 0xFA, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xD3, 0xAC, 0x04, 0xE2, 0xDD, 0xF1, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x6D, 0x7D, 0x30, 0xC6, 0xFA, 0x94, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xAD, 0xF5, 0x88, 0xA0, 0x18, 0x1C, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x02, 0x51, 0x56, 0xCC, 0xEC, 0x0A, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x32, 0x71, 0x5B, 0x08, 0x5D, 0x61, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xCF, 0x0F, 0xED, 0x3A, 0x0E, 0xA7, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x6C, 0x8B, 0x40, 0x91, 0xF8, 0x81, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x46, 0xE5, 0x59, 0x14, 0xFD, 0xC9, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x5F, 0x46, 0xA7, 0xEF, 0xCF, 0xBD, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xC1, 0xB2, 0x28, 0xBC, 0x99, 0x0C, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x69, 0xD3, 0xAB, 0x06, 0xEC, 0xD4, 0x6F ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_10[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xE6, 0x71, 0x33, 0xED, 0xEB, 0xC8, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x15, 0xC6, 0xDE, 0x7C, 0x94, 0xB7, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x80, 0xFB, 0xB4, 0x1C, 0xD7, 0x53, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x42, 0x31, 0xBA, 0x75, 0x88, 0x6B, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x2F, 0x62, 0xFF, 0xC9, 0x09, 0x00, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x94, 0x04, 0x33, 0x54, 0x4F, 0x84, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x70, 0x88, 0xDE, 0x49, 0x5C, 0x1F, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x84, 0x69, 0xE7, 0x90, 0x95, 0xAD, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xE8, 0xBD, 0x12, 0xF9, 0x1A, 0xEE, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x3D, 0xF2, 0xB8, 0x74, 0xDD, 0x49, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x84, 0x4A, 0xF2, 0x2A, 0x83, 0x65, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x65, 0xF1, 0xCF, 0x7D, 0xF8, 0xC7, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xD7, 0x07, 0x0C, 0xDE, 0x89, 0x98, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xCA, 0x3B, 0x49, 0xF1, 0xD0, 0xAB, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x77, 0x14, 0x0C, 0x43, 0x82, 0x1A, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x49, 0x2C, 0x52, 0x19, 0x12, 0x9D, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xB3, 0x19, 0x92, 0x48, 0x24, 0xC9, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x66, 0x57, 0xA8, 0xA7, 0xDA, 0xE1, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x78, 0x28, 0x7F, 0x5B, 0x27, 0x43, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xB7, 0x89, 0xAE, 0x3A, 0x98, 0x70, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x35, 0x82, 0x34, 0xF3, 0x98, 0xFE, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x95, 0x0B, 0xF4, 0x08, 0x7C, 0x87, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xEC, 0x57, 0xCB, 0xA2, 0x7A, 0xA6, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xB4, 0x05, 0x1B, 0x9D, 0x70, 0xE3, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x95, 0xE1, 0x33, 0x99, 0x09, 0xF1, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x54, 0x95, 0x4B, 0xB6, 0x85, 0x35, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB1, 0x43, 0x2A, 0x5F, 0xEB, 0xF5, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x81, 0xD9, 0x4D, 0x7F, 0x26, 0xB1, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x9E, 0x31, 0xDE, 0xF8, 0xF8, 0x85, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x9C, 0xFF, 0x44, 0x77, 0xFD, 0x27, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x62, 0xE4, 0x0C, 0x6D, 0xDF, 0xB8, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x5E, 0xF5, 0xBC, 0xF1, 0x7C, 0x4B, 0x04 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_11[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xCD, 0xE3, 0x66, 0xDA, 0xD7, 0x91, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x2A, 0x8C, 0xBD, 0xF9, 0x28, 0x6F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x01, 0xF7, 0x69, 0x39, 0xAE, 0xA7, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x85, 0x62, 0x74, 0xEB, 0x10, 0xD7, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x5E, 0xC4, 0xFE, 0x93, 0x13, 0x00, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x29, 0x09, 0x66, 0xA8, 0x9E, 0x08, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xE0, 0x10, 0xBD, 0x93, 0xB8, 0x3E, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x08, 0xD3, 0xCE, 0x21, 0x2B, 0x5B, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xD1, 0x7B, 0x25, 0xF2, 0x35, 0xDC, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x7B, 0xE4, 0x71, 0xE9, 0xBA, 0x93, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x08, 0x95, 0xE4, 0x55, 0x06, 0xCB, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xCA, 0xE2, 0x9F, 0xFB, 0xF0, 0x8F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xAF, 0x0F, 0x18, 0xBC, 0x13, 0x31, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x94, 0x77, 0x92, 0xE2, 0xA1, 0x57, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xEF, 0x28, 0x18, 0x86, 0x04, 0x35, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x92, 0x58, 0xA4, 0x32, 0x24, 0x3A, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x67, 0x33, 0x24, 0x91, 0x48, 0x92, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xCC, 0xAE, 0x50, 0x4F, 0xB5, 0xC3, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xF1, 0x50, 0xFE, 0xB6, 0x4E, 0x86, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x6F, 0x13, 0x5D, 0x75, 0x30, 0xE1, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x6B, 0x04, 0x69, 0xE6, 0x31, 0xFD, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x2B, 0x17, 0xE8, 0x11, 0xF8, 0x0E, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xD9, 0xAF, 0x96, 0x45, 0xF5, 0x4C, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x69, 0x0B, 0x36, 0x3A, 0xE1, 0xC6, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x2A, 0xC3, 0x67, 0x32, 0x13, 0xE2, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xA8, 0x2A, 0x97, 0x6C, 0x0B, 0x6B, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x63, 0x87, 0x54, 0xBE, 0xD6, 0xEB, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x02, 0xB3, 0x9B, 0xFE, 0x4C, 0x62, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x3C, 0x63, 0xBC, 0xF1, 0xF1, 0x0B, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x39, 0xFF, 0x89, 0xEE, 0xFA, 0x4F, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xC5, 0xC8, 0x19, 0xDA, 0xBE, 0x71, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xBC, 0xEA, 0x79, 0xE3, 0xF9, 0x96, 0x08 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_12[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x0E, 0xC2, 0x05, 0x25, 0x9D, 0x31, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xD2, 0x7F, 0xB8, 0x5C, 0x2F, 0x3E, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x83, 0xA6, 0x6E, 0xA1, 0xD3, 0x94, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xED, 0xE4, 0xBE, 0x0E, 0x9C, 0x9A, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x23, 0x82, 0x6F, 0xA8, 0x71, 0x4C, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xC2, 0x4C, 0xC9, 0xCF, 0xE4, 0x13, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xC6, 0x76, 0xAF, 0xCF, 0xF1, 0x48, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x01, 0x00, 0x9C, 0xC3, 0x97, 0xEB, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x91, 0x39, 0x6D, 0x1A, 0x53, 0x53, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x83, 0xDC, 0x19, 0x6A, 0x49, 0x8F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xEC, 0xA2, 0xDE, 0xF6, 0xE6, 0x3C, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xE7, 0xCE, 0x73, 0x78, 0x1B, 0xD3, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x32, 0x62, 0xDD, 0x81, 0x33, 0x8E, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xA4, 0x3C, 0xF1, 0xC3, 0xAB, 0x36, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xBE, 0xC8, 0xBF, 0xD6, 0x91, 0x70, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x21, 0xC5, 0xA2, 0x82, 0xC1, 0xC3, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x09, 0x61, 0xE7, 0x3B, 0x69, 0x2E, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xA1, 0x8A, 0x53, 0x44, 0xF3, 0x2B, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xE9, 0x62, 0x02, 0xCA, 0xD1, 0xB3, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xEF, 0xC7, 0x14, 0x83, 0x68, 0x10, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xF8, 0x95, 0x27, 0xB7, 0xEE, 0x37, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x1F, 0xD6, 0xDE, 0xA2, 0x05, 0xEA, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x20, 0x23, 0x78, 0x5D, 0xC0, 0xAE, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x2B, 0xD8, 0xED, 0x8F, 0x6A, 0xED, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x3A, 0x44, 0x72, 0x8C, 0xF1, 0x33, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x2A, 0x08, 0xB1, 0x98, 0xFC, 0x75, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x0B, 0xCF, 0x9D, 0xBD, 0x64, 0xD9, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xAB, 0xC1, 0x4B, 0x8F, 0x32, 0x69, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x70, 0x78, 0x69, 0xBA, 0x9D, 0x14, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x83, 0xCC, 0x4E, 0x6A, 0x62, 0x9B, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x70, 0x61, 0x1C, 0x55, 0x62, 0xBF, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x86, 0xC6, 0xB2, 0x9B, 0x43, 0xB7, 0xF1 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_13[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x1D, 0x84, 0x0B, 0x4A, 0x3A, 0x63, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x48, 0xD7, 0x0F, 0x81, 0x1C, 0x11, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x17, 0x9A, 0x1B, 0x1C, 0x5D, 0x36, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x56, 0xB3, 0x00, 0x9A, 0x46, 0xA6, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x26, 0x42, 0xB0, 0x94, 0xE6, 0xE2, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xD7, 0x29, 0x46, 0x84, 0x8E, 0x29, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x0C, 0xFB, 0x6F, 0x6C, 0xD1, 0x42, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x7F, 0x7A, 0x4E, 0xEA, 0x30, 0x64, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xF4, 0x3E, 0xB2, 0x67, 0xA1, 0x72, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x24, 0xC1, 0x65, 0xF2, 0x95, 0x1B, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x6B, 0x3B, 0xCF, 0x24, 0x26, 0x72, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x14, 0x2B, 0x84, 0x09, 0x49, 0x4F, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x16, 0x8B, 0xDC, 0x5F, 0x24, 0xCD, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x55, 0xA1, 0x81, 0xD0, 0x7C, 0x02, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x99, 0xC8, 0xCC, 0x61, 0x7A, 0xD8, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x48, 0x65, 0x92, 0x82, 0xD1, 0x7C, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x99, 0x87, 0x86, 0x28, 0x08, 0xB0, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x5B, 0x67, 0x70, 0xE7, 0x8D, 0x66, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xEB, 0xD5, 0x10, 0xB9, 0x19, 0xC1, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x54, 0xA9, 0x48, 0x95, 0xC4, 0xD1, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x27, 0xD4, 0xCF, 0x0F, 0xCA, 0x18, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x23, 0xBF, 0x7F, 0xF0, 0xA5, 0x70, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xD2, 0x3F, 0x91, 0x9B, 0x8B, 0x29, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xF1, 0xB2, 0x05, 0x4A, 0xB6, 0xFB, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x14, 0xC4, 0x35, 0x16, 0x31, 0xE6, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xDE, 0x03, 0xFF, 0xCD, 0x15, 0xBC, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xD7, 0x02, 0x17, 0xAD, 0x2B, 0x1F, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x22, 0x1F, 0x83, 0xDD, 0x2E, 0xF1, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xAA, 0xC3, 0x04, 0xF1, 0x75, 0x6F, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xCA, 0x5B, 0x76, 0xB4, 0x6E, 0x5A, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x96, 0x07, 0x96, 0x51, 0x70, 0x86, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x0C, 0x8D, 0x65, 0x37, 0x87, 0x6E, 0xE3 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_14[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x7D, 0x2B, 0xED, 0x93, 0xFD, 0xA1, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x8A, 0x9E, 0x46, 0xB0, 0xA2, 0xDE, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xCC, 0x06, 0x5D, 0x5F, 0xAD, 0x84, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x47, 0x05, 0xA5, 0x97, 0xEA, 0xDB, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xA6, 0x4B, 0xF1, 0x14, 0x53, 0x58, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x26, 0xAB, 0x61, 0x13, 0xE4, 0x6B, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x47, 0xD9, 0xC8, 0x62, 0x35, 0x94, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x78, 0x5A, 0xEF, 0x6D, 0xA5, 0xCD, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xC2, 0x47, 0x86, 0xAE, 0x33, 0x53, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x7A, 0x9F, 0xB9, 0x5D, 0xEB, 0x30, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x3A, 0x46, 0xDB, 0x26, 0x79, 0xBA, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x74, 0x56, 0x92, 0x7B, 0x7C, 0x58, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xCA, 0x21, 0x12, 0x18, 0xF6, 0x9B, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x81, 0x88, 0xBB, 0xBA, 0x09, 0xE5, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xCF, 0x1E, 0x54, 0x0F, 0xB3, 0xAA, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x5F, 0x85, 0xA1, 0xFD, 0x6B, 0xAB, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x7E, 0x52, 0x6E, 0x0C, 0x9B, 0xA0, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x0D, 0xAD, 0x1C, 0x7C, 0x2B, 0xC5, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xE3, 0xE4, 0xAD, 0x64, 0x87, 0x08, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xF3, 0xE3, 0x45, 0x9A, 0x53, 0xE1, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xF6, 0x45, 0x3E, 0x6A, 0xC2, 0x8B, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x65, 0x8C, 0xE9, 0xAB, 0xFC, 0x12, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xD5, 0xB5, 0x8E, 0x8E, 0x04, 0x63, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x11, 0xBB, 0x0D, 0x21, 0xB8, 0xE1, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x1A, 0xCC, 0xAD, 0xA1, 0xEE, 0x76, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xAF, 0xF5, 0xAB, 0x0C, 0x96, 0xBD, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x2C, 0x43, 0x1D, 0x6D, 0xE0, 0x89, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x51, 0x04, 0xE0, 0xCC, 0xF1, 0xF1, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xAD, 0x78, 0xB7, 0xD3, 0x91, 0x87, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xA8, 0xF9, 0x59, 0x32, 0xAF, 0x1C, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xC3, 0x44, 0xA7, 0xC1, 0xD7, 0x57, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x0C, 0xFA, 0x60, 0xE3, 0x56, 0xB9, 0xA1 ),
+};
+static const mbedtls_mpi_uint ffdhe2048_T_15[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xFA, 0x56, 0xDA, 0x27, 0xFB, 0x43, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xB9, 0x14, 0x2C, 0x28, 0x03, 0x52, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xA9, 0x5A, 0xF8, 0x97, 0x10, 0x16, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x0B, 0xF4, 0xCC, 0xAB, 0xE3, 0x28, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x2D, 0xD5, 0xB3, 0x6D, 0xA9, 0xFA, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x9E, 0xE6, 0x76, 0x0B, 0x8D, 0xD9, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x0D, 0xC0, 0xA2, 0x92, 0x58, 0xD9, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x6D, 0x2F, 0xF5, 0x3E, 0x4C, 0x28, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x56, 0x5B, 0xE4, 0x8F, 0x62, 0x72, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x12, 0x47, 0xA5, 0xD9, 0xD9, 0x5E, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x06, 0x82, 0xC8, 0x84, 0x4A, 0x6D, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x2C, 0x3A, 0xC1, 0x0F, 0x0B, 0x5A, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x47, 0x0A, 0x46, 0x8C, 0xA9, 0xE8, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x0D, 0x39, 0x16, 0xBE, 0x38, 0x5F, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xBB, 0x74, 0xF5, 0xD2, 0xBC, 0x4C, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xC4, 0xE5, 0x8F, 0x78, 0x26, 0x4C, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x82, 0x6A, 0x94, 0xC9, 0x6B, 0x94, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x34, 0xAC, 0x02, 0x57, 0xFE, 0x98, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xDD, 0xD9, 0x67, 0xEE, 0x84, 0x6A, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x5A, 0xE1, 0xAA, 0xC3, 0x9A, 0x73, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x23, 0x34, 0xFD, 0x75, 0x71, 0xC0, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xB0, 0x2B, 0x95, 0x02, 0x94, 0xC2, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x3C, 0x65, 0xBE, 0xFD, 0x13, 0x92, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xBC, 0x78, 0x45, 0x6C, 0x51, 0xE4, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xD3, 0xD3, 0xAC, 0x40, 0x2B, 0x6C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xE8, 0xDE, 0xF4, 0xB5, 0x48, 0x4B, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x1A, 0xEB, 0x15, 0x0C, 0x23, 0x80, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x6E, 0xA4, 0xAB, 0x58, 0xAD, 0x02, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x24, 0xC4, 0xA0, 0x23, 0x5E, 0x55, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x14, 0xB6, 0x8C, 0x44, 0x08, 0x5D, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x3B, 0xCE, 0xAB, 0x2A, 0x5B, 0xB7, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x18, 0xF4, 0xC1, 0xC6, 0xAD, 0x72, 0x43 ),
+};
+static const mbedtls_mpi ffdhe2048_P = DHM_MPI_INIT_ARRAY( ffdhe2048_p );
+static const mbedtls_mpi ffdhe2048_T[15] = {
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_1 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_2 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_3 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_4 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_5 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_6 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_7 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_8 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_9 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_10 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_11 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_12 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_13 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_14 ),
+    DHM_MPI_INIT_ARRAY( ffdhe2048_T_15 ),
+};
+
+static const mbedtls_mpi_uint ffdhe3072_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x2E, 0xC6, 0x66, 0x2B, 0x1D, 0xE4, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9D, 0xD5, 0x3F, 0xEE, 0x20, 0x1B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xDD, 0x53, 0xFA, 0x6B, 0xD0, 0xBC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x48, 0xC4, 0xD5, 0x42, 0x9A, 0xBF, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xEA, 0x0D, 0x9B, 0x97, 0x21, 0xC5, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x3A, 0x36, 0x22, 0xC5, 0x2B, 0x6D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF6, 0x9D, 0x9C, 0xAB, 0x82, 0xAE, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x4B, 0xF5, 0x71, 0x1E, 0xE2, 0xF2, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4D, 0xD7, 0xE2, 0x52, 0x44, 0xFD, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x79, 0x43, 0xBC, 0x93, 0x0C, 0x13, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x92, 0x13, 0x85, 0x09, 0x13, 0xFE, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xD9, 0x86, 0xC1, 0xFA, 0xB0, 0x8C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xF7, 0x91, 0x26, 0x1D, 0xD9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xC9, 0xE6, 0xD6, 0xC9, 0x6F, 0xB4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x02, 0x9C, 0xF9, 0xDE, 0xF4, 0x34, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x03, 0x19, 0x65, 0x3B, 0x5B, 0x35, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xCF, 0x1F, 0x61, 0x38, 0x42, 0x6B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xB4, 0x43, 0x9C, 0xB9, 0x64, 0x96, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x2A, 0x24, 0x80, 0x12, 0xEB, 0x5D, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xB2, 0xBA, 0x7F, 0x36, 0x72, 0x7F, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x61, 0x23, 0x59, 0xB5, 0x1A, 0xCE, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xB2, 0x4C, 0x82, 0xB7, 0x3C, 0x7D, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x94, 0x7D, 0xF8, 0xBD, 0x7B, 0xFA, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xB3, 0x6E, 0x9B, 0xAA, 0xAD, 0xDE, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x81, 0x46, 0x14, 0x53, 0x0D, 0xC2, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xAF, 0xBB, 0xF0, 0x57, 0x9D, 0xC5, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xA4, 0xB7, 0x24, 0xBE, 0x40, 0xF8, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x3F, 0xA5, 0xC7, 0x00, 0xF6, 0x7A, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xB9, 0x9E, 0x51, 0xAC, 0xA1, 0x5E, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xEB, 0x97, 0x91, 0x01, 0x00, 0x2D, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x28, 0x49, 0xFE, 0xF4, 0xAC, 0x81, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x6E, 0x60, 0xB3, 0xD1, 0x84, 0x5A, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x95, 0xE9, 0x2D, 0x12, 0xE9, 0x38, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x2C, 0x1C, 0x99, 0x14, 0x8F, 0xD4, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xEE, 0x06, 0x4A, 0xEC, 0x61, 0xE6, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x2D, 0x1A, 0x88, 0x70, 0x7B, 0x48, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x5C, 0xCD, 0x69, 0x0D, 0x4B, 0x91, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xBB, 0xF7, 0x60, 0x00, 0xCE, 0x38, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x18, 0xB7, 0x9C, 0x0B, 0x15, 0x42, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x16, 0x44, 0x70, 0xA3, 0xB5, 0x56, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x1B, 0x82, 0x21, 0x5D, 0xA3, 0x77, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x6A, 0x59, 0xB6, 0x89, 0xC4, 0x77, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xCA, 0x62, 0x53, 0x74, 0x49, 0x67, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xC2, 0xD1, 0xB6, 0x81, 0xDD, 0xD0, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x48, 0x9C, 0xE4, 0xA4, 0xD3, 0xEF, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x8A, 0xF3, 0x08, 0x27, 0x37, 0xB9, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x89, 0xFD, 0x45, 0xA2, 0x72, 0x30, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xCB, 0x2D, 0x2E, 0x78, 0x62, 0xC7, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x40, 0xE2, 0x69, 0x40, 0x6D, 0x72, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x9F, 0xA3, 0xFD, 0xE6, 0xB8, 0x6D, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x2E, 0x72, 0xD7, 0xC7, 0xB2, 0x0E, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x4E, 0x68, 0x9E, 0xED, 0x35, 0x6D, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xAF, 0x7B, 0xB4, 0x2E, 0x8B, 0x0A, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x8F, 0x50, 0xB8, 0x42, 0x9A, 0x66, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x9E, 0xD7, 0xA5, 0x27, 0x83, 0x16, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x7C, 0x13, 0xAB, 0x51, 0x1D, 0x2B, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x10, 0xF7, 0x74, 0xB8, 0x80, 0x5C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xD0, 0x3A, 0x06, 0x69, 0x05, 0xB7, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x4E, 0xD3, 0x14, 0xBC, 0xFA, 0xED, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x24, 0x55, 0x45, 0x88, 0x3A, 0x57, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xFA, 0x23, 0x0D, 0x93, 0x1D, 0xA7, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x76, 0x8B, 0xA7, 0x37, 0x04, 0x08, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x9C, 0xC0, 0x34, 0x51, 0x98, 0x74, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x23, 0x1F, 0xE8, 0xC3, 0x7A, 0xF9, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x96, 0x7A, 0xAC, 0x03, 0x17, 0x03, 0x4E ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_3[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x69, 0x87, 0x38, 0x73, 0xC9, 0x2C, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x55, 0x48, 0x00, 0x25, 0xD6, 0xBB, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x65, 0x75, 0xFF, 0x6C, 0xE4, 0xFE, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xC2, 0x46, 0xB2, 0x6A, 0x35, 0x9C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x64, 0x99, 0x04, 0x6F, 0x79, 0xFA, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x29, 0xFB, 0xF0, 0x7B, 0xF7, 0xF4, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x66, 0xDD, 0x36, 0x55, 0x5B, 0xBD, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x03, 0x8D, 0x28, 0xA6, 0x1A, 0x84, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x5E, 0x77, 0xE1, 0xAF, 0x3A, 0x8B, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x48, 0x6F, 0x49, 0x7C, 0x81, 0xF0, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x7F, 0x4A, 0x8F, 0x01, 0xEC, 0xF5, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x73, 0x3D, 0xA3, 0x58, 0x43, 0xBD, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xD6, 0x2F, 0x23, 0x03, 0x00, 0x5A, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x50, 0x92, 0xFC, 0xE9, 0x59, 0x03, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xDC, 0xC0, 0x66, 0xA3, 0x09, 0xB5, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x2A, 0xD3, 0x5B, 0x24, 0xD2, 0x71, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x59, 0x38, 0x32, 0x29, 0x1E, 0xA9, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xDC, 0x0D, 0x94, 0xD8, 0xC3, 0xCC, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x5B, 0x34, 0x10, 0xE1, 0xF6, 0x90, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xB8, 0x9A, 0xD3, 0x1A, 0x96, 0x22, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x76, 0xEF, 0xC1, 0x00, 0x9C, 0x71, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x31, 0x6E, 0x39, 0x17, 0x2A, 0x84, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x2D, 0x88, 0xE0, 0x46, 0x6B, 0xAD, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x36, 0x04, 0x43, 0xBA, 0x46, 0xEF, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xD4, 0xB2, 0x6C, 0x13, 0x89, 0xEF, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x94, 0xC5, 0xA6, 0xE8, 0x92, 0xCE, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x85, 0xA3, 0x6D, 0x03, 0xBB, 0xA1, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x90, 0x38, 0xC9, 0x49, 0xA7, 0xDF, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x15, 0xE7, 0x11, 0x4E, 0x6E, 0x72, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x13, 0xFB, 0x8B, 0x44, 0xE5, 0x60, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x96, 0x5B, 0x5C, 0xF0, 0xC4, 0x8E, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x80, 0xC4, 0xD3, 0x80, 0xDA, 0xE4, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x3F, 0x47, 0xFB, 0xCD, 0x71, 0xDB, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x5C, 0xE4, 0xAE, 0x8F, 0x65, 0x1D, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x9D, 0xD0, 0x3C, 0xDB, 0x6B, 0xDA, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x5E, 0xF7, 0x68, 0x5D, 0x16, 0x15, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x1E, 0xA1, 0x70, 0x85, 0x34, 0xCD, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x3C, 0xAF, 0x4B, 0x4F, 0x06, 0x2D, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF8, 0x26, 0x56, 0xA3, 0x3A, 0x56, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x21, 0xEE, 0xE9, 0x70, 0x01, 0xB9, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xA0, 0x75, 0x0C, 0xD2, 0x0A, 0x6E, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x9D, 0xA6, 0x29, 0x78, 0xF5, 0xDB, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x49, 0xAA, 0x8A, 0x10, 0x75, 0xAE, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xF4, 0x47, 0x1A, 0x26, 0x3B, 0x4E, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xED, 0x16, 0x4F, 0x6F, 0x08, 0x10, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x38, 0x81, 0x69, 0xA2, 0x30, 0xE9, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x47, 0x3E, 0xD0, 0x87, 0xF5, 0xF2, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x2D, 0xF5, 0x58, 0x07, 0x2E, 0x06, 0x9C ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_4[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xB1, 0xB9, 0x2C, 0x86, 0x90, 0x7D, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x0D, 0x56, 0x71, 0xF0, 0x9E, 0x77, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xE4, 0x20, 0x90, 0x0D, 0x74, 0x36, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xD6, 0xF2, 0x32, 0x73, 0xB2, 0x4C, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xB0, 0x85, 0xD3, 0x05, 0x00, 0xF6, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0xE0, 0x0D, 0xA3, 0x10, 0xA3, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x16, 0x94, 0x52, 0x76, 0xCA, 0x5D, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x4B, 0xCA, 0xBA, 0x01, 0xD6, 0x5A, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x4D, 0x7C, 0x3D, 0x8C, 0xDF, 0x1E, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x63, 0xCC, 0x3A, 0x51, 0xB4, 0x40, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x4B, 0x0B, 0x6F, 0x7B, 0xDA, 0x84, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x12, 0x4C, 0x77, 0x17, 0x48, 0xB1, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x3D, 0xDA, 0x18, 0xAD, 0x6E, 0xB8, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xAE, 0xAD, 0xE3, 0xF9, 0x08, 0xA0, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x15, 0x93, 0x56, 0x4B, 0xD4, 0xF5, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xFE, 0x5C, 0x37, 0xEA, 0xE5, 0x64, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x92, 0xD9, 0x7A, 0xED, 0xD6, 0x37, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xA7, 0x10, 0xA9, 0x83, 0x62, 0xB2, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x5F, 0x20, 0xF3, 0x98, 0xBB, 0x64, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x98, 0x1A, 0x5C, 0x58, 0x62, 0x8D, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x07, 0x79, 0x70, 0xDF, 0x66, 0xDD, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x21, 0xA9, 0x25, 0xE1, 0x8F, 0x8A, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xFD, 0x18, 0x4A, 0x94, 0x35, 0xA5, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xE0, 0xE5, 0x51, 0x2E, 0x71, 0x8C, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x96, 0x9B, 0x14, 0x2B, 0x14, 0x39, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x8F, 0x57, 0xB5, 0xD2, 0x16, 0x3B, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x29, 0xE5, 0x86, 0x51, 0xF4, 0x56, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x3C, 0x51, 0x95, 0xC2, 0xAF, 0x2D, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xC5, 0x5E, 0x39, 0x4B, 0x89, 0xF2, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA1, 0x20, 0x08, 0x8D, 0x4D, 0x72, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x24, 0x14, 0x48, 0x04, 0x64, 0xFF, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x60, 0x34, 0xEF, 0x99, 0xAC, 0x2D, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xAF, 0x7D, 0xF8, 0x42, 0x0C, 0xB4, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xA8, 0xE0, 0x15, 0x88, 0x85, 0x02, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x5A, 0xDB, 0xC0, 0xC9, 0xFD, 0xA0, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x94, 0xD3, 0xA9, 0x98, 0x7C, 0xB0, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x41, 0x41, 0x33, 0x38, 0x28, 0xE2, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xE0, 0x16, 0x5E, 0x3B, 0x4E, 0xC9, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x1D, 0x59, 0x08, 0xA5, 0x2E, 0xCD, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x4E, 0xBB, 0x10, 0x53, 0xFF, 0x26, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x01, 0xE3, 0xA8, 0x3C, 0xCC, 0xDA, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x0E, 0xDA, 0x9F, 0x71, 0x88, 0x7C, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x0A, 0x4F, 0xF7, 0x62, 0xFF, 0xC9, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xF9, 0x32, 0x46, 0x42, 0xEA, 0xA0, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x60, 0x83, 0x13, 0x00, 0x2C, 0x36, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x24, 0x06, 0x0D, 0xCB, 0xE2, 0xBA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xD1, 0x57, 0xF8, 0x08, 0x49, 0x17, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x96, 0x5E, 0x55, 0x33, 0x3F, 0x52, 0xA5 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_5[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x63, 0x73, 0x59, 0x0C, 0x21, 0xFB, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xED, 0xE5, 0x7B, 0xB5, 0x20, 0x0B, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x2B, 0x6C, 0xE0, 0x2C, 0xC7, 0x51, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xCF, 0x91, 0x6B, 0x7A, 0x94, 0xDC, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x18, 0x47, 0xD1, 0xC8, 0x65, 0x2C, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x9D, 0xB2, 0x80, 0xAE, 0xFF, 0x80, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xF3, 0xF1, 0x82, 0x27, 0x69, 0x4E, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x9F, 0xF6, 0xD8, 0x57, 0x29, 0x07, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x4F, 0x03, 0x09, 0xFA, 0xDC, 0x4A, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x79, 0xC1, 0x92, 0x4F, 0x24, 0x84, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x1E, 0xD3, 0x21, 0x63, 0xA8, 0xF6, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x93, 0x84, 0x69, 0x25, 0x7D, 0x64, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xA1, 0x2D, 0x70, 0x5F, 0x2C, 0xE4, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x64, 0x63, 0x35, 0xCD, 0xF4, 0x66, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x61, 0x3F, 0xD6, 0xCC, 0x38, 0x37, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xFB, 0x1D, 0x75, 0xF5, 0xD6, 0x94, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x21, 0x9A, 0x90, 0x9F, 0x52, 0x3A, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x7F, 0x01, 0xF1, 0xCE, 0x82, 0xF9, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xCF, 0x8D, 0x24, 0x0B, 0x2D, 0xD6, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xAC, 0x1E, 0x3B, 0x2D, 0xD3, 0x8B, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xEE, 0x2F, 0xB2, 0x02, 0xD1, 0x04, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x94, 0xE2, 0xFE, 0xA6, 0xE4, 0x16, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x7A, 0x3F, 0xA5, 0xF5, 0x58, 0xFB, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x3D, 0x46, 0xBA, 0xBF, 0xE3, 0xA5, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xFE, 0x02, 0x01, 0x89, 0x23, 0x3E, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x3B, 0xB7, 0x9C, 0xC3, 0x30, 0x73, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xE5, 0xBF, 0x1F, 0xDA, 0x40, 0xA6, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xBD, 0x2F, 0xC7, 0x9D, 0x71, 0x04, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x3D, 0x84, 0x94, 0xF2, 0xCF, 0x95, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x4D, 0x69, 0xAF, 0x62, 0xC0, 0x79, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x64, 0x5F, 0xDD, 0xBC, 0x1E, 0xF6, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xC6, 0x43, 0x2B, 0xB1, 0xA7, 0x50, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xE5, 0xC0, 0xA8, 0x36, 0x4E, 0xBB, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x69, 0x13, 0xF5, 0x6E, 0xB2, 0x13, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xCD, 0xC6, 0x8D, 0xB8, 0x71, 0x9B, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x9E, 0xC0, 0x72, 0xC0, 0xEC, 0x11, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xB9, 0x2A, 0xE7, 0x11, 0x3D, 0x6D, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xA6, 0x40, 0x7E, 0x21, 0x37, 0x2F, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xCD, 0xAB, 0xB1, 0x2A, 0x68, 0x66, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x37, 0x79, 0x4B, 0xD0, 0xDF, 0x6E, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xA1, 0x01, 0xA3, 0x76, 0xE6, 0x33, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xA7, 0xA7, 0xDC, 0x7F, 0x2D, 0xC9, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xD6, 0x02, 0xCA, 0xF7, 0x60, 0x00, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xBF, 0x01, 0x78, 0x43, 0x9E, 0x60, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x8A, 0xD9, 0x58, 0x7C, 0x92, 0xB2, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x0B, 0xCF, 0xF2, 0x75, 0x6F, 0x99, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x58, 0xF4, 0x4D, 0xB9, 0x3D, 0x36, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x2D, 0xBD, 0xAA, 0x66, 0x7E, 0xA4, 0x4A ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_6[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xA0, 0x4E, 0x6D, 0x2C, 0xFE, 0xBE, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x8F, 0x30, 0xBA, 0x13, 0x67, 0x30, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x89, 0x11, 0x0A, 0x89, 0xD5, 0xA2, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x8A, 0x9D, 0x1A, 0xA9, 0xD1, 0x67, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x0B, 0x86, 0xFD, 0x1D, 0x71, 0xBB, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x84, 0xE3, 0xF2, 0x3A, 0x53, 0xF7, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x5A, 0xC1, 0xF2, 0xE9, 0x55, 0x33, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x12, 0x8A, 0x5E, 0x0C, 0x11, 0x9C, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x4F, 0xDD, 0x0D, 0x9F, 0x32, 0xDE, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x02, 0xAC, 0xED, 0x1E, 0x3B, 0x81, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xE7, 0xA7, 0x33, 0x02, 0xDB, 0x70, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x61, 0xBB, 0xB8, 0x40, 0x97, 0x7A, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x54, 0x8F, 0x9A, 0xBA, 0x3C, 0x42, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xCE, 0x08, 0x28, 0x04, 0xD9, 0xA2, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xAF, 0xA3, 0x0D, 0xF5, 0x22, 0x4B, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x51, 0x6B, 0xB1, 0x02, 0xBE, 0xCD, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x87, 0x7C, 0x7C, 0xA6, 0x08, 0xEC, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x8A, 0x84, 0x57, 0x90, 0xC4, 0xBD, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xE3, 0x66, 0x5C, 0x32, 0x1C, 0x8B, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x86, 0x4B, 0x59, 0x6C, 0xD1, 0xF5, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x55, 0x9F, 0x8E, 0xB1, 0x50, 0x08, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x03, 0x41, 0x47, 0x63, 0x04, 0x0B, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x50, 0x38, 0xFB, 0x7D, 0x06, 0x13, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x5E, 0xF1, 0xB8, 0x4C, 0x10, 0x59, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x9F, 0x53, 0x06, 0x86, 0xA8, 0xA4, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x10, 0x37, 0x1B, 0x9D, 0x98, 0xBB, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xFF, 0x54, 0xEB, 0x9F, 0x5B, 0xF5, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xF9, 0x49, 0x1E, 0x1D, 0x61, 0xD3, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2B, 0xE7, 0x73, 0x71, 0xC5, 0xF1, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xB4, 0x33, 0x47, 0x38, 0x07, 0x19, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xED, 0x39, 0x43, 0x4F, 0xA2, 0xAD, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x8E, 0x47, 0x42, 0x89, 0xF8, 0x7C, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xA8, 0x74, 0x63, 0x28, 0x63, 0x2A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6A, 0x1C, 0xF4, 0x51, 0xBB, 0x5B, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xF1, 0xF2, 0x0C, 0x92, 0x57, 0x1A, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x9F, 0xA7, 0x5B, 0x99, 0x6E, 0x75, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x7C, 0x23, 0x45, 0x54, 0xAE, 0x66, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xDE, 0x90, 0x8C, 0x77, 0xEF, 0x15, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xD1, 0xFC, 0xD8, 0xEC, 0x4F, 0x6E, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x3B, 0x3A, 0x1F, 0xA6, 0x02, 0xA5, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x4F, 0xC6, 0x59, 0x3B, 0x75, 0x38, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x6A, 0x77, 0x3A, 0xCA, 0x00, 0x3A, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xC9, 0xD6, 0x40, 0x04, 0xB2, 0xFD, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xDB, 0xDE, 0x34, 0x1A, 0xD7, 0xD9, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x02, 0xDE, 0x98, 0x80, 0xB6, 0x19, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x3E, 0x30, 0xA1, 0x9C, 0x7F, 0x73, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x13, 0xF0, 0xB1, 0xB0, 0x84, 0x5C, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x7D, 0x85, 0xD6, 0x5C, 0x71, 0x26, 0x10 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_7[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x40, 0x9D, 0xDA, 0x58, 0xFC, 0x7D, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x1E, 0x61, 0x74, 0x27, 0xCE, 0x60, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x12, 0x23, 0x14, 0x12, 0xAB, 0x45, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x15, 0x3B, 0x35, 0x52, 0xA3, 0xCF, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x17, 0x0C, 0xFB, 0x3B, 0xE2, 0x76, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x08, 0xC7, 0xE5, 0x75, 0xA6, 0xEE, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xB4, 0x82, 0xE5, 0xD3, 0xAB, 0x66, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x25, 0x14, 0xBD, 0x18, 0x22, 0x38, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x9F, 0xBA, 0x1B, 0x3E, 0x65, 0xBC, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x05, 0x58, 0xDB, 0x3D, 0x76, 0x02, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xCE, 0x4F, 0x67, 0x04, 0xB6, 0xE1, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xC3, 0x76, 0x71, 0x81, 0x2E, 0xF5, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xA8, 0x1E, 0x35, 0x75, 0x79, 0x84, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x9D, 0x11, 0x50, 0x08, 0xB2, 0x45, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x5F, 0x47, 0x1B, 0xEA, 0x45, 0x96, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xA3, 0xD6, 0x62, 0x05, 0x7C, 0x9B, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x0E, 0xF9, 0xF8, 0x4C, 0x11, 0xD8, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x15, 0x09, 0xAF, 0x20, 0x89, 0x7B, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xC6, 0xCD, 0xB8, 0x64, 0x38, 0x16, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x0C, 0x97, 0xB2, 0xD8, 0xA2, 0xEB, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xAB, 0x3E, 0x1D, 0x63, 0xA1, 0x10, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x06, 0x82, 0x8E, 0xC6, 0x08, 0x16, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xA1, 0x70, 0xF6, 0xFB, 0x0C, 0x26, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xBC, 0xE2, 0x71, 0x99, 0x20, 0xB2, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x3E, 0xA7, 0x0C, 0x0C, 0x51, 0x49, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x21, 0x6E, 0x36, 0x3A, 0x31, 0x77, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xFE, 0xA9, 0xD6, 0x3F, 0xB7, 0xEA, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF3, 0x93, 0x3C, 0x3A, 0xC2, 0xA6, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x56, 0xCE, 0xE7, 0xE2, 0x8A, 0xE3, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x69, 0x67, 0x8E, 0x70, 0x0E, 0x32, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xDA, 0x73, 0x86, 0x9E, 0x44, 0x5B, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1C, 0x8F, 0x84, 0x12, 0xF1, 0xF9, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x51, 0xE9, 0xC6, 0x50, 0xC6, 0x54, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xD4, 0x38, 0xE8, 0xA3, 0x76, 0xB7, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xE2, 0xE5, 0x19, 0x24, 0xAF, 0x34, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x3E, 0x4F, 0xB7, 0x32, 0xDD, 0xEA, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xF8, 0x46, 0x8A, 0xA8, 0x5C, 0xCD, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xBC, 0x21, 0x19, 0xEF, 0xDE, 0x2B, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xA3, 0xF9, 0xB1, 0xD9, 0x9F, 0xDC, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x77, 0x74, 0x3E, 0x4C, 0x05, 0x4A, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x9E, 0x8C, 0xB3, 0x76, 0xEA, 0x70, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xD5, 0xEE, 0x74, 0x94, 0x01, 0x74, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x93, 0xAD, 0x81, 0x08, 0x64, 0xFB, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xB7, 0xBD, 0x69, 0x34, 0xAE, 0xB3, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x05, 0xBC, 0x31, 0x01, 0x6D, 0x33, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x7D, 0x60, 0x42, 0x39, 0xFF, 0xE6, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x27, 0xE0, 0x63, 0x61, 0x09, 0xB9, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xFA, 0x0A, 0xAD, 0xB9, 0xE2, 0x4C, 0x20 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_8[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x4D, 0x13, 0x61, 0x35, 0xB2, 0xA0, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xD8, 0xB4, 0xA2, 0x41, 0x19, 0xF3, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xB5, 0x0D, 0x33, 0x04, 0x83, 0x2B, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xBD, 0x14, 0xB3, 0x1A, 0x07, 0xF4, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x4E, 0x91, 0xF7, 0x87, 0xBE, 0x97, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x09, 0x7A, 0x25, 0xA5, 0xBB, 0xD1, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC2, 0x43, 0x64, 0xDB, 0xC8, 0xEB, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x33, 0x26, 0x9C, 0x92, 0x37, 0x1C, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xA0, 0xB0, 0x91, 0x1A, 0xB0, 0x12, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x21, 0x48, 0x6C, 0xE0, 0x78, 0x57, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x26, 0x12, 0x1A, 0xB6, 0x5D, 0x72, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x9A, 0x9C, 0xF3, 0xD0, 0xA9, 0x00, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x1B, 0x9B, 0x87, 0xA8, 0x22, 0x80, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x7F, 0xE2, 0x16, 0x1C, 0xFD, 0xD9, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x4A, 0xC2, 0xE3, 0x72, 0x85, 0xD1, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x64, 0x25, 0x15, 0x42, 0x1D, 0xDA, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xBE, 0xEB, 0xE2, 0x94, 0x11, 0x71, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x74, 0xD2, 0x07, 0x66, 0x51, 0x23, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x41, 0x4C, 0x02, 0x2D, 0x25, 0xE1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x29, 0x0C, 0xE2, 0x0E, 0x24, 0x4D, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x59, 0x95, 0x2D, 0x00, 0x14, 0x6A, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xD4, 0xA3, 0xA0, 0x2C, 0x5C, 0x4E, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xE2, 0x79, 0xBA, 0xF6, 0x65, 0x22, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x34, 0x06, 0x14, 0x5E, 0x04, 0x57, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x72, 0x6A, 0xBC, 0x3F, 0x43, 0x08, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xF3, 0x0D, 0xC0, 0x75, 0xD5, 0x93, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x5C, 0x48, 0xEE, 0x46, 0x8B, 0xEF, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xEE, 0xFA, 0x81, 0x4A, 0x04, 0x74, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xDC, 0x4D, 0x8B, 0x19, 0x47, 0xFC, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x41, 0xA7, 0x28, 0xD8, 0x28, 0x0F, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x09, 0xEF, 0xED, 0xF7, 0x8A, 0xCD, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x66, 0xBA, 0x6E, 0xCD, 0x33, 0x9A, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xF4, 0xA6, 0xE5, 0xE3, 0xE5, 0x46, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x88, 0x69, 0x3A, 0x1E, 0x55, 0x8D, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x95, 0x46, 0xD6, 0xD5, 0x64, 0x85, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x94, 0xCB, 0xA5, 0x63, 0x81, 0x92, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x89, 0x60, 0xBD, 0xE1, 0xB4, 0xF6, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x51, 0x51, 0xCB, 0x3D, 0xF0, 0x5E, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x28, 0xB5, 0x2D, 0x97, 0x48, 0x19, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x75, 0x14, 0x41, 0x50, 0xFB, 0x0C, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x83, 0x65, 0x58, 0x8A, 0x00, 0x9D, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xCA, 0x97, 0xA3, 0xE7, 0x6C, 0x0C, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x05, 0x60, 0x02, 0xF9, 0x5D, 0x14, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x06, 0xAD, 0x60, 0xEC, 0x1D, 0xF4, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x2F, 0x68, 0xB6, 0xB5, 0xFE, 0x52, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xD6, 0x34, 0xD6, 0xE2, 0xA0, 0xC0, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xEC, 0x78, 0xF8, 0x92, 0xE7, 0x75, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x44, 0xAF, 0x7A, 0xC8, 0xB9, 0x7E, 0xCA ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_9[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x9A, 0x26, 0xC2, 0x6A, 0x64, 0x41, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x83, 0xA3, 0xDE, 0x57, 0x15, 0x02, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xCD, 0x45, 0x26, 0x1A, 0xE5, 0x3B, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x9D, 0xD5, 0x6B, 0xC9, 0x3D, 0x2B, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x54, 0x5E, 0x19, 0xCD, 0xE2, 0x6F, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x27, 0xE6, 0xAF, 0xB2, 0x55, 0xDE, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x4B, 0x51, 0xA6, 0xF1, 0x65, 0x6A, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x6F, 0xAE, 0x9B, 0x79, 0xEC, 0x89, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xF4, 0x6B, 0xB1, 0x16, 0x7E, 0x32, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xF5, 0xB8, 0xF5, 0x6D, 0xAD, 0xB1, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xD3, 0xE0, 0x77, 0xD8, 0xAE, 0xD1, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xA2, 0x25, 0x62, 0x98, 0x40, 0x03, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x5D, 0xAF, 0x4D, 0x56, 0x94, 0x73, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x07, 0xCD, 0x9B, 0x11, 0xDD, 0xDA, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xCB, 0x9D, 0xF0, 0x1B, 0x9B, 0xEE, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xC6, 0xAE, 0x30, 0xA5, 0x45, 0x7F, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x7A, 0xBE, 0x60, 0xEE, 0xC7, 0xAC, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x18, 0x85, 0xAE, 0x93, 0x60, 0xDB, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x92, 0xE5, 0x42, 0x33, 0x00, 0xCF, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xCF, 0x01, 0x47, 0x9A, 0x56, 0x0B, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x92, 0x68, 0x2C, 0x44, 0x2B, 0x1E, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xFB, 0xD7, 0xF4, 0x3D, 0x7D, 0x9E, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x44, 0x01, 0x86, 0xBA, 0xB9, 0xF5, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xE5, 0x86, 0x3E, 0x1F, 0x0A, 0x3B, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xB4, 0xA0, 0x50, 0xB2, 0x81, 0xDC, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x03, 0x24, 0xB2, 0x09, 0xAE, 0x24, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x4B, 0x86, 0xEE, 0xC4, 0x6E, 0xD7, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x21, 0x83, 0xA0, 0xAD, 0x1A, 0x91, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x6A, 0x62, 0x38, 0x8F, 0x4B, 0xA9, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x8F, 0x76, 0xF0, 0xF8, 0x76, 0xB3, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x2E, 0x15, 0x29, 0xA4, 0x6C, 0x92, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xD2, 0x4F, 0x2A, 0x18, 0xB6, 0x29, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x70, 0x13, 0x83, 0x78, 0x01, 0xE1, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x2A, 0x25, 0x3E, 0x9B, 0x51, 0x29, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x41, 0x9D, 0xB8, 0xD0, 0x3F, 0x64, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x9D, 0xB0, 0x6A, 0x56, 0xF6, 0xD5, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x49, 0x69, 0xFB, 0x64, 0x56, 0x96, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x88, 0xB5, 0x58, 0x26, 0x7B, 0x5A, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xE1, 0x63, 0xFC, 0x0E, 0x9C, 0xFE, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x86, 0x2B, 0xAC, 0xCA, 0xD7, 0x3A, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xA4, 0x06, 0x02, 0x12, 0x4F, 0xB8, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x1F, 0x23, 0xE4, 0x6B, 0xF6, 0xE8, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xCC, 0x24, 0xE0, 0x23, 0x1E, 0x95, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xD8, 0xF5, 0xAC, 0x97, 0x05, 0x07, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x28, 0xA3, 0x9E, 0xE7, 0x37, 0xEC, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x70, 0x2C, 0x85, 0xA5, 0xEB, 0xA4, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x8E, 0x36, 0x4E, 0xCD, 0x7A, 0xF3, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x89, 0x5E, 0xF5, 0x90, 0x73, 0xFD, 0x94 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_10[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x7E, 0x5C, 0xD8, 0xD3, 0xC9, 0x3D, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x0C, 0x97, 0x50, 0x4F, 0x06, 0x08, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x1E, 0x7C, 0x23, 0xE5, 0x49, 0x09, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x9E, 0x8C, 0xA7, 0x38, 0xB6, 0x82, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xDB, 0x5E, 0x9A, 0x46, 0xFC, 0x34, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x9D, 0xCE, 0x46, 0x9D, 0xCB, 0x85, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x46, 0x8D, 0xC8, 0x52, 0x55, 0xFB, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xCF, 0xDC, 0xEA, 0x8B, 0xD3, 0x1B, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xA8, 0xDC, 0xB0, 0x6C, 0x46, 0x41, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x1E, 0xD0, 0x25, 0x21, 0x93, 0x87, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x2D, 0x90, 0xB6, 0x25, 0x20, 0x50, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x8F, 0x65, 0xFA, 0x02, 0x00, 0xF9, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x2C, 0xDE, 0x3C, 0xE1, 0x80, 0xCB, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xB7, 0xC7, 0xB7, 0x3F, 0x96, 0xAF, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x6A, 0x5F, 0x6F, 0xBA, 0x11, 0x39, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x76, 0x04, 0xE3, 0x8B, 0xB6, 0xA5, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x5B, 0x83, 0x2D, 0x89, 0x43, 0xBC, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x2B, 0x4F, 0x2C, 0x6C, 0x49, 0x9C, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x20, 0xFA, 0x34, 0xFB, 0x09, 0x1A, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x6E, 0x77, 0x28, 0xC7, 0xB1, 0x6E, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x5D, 0x08, 0xA1, 0xFE, 0x52, 0x30, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xCC, 0x7C, 0x52, 0x1D, 0xC6, 0x91, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x24, 0x6A, 0xAF, 0x0E, 0x5E, 0x55, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x8D, 0xBA, 0xF3, 0xBF, 0xC4, 0xDF, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x99, 0x71, 0x86, 0x8C, 0x10, 0x52, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x8D, 0xFC, 0x33, 0xFC, 0x1F, 0xD0, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5C, 0x44, 0xE3, 0xF0, 0xF3, 0xD5, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x3F, 0x1F, 0x6B, 0xD6, 0xA0, 0x28, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA6, 0xCE, 0x4F, 0x12, 0xDA, 0x27, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x99, 0x44, 0xE9, 0x27, 0xE1, 0x4F, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xE4, 0x80, 0x48, 0x8E, 0xD7, 0xF4, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xEA, 0x5F, 0x2F, 0x1B, 0xE2, 0x79, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x8E, 0x85, 0x05, 0xB7, 0xED, 0xBD, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x00, 0xCA, 0xDD, 0x0D, 0x9C, 0xD9, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x1E, 0x67, 0x82, 0x27, 0xC0, 0xA8, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x1A, 0x4A, 0x14, 0x80, 0x53, 0x25, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xA7, 0xF3, 0x0C, 0xFE, 0xFA, 0xE9, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xE6, 0x62, 0xD3, 0xA4, 0x5B, 0xB8, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xB2, 0x36, 0x00, 0xAF, 0x86, 0xE8, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x6A, 0x1B, 0x83, 0x78, 0xF1, 0x7B, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x2F, 0xE6, 0xCF, 0xF3, 0x31, 0x98, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xC6, 0x08, 0xA4, 0x1A, 0xC4, 0x69, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x48, 0x86, 0xAD, 0x75, 0x91, 0x1A, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x31, 0xA4, 0xD3, 0x03, 0x88, 0xAD, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x46, 0x49, 0x81, 0x69, 0x81, 0x88, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x46, 0x1B, 0x39, 0xA3, 0x7F, 0xB8, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xE1, 0x79, 0xA1, 0xF8, 0xCC, 0x84, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF4, 0xF7, 0x5A, 0xDB, 0x61, 0x44, 0xB1 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_11[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xFD, 0xB8, 0xB0, 0xA7, 0x93, 0x7B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xEB, 0x67, 0x3A, 0x73, 0xEF, 0x2B, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x9E, 0x22, 0x07, 0xDC, 0x72, 0xF7, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x5E, 0xC5, 0x54, 0x05, 0x9C, 0x48, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x6F, 0xF9, 0x5E, 0x4A, 0x5E, 0xAA, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x4F, 0x8F, 0xF2, 0xA2, 0x75, 0x46, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x53, 0xE4, 0x6E, 0xE0, 0x7E, 0x89, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xA7, 0x1B, 0x39, 0x6C, 0x24, 0x89, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x05, 0xC4, 0xEF, 0xBA, 0xAA, 0x8F, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xEF, 0xC8, 0x68, 0xEF, 0xE1, 0x11, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xE1, 0xDC, 0xB0, 0xB7, 0x33, 0x8D, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x8B, 0xB7, 0x6F, 0xFC, 0xEC, 0xF3, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x80, 0x35, 0xB8, 0xC7, 0x50, 0x0A, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x77, 0x97, 0xDD, 0x58, 0x0F, 0x86, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x0B, 0xD8, 0x07, 0xAB, 0xB3, 0xBD, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xEA, 0x6C, 0xCC, 0x38, 0x78, 0x16, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xB3, 0xED, 0xF5, 0xD6, 0x2B, 0x43, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x86, 0x7E, 0xF7, 0x9F, 0x50, 0xCD, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x51, 0x41, 0xA8, 0xCF, 0xC9, 0x40, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x58, 0xD8, 0xD3, 0x0A, 0x72, 0x4E, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x9A, 0x4E, 0x13, 0x41, 0xA9, 0xAA, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xEC, 0x89, 0x58, 0x1F, 0x51, 0x25, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC8, 0xE1, 0x6F, 0xEA, 0xA9, 0x5B, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x96, 0xEF, 0xFD, 0xE2, 0x8A, 0x4C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x03, 0xAF, 0xE4, 0x4B, 0x1C, 0x70, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x38, 0x01, 0x9A, 0x16, 0x43, 0x9D, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x4B, 0x7E, 0xD8, 0x18, 0x40, 0xA4, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xC4, 0xCB, 0x72, 0xC5, 0x53, 0xFA, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xFF, 0x63, 0xC1, 0x80, 0x71, 0x00, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x3E, 0xB1, 0x71, 0x98, 0xE7, 0x34, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xE4, 0x38, 0xDE, 0xD0, 0x05, 0xE1, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xDA, 0x9A, 0xAB, 0xB3, 0x12, 0xE9, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xA3, 0xD0, 0xC2, 0x1E, 0x11, 0xCF, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x19, 0xE6, 0x84, 0x7A, 0xDF, 0xC1, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x53, 0xDE, 0x10, 0x74, 0xF6, 0xAA, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA8, 0xAD, 0x47, 0x8F, 0x9A, 0xFB, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x85, 0x8F, 0x9A, 0x9D, 0xE2, 0x7C, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xB2, 0xD8, 0x68, 0xF4, 0x51, 0x0D, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xF6, 0x66, 0xA1, 0x3E, 0x18, 0x9D, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x6F, 0x39, 0x30, 0x1B, 0xC4, 0x18, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xFE, 0x07, 0xF1, 0xE4, 0xB1, 0xAE, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x17, 0x05, 0xE5, 0xD1, 0xA4, 0xA3, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x52, 0x71, 0x36, 0x1D, 0x85, 0xA1, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x2E, 0xE4, 0x92, 0xC6, 0xD9, 0x79, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x56, 0x65, 0x34, 0x4F, 0x3D, 0x57, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x50, 0xF9, 0x4A, 0x26, 0xA9, 0x94, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x78, 0x38, 0xA0, 0x98, 0x45, 0x11, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xE8, 0xEF, 0xB5, 0xB6, 0xC3, 0x88, 0x62 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_12[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x57, 0xB6, 0xAA, 0xD5, 0xEC, 0x20, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xED, 0xD9, 0xD8, 0x6B, 0x4C, 0x86, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x42, 0xA2, 0x09, 0x17, 0x22, 0x4C, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x22, 0x1B, 0xF9, 0xBB, 0xBE, 0xC7, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x85, 0x63, 0xF5, 0x84, 0x2E, 0x48, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xBE, 0x94, 0x9A, 0x6F, 0x90, 0x1B, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x9E, 0x87, 0x8F, 0xBC, 0x8E, 0x11, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x73, 0x2B, 0x9D, 0x7F, 0x0F, 0x10, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x43, 0xF6, 0xB5, 0x09, 0x9F, 0xD6, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x1F, 0xF6, 0x28, 0x8F, 0xFE, 0xF1, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x13, 0xCA, 0x38, 0xD1, 0xAE, 0x9F, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xFE, 0x49, 0x48, 0x63, 0xC1, 0x54, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x97, 0x01, 0x47, 0x15, 0x63, 0xC3, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xA4, 0x21, 0x5C, 0xB5, 0x91, 0x5C, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x76, 0xC0, 0x8B, 0x8F, 0xCC, 0x99, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x85, 0x2A, 0x96, 0xC2, 0x41, 0xA6, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x00, 0x2F, 0x8E, 0x0F, 0x4C, 0xF0, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xD6, 0xCB, 0x5F, 0x06, 0x49, 0x72, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x97, 0xBF, 0xD8, 0xC4, 0xEE, 0x58, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x89, 0xEA, 0xBF, 0x80, 0x3D, 0x1B, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xFB, 0x0C, 0xED, 0x44, 0xEC, 0xA1, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xFE, 0x36, 0x3C, 0x80, 0x84, 0xD2, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xEE, 0x36, 0x95, 0xBD, 0x84, 0xCB, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x81, 0x53, 0xC0, 0x22, 0xEC, 0xE5, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xE0, 0x8E, 0x08, 0xE4, 0x78, 0x29, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x81, 0x5C, 0xC5, 0x89, 0x9A, 0xD0, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xF3, 0xC7, 0x54, 0xED, 0x99, 0x11, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xEC, 0xF4, 0xE5, 0x5C, 0xF8, 0xA6, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x76, 0xD0, 0x13, 0x01, 0x83, 0x4D, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x05, 0x8C, 0x64, 0x6B, 0x20, 0xF6, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xCD, 0x87, 0x6E, 0xAF, 0x8F, 0x32, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xC2, 0x23, 0x7A, 0xC6, 0xF5, 0xD5, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xA1, 0x75, 0x29, 0x0A, 0xBB, 0x1E, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x77, 0x1A, 0x82, 0xEC, 0x24, 0xFB, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xB8, 0x69, 0x97, 0xD6, 0x51, 0xB8, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x7F, 0x2E, 0xB6, 0x2D, 0xBB, 0x9F, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x8D, 0x05, 0xE6, 0x93, 0x87, 0x16, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xFA, 0xE1, 0x05, 0xC8, 0x65, 0xDC, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xA8, 0x91, 0x20, 0x81, 0x3C, 0x71, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x2B, 0x84, 0xB5, 0xF4, 0x8C, 0xEC, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x77, 0xBE, 0xE4, 0x60, 0x87, 0xF8, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x6F, 0x15, 0x49, 0x63, 0xEA, 0x91, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xC3, 0x22, 0x2F, 0xB2, 0xA0, 0x32, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x48, 0x73, 0xCB, 0xCB, 0xBC, 0x65, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xF1, 0xB0, 0x08, 0x6A, 0xB7, 0x82, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xF1, 0xA2, 0x95, 0x53, 0x9C, 0x5A, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x4B, 0x9C, 0xFA, 0xF5, 0x56, 0x47, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x43, 0x12, 0x07, 0x8E, 0x26, 0x67, 0xEA ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_13[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xAE, 0x6C, 0x55, 0xAB, 0xD9, 0x41, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xAC, 0xED, 0x4A, 0xAC, 0x7B, 0x28, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xE7, 0x6E, 0xD3, 0x3F, 0x23, 0x7D, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x66, 0xE2, 0xF7, 0x0B, 0xAD, 0xD2, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xC3, 0x02, 0x15, 0xC7, 0xC2, 0xD0, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x92, 0x1B, 0x9A, 0x47, 0xFF, 0x71, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x02, 0xD9, 0xFC, 0xB3, 0xF1, 0xB5, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xF0, 0xB8, 0x9D, 0x53, 0x9C, 0x71, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x3A, 0xF7, 0xF9, 0xF4, 0x5B, 0xBA, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xF1, 0x14, 0x6F, 0xCB, 0xB8, 0xE6, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xAD, 0x50, 0xB5, 0x0E, 0x51, 0x2C, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x69, 0x80, 0x0B, 0xBD, 0x6F, 0xAB, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x56, 0x7C, 0xCC, 0x2F, 0x15, 0xFA, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x51, 0x4B, 0x26, 0x44, 0x06, 0xE0, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x23, 0x9A, 0x40, 0x55, 0x29, 0x7F, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x09, 0xB9, 0x32, 0xA6, 0x8E, 0x17, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xFE, 0x44, 0xB7, 0xE3, 0x3C, 0xAB, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xDC, 0x77, 0x5E, 0xD4, 0x4F, 0x79, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x3F, 0xCC, 0xEF, 0x62, 0x93, 0xBE, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x8F, 0xBE, 0x02, 0x7E, 0x89, 0xA7, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xD6, 0x57, 0xAB, 0xCD, 0xDB, 0x8D, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x4F, 0xFE, 0x2B, 0xE5, 0xCD, 0xA6, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x5B, 0x7B, 0x3B, 0x48, 0xF7, 0x47, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x7E, 0x21, 0x97, 0xA8, 0xD9, 0x58, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x90, 0xE9, 0xE8, 0xFA, 0xEC, 0x1E, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x20, 0xC1, 0xBC, 0x31, 0x38, 0x9E, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x79, 0x85, 0xBB, 0x11, 0x8C, 0x1B, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x1E, 0x77, 0x68, 0xD2, 0x02, 0xF7, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x9F, 0x67, 0x49, 0x5E, 0xC3, 0x4B, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x16, 0x40, 0x68, 0x1F, 0x66, 0x81, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xB6, 0x46, 0x2A, 0x13, 0x76, 0x5C, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x89, 0x22, 0x41, 0x0A, 0x3A, 0xA1, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xCA, 0xB0, 0x0A, 0xC5, 0xAB, 0x90, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x08, 0x87, 0xCD, 0x37, 0xF1, 0x04, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x88, 0xE3, 0x3A, 0xD2, 0x19, 0xCA, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x72, 0x76, 0x8B, 0xEA, 0x69, 0xF0, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x52, 0xB3, 0x4C, 0xC9, 0xFB, 0xD5, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xDA, 0xD6, 0xCD, 0x3A, 0x66, 0x55, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xE2, 0x1C, 0xE2, 0xE2, 0x83, 0xAE, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xF1, 0x0A, 0x95, 0x13, 0xFB, 0xF9, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x8C, 0xB8, 0x1A, 0xBF, 0x5C, 0x6F, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x69, 0x1E, 0x2F, 0x63, 0xF1, 0xF3, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x48, 0xAA, 0x39, 0x96, 0xA3, 0xD1, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x5C, 0x82, 0x82, 0x56, 0x43, 0xEA, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xAC, 0x34, 0x43, 0x50, 0xA9, 0x4B, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xA5, 0x08, 0x04, 0x87, 0xE2, 0xD8, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x4C, 0x7D, 0x52, 0x93, 0x59, 0x96, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x86, 0x24, 0x0E, 0x1C, 0x4D, 0xCE, 0xD4 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_14[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x1C, 0xC6, 0xFA, 0x40, 0x7A, 0x83, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xBC, 0xA1, 0xC2, 0xB0, 0xBB, 0x51, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x87, 0xEF, 0x3F, 0x6E, 0xEA, 0xFC, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xF8, 0x4A, 0x59, 0xB8, 0xDC, 0xF1, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xC6, 0xE5, 0x1E, 0xB7, 0x2A, 0x20, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xFC, 0x60, 0x19, 0x2E, 0x89, 0xDC, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xCA, 0x82, 0x78, 0x26, 0x0C, 0x7E, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x8C, 0x9A, 0x3C, 0x56, 0x6C, 0x90, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x27, 0xBA, 0x50, 0x29, 0x78, 0x80, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x13, 0x5B, 0xAB, 0x52, 0xA6, 0x3D, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xA7, 0x0F, 0xC8, 0x27, 0x64, 0x33, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x96, 0x96, 0x1B, 0x93, 0x94, 0x2E, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x53, 0x2C, 0x59, 0xBE, 0x61, 0x9E, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xE8, 0x30, 0x6E, 0xA2, 0xD2, 0xC4, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x7B, 0x4F, 0xFB, 0x55, 0x33, 0xA2, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xA2, 0x67, 0xC4, 0x0E, 0xC8, 0xCF, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xCC, 0x49, 0x74, 0x70, 0x26, 0x38, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x04, 0x4E, 0x04, 0xD0, 0x46, 0x42, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xD0, 0x50, 0x66, 0xDE, 0xA4, 0x1A, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x84, 0xDC, 0xD4, 0xD8, 0xF1, 0x1B, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x86, 0x6B, 0xB3, 0x00, 0xF0, 0x49, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x75, 0x26, 0x7A, 0xD5, 0x11, 0xD8, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xBE, 0x75, 0x31, 0xE1, 0x7F, 0xB4, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x2B, 0x8C, 0x0A, 0x63, 0xDC, 0x59, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE6, 0x6B, 0x53, 0x02, 0xB3, 0xC6, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x63, 0x84, 0x5B, 0x80, 0x65, 0x11, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x02, 0x90, 0xD4, 0x74, 0xB8, 0x28, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x92, 0x41, 0xAC, 0x6B, 0x31, 0xC3, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xDF, 0x19, 0xA9, 0x12, 0xDB, 0x7A, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x17, 0x1F, 0x23, 0xEF, 0xA0, 0x46, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xDE, 0x0F, 0x0A, 0xAA, 0xE1, 0x35, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x74, 0x3E, 0xDB, 0x78, 0x1D, 0x08, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x1C, 0x12, 0x33, 0x6F, 0x50, 0xE1, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xDB, 0xE7, 0x2A, 0xE0, 0xF0, 0x5D, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x7C, 0x41, 0x67, 0xEB, 0x25, 0x2F, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x0A, 0x53, 0xAE, 0xBB, 0x3A, 0x7D, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x07, 0x2F, 0xF4, 0x59, 0x00, 0x0D, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x91, 0xD7, 0x96, 0xBB, 0x55, 0x1C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xFC, 0x48, 0x47, 0x65, 0xDE, 0x2F, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xC5, 0x87, 0xF9, 0xAB, 0xF6, 0x00, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x58, 0x83, 0x9E, 0xAD, 0x21, 0x8B, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x02, 0x27, 0xD9, 0x23, 0x78, 0x19, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x0C, 0xAD, 0x1F, 0x15, 0x56, 0x32, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xBE, 0xCA, 0x80, 0x7C, 0xF6, 0xBD, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x75, 0x36, 0x26, 0x85, 0x3C, 0xF5, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x71, 0x43, 0x12, 0x7B, 0x9C, 0xA1, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x28, 0xC5, 0xD9, 0xFC, 0x83, 0x78, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x0F, 0x96, 0x4C, 0xF3, 0xE6, 0x83, 0x23 ),
+};
+static const mbedtls_mpi_uint ffdhe3072_T_15[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x38, 0x8C, 0xF5, 0x81, 0xF4, 0x06, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x79, 0x43, 0x85, 0x61, 0x77, 0xA3, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x0E, 0xDF, 0x7F, 0xDC, 0xD4, 0xF9, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xF1, 0x95, 0xB2, 0x70, 0xB9, 0xE3, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x8D, 0xCB, 0x3D, 0x6E, 0x55, 0x40, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xF9, 0xC1, 0x32, 0x5C, 0x12, 0xB9, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x94, 0x05, 0xF1, 0x4C, 0x18, 0xFC, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x19, 0x35, 0x79, 0xAC, 0xD8, 0x20, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x4F, 0x74, 0xA1, 0x52, 0xF0, 0x00, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x26, 0xB6, 0x56, 0xA5, 0x4C, 0x7B, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x4E, 0x1F, 0x90, 0x4F, 0xC8, 0x66, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x2D, 0x2D, 0x37, 0x26, 0x29, 0x5D, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xA7, 0x58, 0xB2, 0x7C, 0xC3, 0x3C, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xD1, 0x61, 0xDC, 0x44, 0xA5, 0x89, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xF7, 0x9E, 0xF6, 0xAB, 0x66, 0x44, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x44, 0xCF, 0x88, 0x1D, 0x90, 0x9F, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x99, 0x93, 0xE8, 0xE0, 0x4C, 0x70, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x08, 0x9C, 0x08, 0xA0, 0x8D, 0x84, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xA0, 0xA1, 0xCC, 0xBC, 0x49, 0x35, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x09, 0xB9, 0xA9, 0xB1, 0xE3, 0x37, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x0C, 0xD7, 0x66, 0x01, 0xE0, 0x93, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xEA, 0x4C, 0xF4, 0xAA, 0x23, 0xB0, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x7D, 0xEB, 0x62, 0xC2, 0xFF, 0x68, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x57, 0x18, 0x15, 0xC6, 0xB8, 0xB3, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xCC, 0xD7, 0xA6, 0x04, 0x66, 0x8D, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC7, 0x08, 0xB7, 0x00, 0xCB, 0x22, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x05, 0x20, 0xA9, 0xE9, 0x70, 0x51, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x25, 0x83, 0x58, 0xD7, 0x62, 0x86, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xBE, 0x33, 0x52, 0x25, 0xB6, 0xF5, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x2F, 0x3E, 0x46, 0xDE, 0x41, 0x8D, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xBD, 0x1F, 0x14, 0x54, 0xC3, 0x6B, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xE9, 0x7C, 0xB6, 0xF1, 0x3A, 0x10, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x39, 0x24, 0x66, 0xDE, 0xA0, 0xC2, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xB6, 0xCF, 0x55, 0xC0, 0xE1, 0xBB, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xF8, 0x82, 0xCE, 0xD6, 0x4B, 0x5E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x14, 0xA6, 0x5C, 0x77, 0x75, 0xFA, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x0E, 0x5E, 0xE8, 0xB3, 0x00, 0x1A, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x22, 0xAF, 0x2D, 0x77, 0xAB, 0x38, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xF9, 0x91, 0x8E, 0xCA, 0xBC, 0x5F, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x8A, 0x0F, 0xF3, 0x57, 0xED, 0x01, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xB0, 0x06, 0x3D, 0x5B, 0x43, 0x16, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x04, 0x4E, 0xB2, 0x47, 0xF0, 0x32, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x18, 0x5A, 0x3F, 0x2A, 0xAC, 0x64, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x7C, 0x95, 0x01, 0xF9, 0xEC, 0x7B, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xEB, 0x6C, 0x4C, 0x0A, 0x79, 0xEA, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xE2, 0x86, 0x24, 0xF6, 0x38, 0x43, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x50, 0x8A, 0xB3, 0xF9, 0x07, 0xF1, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x1F, 0x2C, 0x99, 0xE6, 0xCD, 0x07, 0x47 ),
+};
+static const mbedtls_mpi ffdhe3072_P = DHM_MPI_INIT_ARRAY( ffdhe3072_p );
+static const mbedtls_mpi ffdhe3072_T[15] = {
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_1 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_2 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_3 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_4 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_5 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_6 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_7 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_8 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_9 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_10 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_11 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_12 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_13 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_14 ),
+    DHM_MPI_INIT_ARRAY( ffdhe3072_T_15 ),
+};
+
+static const mbedtls_mpi_uint ffdhe4096_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x5F, 0x65, 0x5E, 0x7E, 0x00, 0x8A, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x82, 0x41, 0xF4, 0x51, 0xA8, 0xB5, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA4, 0x88, 0x7F, 0x5A, 0xB5, 0xC9, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x7D, 0xC9, 0xCE, 0xCD, 0x91, 0x82, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x0A, 0x8D, 0xF9, 0xA9, 0xCE, 0x4E, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x00, 0x40, 0x71, 0x3D, 0xB9, 0x1D, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x8B, 0xCB, 0x33, 0xA3, 0x99, 0x29, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x00, 0xAD, 0x71, 0xF9, 0x78, 0xC7, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x30, 0x81, 0x91, 0x0A, 0x60, 0x07, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x68, 0x9E, 0x2D, 0x01, 0x1E, 0x6A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x31, 0xB4, 0xEF, 0x86, 0xC8, 0x35, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xCC, 0x31, 0x7E, 0xA5, 0x5B, 0xF5, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x40, 0x03, 0x55, 0x1D, 0xCF, 0x63, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x6D, 0x9F, 0xD6, 0x42, 0x5F, 0x7D, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x57, 0x88, 0xE5, 0xE4, 0xE9, 0x30, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xF4, 0x4D, 0x16, 0xC3, 0x52, 0x6F, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x1E, 0x9E, 0x66, 0x2B, 0x1D, 0xE4, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9D, 0xD5, 0x3F, 0xEE, 0x20, 0x1B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xDD, 0x53, 0xFA, 0x6B, 0xD0, 0xBC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x48, 0xC4, 0xD5, 0x42, 0x9A, 0xBF, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xEA, 0x0D, 0x9B, 0x97, 0x21, 0xC5, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x3A, 0x36, 0x22, 0xC5, 0x2B, 0x6D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF6, 0x9D, 0x9C, 0xAB, 0x82, 0xAE, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x4B, 0xF5, 0x71, 0x1E, 0xE2, 0xF2, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4D, 0xD7, 0xE2, 0x52, 0x44, 0xFD, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x79, 0x43, 0xBC, 0x93, 0x0C, 0x13, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x92, 0x13, 0x85, 0x09, 0x13, 0xFE, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xD9, 0x86, 0xC1, 0xFA, 0xB0, 0x8C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xF7, 0x91, 0x26, 0x1D, 0xD9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xC9, 0xE6, 0xD6, 0xC9, 0x6F, 0xB4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x02, 0x9C, 0xF9, 0xDE, 0xF4, 0x34, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x03, 0x19, 0x65, 0x3B, 0x5B, 0x35, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xCF, 0x1F, 0x61, 0x38, 0x42, 0x6B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x2B, 0x9F, 0x7A, 0x96, 0xB0, 0xDD, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xE0, 0xEC, 0x36, 0x3A, 0xAD, 0x95, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xBC, 0x25, 0x4B, 0x7E, 0x7C, 0xB4, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xBB, 0x82, 0xCA, 0x97, 0x36, 0x50, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x5C, 0xF7, 0xD9, 0xC0, 0x34, 0x65, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x39, 0x17, 0xB7, 0xBB, 0x34, 0x64, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xD5, 0x95, 0xE7, 0x1D, 0xEB, 0x0A, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x6E, 0xF0, 0x8B, 0x1D, 0xBC, 0x6B, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xE0, 0x6A, 0x81, 0x71, 0x65, 0xA4, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x5E, 0x9A, 0xD7, 0x2B, 0x81, 0x91, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x29, 0xDD, 0xFA, 0x1F, 0x24, 0x81, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x9A, 0xF4, 0xC3, 0xE0, 0xDA, 0x4B, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x49, 0xF4, 0x88, 0x86, 0x60, 0xA0, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x7C, 0x0E, 0xBE, 0x2F, 0x17, 0x26, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x5E, 0xBD, 0x4E, 0x59, 0xA4, 0x9A, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xBD, 0x9E, 0x68, 0xEB, 0x56, 0x3B, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x99, 0x36, 0xC1, 0x30, 0xAD, 0x14, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x5F, 0x5E, 0x62, 0x10, 0xEF, 0xE7, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xEF, 0x14, 0xB9, 0x87, 0x8F, 0x74, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xA3, 0x93, 0xC9, 0x88, 0xE1, 0xB3, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xFC, 0xFF, 0xA2, 0x98, 0x6D, 0x02, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x92, 0xA6, 0xED, 0x59, 0xCA, 0x35, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xDE, 0xDA, 0x95, 0x0E, 0x16, 0x6A, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xDF, 0xF8, 0x43, 0x5B, 0x39, 0xE3, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xDF, 0x84, 0xDE, 0x16, 0x8E, 0x90, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x8C, 0xEE, 0x70, 0x82, 0xC8, 0x60, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x36, 0x48, 0xC5, 0xEE, 0x7A, 0x4C, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x78, 0xE9, 0x82, 0xC4, 0x9A, 0x72, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x5D, 0x16, 0x64, 0xD6, 0xEE, 0x62, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x42, 0x97, 0x16, 0x9D, 0x03, 0x5E, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x31, 0x28, 0x81, 0x62, 0x6A, 0x27, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xCB, 0xB1, 0xE0, 0x9E, 0x7B, 0xD6, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x3E, 0xC8, 0xA5, 0x80, 0x86, 0xB4, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x40, 0xB1, 0x10, 0x6B, 0xAB, 0xD1, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xFD, 0x04, 0xDD, 0xB5, 0xA4, 0x6E, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x08, 0x0C, 0x31, 0xDD, 0x97, 0x86, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x21, 0x48, 0xD3, 0x4D, 0x6B, 0x72, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x3A, 0xF5, 0x85, 0x5D, 0x4F, 0x1F, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xF7, 0x0F, 0xB2, 0x71, 0xFE, 0x44, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xE3, 0x59, 0x90, 0xF6, 0x23, 0x47, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x2F, 0x13, 0xB6, 0x80, 0xE6, 0xD7, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x44, 0xEB, 0x53, 0x41, 0xC1, 0xA2, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x68, 0x69, 0x67, 0x5E, 0x0E, 0x54, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x3D, 0x7A, 0x2A, 0xA9, 0x1A, 0x91, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x7F, 0x1E, 0xF5, 0x8D, 0x91, 0xF7, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xC3, 0xBD, 0x0C, 0xAE, 0x96, 0xF9, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xA5, 0xC5, 0x4E, 0x35, 0x68, 0x79, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x02, 0x25, 0x48, 0x8D, 0x8C, 0x66, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x7A, 0x46, 0xF7, 0x4F, 0xBB, 0x18, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xD2, 0xF0, 0x2C, 0xAF, 0xF6, 0x82, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x1C, 0xD1, 0x17, 0xEE, 0xB1, 0xAE, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xCA, 0x97, 0xBB, 0xE8, 0x27, 0xAF, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xFC, 0xBF, 0xFE, 0x50, 0x55, 0xBF, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xAF, 0xC0, 0x55, 0xCF, 0xFC, 0xFC, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x6C, 0xEC, 0x6A, 0x85, 0xC3, 0x0D, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x93, 0xFB, 0xE1, 0x85, 0x8C, 0x19, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x7A, 0xAA, 0x16, 0x3F, 0x28, 0x92, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x31, 0xF1, 0xB3, 0xE8, 0xCF, 0xE4, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x6A, 0x81, 0x12, 0x17, 0x7A, 0x21, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xC3, 0x2D, 0x08, 0xE6, 0xAE, 0x21, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x1B, 0xBD, 0xA8, 0x29, 0x61, 0x90, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x3C, 0xD0, 0x91, 0xC9, 0x85, 0x91, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x69, 0x62, 0xF5, 0x2C, 0x69, 0x50, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x78, 0xCA, 0xA9, 0x7B, 0x0F, 0x84, 0x52 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_3[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x56, 0x3E, 0xF5, 0x2C, 0x61, 0xBB, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xC0, 0xD9, 0x6D, 0x74, 0x5A, 0x2B, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x78, 0x4B, 0x96, 0xFC, 0xF8, 0x68, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x77, 0x05, 0x95, 0x2F, 0x6D, 0xA0, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xB8, 0xEE, 0xB3, 0x81, 0x69, 0xCA, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x73, 0x2E, 0x6E, 0x77, 0x69, 0xC8, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xAB, 0x2B, 0xCF, 0x3B, 0xD6, 0x15, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xDC, 0xE0, 0x17, 0x3B, 0x78, 0xD7, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xC1, 0xD5, 0x02, 0xE3, 0xCA, 0x48, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xBD, 0x34, 0xAF, 0x57, 0x02, 0x23, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x53, 0xBA, 0xF5, 0x3F, 0x48, 0x02, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x35, 0xE9, 0x87, 0xC1, 0xB5, 0x97, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x92, 0xE8, 0x11, 0x0D, 0xC1, 0x40, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xF9, 0x1C, 0x7C, 0x5F, 0x2E, 0x4C, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xBD, 0x7A, 0x9D, 0xB2, 0x48, 0x35, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x7B, 0x3D, 0xD1, 0xD6, 0xAD, 0x76, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x33, 0x6D, 0x82, 0x61, 0x5A, 0x29, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xBF, 0xBC, 0xC4, 0x20, 0xDE, 0xCF, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xDF, 0x29, 0x72, 0x0F, 0x1F, 0xE9, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x46, 0x27, 0x93, 0x11, 0xC3, 0x67, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xF9, 0xFF, 0x45, 0x31, 0xDB, 0x04, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x24, 0x4D, 0xDB, 0xB3, 0x94, 0x6B, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xBD, 0xB5, 0x2B, 0x1D, 0x2C, 0xD4, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xBF, 0xF1, 0x87, 0xB6, 0x72, 0xC6, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xBF, 0x09, 0xBD, 0x2D, 0x1C, 0x21, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x18, 0xDD, 0xE1, 0x04, 0x91, 0xC1, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x6D, 0x90, 0x8A, 0xDD, 0xF5, 0x98, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xF1, 0xD2, 0x05, 0x89, 0x35, 0xE5, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xBB, 0x2C, 0xC8, 0xAC, 0xDD, 0xC5, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x85, 0x2E, 0x2D, 0x3A, 0x07, 0xBC, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x62, 0x50, 0x02, 0xC5, 0xD4, 0x4E, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x96, 0x63, 0xC1, 0x3D, 0xF7, 0xAC, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7C, 0x90, 0x4B, 0x01, 0x0D, 0x69, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x80, 0x62, 0x21, 0xD6, 0x56, 0xA3, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xFB, 0x09, 0xBA, 0x6B, 0x49, 0xDD, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x11, 0x18, 0x62, 0xBA, 0x2F, 0x0D, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x43, 0x90, 0xA6, 0x9B, 0xD6, 0xE4, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x75, 0xEA, 0x0B, 0xBB, 0x9E, 0x3E, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xEE, 0x1F, 0x64, 0xE3, 0xFC, 0x89, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xC7, 0xB3, 0x20, 0xED, 0x47, 0x8E, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x5E, 0x26, 0x6C, 0x01, 0xCD, 0xAF, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x88, 0xD6, 0xA7, 0x82, 0x82, 0x45, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xD1, 0xD2, 0xCE, 0xBC, 0x1C, 0xA8, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x7A, 0xF4, 0x54, 0x52, 0x35, 0x22, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xFE, 0x3C, 0xEA, 0x1B, 0x23, 0xEF, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x87, 0x7B, 0x19, 0x5C, 0x2D, 0xF3, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x4B, 0x8B, 0x9D, 0x6A, 0xD0, 0xF2, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x05, 0x4A, 0x90, 0x1A, 0x19, 0xCD, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xF5, 0x8C, 0xEE, 0x9F, 0x76, 0x31, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xA5, 0xE1, 0x59, 0x5E, 0xED, 0x05, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x38, 0xA2, 0x2F, 0xDC, 0x63, 0x5D, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x95, 0x2F, 0x77, 0xD1, 0x4F, 0x5E, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xF8, 0x7F, 0xFD, 0xA1, 0xAA, 0x7E, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x5F, 0x81, 0xAB, 0x9E, 0xF9, 0xF9, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xD9, 0xD8, 0xD5, 0x0A, 0x87, 0x1B, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x27, 0xF7, 0xC3, 0x0B, 0x19, 0x33, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xF5, 0x54, 0x2D, 0x7E, 0x50, 0x24, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x62, 0xE2, 0x67, 0xD1, 0x9F, 0xC9, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xD5, 0x02, 0x25, 0x2E, 0xF4, 0x42, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x86, 0x5B, 0x10, 0xCC, 0x5D, 0x43, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x36, 0x7A, 0x51, 0x53, 0xC2, 0x20, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x79, 0xA0, 0x23, 0x93, 0x0B, 0x23, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xD2, 0xC4, 0xEA, 0x59, 0xD2, 0xA0, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xF1, 0x94, 0x53, 0xF7, 0x1E, 0x08, 0xA5 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_4[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x9F, 0x75, 0xFB, 0x85, 0x6C, 0xEB, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xAE, 0x53, 0x7C, 0x25, 0x7F, 0x1B, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x5C, 0xAF, 0xDB, 0x3D, 0xD4, 0xC6, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x50, 0xBE, 0x14, 0x06, 0x55, 0xAC, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x6F, 0x16, 0x75, 0x74, 0x3C, 0x0B, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8D, 0x13, 0xDF, 0x1B, 0x9C, 0x95, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x95, 0x02, 0x13, 0x67, 0x36, 0x85, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x46, 0x38, 0xCA, 0xB2, 0x9A, 0x34, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x4C, 0x25, 0x59, 0x05, 0x77, 0x97, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x76, 0x67, 0x80, 0xAE, 0x62, 0x2C, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xD3, 0x8D, 0x51, 0x11, 0xFD, 0x72, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x24, 0xF4, 0x7A, 0x05, 0x60, 0xA9, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x2C, 0xD2, 0x10, 0x8A, 0xBF, 0x83, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x3B, 0x3A, 0x0D, 0x71, 0xD0, 0x7F, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x55, 0x8C, 0x7E, 0x59, 0x21, 0xE5, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x55, 0x9D, 0x2F, 0xB1, 0x3F, 0x86, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x00, 0xDA, 0x43, 0x47, 0x8B, 0x09, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x54, 0x89, 0x72, 0x15, 0x60, 0x44, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xB4, 0xAF, 0xC1, 0x45, 0x3D, 0x1B, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x51, 0x03, 0x14, 0x4B, 0x14, 0x28, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x40, 0xA5, 0x49, 0x2E, 0xAF, 0x19, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xFB, 0x74, 0x3E, 0xBD, 0x2E, 0xCD, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x60, 0x92, 0x60, 0x2C, 0xE6, 0x43, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x22, 0xBB, 0x35, 0xE4, 0xF2, 0xC5, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x42, 0xEE, 0xB4, 0x0A, 0xE1, 0x04, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x5E, 0x0D, 0x5E, 0x51, 0xDA, 0x34, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xDD, 0x79, 0x16, 0x42, 0xFE, 0xB2, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x68, 0xBE, 0x9E, 0x00, 0xCD, 0x69, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x9B, 0x83, 0x76, 0x9A, 0xD7, 0x58, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x61, 0x8A, 0xE7, 0xB6, 0xFF, 0x7E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xC7, 0x84, 0xFA, 0xD4, 0x08, 0x54, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xAF, 0xB4, 0x0A, 0xD0, 0x4B, 0x8C, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xEC, 0x31, 0x0F, 0xFD, 0xB3, 0xC4, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x57, 0xB8, 0xB2, 0x7D, 0xAB, 0x75, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x0F, 0x3F, 0x52, 0xB7, 0x2B, 0x21, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xFA, 0x13, 0x53, 0x68, 0xDD, 0xF0, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xCE, 0x51, 0xDC, 0x9A, 0xC9, 0x0D, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x61, 0x12, 0xD8, 0x7F, 0xFF, 0x8F, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x80, 0x66, 0x5B, 0xBF, 0x91, 0xCD, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xE8, 0x05, 0x29, 0x6D, 0x05, 0x17, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x85, 0xAD, 0x5E, 0xDF, 0xEA, 0x34, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x24, 0xC1, 0xC9, 0x40, 0x56, 0x26, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x1D, 0xE7, 0x15, 0xC3, 0x39, 0x21, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x5E, 0x1E, 0x92, 0x28, 0xD4, 0xA7, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xA0, 0x4E, 0x0B, 0x30, 0xE7, 0x7C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x85, 0xE0, 0x40, 0x34, 0xB0, 0xB1, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x12, 0x53, 0x66, 0x75, 0xEB, 0xF7, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x3C, 0x61, 0x25, 0xE9, 0x69, 0xE7, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xBD, 0x4F, 0x23, 0xE8, 0x4F, 0xCE, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xE3, 0x90, 0x99, 0x5F, 0x83, 0x9E, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xB6, 0xE4, 0x5D, 0xCA, 0xDC, 0xD2, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x70, 0xAA, 0x50, 0x4A, 0xBD, 0x75, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x13, 0x6C, 0x80, 0x5E, 0x33, 0xE2, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x4D, 0x30, 0xAB, 0xB7, 0xE4, 0xC8, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xFA, 0x09, 0xDB, 0xD4, 0xB8, 0xDE, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5D, 0x4E, 0xFA, 0x3E, 0xB5, 0x4C, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x3B, 0x1D, 0xF5, 0x1F, 0x39, 0xEE, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x60, 0x8E, 0x30, 0x84, 0xAB, 0xCF, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xB9, 0xA3, 0xC3, 0x2E, 0x81, 0x52, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x74, 0x4D, 0xA3, 0xB1, 0x65, 0xE4, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x76, 0x4F, 0x92, 0xC6, 0xB9, 0x6E, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xD2, 0x68, 0xC3, 0x2C, 0xD1, 0x5F, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x85, 0xD8, 0x37, 0xC9, 0x47, 0x0A, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x2A, 0x28, 0x8D, 0x55, 0xB6, 0xB1, 0x40 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_5[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x3F, 0xEB, 0xF6, 0x0B, 0xD9, 0xD6, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x5C, 0xA7, 0xF8, 0x4A, 0xFE, 0x36, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xB8, 0x5E, 0xB7, 0x7B, 0xA8, 0x8D, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xA0, 0x7C, 0x29, 0x0C, 0xAA, 0x58, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xDF, 0x2C, 0xEA, 0xE8, 0x78, 0x16, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x1B, 0x27, 0xBE, 0x37, 0x38, 0x2B, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x2A, 0x05, 0x26, 0xCE, 0x6C, 0x0A, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x8C, 0x70, 0x94, 0x65, 0x35, 0x69, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x99, 0x4A, 0xB2, 0x0A, 0xEE, 0x2E, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xED, 0xCE, 0x00, 0x5D, 0xC5, 0x58, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xA6, 0x1B, 0xA3, 0x22, 0xFA, 0xE5, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x49, 0xE8, 0xF5, 0x0A, 0xC0, 0x52, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x58, 0xA4, 0x21, 0x14, 0x7F, 0x07, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x77, 0x74, 0x1A, 0xE2, 0xA0, 0xFF, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAA, 0x18, 0xFD, 0xB2, 0x42, 0xCA, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xAB, 0x3A, 0x5F, 0x62, 0x7F, 0x0C, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x00, 0xB4, 0x87, 0x8E, 0x16, 0x13, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xA9, 0x12, 0xE5, 0x2A, 0xC0, 0x88, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x69, 0x5F, 0x83, 0x8B, 0x7A, 0x36, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xA3, 0x06, 0x28, 0x96, 0x28, 0x50, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x81, 0x4A, 0x93, 0x5C, 0x5E, 0x33, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xF6, 0xE9, 0x7C, 0x7A, 0x5D, 0x9A, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xC0, 0x24, 0xC1, 0x58, 0xCC, 0x87, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x44, 0x76, 0x6B, 0xC8, 0xE5, 0x8B, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x85, 0xDC, 0x69, 0x15, 0xC2, 0x09, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xBC, 0x1A, 0xBC, 0xA2, 0xB4, 0x69, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xBA, 0xF3, 0x2C, 0x84, 0xFC, 0x65, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xD1, 0x7C, 0x3D, 0x01, 0x9A, 0xD3, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x36, 0x07, 0xED, 0x34, 0xAF, 0xB1, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xC3, 0x14, 0xCF, 0x6D, 0xFF, 0xFD, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x8E, 0x09, 0xF5, 0xA9, 0x11, 0xA8, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x5E, 0x69, 0x15, 0xA0, 0x97, 0x18, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xD9, 0x63, 0x1E, 0xFA, 0x67, 0x89, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xAE, 0x70, 0x65, 0xFB, 0x56, 0xEB, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x1E, 0x7E, 0xA4, 0x6E, 0x57, 0x42, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xF4, 0x27, 0xA6, 0xD0, 0xBA, 0xE1, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x9C, 0xA3, 0xB8, 0x35, 0x93, 0x1B, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xC3, 0x24, 0xB0, 0xFF, 0xFE, 0x1F, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x01, 0xCD, 0xB6, 0x7E, 0x23, 0x9B, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xD0, 0x0B, 0x52, 0xDA, 0x0A, 0x2E, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x0B, 0x5B, 0xBD, 0xBE, 0xD5, 0x69, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x49, 0x82, 0x93, 0x81, 0xAC, 0x4C, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x3B, 0xCE, 0x2B, 0x86, 0x73, 0x42, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xBD, 0x3C, 0x24, 0x51, 0xA8, 0x4F, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x40, 0x9D, 0x16, 0x60, 0xCE, 0xF9, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x0A, 0xC1, 0x81, 0x68, 0x60, 0x63, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x25, 0xA6, 0xCC, 0xEA, 0xD6, 0xEF, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x79, 0xC2, 0x4A, 0xD2, 0xD3, 0xCE, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x7B, 0x9F, 0x46, 0xD0, 0x9F, 0x9C, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xC6, 0x21, 0x33, 0xBF, 0x06, 0x3D, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x6C, 0xC9, 0xBB, 0x94, 0xB9, 0xA5, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xE1, 0x54, 0xA1, 0x94, 0x7A, 0xEB, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x27, 0xD8, 0x00, 0xBD, 0x66, 0xC4, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x9A, 0x60, 0x56, 0x6F, 0xC9, 0x91, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xF4, 0x13, 0xB6, 0xA9, 0x71, 0xBD, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xBA, 0x9C, 0xF4, 0x7D, 0x6A, 0x99, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x76, 0x3A, 0xEA, 0x3F, 0x72, 0xDC, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xC1, 0x1C, 0x61, 0x08, 0x57, 0x9F, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x73, 0x47, 0x87, 0x5D, 0x02, 0xA5, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xE8, 0x9A, 0x46, 0x63, 0xCB, 0xC8, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xEC, 0x9E, 0x24, 0x8D, 0x73, 0xDD, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xA4, 0xD1, 0x86, 0x59, 0xA2, 0xBF, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x0B, 0xB1, 0x6F, 0x92, 0x8F, 0x14, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x54, 0x50, 0x1A, 0xAB, 0x6C, 0x63, 0x81 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_6[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x42, 0xDD, 0x8A, 0x38, 0x17, 0xE7, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x3F, 0xEC, 0x55, 0xD9, 0xDB, 0xF0, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x76, 0x2D, 0x1D, 0x6E, 0xED, 0xB6, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xC6, 0x7A, 0x5D, 0x79, 0xA1, 0x57, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x40, 0xE0, 0xA4, 0x27, 0x55, 0x28, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xE0, 0xA5, 0xC5, 0x20, 0x1A, 0x21, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x81, 0xC9, 0xCC, 0xFF, 0x1F, 0xC1, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xDE, 0xE0, 0x53, 0x69, 0x98, 0x84, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x71, 0xC6, 0x3B, 0x4C, 0x6F, 0x03, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xA3, 0xDC, 0xCD, 0xFE, 0x4C, 0x6D, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x55, 0x10, 0x21, 0x8B, 0xD4, 0x8F, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xC0, 0x61, 0x9F, 0x98, 0xC3, 0x37, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x52, 0xF1, 0xCF, 0xAC, 0xEE, 0x90, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xCA, 0xCA, 0x04, 0x5A, 0xE1, 0x23, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x37, 0xC7, 0xBF, 0x41, 0x5F, 0x7F, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x73, 0x9C, 0xA2, 0x00, 0xF3, 0xFC, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x96, 0xDF, 0x8E, 0x67, 0x0B, 0xCB, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x0E, 0xAE, 0xD4, 0x81, 0x54, 0xC4, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xA5, 0x2B, 0x9D, 0x0A, 0x7D, 0xB7, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x28, 0x0D, 0x00, 0x8A, 0xE5, 0x6B, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x28, 0xB4, 0x0F, 0xAE, 0xB1, 0x5B, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xAB, 0x45, 0xE2, 0xE2, 0x35, 0x1A, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xBB, 0xF4, 0xFA, 0xD5, 0xFD, 0x93, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x57, 0x1D, 0xB1, 0x0A, 0x7B, 0x5E, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x5B, 0x2A, 0x67, 0xD6, 0x19, 0x89, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x18, 0xCB, 0x24, 0x36, 0x59, 0x92, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x48, 0x26, 0x5C, 0x3F, 0xCA, 0xE3, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x71, 0xBC, 0x10, 0x28, 0x9C, 0xFB, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x69, 0xDD, 0xFD, 0xBB, 0x15, 0x26, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x70, 0xA1, 0x15, 0x79, 0xF3, 0x90, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xCD, 0x42, 0xB3, 0xD6, 0x8B, 0x70, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x5F, 0x56, 0xA4, 0x5C, 0x02, 0x46, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x7D, 0x01, 0xB9, 0x01, 0x06, 0x4C, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xE5, 0xFA, 0xFF, 0xBC, 0x83, 0xFA, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x47, 0x3D, 0x77, 0xFE, 0xE1, 0xC8, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x00, 0x83, 0x56, 0x62, 0x09, 0xA2, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x9D, 0x1B, 0xA0, 0xF5, 0x84, 0x1D, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xB4, 0xD0, 0xC8, 0x5C, 0xDC, 0x32, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x1B, 0x7F, 0xE3, 0xEE, 0x46, 0x00, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x1D, 0x76, 0x37, 0x5E, 0x2F, 0x2D, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x3A, 0x76, 0x54, 0xB8, 0xDF, 0x06, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xCC, 0x0D, 0xC6, 0x40, 0x37, 0x22, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x1C, 0x67, 0x4C, 0xB4, 0x0F, 0x57, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x5D, 0x20, 0x5D, 0x8D, 0xF4, 0xD5, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x20, 0xE4, 0x07, 0x87, 0xB5, 0x31, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xB1, 0x6F, 0x7D, 0xBD, 0xA9, 0x05, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x63, 0x6E, 0xE6, 0xE8, 0x17, 0x2C, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x4A, 0xEA, 0x77, 0xE9, 0x39, 0xFC, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xCF, 0xA1, 0x30, 0x71, 0x8A, 0xFA, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAA, 0x16, 0x71, 0x94, 0x82, 0xC1, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x8B, 0xFB, 0x8A, 0x4A, 0xB2, 0xA7, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x60, 0x1B, 0xED, 0xB9, 0x30, 0xDD, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x4A, 0xA1, 0x23, 0x53, 0x5A, 0x62, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x2F, 0x93, 0x3B, 0x04, 0x5D, 0x33, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xBA, 0xAF, 0x09, 0x99, 0x81, 0xDA, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xA5, 0x75, 0x72, 0x9B, 0x21, 0x42, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x04, 0xA7, 0x7E, 0xC9, 0xD4, 0x3D, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xEA, 0x7A, 0x1B, 0x5C, 0x21, 0x93, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x65, 0x85, 0x0E, 0x3B, 0xA6, 0x25, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x01, 0x46, 0xAB, 0x37, 0x39, 0xBF, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x1A, 0xFC, 0xF6, 0x9A, 0x3D, 0x8C, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xC3, 0x47, 0x7E, 0xB3, 0xE2, 0xB4, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x86, 0x41, 0xC7, 0x7E, 0x81, 0x36, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x52, 0xE7, 0x8F, 0x08, 0xA1, 0xCE, 0x20 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_7[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x84, 0xBA, 0x15, 0x71, 0x2E, 0xCE, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x7E, 0xD8, 0xAB, 0xB2, 0xB7, 0xE1, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xEC, 0x5A, 0x3A, 0xDC, 0xDA, 0x6D, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x8C, 0xF5, 0xBA, 0xF2, 0x42, 0xAF, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x81, 0xC0, 0x49, 0x4F, 0xAA, 0x50, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xC0, 0x4B, 0x8B, 0x41, 0x34, 0x42, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x02, 0x93, 0x99, 0xFF, 0x3F, 0x82, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xBC, 0xC1, 0xA7, 0xD2, 0x30, 0x09, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE2, 0x8C, 0x77, 0x98, 0xDE, 0x06, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x47, 0xB9, 0x9B, 0xFD, 0x99, 0xDA, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xAA, 0x20, 0x42, 0x16, 0xA9, 0x1F, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x80, 0xC3, 0x3E, 0x31, 0x87, 0x6F, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xA5, 0xE2, 0x9F, 0x59, 0xDD, 0x21, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x95, 0x95, 0x09, 0xB4, 0xC2, 0x47, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x6F, 0x8E, 0x7F, 0x83, 0xBE, 0xFE, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xE7, 0x38, 0x45, 0x01, 0xE6, 0xF9, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x2D, 0xBF, 0x1D, 0xCF, 0x16, 0x96, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x1D, 0x5C, 0xA9, 0x03, 0xA9, 0x88, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x4A, 0x57, 0x3A, 0x15, 0xFA, 0x6E, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x50, 0x1A, 0x00, 0x14, 0xCB, 0xD7, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x50, 0x68, 0x1F, 0x5C, 0x63, 0xB7, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x56, 0x8B, 0xC4, 0xC5, 0x6B, 0x34, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x76, 0xE9, 0xF5, 0xAB, 0xFB, 0x27, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xAE, 0x3A, 0x62, 0x15, 0xF6, 0xBC, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xB7, 0x54, 0xCE, 0xAC, 0x33, 0x12, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x31, 0x96, 0x49, 0x6C, 0xB2, 0x24, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x90, 0x4C, 0xB8, 0x7E, 0x94, 0xC7, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xE3, 0x78, 0x21, 0x50, 0x38, 0xF7, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xD3, 0xBA, 0xFB, 0x77, 0x2B, 0x4C, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xE0, 0x42, 0x2B, 0xF2, 0xE6, 0x21, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x9B, 0x85, 0x66, 0xAD, 0x17, 0xE1, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xBE, 0xAC, 0x48, 0xB9, 0x04, 0x8C, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xFB, 0x02, 0x72, 0x03, 0x0C, 0x98, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xCA, 0xF5, 0xFF, 0x79, 0x07, 0xF5, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x8F, 0x7A, 0xEE, 0xFC, 0xC3, 0x91, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x01, 0x06, 0xAD, 0xC4, 0x12, 0x44, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x3A, 0x37, 0x40, 0xEB, 0x09, 0x3B, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x68, 0xA1, 0x91, 0xB9, 0xB8, 0x65, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x36, 0xFE, 0xC6, 0xDD, 0x8D, 0x00, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x3A, 0xEC, 0x6E, 0xBC, 0x5E, 0x5A, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x75, 0xEC, 0xA8, 0x70, 0xBF, 0x0D, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x99, 0x1B, 0x8C, 0x81, 0x6E, 0x44, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x39, 0xCE, 0x98, 0x68, 0x1F, 0xAE, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xBB, 0x40, 0xBA, 0x1A, 0xE9, 0xAB, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x40, 0xC8, 0x0F, 0x0E, 0x6B, 0x63, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x63, 0xDF, 0xFA, 0x7A, 0x53, 0x0B, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xC6, 0xDC, 0xCC, 0xD1, 0x2F, 0x58, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x94, 0xD4, 0xEF, 0xD2, 0x73, 0xF8, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x9F, 0x43, 0x61, 0xE2, 0x14, 0xF5, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x54, 0x2D, 0xE2, 0x28, 0x05, 0x83, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x17, 0xF7, 0x15, 0x95, 0x64, 0x4F, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xC1, 0x36, 0xDA, 0x73, 0x61, 0xBA, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x95, 0x42, 0x47, 0xA6, 0xB4, 0xC4, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x5E, 0x26, 0x77, 0x08, 0xBA, 0x66, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x75, 0x5F, 0x13, 0x32, 0x03, 0xB5, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x4B, 0xEB, 0xE4, 0x36, 0x43, 0x84, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x08, 0x4E, 0xFD, 0x92, 0xA9, 0x7B, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xD4, 0xF5, 0x36, 0xB8, 0x42, 0x26, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xCB, 0x0A, 0x1D, 0x76, 0x4C, 0x4B, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x02, 0x8C, 0x56, 0x6F, 0x72, 0x7E, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x34, 0xF8, 0xED, 0x35, 0x7B, 0x18, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x87, 0x8F, 0xFC, 0x66, 0xC5, 0x69, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x0D, 0x83, 0x8E, 0xFD, 0x02, 0x6D, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA5, 0xCE, 0x1F, 0x11, 0x42, 0x9D, 0x41 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_8[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x13, 0x49, 0xC6, 0xBF, 0x18, 0xC2, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xEC, 0x93, 0x8E, 0x9E, 0xB2, 0x51, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x4F, 0x77, 0xC1, 0x17, 0x2A, 0xB9, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x66, 0x8F, 0x03, 0x69, 0xC1, 0x66, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x37, 0x7F, 0x26, 0x97, 0x75, 0xE1, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xB5, 0x6A, 0x16, 0x65, 0x01, 0xCD, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x73, 0x1A, 0x40, 0xFE, 0x1A, 0x1F, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x72, 0xA5, 0xB1, 0x5F, 0x3B, 0x0A, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x8E, 0xA9, 0xD7, 0xE1, 0xDE, 0x84, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x5B, 0xC1, 0x24, 0x9C, 0x0C, 0x42, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x40, 0xF7, 0x1E, 0xC4, 0xE1, 0xC9, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xCE, 0xD0, 0x8A, 0x68, 0x64, 0x8C, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x29, 0xD2, 0x70, 0xE5, 0x50, 0x4A, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA8, 0x0C, 0x28, 0x45, 0xF2, 0x58, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xCD, 0x22, 0x3B, 0xBE, 0x3B, 0xC8, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xE3, 0x0E, 0xCE, 0x0A, 0x3D, 0x43, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1F, 0x80, 0x39, 0x77, 0x63, 0xFD, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x87, 0x02, 0x5C, 0x88, 0xE5, 0x20, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xE0, 0x69, 0x9D, 0x98, 0x14, 0x18, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x8F, 0xC5, 0x23, 0xF9, 0x42, 0x42, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xAA, 0x91, 0x8A, 0x35, 0x0C, 0xF3, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x91, 0xB9, 0xAB, 0x53, 0xDC, 0xA9, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x44, 0xF6, 0x66, 0xF1, 0x01, 0xD6, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xE6, 0x51, 0xB0, 0x11, 0x9A, 0xD6, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x7E, 0x1A, 0xF5, 0x00, 0x06, 0x02, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x3D, 0x08, 0x8A, 0xEC, 0x59, 0xFC, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x61, 0xFA, 0xC7, 0x72, 0x7F, 0xDF, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x77, 0x5B, 0x52, 0x35, 0x58, 0x01, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xB5, 0xCD, 0x67, 0x20, 0x56, 0xBD, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xD0, 0x8A, 0xD0, 0x06, 0x03, 0xBB, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x20, 0x77, 0x02, 0xED, 0x61, 0xC4, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xB8, 0xD7, 0x36, 0xC3, 0x33, 0x21, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x53, 0xD7, 0x09, 0x66, 0x6E, 0x80, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xD7, 0xD2, 0xEF, 0x9B, 0xEE, 0x9C, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x74, 0x0B, 0xC6, 0xAE, 0x88, 0xCE, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x9C, 0x75, 0x8C, 0x98, 0x81, 0xB8, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xFB, 0xBE, 0xCE, 0x9F, 0x37, 0xA2, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xD6, 0xA1, 0xC7, 0x7C, 0x35, 0x5E, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x06, 0x83, 0x1E, 0x1E, 0xF3, 0xE5, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x81, 0x02, 0x39, 0x6C, 0xEB, 0x5A, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x7E, 0xE1, 0x8E, 0xA3, 0x99, 0x26, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xE5, 0x97, 0xB1, 0xA3, 0x7F, 0xAB, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x8A, 0xC5, 0x0A, 0xCF, 0x91, 0x57, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x3A, 0x21, 0xC2, 0xE4, 0x58, 0x5B, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x3A, 0xFA, 0x50, 0xC7, 0xB1, 0x08, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x32, 0x08, 0xC4, 0xDC, 0xA4, 0xC6, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x5D, 0x90, 0xE4, 0x59, 0xCD, 0x81, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x87, 0x5F, 0xDC, 0x7C, 0x81, 0x8A, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x4D, 0xB4, 0x80, 0x24, 0x48, 0x77, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x4F, 0x6C, 0x0F, 0xED, 0x5B, 0xED, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xF5, 0x23, 0x09, 0xE6, 0x06, 0x2B, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xA7, 0xB7, 0x2F, 0x34, 0xE4, 0x53, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xFA, 0x95, 0xDD, 0x7E, 0xEC, 0x4B, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x4A, 0x3F, 0x0C, 0x3B, 0x34, 0x09, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x38, 0xDC, 0x51, 0x05, 0x3A, 0x01, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xF8, 0xA8, 0xF7, 0xBF, 0x85, 0x75, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xBA, 0x09, 0xEF, 0xAF, 0x96, 0x22, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x2A, 0xE0, 0x1D, 0x73, 0x65, 0x5D, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x28, 0x06, 0x34, 0x85, 0x3F, 0x0F, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x96, 0x47, 0x68, 0x08, 0xBD, 0x86, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x82, 0x58, 0x19, 0xB2, 0x9A, 0x36, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x6F, 0x06, 0x14, 0xB3, 0x5E, 0xCA, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x14, 0xBA, 0x7C, 0x36, 0x84, 0x31, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x21, 0x0E, 0x4F, 0x5A, 0x05, 0x65, 0x01 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_9[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x26, 0x92, 0x8C, 0x7F, 0x31, 0x84, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xD8, 0x27, 0x1D, 0x3D, 0x65, 0xA3, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x9E, 0xEE, 0x82, 0x2F, 0x54, 0x72, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xCC, 0x1E, 0x07, 0xD2, 0x82, 0xCD, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x6E, 0xFE, 0x4C, 0x2E, 0xEB, 0xC2, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6A, 0xD5, 0x2C, 0xCA, 0x02, 0x9A, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xE7, 0x34, 0x80, 0xFC, 0x35, 0x3E, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xE4, 0x4A, 0x63, 0xBF, 0x76, 0x14, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x1D, 0x53, 0xAF, 0xC3, 0xBD, 0x09, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xB7, 0x82, 0x49, 0x38, 0x19, 0x84, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x81, 0xEE, 0x3D, 0x88, 0xC3, 0x93, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x9D, 0xA1, 0x15, 0xD1, 0xC8, 0x18, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x53, 0xA4, 0xE1, 0xCA, 0xA1, 0x94, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x51, 0x19, 0x50, 0x8A, 0xE4, 0xB1, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x9A, 0x45, 0x76, 0x7C, 0x77, 0x90, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xC6, 0x1D, 0x9C, 0x15, 0x7A, 0x86, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x3E, 0x00, 0x73, 0xEE, 0xC6, 0xFA, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x0E, 0x05, 0xB8, 0x10, 0xCB, 0x41, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xC1, 0xD3, 0x3A, 0x31, 0x29, 0x30, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x1F, 0x8B, 0x47, 0xF2, 0x85, 0x84, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x54, 0x23, 0x15, 0x6B, 0x18, 0xE6, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x23, 0x73, 0x57, 0xA7, 0xB8, 0x53, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x89, 0xEC, 0xCD, 0xE2, 0x03, 0xAC, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xCD, 0xA3, 0x60, 0x23, 0x34, 0xAD, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xFD, 0x34, 0xEA, 0x01, 0x0C, 0x04, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x7B, 0x10, 0x14, 0xD9, 0xB3, 0xF8, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xC2, 0xF4, 0x8F, 0xE5, 0xFE, 0xBE, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xEF, 0xB6, 0xA4, 0x6A, 0xB0, 0x02, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x6B, 0x9B, 0xCF, 0x40, 0xAC, 0x7A, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xA0, 0x15, 0xA1, 0x0D, 0x06, 0x76, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x40, 0xEE, 0x04, 0xDA, 0xC3, 0x88, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x70, 0xAF, 0x6D, 0x86, 0x67, 0x42, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xA6, 0xAE, 0x13, 0xCC, 0xDC, 0x00, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xAF, 0xA5, 0xDF, 0x37, 0xDD, 0x39, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xE8, 0x16, 0x8C, 0x5D, 0x11, 0x9D, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x38, 0xEB, 0x18, 0x31, 0x03, 0x71, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xF6, 0x7D, 0x9D, 0x3F, 0x6F, 0x44, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xAC, 0x43, 0x8F, 0xF9, 0x6A, 0xBC, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x0D, 0x06, 0x3D, 0x3C, 0xE6, 0xCB, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x03, 0x05, 0x72, 0xD8, 0xD6, 0xB5, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xFC, 0xC2, 0x1D, 0x47, 0x33, 0x4D, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xCA, 0x2F, 0x63, 0x47, 0xFF, 0x56, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x14, 0x8B, 0x15, 0x9E, 0x23, 0xAF, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x74, 0x42, 0x84, 0xC9, 0xB1, 0xB6, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x75, 0xF4, 0xA1, 0x8E, 0x63, 0x11, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x64, 0x10, 0x88, 0xB9, 0x49, 0x8D, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xBA, 0x20, 0xC9, 0xB3, 0x9A, 0x03, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x0F, 0xBF, 0xB8, 0xF9, 0x02, 0x15, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x9A, 0x68, 0x01, 0x49, 0x90, 0xEE, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x9F, 0xD8, 0x1E, 0xDA, 0xB7, 0xDA, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xEB, 0x47, 0x12, 0xCC, 0x0D, 0x56, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x4E, 0x6F, 0x5F, 0x68, 0xC8, 0xA7, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xF4, 0x2B, 0xBB, 0xFD, 0xD8, 0x97, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x94, 0x7E, 0x18, 0x76, 0x68, 0x12, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x71, 0xB8, 0xA3, 0x0A, 0x74, 0x02, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xF0, 0x51, 0xEF, 0x7F, 0x0B, 0xEB, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x75, 0x13, 0xDE, 0x5F, 0x2D, 0x45, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x55, 0xC0, 0x3B, 0xE6, 0xCA, 0xBA, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x51, 0x0C, 0x68, 0x0A, 0x7F, 0x1E, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x2D, 0x8F, 0xD0, 0x10, 0x7A, 0x0D, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x05, 0xB1, 0x32, 0x64, 0x35, 0x6D, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xDE, 0x0C, 0x28, 0x66, 0xBD, 0x94, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x29, 0x74, 0xF9, 0x6C, 0x08, 0x63, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x42, 0x1C, 0x9E, 0xB4, 0x0A, 0xCA, 0x02 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_10[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xB6, 0x7D, 0x1B, 0x32, 0xDC, 0xCE, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x4F, 0x17, 0xA0, 0x5D, 0x12, 0xEE, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x5B, 0x7A, 0x01, 0x07, 0x2E, 0x23, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x30, 0x54, 0x30, 0x48, 0x23, 0xA2, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xC6, 0x3C, 0x57, 0x69, 0xF5, 0xA2, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xFD, 0x84, 0x28, 0x6A, 0x04, 0x02, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xD2, 0xCB, 0x41, 0xAB, 0x9F, 0x3C, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x7B, 0x2B, 0x4F, 0x80, 0xA0, 0x83, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xA4, 0x3F, 0x42, 0xED, 0x82, 0xD4, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x29, 0xC9, 0xE7, 0x93, 0x59, 0xF3, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x77, 0x63, 0xC2, 0xB0, 0x04, 0x04, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x5D, 0x1E, 0x63, 0x7D, 0x73, 0xC4, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x93, 0xFC, 0x73, 0x2E, 0xB5, 0x2F, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xA2, 0xD4, 0xA7, 0x0C, 0x17, 0x06, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xF3, 0xDF, 0x56, 0x69, 0x8C, 0xC9, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x4C, 0xCB, 0x13, 0x1F, 0xBD, 0x58, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x60, 0xAF, 0x35, 0x3D, 0x92, 0x15, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x34, 0x19, 0xE1, 0x6F, 0x96, 0xA1, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xCA, 0xFA, 0x49, 0xA6, 0xDE, 0xBF, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x10, 0xAF, 0x01, 0xB3, 0xA2, 0xF8, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x78, 0x0A, 0x4A, 0x56, 0x41, 0x8C, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xD8, 0xDB, 0xAE, 0xA9, 0xA9, 0x8C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x71, 0x41, 0x08, 0x56, 0x0E, 0x50, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x3A, 0xED, 0x33, 0x3A, 0xDC, 0xC8, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x87, 0xBF, 0x22, 0xA4, 0x5B, 0x10, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x39, 0xA3, 0x9F, 0x01, 0x18, 0x50, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x72, 0x9C, 0xF8, 0xD6, 0x7E, 0x06, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x09, 0xE5, 0xA3, 0x61, 0xA2, 0x18, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xA4, 0x75, 0xA9, 0x68, 0xC0, 0x61, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x7A, 0x80, 0xD8, 0x29, 0x5F, 0xE3, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xE0, 0x1E, 0xD5, 0xF4, 0xC7, 0xC0, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x0D, 0x2A, 0x1F, 0x7E, 0x09, 0x72, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x02, 0x9A, 0x53, 0x12, 0xF5, 0x0B, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x7A, 0x48, 0xE2, 0xF4, 0x9D, 0xD7, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x15, 0x5D, 0xB0, 0x7B, 0x26, 0x84, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x84, 0xA2, 0xCC, 0xCE, 0x1E, 0x59, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x02, 0x65, 0x3E, 0x5E, 0xFC, 0xE7, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x34, 0x25, 0x0E, 0x90, 0xF2, 0xBC, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x96, 0xEC, 0x8A, 0x57, 0xDD, 0x7F, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x4B, 0xC2, 0xDA, 0x80, 0x26, 0x13, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x76, 0x06, 0xDA, 0x56, 0xE4, 0xCD, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xDA, 0xEA, 0xD4, 0x4A, 0xCC, 0x43, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF6, 0xC5, 0xD4, 0x46, 0xE9, 0xA5, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x94, 0x29, 0x58, 0xC0, 0x13, 0x1C, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x48, 0xB1, 0xBC, 0x3A, 0xA5, 0x88, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xA0, 0xD9, 0x79, 0x07, 0x5F, 0x0A, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x20, 0xE7, 0xF5, 0x86, 0x8F, 0x72, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x32, 0xA1, 0x9E, 0xBC, 0x88, 0xE3, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x3B, 0xBE, 0xF2, 0x04, 0xC4, 0xA1, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x3F, 0xF3, 0xE3, 0x1A, 0x4F, 0xE4, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x24, 0x84, 0x71, 0x29, 0xC8, 0x41, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x0D, 0x44, 0x52, 0x2D, 0x63, 0xA9, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x4F, 0xA5, 0xA8, 0x5A, 0x46, 0x08, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xE6, 0xFB, 0x47, 0x9F, 0x8D, 0xF1, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xC0, 0x21, 0x2A, 0x56, 0xD5, 0x47, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x5D, 0xA4, 0xBD, 0x7E, 0xEB, 0x85, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x7A, 0x29, 0xDC, 0x31, 0x3C, 0x7D, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x19, 0x6C, 0x1E, 0xD9, 0x17, 0xDD, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xB7, 0xAE, 0xC4, 0x3C, 0x84, 0xE6, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x33, 0x81, 0x8D, 0xE4, 0xDA, 0xC7, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x32, 0x74, 0xCD, 0x81, 0xFE, 0xF2, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x59, 0xA1, 0xD6, 0x87, 0x8C, 0x5B, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x5F, 0x6F, 0x52, 0x44, 0xD9, 0x73, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xB7, 0xBF, 0x23, 0xED, 0xF3, 0xEC, 0x9A ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_11[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x6D, 0xFB, 0x36, 0x64, 0xB8, 0x9D, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x3F, 0xC9, 0xE1, 0x3C, 0x24, 0x52, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x34, 0xB3, 0x0E, 0xBC, 0xB3, 0x90, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xBB, 0x1F, 0xE1, 0x35, 0x91, 0x7A, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x0E, 0xB0, 0xDF, 0x04, 0x59, 0xC3, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xF1, 0x7C, 0x57, 0x2A, 0x3A, 0xB5, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xA4, 0x57, 0x12, 0x19, 0x86, 0x5B, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x6C, 0x8B, 0x6A, 0x5D, 0xA7, 0xDD, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x48, 0xD2, 0x12, 0xE1, 0x8C, 0xE1, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x22, 0x11, 0x3E, 0x1D, 0x53, 0xDF, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x87, 0x28, 0x57, 0x60, 0xEB, 0x9D, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x88, 0x88, 0xD6, 0x73, 0x1E, 0x53, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x59, 0xC7, 0x69, 0xB7, 0x0E, 0x6A, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x04, 0xA6, 0xFA, 0xFB, 0x5E, 0xA8, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x79, 0x20, 0xD7, 0x8F, 0xB9, 0x15, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x40, 0x0E, 0x42, 0x59, 0x90, 0x80, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xCB, 0x10, 0x55, 0xB7, 0xD1, 0xBB, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x49, 0x94, 0x5B, 0xB4, 0x0F, 0x5F, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xF6, 0x1F, 0x54, 0x5E, 0x9C, 0x64, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x43, 0x0A, 0x09, 0xFA, 0x74, 0x34, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xA8, 0x50, 0xBE, 0x69, 0xE8, 0x58, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xC5, 0xA9, 0xC2, 0xBB, 0x31, 0x54, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xA9, 0x4C, 0xEE, 0xE6, 0xF0, 0x32, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x7F, 0x3C, 0xCB, 0xC8, 0x35, 0xE3, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xC3, 0x89, 0xD3, 0x29, 0xD5, 0x2D, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x24, 0x6F, 0x5C, 0xB0, 0xEB, 0xA2, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x6C, 0xF5, 0x34, 0x1A, 0xF1, 0xF9, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x7F, 0xB6, 0xC2, 0xB9, 0x31, 0x33, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x6F, 0x64, 0x91, 0xD6, 0xCF, 0x36, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xFC, 0x08, 0x1F, 0x2D, 0xA1, 0xED, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xF8, 0x56, 0xD3, 0x1F, 0x20, 0xCD, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x18, 0xB8, 0x44, 0x1D, 0x1E, 0xAF, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x01, 0x1B, 0x42, 0xE9, 0x8E, 0xE2, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x25, 0x71, 0x63, 0xB1, 0xF9, 0x43, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x3B, 0x07, 0x9F, 0xD0, 0x02, 0x15, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x85, 0x2E, 0x1C, 0x1A, 0x4C, 0x23, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xE5, 0x07, 0x4E, 0x00, 0xFC, 0x19, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xBB, 0xDA, 0xCF, 0x04, 0xAA, 0x7B, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xAC, 0xE6, 0x26, 0x7C, 0xA8, 0xB0, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x12, 0xFF, 0xCB, 0x64, 0x4E, 0xB3, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xBD, 0xD8, 0x8B, 0xE0, 0xC3, 0x67, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xD1, 0xDD, 0xDB, 0xB3, 0x9B, 0x84, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x80, 0x81, 0xBB, 0xC4, 0x2A, 0x44, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x6D, 0xE0, 0x4C, 0x99, 0x39, 0xE1, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x43, 0x29, 0x9B, 0xD1, 0x07, 0xC2, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x4C, 0xDB, 0x92, 0x57, 0xE3, 0xA9, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x5C, 0x05, 0x39, 0xC2, 0x75, 0xDC, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x6A, 0x1D, 0x8A, 0xF6, 0x5F, 0xBC, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xFD, 0x41, 0x9D, 0xBA, 0xBD, 0x96, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x98, 0x38, 0x91, 0x94, 0x45, 0xD7, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x60, 0x18, 0xEF, 0x77, 0x06, 0xDD, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x8E, 0xA1, 0xC3, 0xE9, 0xB9, 0x03, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xD6, 0xF2, 0xD1, 0x56, 0x79, 0xB9, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xB1, 0x0A, 0x52, 0xE9, 0xB5, 0x7F, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x12, 0x3D, 0xF5, 0x8C, 0xB5, 0x5B, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x54, 0x4B, 0xA5, 0x27, 0xB8, 0x2C, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x93, 0x8E, 0x09, 0x61, 0xC6, 0x78, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xBE, 0xCB, 0xD9, 0x4E, 0x4C, 0x8A, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x2F, 0xC2, 0x64, 0xAB, 0x6A, 0x39, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x33, 0x9E, 0x06, 0x88, 0x7F, 0xAE, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x2D, 0xBB, 0xCC, 0x7F, 0x37, 0x2C, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x76, 0x05, 0x86, 0xEF, 0xC2, 0xDA, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x74, 0x23, 0x02, 0x30, 0x5E, 0xEF, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x6F, 0x7F, 0x47, 0xDA, 0xE7, 0xD9, 0x35 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_12[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x5B, 0xDB, 0x87, 0xB9, 0x85, 0x29, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x06, 0x6C, 0x98, 0x1B, 0xC5, 0x34, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xA1, 0x96, 0x4B, 0xD7, 0x14, 0x02, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xE8, 0xF3, 0x1E, 0x39, 0xFF, 0x5A, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x6A, 0x1F, 0x7B, 0xC9, 0xAB, 0xF0, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x2C, 0x2F, 0x55, 0x9B, 0x82, 0xDF, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xB4, 0x86, 0x29, 0x50, 0xD7, 0xC0, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x17, 0x03, 0x67, 0x03, 0xAB, 0xDC, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xE2, 0x57, 0x50, 0xD5, 0xBF, 0x5B, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x66, 0xF3, 0x30, 0x62, 0x0A, 0xD0, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x04, 0xB8, 0x8D, 0x1B, 0x12, 0x72, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x34, 0x96, 0xCD, 0x35, 0x93, 0x98, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x5B, 0xAB, 0x54, 0x2B, 0xEE, 0x22, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xDF, 0x0A, 0xFB, 0x48, 0xE7, 0xB9, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x6B, 0x75, 0x0D, 0x8C, 0xC7, 0x3B, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xB2, 0x8D, 0x20, 0x71, 0x13, 0xAE, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x26, 0xC8, 0xF0, 0x90, 0x45, 0x42, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x11, 0x14, 0x48, 0x1B, 0x8F, 0xBD, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x4D, 0xF9, 0x47, 0x4A, 0x30, 0xE9, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xE3, 0x7E, 0xD9, 0xFD, 0x12, 0x87, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x38, 0xE6, 0x3D, 0xFC, 0x97, 0x47, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xAF, 0xAE, 0x47, 0xFD, 0x19, 0xCA, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x07, 0xA5, 0x2F, 0xE8, 0x74, 0x7B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x27, 0xB0, 0x4C, 0xC4, 0x1A, 0x0C, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xDE, 0x51, 0x54, 0x42, 0xD3, 0x4C, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x90, 0x04, 0xFB, 0x1D, 0x8A, 0xEB, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xBE, 0xD6, 0x24, 0x6B, 0x6A, 0xD3, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x65, 0xD9, 0xB3, 0xC1, 0x6D, 0x03, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x7C, 0x2C, 0x0A, 0xB0, 0xAA, 0x9D, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x75, 0x2B, 0x00, 0xAE, 0xF2, 0xC6, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x3A, 0x45, 0x89, 0x93, 0x55, 0x88, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x28, 0xC1, 0x5C, 0xD8, 0x5D, 0x29, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x16, 0x1B, 0x63, 0x1D, 0x88, 0x5D, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x80, 0x32, 0x07, 0x71, 0x74, 0x85, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xC4, 0xAE, 0x78, 0xAF, 0xBF, 0xCE, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xB3, 0x89, 0x86, 0x60, 0x45, 0xC5, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x97, 0xA2, 0x31, 0xA9, 0x5B, 0x11, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xF6, 0x45, 0xBF, 0x42, 0xCE, 0x6D, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x70, 0x87, 0x9D, 0x3F, 0xA9, 0x08, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xED, 0xFB, 0xD3, 0x48, 0xE3, 0x32, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xCA, 0xEA, 0xD6, 0xB8, 0xDE, 0x48, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x4C, 0xD6, 0xCA, 0x3D, 0x43, 0x93, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xFC, 0xED, 0x95, 0xEB, 0x64, 0x46, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xA8, 0x63, 0xF2, 0x0C, 0x97, 0x4B, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x6E, 0x38, 0x16, 0x93, 0x7D, 0x61, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xF7, 0xBB, 0x77, 0x6B, 0x57, 0xA1, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x6E, 0x4E, 0xF3, 0x7F, 0xEE, 0x7D, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xEF, 0x49, 0x22, 0xED, 0x9B, 0x3C, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xE1, 0x3D, 0x77, 0xE8, 0xAA, 0xBC, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x85, 0x58, 0xFD, 0x71, 0xE4, 0x8A, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xE8, 0xF2, 0xE2, 0xCD, 0xED, 0xC3, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x14, 0x3F, 0x39, 0x3F, 0x49, 0xA4, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xA4, 0x23, 0x14, 0x10, 0xA7, 0xD9, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xB2, 0x28, 0xC9, 0xF0, 0xE3, 0xE3, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xA0, 0x93, 0x13, 0xC0, 0xD3, 0xE3, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xC8, 0xE6, 0x8B, 0xCA, 0x1F, 0x69, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xA2, 0x2F, 0x0B, 0x1C, 0x43, 0x17, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x93, 0x2C, 0x30, 0x5E, 0xA6, 0x0B, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xFF, 0x1F, 0x02, 0x5D, 0xD2, 0x5D, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x4D, 0xF6, 0x64, 0x8A, 0x55, 0x40, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x56, 0xC4, 0x54, 0x11, 0xCA, 0xD4, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x69, 0x06, 0x75, 0x8E, 0x90, 0x0B, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x37, 0x06, 0xE1, 0xF3, 0x7E, 0x77, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x02, 0x92, 0xA4, 0xA2, 0xCD, 0x60, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_13[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xB6, 0xB6, 0x0F, 0x73, 0x0B, 0x53, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x0D, 0xD8, 0x30, 0x37, 0x8A, 0x69, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x42, 0x2D, 0x97, 0xAE, 0x29, 0x04, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xD0, 0xE7, 0x3D, 0x72, 0xFE, 0xB5, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xD5, 0x3E, 0xF6, 0x92, 0x57, 0xE1, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x59, 0x5E, 0xAA, 0x36, 0x05, 0xBF, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x69, 0x0D, 0x53, 0xA0, 0xAE, 0x81, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x2E, 0x06, 0xCE, 0x06, 0x56, 0xB9, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xC5, 0xAF, 0xA0, 0xAA, 0x7F, 0xB7, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xCD, 0xE6, 0x61, 0xC4, 0x14, 0xA0, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x08, 0x70, 0x1B, 0x37, 0x24, 0xE4, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x69, 0x2C, 0x9B, 0x6B, 0x26, 0x31, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xB6, 0x56, 0xA9, 0x56, 0xDC, 0x45, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xBF, 0x15, 0xF6, 0x91, 0xCE, 0x73, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xD6, 0xEA, 0x1A, 0x18, 0x8F, 0x77, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x65, 0x1B, 0x41, 0xE2, 0x26, 0x5C, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x4C, 0x90, 0xE1, 0x21, 0x8B, 0x84, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x22, 0x28, 0x90, 0x36, 0x1E, 0x7B, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x9B, 0xF2, 0x8F, 0x94, 0x60, 0xD2, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xC6, 0xFD, 0xB2, 0xFB, 0x25, 0x0E, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x70, 0xCC, 0x7B, 0xF8, 0x2F, 0x8F, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x5E, 0x5D, 0x8F, 0xFA, 0x33, 0x94, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x0F, 0x4A, 0x5F, 0xD0, 0xE9, 0xF6, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x4F, 0x60, 0x99, 0x88, 0x35, 0x18, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xBD, 0xA3, 0xA8, 0x84, 0xA6, 0x99, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x20, 0x09, 0xF6, 0x3B, 0x14, 0xD7, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x7D, 0xAD, 0x49, 0xD6, 0xD4, 0xA6, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xCA, 0xB2, 0x67, 0x83, 0xDB, 0x06, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xF8, 0x58, 0x14, 0x60, 0x55, 0x3B, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xEB, 0x56, 0x00, 0x5C, 0xE5, 0x8D, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x74, 0x8A, 0x12, 0x27, 0xAB, 0x10, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x50, 0x82, 0xB9, 0xB0, 0xBB, 0x52, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x2D, 0x36, 0xC6, 0x3A, 0x10, 0xBB, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x00, 0x65, 0x0E, 0xE2, 0xE8, 0x0A, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x88, 0x5D, 0xF1, 0x5E, 0x7F, 0x9D, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x67, 0x13, 0x0D, 0xC1, 0x8A, 0x8A, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x2F, 0x45, 0x63, 0x52, 0xB7, 0x22, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xED, 0x8B, 0x7E, 0x85, 0x9C, 0xDB, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xE1, 0x0E, 0x3B, 0x7F, 0x52, 0x11, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xDA, 0xF7, 0xA7, 0x91, 0xC6, 0x65, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x94, 0xD5, 0xAD, 0x71, 0xBD, 0x91, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x98, 0xAC, 0x95, 0x7B, 0x86, 0x26, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xF8, 0xDB, 0x2B, 0xD7, 0xC9, 0x8C, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x51, 0xC7, 0xE4, 0x19, 0x2E, 0x97, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xDD, 0x70, 0x2C, 0x26, 0xFB, 0xC2, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xEF, 0x77, 0xEF, 0xD6, 0xAE, 0x42, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xDC, 0x9C, 0xE6, 0xFF, 0xDC, 0xFB, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xDE, 0x93, 0x44, 0xDA, 0x37, 0x79, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xC3, 0x7B, 0xEE, 0xD0, 0x55, 0x79, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x0A, 0xB1, 0xFA, 0xE3, 0xC8, 0x15, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xD1, 0xE5, 0xC5, 0x9B, 0xDB, 0x87, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x28, 0x7E, 0x72, 0x7E, 0x92, 0x48, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x49, 0x47, 0x28, 0x20, 0x4E, 0xB3, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x65, 0x51, 0x92, 0xE1, 0xC7, 0xC7, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x40, 0x27, 0x27, 0x80, 0xA7, 0xC7, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x91, 0xCD, 0x17, 0x95, 0x3F, 0xD2, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x45, 0x5F, 0x16, 0x38, 0x86, 0x2E, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x27, 0x59, 0x60, 0xBC, 0x4C, 0x17, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xFF, 0x3F, 0x04, 0xBA, 0xA4, 0xBB, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x9A, 0xEC, 0xC9, 0x14, 0xAB, 0x80, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xAD, 0x88, 0xA9, 0x22, 0x94, 0xA9, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xD2, 0x0C, 0xEA, 0x1C, 0x21, 0x17, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x6F, 0x0C, 0xC2, 0xE7, 0xFD, 0xEE, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x04, 0x24, 0x49, 0x45, 0x9B, 0xC1, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_14[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xE7, 0x6C, 0x8D, 0xB3, 0xD5, 0xDC, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xB5, 0x04, 0x42, 0x2F, 0xBE, 0x94, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x30, 0xF1, 0xDE, 0x32, 0xC0, 0x77, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xB4, 0x7F, 0x87, 0x14, 0xA3, 0xA8, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x8D, 0x9C, 0xD8, 0x47, 0x5F, 0x42, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x8F, 0x28, 0xF5, 0x97, 0x95, 0xDB, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xE6, 0x3A, 0x49, 0xE3, 0x0D, 0x9A, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x9A, 0x17, 0x9C, 0x8B, 0x6F, 0xAA, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x0B, 0xDA, 0x8D, 0xA9, 0x54, 0x00, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xB1, 0x58, 0x77, 0xA1, 0x69, 0x93, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xC2, 0x68, 0xFC, 0x2F, 0x02, 0x42, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x84, 0x70, 0x82, 0x25, 0x26, 0x7C, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xB0, 0x52, 0x9D, 0x7F, 0xBE, 0x14, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x6A, 0x3A, 0x88, 0xA0, 0x79, 0x88, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xAE, 0xA0, 0x19, 0xC5, 0x2E, 0xBD, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x8E, 0x90, 0x57, 0x0B, 0xC3, 0xE8, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x34, 0x1D, 0x9B, 0x4D, 0x27, 0x90, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x8F, 0x55, 0xF1, 0x26, 0x95, 0xEB, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xAB, 0xC2, 0xF7, 0x3A, 0xFB, 0x46, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x9B, 0x04, 0x2E, 0x5F, 0x41, 0x7E, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x04, 0xE7, 0x5C, 0xE3, 0x25, 0x00, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xC9, 0x4D, 0x5B, 0x86, 0x8D, 0x21, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x40, 0x88, 0xB3, 0xF6, 0x8A, 0xF7, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x15, 0x2B, 0xFA, 0xAB, 0xE1, 0x68, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x9A, 0xC8, 0x45, 0x39, 0x72, 0x2F, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x26, 0x2B, 0x3C, 0x96, 0x98, 0x28, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x3E, 0x71, 0x1B, 0x4E, 0x78, 0xDC, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x14, 0x8B, 0xA3, 0xAD, 0x05, 0xB7, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xAE, 0xBB, 0x66, 0xCF, 0xAA, 0x4F, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x6A, 0xF7, 0x8D, 0x8B, 0xCB, 0xA7, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xE3, 0x12, 0x00, 0x0A, 0xA3, 0x87, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x67, 0xE6, 0x48, 0xBD, 0xF8, 0xBA, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xBF, 0xA8, 0x23, 0xBB, 0xFE, 0xA2, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x77, 0x08, 0x18, 0xCB, 0x06, 0x4C, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x95, 0x1D, 0x0F, 0x42, 0x9E, 0xDD, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xAA, 0x0B, 0xAD, 0x85, 0x2E, 0xB9, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x9C, 0x06, 0x38, 0x9E, 0x59, 0x0F, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x3A, 0x25, 0xFC, 0x2A, 0x6A, 0xCE, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x29, 0x11, 0x3E, 0x36, 0xF8, 0x5A, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xFC, 0x0D, 0x97, 0x3E, 0x04, 0xD2, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xEA, 0xBD, 0x45, 0x22, 0xC6, 0x8A, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x8F, 0x6C, 0xE1, 0x1B, 0xBE, 0xEF, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xBD, 0x66, 0x7C, 0xEB, 0xED, 0x65, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xA9, 0x6A, 0xE6, 0x9C, 0xF0, 0x35, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x60, 0x5D, 0xD4, 0x87, 0x6B, 0x14, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xB5, 0x77, 0x58, 0x57, 0xA8, 0x8C, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xE0, 0x87, 0x88, 0xB6, 0x26, 0xD6, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x69, 0xFA, 0x71, 0x9A, 0x92, 0xBB, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x14, 0x78, 0x0D, 0xDE, 0x02, 0xF4, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x33, 0x1B, 0xD6, 0xCC, 0x61, 0x71, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xC8, 0x68, 0x4E, 0xC4, 0xA4, 0x7A, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x83, 0x57, 0x9D, 0xE4, 0xAB, 0x9E, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x6A, 0x8F, 0xC0, 0xEC, 0x6C, 0x91, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x8B, 0x26, 0x9E, 0x93, 0x92, 0xDC, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x38, 0x93, 0x20, 0x55, 0x10, 0x06, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x5E, 0x38, 0x7D, 0x52, 0x08, 0xD9, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x75, 0x13, 0x3A, 0xB5, 0x40, 0xD6, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x1A, 0x3C, 0xAF, 0xFC, 0x81, 0x75, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xEA, 0x72, 0xE5, 0x59, 0xFA, 0x1D, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xC0, 0x2D, 0x8D, 0xBA, 0x28, 0x63, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xD7, 0xD0, 0xA5, 0xAC, 0x7F, 0x72, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xC3, 0xDD, 0xE6, 0x4F, 0x40, 0x2F, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x4F, 0xED, 0x1C, 0x61, 0x16, 0xBA, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x37, 0x06, 0x40, 0x14, 0x69, 0xD3, 0xE2 ),
+};
+static const mbedtls_mpi_uint ffdhe4096_T_15[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xCF, 0xD9, 0x1A, 0x67, 0xAB, 0xB9, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x0C, 0xA4, 0x25, 0xE0, 0x7B, 0x9F, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xDD, 0xA0, 0xC9, 0x13, 0xD8, 0x39, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xC3, 0x76, 0x8F, 0xCE, 0x90, 0x87, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x9C, 0x6F, 0xE2, 0xC1, 0x2C, 0x02, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x15, 0xC4, 0xF0, 0x85, 0x5C, 0x68, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xCD, 0x35, 0x21, 0x89, 0x62, 0x16, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xA9, 0x63, 0x04, 0x74, 0x45, 0x2B, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x17, 0x07, 0xAA, 0x59, 0x30, 0x39, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x31, 0x30, 0x5D, 0x38, 0x73, 0x1F, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x1C, 0x33, 0xCB, 0x5E, 0xE6, 0x19, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xD7, 0x2C, 0x15, 0xC4, 0x83, 0xC2, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x94, 0x73, 0xBC, 0x59, 0x21, 0x34, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x94, 0x71, 0xBB, 0x23, 0x24, 0xAD, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xF0, 0xA1, 0x5C, 0x47, 0xFE, 0xFC, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xC4, 0x98, 0xC9, 0x31, 0x9C, 0xA0, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x74, 0xEC, 0x1F, 0xD8, 0xFB, 0xB0, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x00, 0x0D, 0x7C, 0x22, 0x0D, 0xF3, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xB9, 0xAF, 0xAF, 0x87, 0xD5, 0x72, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x58, 0xB5, 0x61, 0x52, 0xB2, 0x3F, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xC0, 0x09, 0xE4, 0x83, 0xB1, 0x40, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xA8, 0x8D, 0x1B, 0x75, 0xF9, 0x7D, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x46, 0xDA, 0x44, 0x28, 0xEA, 0x81, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x35, 0xB8, 0x57, 0xAC, 0x40, 0x23, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xE9, 0x9B, 0x19, 0x54, 0x02, 0x6C, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xFE, 0x7E, 0x95, 0xD9, 0xEC, 0x53, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x03, 0x9F, 0x7A, 0x08, 0xE4, 0xA5, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x96, 0x02, 0xC2, 0x51, 0xF8, 0x6F, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x84, 0xF0, 0x0B, 0xA4, 0xA4, 0x12, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xDD, 0xF6, 0x89, 0xF0, 0x79, 0x76, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xFE, 0x3E, 0x29, 0x4A, 0xD6, 0x5A, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xCB, 0x30, 0x98, 0x9B, 0xFC, 0x40, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x7B, 0x38, 0xE2, 0x3A, 0xA2, 0x10, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x1F, 0xF1, 0xCE, 0x5D, 0xCB, 0x2C, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x3B, 0x88, 0x5C, 0x5D, 0xF2, 0xC7, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xD1, 0x00, 0xDD, 0x87, 0x6B, 0xE3, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x19, 0x4B, 0x41, 0x80, 0xB6, 0x68, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xC8, 0xDA, 0xAB, 0x3A, 0x99, 0x9E, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xD1, 0x2F, 0x8D, 0x39, 0xDE, 0x66, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x74, 0x96, 0x44, 0xE0, 0x09, 0x31, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xA4, 0x47, 0x63, 0x77, 0x87, 0xE1, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x3B, 0xE1, 0xF4, 0x55, 0x7F, 0xDC, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x0D, 0xC3, 0x0A, 0x0E, 0x34, 0xC4, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x98, 0x62, 0x69, 0x52, 0xF3, 0x14, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x73, 0x81, 0xCA, 0x6B, 0x94, 0xD9, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x75, 0x17, 0x50, 0xF7, 0x75, 0xAE, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xDC, 0x46, 0x5E, 0x21, 0xA4, 0xA3, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xD6, 0xCF, 0x30, 0xB2, 0x73, 0x6C, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xB0, 0xB5, 0xD2, 0x6C, 0x3B, 0x3B, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x80, 0x88, 0x75, 0xF8, 0x6A, 0xF1, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xA9, 0xE1, 0xA8, 0xAD, 0xBF, 0x4E, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x7B, 0xC8, 0x59, 0x58, 0x4B, 0xEE, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x0B, 0xC7, 0x01, 0x7B, 0xC6, 0xCB, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xFC, 0x5F, 0xFE, 0xD1, 0xBF, 0x55, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x01, 0x20, 0xE2, 0x8A, 0x2B, 0xD8, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x57, 0x73, 0x24, 0xCF, 0xF1, 0xD2, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x89, 0x62, 0xC5, 0x67, 0xCF, 0x2A, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xBF, 0x6B, 0xFB, 0x95, 0x20, 0xBB, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x96, 0x4A, 0xA6, 0xE5, 0x56, 0xA8, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x4D, 0xF7, 0x05, 0x34, 0x1B, 0xE5, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x78, 0x74, 0x7D, 0xD5, 0x39, 0x2B, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x4A, 0x7E, 0xA6, 0x7F, 0x2A, 0x82, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x54, 0x1F, 0x97, 0x69, 0xD8, 0x7B, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x6E, 0x0C, 0x80, 0x28, 0xD2, 0xA6, 0xC5 ),
+};
+static const mbedtls_mpi ffdhe4096_P = DHM_MPI_INIT_ARRAY( ffdhe4096_p );
+static const mbedtls_mpi ffdhe4096_T[15] = {
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_1 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_2 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_3 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_4 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_5 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_6 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_7 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_8 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_9 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_10 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_11 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_12 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_13 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_14 ),
+    DHM_MPI_INIT_ARRAY( ffdhe4096_T_15 ),
+};
+
+static const mbedtls_mpi_uint ffdhe6144_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x0E, 0xE4, 0xD0, 0x9C, 0x32, 0x0E, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xDA, 0x38, 0x79, 0x0D, 0x57, 0x1D, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x61, 0x31, 0xD4, 0x26, 0x95, 0xA6, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x1E, 0xDB, 0x9A, 0x8E, 0x4A, 0xDD, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x80, 0x6B, 0xDC, 0xF9, 0x71, 0x3B, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x2B, 0x27, 0xC6, 0x10, 0x18, 0x9D, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xF4, 0xCE, 0xCA, 0xD5, 0x2D, 0xCF, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x91, 0x5B, 0xC9, 0x35, 0x52, 0x9F, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x33, 0x54, 0xB8, 0x2D, 0xC8, 0x5D, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xA8, 0x62, 0x15, 0x31, 0x2C, 0x29, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x7F, 0xE7, 0x6A, 0x74, 0x03, 0x2B, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x53, 0x2D, 0x46, 0x1B, 0x09, 0xC9, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x7C, 0xA6, 0x47, 0x58, 0xDB, 0xE8, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x16, 0x61, 0x22, 0xC1, 0x39, 0xA7, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x1B, 0x28, 0x2A, 0x23, 0xC0, 0xAA, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xF9, 0xCA, 0x77, 0x1E, 0x65, 0xC6, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xBB, 0xB2, 0x94, 0x4B, 0x4E, 0x3E, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xD9, 0x77, 0x00, 0xDA, 0x38, 0x7E, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x23, 0x30, 0x18, 0x8C, 0x9F, 0xB2, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA2, 0xE3, 0xF9, 0xFF, 0xC1, 0xBE, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x11, 0x05, 0x35, 0x92, 0xF0, 0x0E, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x40, 0x63, 0xDB, 0x2E, 0x32, 0x55, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x69, 0xA9, 0xA9, 0xF7, 0x71, 0x24, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xB4, 0xFD, 0x4C, 0xFB, 0x47, 0x81, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x04, 0x46, 0x4E, 0x3E, 0x5C, 0x1F, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xEC, 0xCF, 0xFC, 0x57, 0x06, 0xAD, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x1C, 0x70, 0x4C, 0x33, 0x8C, 0x8E, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFD, 0xC0, 0xB1, 0x64, 0xDD, 0x7B, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x24, 0x76, 0x9B, 0x32, 0x54, 0xB4, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x3E, 0xF5, 0xCA, 0x42, 0x44, 0xBA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x2A, 0x53, 0x38, 0x2C, 0x7D, 0x67, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x6C, 0x03, 0x45, 0xB6, 0x64, 0xFD, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xD9, 0x0D, 0x5E, 0x7E, 0x00, 0x8A, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x82, 0x41, 0xF4, 0x51, 0xA8, 0xB5, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA4, 0x88, 0x7F, 0x5A, 0xB5, 0xC9, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x7D, 0xC9, 0xCE, 0xCD, 0x91, 0x82, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x0A, 0x8D, 0xF9, 0xA9, 0xCE, 0x4E, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x00, 0x40, 0x71, 0x3D, 0xB9, 0x1D, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x8B, 0xCB, 0x33, 0xA3, 0x99, 0x29, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x00, 0xAD, 0x71, 0xF9, 0x78, 0xC7, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x30, 0x81, 0x91, 0x0A, 0x60, 0x07, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x68, 0x9E, 0x2D, 0x01, 0x1E, 0x6A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x31, 0xB4, 0xEF, 0x86, 0xC8, 0x35, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xCC, 0x31, 0x7E, 0xA5, 0x5B, 0xF5, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x40, 0x03, 0x55, 0x1D, 0xCF, 0x63, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x6D, 0x9F, 0xD6, 0x42, 0x5F, 0x7D, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x57, 0x88, 0xE5, 0xE4, 0xE9, 0x30, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xF4, 0x4D, 0x16, 0xC3, 0x52, 0x6F, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x1E, 0x9E, 0x66, 0x2B, 0x1D, 0xE4, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9D, 0xD5, 0x3F, 0xEE, 0x20, 0x1B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xDD, 0x53, 0xFA, 0x6B, 0xD0, 0xBC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x48, 0xC4, 0xD5, 0x42, 0x9A, 0xBF, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xEA, 0x0D, 0x9B, 0x97, 0x21, 0xC5, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x3A, 0x36, 0x22, 0xC5, 0x2B, 0x6D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF6, 0x9D, 0x9C, 0xAB, 0x82, 0xAE, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x4B, 0xF5, 0x71, 0x1E, 0xE2, 0xF2, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4D, 0xD7, 0xE2, 0x52, 0x44, 0xFD, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x79, 0x43, 0xBC, 0x93, 0x0C, 0x13, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x92, 0x13, 0x85, 0x09, 0x13, 0xFE, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xD9, 0x86, 0xC1, 0xFA, 0xB0, 0x8C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xF7, 0x91, 0x26, 0x1D, 0xD9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xC9, 0xE6, 0xD6, 0xC9, 0x6F, 0xB4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x02, 0x9C, 0xF9, 0xDE, 0xF4, 0x34, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x03, 0x19, 0x65, 0x3B, 0x5B, 0x35, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xCF, 0x1F, 0x61, 0x38, 0x42, 0x6B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x07, 0x59, 0xED, 0xE6, 0x38, 0xB0, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xAE, 0x74, 0x91, 0xF4, 0x8D, 0x1A, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x9E, 0x01, 0xFD, 0xE1, 0x34, 0xA9, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x18, 0xD1, 0x7C, 0x78, 0xCB, 0x6C, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xEF, 0xFA, 0xF0, 0xDF, 0x74, 0x9E, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x01, 0x3A, 0xD2, 0xCB, 0x56, 0x50, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xD0, 0xD0, 0x43, 0xA9, 0xF0, 0x7D, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xFA, 0x13, 0x0A, 0xF3, 0x8E, 0x65, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x68, 0x0A, 0xDA, 0x27, 0x6F, 0xD7, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0xEC, 0x51, 0x43, 0xF7, 0xF5, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x0C, 0xFD, 0x83, 0x12, 0x00, 0xB3, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x16, 0xFA, 0xF1, 0x4E, 0x1A, 0xBE, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xE9, 0x76, 0x6A, 0xB7, 0xFF, 0x51, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x6F, 0x73, 0xAD, 0x06, 0x61, 0xE0, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x71, 0x5A, 0x2F, 0x26, 0xBD, 0x1F, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x50, 0x88, 0x39, 0x6E, 0xD9, 0x9B, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x2C, 0x9E, 0x25, 0x97, 0x2C, 0x67, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x68, 0x96, 0x75, 0xA6, 0xE2, 0xC0, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x5A, 0xB5, 0x8A, 0x41, 0x3B, 0x0D, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x05, 0x5D, 0x91, 0xA2, 0x63, 0x49, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x80, 0x56, 0x3B, 0x6C, 0x74, 0x0F, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x27, 0x54, 0x74, 0x05, 0x73, 0xB9, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x91, 0xFA, 0x4B, 0xE9, 0x0F, 0x7D, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xEA, 0x34, 0x12, 0x98, 0x5D, 0x55, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xDB, 0x06, 0x81, 0x1D, 0x8E, 0x54, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xED, 0x36, 0xE3, 0x09, 0x4F, 0xA9, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x07, 0x8B, 0x72, 0x3D, 0xB1, 0x63, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x58, 0x6D, 0x41, 0x13, 0xEC, 0xEF, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x9B, 0x18, 0x5B, 0x9D, 0x8A, 0xD3, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x4F, 0x26, 0x72, 0x61, 0xBD, 0x8D, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x66, 0xBF, 0xAB, 0x84, 0xE2, 0xC1, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x65, 0x21, 0x65, 0x2B, 0x80, 0x5C, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xF8, 0xD2, 0x7D, 0xA2, 0x6C, 0x80, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xAD, 0x21, 0xD8, 0x4B, 0x8D, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xCA, 0xE3, 0xC1, 0x15, 0x05, 0x06, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x02, 0x4E, 0x82, 0xC6, 0x13, 0x1F, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xB0, 0xB7, 0x90, 0x54, 0x23, 0x9A, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xA7, 0xE6, 0xE5, 0x22, 0x76, 0xD9, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x8D, 0x43, 0xC4, 0x49, 0xDC, 0x7D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xF4, 0xCC, 0x07, 0x0E, 0x32, 0xCB, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC4, 0x44, 0xE3, 0x34, 0xD1, 0x35, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xD2, 0xDF, 0x79, 0x30, 0x81, 0x65, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xF7, 0x9F, 0x17, 0x70, 0x95, 0x6D, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x70, 0x3F, 0x3D, 0x92, 0x37, 0x8E, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x54, 0x32, 0xCF, 0xF1, 0x28, 0x5D, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x66, 0x05, 0xCE, 0x3D, 0x54, 0xF5, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xA8, 0xBA, 0xDA, 0x79, 0x39, 0x4A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x7C, 0x51, 0xCA, 0x05, 0x2D, 0x26, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x44, 0x82, 0x3C, 0x64, 0x4C, 0x10, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x8C, 0x1F, 0x3B, 0xB6, 0x74, 0x65, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xCC, 0xF1, 0x0C, 0x18, 0x67, 0x3F, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x7E, 0xD8, 0x5B, 0x0E, 0x60, 0x89, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xF8, 0x53, 0xA0, 0x41, 0x83, 0xBF, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x9F, 0x82, 0xA9, 0xB7, 0x6F, 0xA8, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x84, 0xCD, 0x8C, 0xC3, 0xBC, 0x6A, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xFF, 0x67, 0xEB, 0x29, 0xE3, 0x75, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x1C, 0x33, 0x5B, 0xFF, 0x3F, 0xF2, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x9E, 0xF2, 0xAF, 0xBF, 0x92, 0x0B, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xDC, 0xD3, 0x9F, 0xC3, 0x88, 0x5D, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x05, 0x4D, 0x1B, 0x34, 0x2F, 0x2C, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x16, 0x43, 0xF8, 0xE5, 0xA0, 0xB7, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xC1, 0xC7, 0x68, 0x83, 0x00, 0x1C, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x89, 0x8F, 0x28, 0xEC, 0x15, 0xB5, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xB3, 0x7F, 0xBE, 0xDE, 0x81, 0x20, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xD6, 0x1E, 0xC7, 0xF1, 0xE8, 0xB8, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xEC, 0xB9, 0x67, 0xF7, 0xFA, 0x47, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x02, 0xC6, 0x3E, 0x35, 0x6B, 0x4E, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xDA, 0xA5, 0xAD, 0xB4, 0xB1, 0x1A, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x06, 0x9E, 0x22, 0xF0, 0x7E, 0x53, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x54, 0xDB, 0xF2, 0x18, 0x2E, 0x37, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x9E, 0x7D, 0x31, 0xCD, 0x10, 0x5A, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x8C, 0x4D, 0x1B, 0x96, 0xDC, 0x2C, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x95, 0x81, 0x32, 0x42, 0x25, 0xE9, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xE5, 0x61, 0x92, 0xF5, 0x39, 0x91, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x1E, 0x9C, 0x66, 0x34, 0x04, 0xF2, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xC6, 0x03, 0xE2, 0xD5, 0xE3, 0x00, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xC8, 0xCE, 0x64, 0x10, 0xB5, 0x62, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x69, 0xB6, 0x7B, 0x36, 0xC6, 0x2A, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x85, 0x0C, 0xB3, 0xBC, 0xDC, 0x37, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x04, 0x5F, 0x10, 0x22, 0xBB, 0x3C, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x3C, 0xB3, 0x3C, 0x29, 0x03, 0xC3, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x5B, 0xDA, 0xC6, 0xC8, 0xA6, 0x8A, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xE8, 0x08, 0x79, 0x06, 0xA4, 0xEE, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x98, 0x72, 0x6F, 0x2F, 0xFA, 0x51, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x7B, 0x24, 0x64, 0xE0, 0xB2, 0x37, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xDA, 0x8A, 0x64, 0xD2, 0x6B, 0x26, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x32, 0x45, 0x46, 0x94, 0x5B, 0x8B, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xE4, 0xAB, 0x9C, 0x12, 0xCF, 0xE1, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xC2, 0x47, 0xD4, 0xBD, 0xDE, 0x3A, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xAE, 0xC4, 0x89, 0x5E, 0x28, 0x84, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x6E, 0xAE, 0x21, 0x90, 0xEA, 0x6F, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xEF, 0x17, 0x4F, 0x39, 0x2E, 0x61, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x94, 0x5F, 0xDB, 0x90, 0xE8, 0x55, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xD6, 0xE6, 0x80, 0x66, 0xB3, 0x9F, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xC1, 0xD0, 0x9E, 0x13, 0x83, 0x23, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xAA, 0xBC, 0xD6, 0xC1, 0xCF, 0xCF, 0x92 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_3[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x0F, 0xB2, 0xDA, 0xCD, 0x71, 0x60, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x4E, 0x05, 0x52, 0x4C, 0xE9, 0x26, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x61, 0xCA, 0x80, 0xB6, 0x12, 0x35, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xCE, 0x70, 0x25, 0xCA, 0x01, 0x33, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xC0, 0x1A, 0x47, 0x31, 0x9F, 0x5F, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x81, 0x08, 0xC8, 0x9D, 0x3B, 0x65, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x76, 0x7A, 0xC1, 0x41, 0xC9, 0x5E, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x01, 0x59, 0x49, 0x10, 0xF0, 0xFB, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x3F, 0xB9, 0xEA, 0x19, 0x8C, 0x0F, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xE1, 0x83, 0xEB, 0x58, 0x26, 0x8E, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x71, 0x97, 0xF2, 0xF3, 0xD3, 0x3C, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xAD, 0x0C, 0x79, 0x29, 0x31, 0x51, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x7F, 0xC0, 0x8E, 0x53, 0xF6, 0xDA, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x62, 0x40, 0x13, 0xB5, 0xE6, 0xD7, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xCC, 0x53, 0x3C, 0x8B, 0x40, 0x98, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x85, 0xE8, 0x48, 0xB9, 0xF2, 0x8C, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5F, 0x71, 0xD3, 0x0F, 0xF4, 0x07, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x15, 0x7A, 0x56, 0x01, 0x77, 0x43, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xDC, 0xF2, 0x14, 0xA9, 0x3D, 0x9C, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xE7, 0x89, 0x0A, 0xB9, 0x27, 0xE0, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x5E, 0xC9, 0x7C, 0xD8, 0x26, 0x60, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x3C, 0xA3, 0xB3, 0x78, 0xF5, 0x63, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xE3, 0x91, 0xBC, 0xA3, 0xED, 0xA4, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x6B, 0xC0, 0x7A, 0x38, 0x49, 0x86, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x03, 0x10, 0xB5, 0x3F, 0xD4, 0x27, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xD7, 0x27, 0x78, 0xD5, 0x41, 0x33, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x22, 0x46, 0xE8, 0x22, 0x5C, 0x1A, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x94, 0x6A, 0x36, 0xF3, 0x4B, 0x51, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x38, 0x70, 0x04, 0xD6, 0x37, 0x2B, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x79, 0xD6, 0x48, 0x90, 0x26, 0x67, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x8F, 0x89, 0x8C, 0xC6, 0x80, 0xC9, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x9F, 0xEF, 0x91, 0x2A, 0x83, 0x51, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x84, 0xA2, 0xB6, 0x8E, 0x74, 0x03, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x82, 0x35, 0x52, 0x19, 0x1A, 0x85, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x12, 0x86, 0x8F, 0xD9, 0x61, 0x56, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x5F, 0x13, 0x85, 0x32, 0x72, 0x74, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xE4, 0xA5, 0x52, 0xDB, 0xB4, 0xB1, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x43, 0x40, 0xD2, 0x9B, 0x1D, 0x64, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1B, 0x47, 0x17, 0x56, 0xFF, 0xDD, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x5D, 0xCE, 0xDB, 0x78, 0xCA, 0x6C, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x89, 0xDC, 0x54, 0x70, 0x29, 0xA4, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x73, 0x3E, 0x62, 0x56, 0xA2, 0xC3, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x86, 0xA1, 0x01, 0xDF, 0x0C, 0x71, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xAF, 0xCA, 0x8A, 0x9D, 0xA6, 0xE6, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xDD, 0x32, 0x20, 0x3E, 0xF6, 0xC4, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x8C, 0x07, 0x47, 0x5E, 0xD9, 0x86, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xE4, 0xD5, 0xDE, 0xB0, 0x13, 0x17, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA0, 0x1A, 0xAF, 0x26, 0x70, 0x1B, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x94, 0xB6, 0x62, 0x05, 0x46, 0xB1, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xFA, 0xA0, 0x0F, 0x41, 0xCC, 0xE6, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xFC, 0x0D, 0xDA, 0x41, 0xAD, 0x63, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x1F, 0x5D, 0xBD, 0xB0, 0xEF, 0x55, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xA8, 0xE3, 0x6A, 0x40, 0x6C, 0xBF, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x55, 0xF7, 0xB7, 0xD7, 0xBD, 0x8B, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xCE, 0x64, 0xF7, 0xC1, 0x4D, 0x68, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x07, 0x32, 0x3A, 0xA8, 0x43, 0x3D, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xED, 0x70, 0x44, 0xE0, 0x9D, 0xF1, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xEF, 0x0D, 0x7D, 0x2C, 0xE1, 0x19, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x3F, 0x64, 0x83, 0xF3, 0x04, 0xA8, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x78, 0x86, 0xB1, 0x5E, 0x4B, 0x5A, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x53, 0xFF, 0x2E, 0xD1, 0x90, 0xE2, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x8A, 0x97, 0x3F, 0xE0, 0xE3, 0x5E, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x4A, 0x38, 0x7A, 0x0E, 0xBC, 0xB5, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x64, 0x63, 0x83, 0xDE, 0x0E, 0x0C, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xA9, 0x24, 0x29, 0xA8, 0x76, 0x3C, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x09, 0x54, 0x6E, 0xB6, 0xB3, 0x24, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x15, 0xD9, 0xBB, 0x43, 0x8C, 0xA9, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x30, 0x35, 0xDE, 0xE5, 0x71, 0xA6, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xED, 0x79, 0x16, 0x24, 0x01, 0xF1, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xFC, 0x46, 0x99, 0x16, 0x21, 0x70, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xBB, 0x08, 0x74, 0x67, 0x0F, 0x65, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x95, 0x15, 0x4D, 0x8F, 0xBA, 0xE6, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xFC, 0xCE, 0x3C, 0xB7, 0x45, 0x9E, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xE7, 0xCB, 0x56, 0x09, 0x77, 0x1F, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xCE, 0x2D, 0xDF, 0x9F, 0x60, 0xDC, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xD2, 0x94, 0x60, 0xC4, 0xD9, 0xAA, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x42, 0x64, 0xEB, 0x7C, 0x27, 0x76, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xDE, 0x94, 0x96, 0xB5, 0xB1, 0xEA, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x26, 0x50, 0xB3, 0x2D, 0x10, 0x67, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x0C, 0x99, 0x6D, 0xC1, 0xC4, 0x6E, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xFE, 0x2B, 0x31, 0x03, 0x3C, 0xD9, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xD0, 0x06, 0x57, 0xF0, 0xF4, 0x23, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xE7, 0x21, 0xFE, 0x31, 0xBE, 0x36, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xA5, 0xFE, 0xFD, 0xED, 0xE7, 0x54, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x2E, 0xF1, 0x48, 0x62, 0x52, 0x18, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x99, 0x28, 0x8B, 0x4F, 0x72, 0xE9, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xF6, 0x83, 0x2D, 0x09, 0xC2, 0xE2, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x63, 0x5A, 0x63, 0x4F, 0x7F, 0xE4, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x23, 0xCB, 0xF9, 0x78, 0x0B, 0xF4, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xE6, 0x7C, 0xB0, 0x59, 0x6D, 0xD8, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x9D, 0xC1, 0x1E, 0x52, 0x37, 0x4C, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xAB, 0xCB, 0x89, 0x31, 0x26, 0xE1, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xF3, 0x91, 0xE8, 0x9D, 0x0B, 0xF2, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x71, 0x90, 0xDA, 0xAC, 0x10, 0x63, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x38, 0xE6, 0x9A, 0xCE, 0xB1, 0x4E, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x55, 0x79, 0xAD, 0x83, 0x9F, 0x9F, 0x25 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_4[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x00, 0x7C, 0x46, 0x2B, 0xE9, 0xD8, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xBB, 0xE0, 0x22, 0xBE, 0xE6, 0xCA, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xD7, 0xFE, 0x08, 0xE1, 0x46, 0x60, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x8B, 0xC8, 0xEA, 0x6F, 0x5A, 0x67, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x90, 0x35, 0xEF, 0x3A, 0xB0, 0x9F, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x94, 0x06, 0xB2, 0x36, 0x06, 0x20, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x62, 0xF5, 0x10, 0x96, 0x75, 0x7C, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xEC, 0xEF, 0x42, 0x9B, 0xA7, 0xEE, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xD7, 0x06, 0x54, 0x4F, 0x43, 0xF6, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x59, 0xF4, 0xE1, 0xA3, 0x6A, 0xC3, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x93, 0x9C, 0x4E, 0x31, 0xC8, 0x31, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x04, 0x0F, 0xFD, 0x0C, 0x5E, 0x05, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x9D, 0xB6, 0xDA, 0xFE, 0x66, 0xD5, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xE9, 0x84, 0x54, 0x21, 0xEA, 0xAA, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x6F, 0x70, 0x0E, 0xDB, 0x62, 0x0F, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x2E, 0x75, 0x41, 0xDD, 0xED, 0x14, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x4D, 0x61, 0xDF, 0xBC, 0xF3, 0xBD, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xC3, 0x64, 0x45, 0x06, 0x28, 0x95, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x20, 0x2C, 0x78, 0xA9, 0x8C, 0xB6, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xDC, 0x04, 0xAC, 0xE8, 0xD4, 0x43, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xCE, 0x11, 0xDF, 0x67, 0xB3, 0x22, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xE6, 0x54, 0x97, 0x7B, 0x56, 0x52, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xCD, 0x25, 0x7B, 0x67, 0x8B, 0xAC, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x59, 0xCA, 0x0B, 0x7C, 0xA1, 0xDD, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xA2, 0x22, 0x53, 0xFC, 0x70, 0xBF, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x75, 0x43, 0xD4, 0x37, 0x32, 0xC2, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xC8, 0xF5, 0xD5, 0x2F, 0xB8, 0x5C, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x93, 0x30, 0x27, 0x44, 0x7A, 0x08, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x4C, 0xB9, 0x3F, 0x76, 0x8B, 0xA5, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x65, 0xCC, 0x73, 0x71, 0x38, 0x36, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xF5, 0x8B, 0x66, 0x0A, 0x88, 0x44, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x77, 0x8B, 0x02, 0x96, 0x76, 0x05, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xD1, 0x2E, 0x1A, 0xE8, 0x9A, 0x3A, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xA9, 0x45, 0x4F, 0x00, 0xFA, 0x0C, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xD0, 0xC3, 0x0B, 0x20, 0xBA, 0x4B, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFA, 0x34, 0x3E, 0xDB, 0x99, 0x8A, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x1E, 0x4D, 0x38, 0xB6, 0x68, 0x3F, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x27, 0xBA, 0xC3, 0x76, 0xBB, 0x71, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x2D, 0x69, 0xF2, 0x1D, 0x39, 0xF6, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x37, 0x6F, 0x1B, 0x73, 0x6F, 0x99, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x59, 0xC5, 0x38, 0xB9, 0x12, 0x00, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x81, 0x80, 0xA4, 0x18, 0x78, 0x73, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xDA, 0xB7, 0x63, 0xC9, 0x02, 0x85, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xE8, 0xA7, 0xB6, 0xC0, 0x57, 0xFC, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x17, 0x92, 0x27, 0x19, 0x13, 0xDC, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x7F, 0xDC, 0xAB, 0xBC, 0x2D, 0x37, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xE0, 0x0E, 0xC7, 0xEA, 0x35, 0xDB, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xEB, 0x19, 0xE6, 0xCF, 0x18, 0x36, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x91, 0xC7, 0x60, 0x26, 0x26, 0xB3, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xAF, 0xBD, 0x64, 0xE6, 0x70, 0x94, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xB6, 0x13, 0x73, 0xD8, 0x77, 0xD6, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x60, 0xD1, 0xAF, 0xDE, 0xF0, 0x72, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xE5, 0x18, 0xD2, 0x83, 0xE6, 0xBE, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x68, 0x1A, 0x5B, 0xBE, 0x5F, 0xFE, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x95, 0x8C, 0xA5, 0x83, 0xCE, 0x3C, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x41, 0xAB, 0x56, 0xA3, 0xB9, 0xB9, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF9, 0x64, 0x94, 0x03, 0xCD, 0x9B, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x90, 0x9B, 0x7E, 0x1B, 0xF5, 0xC9, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x60, 0xE8, 0x4A, 0x0D, 0xED, 0xBC, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x64, 0x39, 0xB5, 0xB0, 0x96, 0xE9, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xF5, 0xF7, 0x4E, 0xE9, 0x8B, 0x41, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x3C, 0xDE, 0x12, 0x9E, 0x3C, 0xD5, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x73, 0x7E, 0xE8, 0x83, 0x75, 0x16, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x8A, 0x06, 0xCC, 0xCA, 0xA9, 0x2D, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x3F, 0x22, 0xB5, 0x5A, 0x00, 0xFE, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x67, 0x72, 0x65, 0x3E, 0x03, 0xB4, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x8B, 0xF2, 0xC2, 0xFD, 0x65, 0x19, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x91, 0x00, 0xC3, 0x0E, 0xBC, 0xBB, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x73, 0x6F, 0x75, 0x71, 0x12, 0xC0, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x5A, 0xA9, 0xE2, 0x7C, 0x4C, 0x35, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x66, 0xCF, 0x8C, 0xC4, 0x5E, 0x1F, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xFA, 0x90, 0x30, 0xC0, 0x88, 0x6F, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x40, 0x35, 0xF6, 0x29, 0x2A, 0x92, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xD3, 0xD5, 0x71, 0xA4, 0xA8, 0x19, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x0F, 0xC9, 0xCA, 0x2A, 0xF6, 0x6E, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x5C, 0xE5, 0xAA, 0x17, 0xFC, 0x7E, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x76, 0x64, 0xEC, 0x67, 0x18, 0xFA, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x99, 0xB6, 0x75, 0x8E, 0xAD, 0x1C, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x15, 0xC4, 0xFE, 0xAF, 0xA4, 0xDE, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x3F, 0xAC, 0x15, 0x44, 0xCF, 0xAE, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x20, 0x82, 0x03, 0x57, 0x5D, 0xF1, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x5D, 0xC3, 0x85, 0x7D, 0x8A, 0xD0, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x78, 0x1F, 0x16, 0x6E, 0x24, 0x91, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xFD, 0x32, 0xB2, 0x55, 0x77, 0xFA, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x66, 0x6F, 0xAD, 0x72, 0xE2, 0x44, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x26, 0x9C, 0xAE, 0xC4, 0x04, 0x64, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xEB, 0x49, 0x99, 0x38, 0x50, 0xC3, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x50, 0x08, 0xD1, 0xC2, 0xD1, 0xAC, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x34, 0xD8, 0xC1, 0x85, 0xAA, 0xCA, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x7C, 0x5B, 0xD9, 0x7C, 0x80, 0xDF, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x79, 0xEF, 0x26, 0x0B, 0x49, 0x84, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x1B, 0x73, 0x6D, 0x5A, 0xA7, 0x8B, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x84, 0xB3, 0xF8, 0xA0, 0xDE, 0xA3, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x1B, 0x47, 0xE3, 0x8C, 0x65, 0x0A, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xB6, 0x41, 0x22, 0x1E, 0xC6, 0x51, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x3E, 0x3A, 0x01, 0x94, 0x6E, 0xB9, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_5[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x01, 0xF8, 0x8C, 0x56, 0xD2, 0xB1, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x68, 0xDD, 0x74, 0xDF, 0x9A, 0x87, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xD4, 0xC4, 0x98, 0xB4, 0x36, 0xA3, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xB4, 0x5F, 0x01, 0xB9, 0x1F, 0x28, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x02, 0x90, 0x43, 0xE7, 0x15, 0x62, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xA8, 0xA1, 0x87, 0x73, 0x9A, 0x04, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x9A, 0xC3, 0x5B, 0x1B, 0xD3, 0x5B, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xE4, 0x10, 0xBB, 0x60, 0x21, 0x0E, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x1D, 0xB2, 0xDE, 0x68, 0x34, 0x4D, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x7E, 0x94, 0x0B, 0x1A, 0x0D, 0x29, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7E, 0xD6, 0x87, 0x31, 0x64, 0x3A, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x88, 0x36, 0x8F, 0xA5, 0xB8, 0xDF, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xE6, 0x3F, 0x6F, 0xE2, 0xC4, 0xE1, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x56, 0x63, 0x61, 0xEA, 0xF8, 0x6C, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xC8, 0x7F, 0xFA, 0xF4, 0x8B, 0x77, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x41, 0xC2, 0x58, 0x97, 0x1B, 0x7F, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xA2, 0xF7, 0x46, 0x5B, 0x82, 0xB5, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xCA, 0x16, 0xF6, 0xC0, 0x01, 0xEC, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x68, 0xE0, 0xEF, 0x78, 0xE0, 0xEE, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x94, 0xD9, 0x3F, 0x45, 0x0A, 0xD5, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xFB, 0x3F, 0xC4, 0xCF, 0xA4, 0x86, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xBB, 0xA4, 0xF9, 0x64, 0xBC, 0x95, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x5B, 0xE8, 0x1A, 0xA0, 0xE4, 0x03, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x49, 0xEB, 0x6D, 0x00, 0xD1, 0x96, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x8F, 0x47, 0x59, 0xFD, 0x99, 0xFD, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xE7, 0x40, 0x5A, 0x31, 0x08, 0x65, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xA4, 0x1B, 0xAF, 0x07, 0x6A, 0x0C, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x0A, 0xF1, 0x01, 0x55, 0x68, 0x82, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x9C, 0xB1, 0xCD, 0x87, 0x39, 0xCF, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xA6, 0x22, 0x4C, 0xB0, 0x1C, 0xB8, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xAD, 0x22, 0x02, 0xD2, 0xCB, 0xCE, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xC5, 0xC3, 0xCC, 0xFF, 0x6F, 0xA3, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x35, 0x5A, 0xEF, 0x19, 0xD1, 0x77, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x7A, 0x7D, 0x40, 0x82, 0xF3, 0x8F, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x1E, 0x46, 0x23, 0xEE, 0xCB, 0xE1, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x51, 0xE1, 0xFC, 0x5B, 0x7E, 0x4B, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xC0, 0xD0, 0xA1, 0x9E, 0x3F, 0xFC, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x43, 0xE7, 0x8D, 0x43, 0xA8, 0x94, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x59, 0x92, 0x73, 0xFE, 0xB8, 0xCE, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xE3, 0x12, 0x03, 0x43, 0x45, 0x09, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xB3, 0xDD, 0xFF, 0x78, 0xAC, 0x38, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xD1, 0x7F, 0xB7, 0x26, 0x90, 0xDF, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x4D, 0xD1, 0x99, 0x91, 0xE7, 0x9F, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xA0, 0x9B, 0x7D, 0xFA, 0xE6, 0xC2, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x63, 0xF2, 0xD0, 0x8C, 0xCA, 0xC2, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xBE, 0xB5, 0x02, 0x5C, 0x8C, 0x0A, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x53, 0x7E, 0xB7, 0x92, 0x0C, 0x39, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x80, 0xAB, 0xE6, 0xBA, 0x47, 0x3B, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x2D, 0x41, 0xAB, 0x89, 0xF9, 0xF6, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x3F, 0xDD, 0x62, 0xA1, 0xC4, 0x44, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xCF, 0x51, 0xA6, 0xC2, 0xCE, 0x91, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE3, 0x4E, 0x65, 0x51, 0x11, 0x29, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x83, 0x6D, 0xCE, 0xC4, 0x32, 0xBE, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xE6, 0x26, 0x1B, 0xE5, 0x9D, 0x37, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xF1, 0xE2, 0x28, 0x42, 0x71, 0x0C, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x8C, 0xB8, 0x10, 0x9B, 0xF0, 0xC4, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xA7, 0xD4, 0xB6, 0xE8, 0xB7, 0x44, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xD3, 0x5F, 0x1A, 0xE4, 0xA5, 0x96, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x48, 0x8D, 0xD9, 0x86, 0xCD, 0x66, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x36, 0x5F, 0xE5, 0x57, 0x1A, 0xD5, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x12, 0x69, 0xDC, 0xD7, 0x66, 0xF6, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x81, 0xC4, 0x93, 0x15, 0x5C, 0xD1, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x1E, 0x16, 0xFA, 0x3D, 0x7B, 0x78, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x12, 0x71, 0x9E, 0xB6, 0x5E, 0x26, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x7B, 0x2B, 0x05, 0x7A, 0xA5, 0xC6, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xFF, 0xC4, 0x69, 0x44, 0xC4, 0xFC, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x26, 0x32, 0xC4, 0xD4, 0x81, 0x3F, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xA0, 0xEA, 0x08, 0x9A, 0x86, 0xE8, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xC6, 0x1C, 0xBC, 0x26, 0x28, 0xCA, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x07, 0xE3, 0x78, 0xDE, 0x5D, 0x6C, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x4B, 0xAC, 0x2A, 0x56, 0xAB, 0xEF, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x70, 0x9C, 0x77, 0xE3, 0x12, 0x6C, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x50, 0x36, 0xC4, 0x86, 0x4F, 0xF0, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xC3, 0xB3, 0x15, 0x67, 0x54, 0x30, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xB2, 0x87, 0xA7, 0x8C, 0x44, 0xD6, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xFE, 0x57, 0xF2, 0x47, 0x0A, 0xA7, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x9F, 0x8F, 0xFA, 0x2B, 0xEE, 0xA4, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x3F, 0x95, 0x8A, 0x65, 0x80, 0xCE, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x47, 0xBF, 0x4A, 0x14, 0xA0, 0xB4, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x83, 0x33, 0x78, 0x05, 0xED, 0x52, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xC7, 0xC9, 0xBE, 0x5E, 0xF0, 0x35, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xD3, 0xD8, 0xD4, 0x59, 0xBC, 0xAF, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x07, 0x4F, 0x38, 0x01, 0xBF, 0x7B, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x6E, 0x7F, 0x83, 0x3A, 0xE2, 0xA5, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x03, 0x87, 0xDB, 0x86, 0xB1, 0x32, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x31, 0x4B, 0x1F, 0x34, 0xA4, 0x64, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x67, 0x8D, 0xD3, 0x51, 0xAB, 0x52, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x3B, 0x13, 0xCC, 0xAF, 0x84, 0x7A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x07, 0xEC, 0xD4, 0x08, 0xA3, 0x13, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x82, 0xAA, 0x4F, 0x96, 0x1D, 0x8F, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xB4, 0x43, 0x29, 0x48, 0xF4, 0x74, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x02, 0x82, 0xC6, 0x73, 0x18, 0x36, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xD1, 0x39, 0x23, 0xBE, 0xF7, 0x8D, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xF9, 0x50, 0x9F, 0xF9, 0x74, 0x38, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x21, 0xC8, 0xA1, 0xE3, 0x37, 0xAB, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x7C, 0x74, 0x02, 0x28, 0xDD, 0x72, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_6[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xD1, 0x29, 0x9B, 0xEB, 0x00, 0xAA, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xC3, 0x7A, 0xB8, 0x87, 0x7A, 0x46, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x1B, 0x71, 0xA2, 0xD2, 0x8A, 0x9A, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xED, 0x70, 0x46, 0xE6, 0x25, 0xB9, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x49, 0x1B, 0xEC, 0xAE, 0xA5, 0x89, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xAF, 0x59, 0x2C, 0xEA, 0xE4, 0xCE, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xCA, 0x92, 0xCE, 0x29, 0x15, 0x33, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x77, 0x9C, 0x7B, 0xB8, 0x4C, 0x53, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xFD, 0xE0, 0x8F, 0x6E, 0x88, 0xC0, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xDC, 0x3C, 0x4C, 0xF2, 0x7A, 0xD9, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x2E, 0xAE, 0x4F, 0x98, 0x32, 0x77, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x20, 0x5A, 0x43, 0xF4, 0x3A, 0xE2, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xFF, 0x03, 0x6F, 0x24, 0x30, 0xA0, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x51, 0xF2, 0x95, 0x9F, 0xF6, 0xCA, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x02, 0x98, 0x11, 0x43, 0x8C, 0xD2, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xA2, 0xA9, 0x6C, 0xB7, 0xD6, 0x07, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xDC, 0xED, 0xAD, 0x79, 0x32, 0xF2, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x27, 0xEC, 0xC2, 0xD2, 0xD2, 0x7C, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x83, 0xCE, 0x6A, 0x5E, 0x9A, 0xCA, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x43, 0x3E, 0x06, 0x44, 0x07, 0xC5, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xD0, 0x04, 0x60, 0xDA, 0xD6, 0xC9, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x12, 0x22, 0xC2, 0x21, 0x9D, 0x46, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3A, 0xFD, 0x05, 0x8A, 0xDD, 0x30, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x19, 0x7C, 0x1D, 0x45, 0xCD, 0x7D, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xAF, 0x30, 0xA4, 0xE7, 0xA8, 0xA7, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xA8, 0xD6, 0xF1, 0x75, 0x93, 0x8E, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x1F, 0xC6, 0x7F, 0x5C, 0x3E, 0x25, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x3B, 0xAE, 0xB1, 0xD4, 0xFC, 0x0E, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xCA, 0xF2, 0x2A, 0x5D, 0x0F, 0xB5, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xA2, 0x79, 0x4C, 0x64, 0x99, 0x63, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xEA, 0xD7, 0xEB, 0xDA, 0xD2, 0xDE, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xC5, 0xE8, 0x79, 0x50, 0x60, 0xDC, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x30, 0xDE, 0x23, 0x8A, 0x45, 0x21, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xC8, 0x05, 0xF5, 0x80, 0x6A, 0x3A, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xC7, 0x91, 0xB6, 0xC8, 0x5C, 0xE1, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xD6, 0xE0, 0xDC, 0x61, 0x25, 0xDC, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xFA, 0xAE, 0xDF, 0x15, 0x80, 0xCF, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xEA, 0x57, 0x55, 0x11, 0x67, 0x1F, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xA5, 0xCC, 0x46, 0xCB, 0xF0, 0xAF, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xD5, 0xDE, 0x7D, 0x06, 0xFD, 0x9C, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xE2, 0xDB, 0x33, 0xDF, 0x9D, 0x86, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xEA, 0x7E, 0xF2, 0x10, 0x6B, 0x9B, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x92, 0xCD, 0xE0, 0x91, 0xEA, 0x3B, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xD1, 0x7C, 0xD9, 0x40, 0x69, 0x12, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x38, 0x9E, 0x4C, 0x29, 0xBC, 0xDC, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xEC, 0x95, 0xA8, 0xE3, 0xCF, 0xC8, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x51, 0xF6, 0x97, 0x54, 0x65, 0x87, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x46, 0x9C, 0xA7, 0x45, 0x14, 0xCE, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xE6, 0xC9, 0xBB, 0x00, 0xB0, 0xDB, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x39, 0x04, 0xCF, 0x21, 0x18, 0x43, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xB8, 0x07, 0x0C, 0x2A, 0xD2, 0xE4, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xCF, 0x75, 0x96, 0x85, 0xF0, 0x44, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xB2, 0x19, 0x9C, 0x45, 0x2D, 0xEB, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x1F, 0x9B, 0x31, 0x16, 0x4B, 0xEB, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x95, 0x92, 0x31, 0x44, 0xAE, 0x1E, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x9A, 0xB7, 0x4B, 0xA9, 0xB0, 0xC8, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x00, 0x60, 0xAA, 0xFF, 0xBB, 0xDA, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xC8, 0x09, 0x77, 0x55, 0xB1, 0x46, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xB5, 0xBF, 0x7D, 0xB2, 0x9F, 0xF1, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x4B, 0x97, 0x97, 0xAD, 0x0B, 0x0A, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xAB, 0xB0, 0x77, 0x4A, 0x5A, 0x94, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x5B, 0xF0, 0x98, 0x19, 0x62, 0x48, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xFB, 0xBB, 0x58, 0xAC, 0x83, 0x44, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xDB, 0xA2, 0xDA, 0x7F, 0x4C, 0xA2, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xE8, 0xDD, 0x16, 0xF0, 0x4F, 0x1C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x18, 0x99, 0x14, 0xD0, 0xFC, 0x65, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xDC, 0x22, 0xED, 0xEE, 0x91, 0x9B, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x16, 0xFE, 0x14, 0xEC, 0x68, 0xE2, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xCD, 0x57, 0xFC, 0x45, 0x0A, 0x77, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x8E, 0x45, 0x0E, 0x7A, 0x25, 0xF8, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x91, 0x4F, 0xC6, 0x05, 0x64, 0x42, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x52, 0x89, 0xC7, 0xB0, 0x1E, 0x17, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x9C, 0xAC, 0x50, 0x2F, 0xFF, 0x09, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x28, 0xA3, 0x3E, 0x7F, 0x1C, 0x0E, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xC8, 0xA0, 0x2D, 0x09, 0x0A, 0xA8, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x1A, 0x97, 0x7B, 0xB2, 0xC7, 0x8C, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xDE, 0x49, 0xEC, 0xF0, 0xB9, 0x56, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xD8, 0xD1, 0xF5, 0x42, 0x81, 0xE8, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x13, 0xCD, 0x3D, 0xED, 0x93, 0x84, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xF3, 0x95, 0x61, 0xA1, 0x34, 0xF3, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xF1, 0x81, 0x38, 0x7D, 0x33, 0x86, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xE0, 0x48, 0x9F, 0x61, 0xBE, 0xE9, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x30, 0x29, 0x19, 0x5F, 0x98, 0x46, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xE5, 0x1D, 0x27, 0xBF, 0x6B, 0x96, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x79, 0x2C, 0x04, 0x67, 0xEE, 0x26, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xA1, 0xB6, 0xC6, 0xE8, 0x4D, 0x2F, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x1A, 0x07, 0xA8, 0x81, 0x95, 0x9A, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x1B, 0x81, 0xBB, 0x13, 0xD1, 0xB7, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x13, 0xF8, 0x00, 0x6C, 0xC5, 0x2C, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x30, 0x1A, 0x47, 0x8D, 0x71, 0x98, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x92, 0xE7, 0xE6, 0x74, 0xBB, 0x55, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xD5, 0x36, 0x99, 0x91, 0x27, 0xE5, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xE4, 0xB7, 0x57, 0xF6, 0x4A, 0x7F, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x7F, 0x0A, 0xCC, 0x34, 0xE2, 0xA2, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x0E, 0xA3, 0x2F, 0xB1, 0x23, 0xC7, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xBE, 0x6F, 0xF6, 0x32, 0x4E, 0xE2, 0xC5 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_7[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xA3, 0x53, 0x36, 0xD7, 0x01, 0x54, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x77, 0x11, 0xA0, 0x72, 0xC2, 0x7E, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x5B, 0xA9, 0xCB, 0x97, 0xBE, 0x17, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x78, 0xB0, 0xB8, 0xA5, 0xB6, 0xCB, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x75, 0x5B, 0x3D, 0xCF, 0x00, 0x36, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xDE, 0x47, 0x7C, 0xDA, 0x57, 0x62, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x6A, 0xFE, 0xD6, 0x42, 0x12, 0xC9, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xFA, 0x69, 0x2C, 0x9B, 0x6B, 0xD7, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x6A, 0x66, 0x56, 0xA7, 0xBE, 0xE1, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x85, 0x25, 0xE0, 0xB6, 0x2D, 0x55, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xB4, 0xF9, 0x89, 0xFF, 0x38, 0xC5, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xC0, 0xCC, 0x1B, 0x74, 0x72, 0x99, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xAB, 0xDA, 0x97, 0x2D, 0x57, 0x77, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x26, 0x3E, 0xE4, 0xE6, 0x11, 0xAD, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xEE, 0xCE, 0x00, 0xC5, 0xDE, 0xFD, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x28, 0x2B, 0xAF, 0x4B, 0xED, 0x64, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xBF, 0x10, 0xE4, 0xD4, 0xFF, 0x1D, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x92, 0x25, 0xF1, 0x59, 0x57, 0xBB, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x2C, 0x25, 0xD5, 0xE2, 0xFB, 0x16, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x63, 0x4C, 0xF4, 0xFB, 0x6E, 0xD7, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xFE, 0x25, 0xC6, 0xB4, 0xEB, 0xD4, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x13, 0x3F, 0x4F, 0xB1, 0x49, 0x7E, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x34, 0x97, 0x30, 0xE5, 0x88, 0x0C, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xC9, 0x4E, 0x91, 0x92, 0x28, 0xD7, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xAA, 0x63, 0xFB, 0xD3, 0x09, 0xCE, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x4D, 0x67, 0x95, 0xAD, 0xCA, 0xFD, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x52, 0xBC, 0x02, 0x61, 0x76, 0x9D, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x5B, 0xEC, 0x16, 0x76, 0x6D, 0x8F, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x98, 0x24, 0xA4, 0x55, 0x41, 0xEE, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x1F, 0x7D, 0xFD, 0x95, 0xDE, 0x12, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x96, 0xBA, 0x0C, 0x73, 0x61, 0x03, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x60, 0x7E, 0xBB, 0x74, 0x43, 0x51, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xF3, 0xB8, 0x02, 0x5E, 0x26, 0x45, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xB7, 0xFD, 0x8B, 0x83, 0xD4, 0xEA, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x0B, 0xE2, 0x78, 0x3F, 0x11, 0x0D, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x08, 0x39, 0x3A, 0x69, 0x95, 0xEE, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x77, 0x94, 0xF0, 0x5D, 0x6E, 0x1C, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xCA, 0x22, 0xB1, 0x78, 0xFF, 0xEF, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x4A, 0x59, 0x1C, 0x59, 0x28, 0x42, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x20, 0xF2, 0xC7, 0x69, 0x60, 0x10, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xC3, 0x0A, 0xF6, 0xC4, 0xC2, 0x45, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xA3, 0x7C, 0x53, 0x17, 0x76, 0x2F, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xBC, 0xFC, 0x93, 0x22, 0xB7, 0x0D, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x70, 0x45, 0xC3, 0xFA, 0x09, 0xEF, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA5, 0x0A, 0x1B, 0xAD, 0x1C, 0xC4, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x99, 0x28, 0xFC, 0xA9, 0xD0, 0x2D, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x36, 0x4D, 0x59, 0x66, 0x6B, 0x91, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x34, 0xB0, 0x69, 0xA6, 0x3E, 0x6B, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xD7, 0x45, 0x61, 0x3E, 0x0D, 0x48, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x54, 0x6A, 0x37, 0x18, 0x13, 0xA2, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xD3, 0x39, 0xD8, 0x65, 0x83, 0xAE, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xC1, 0x97, 0x32, 0x9F, 0x10, 0xCD, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x1D, 0x6F, 0x62, 0x48, 0xC0, 0x16, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x53, 0x28, 0xC8, 0x94, 0x74, 0x11, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xF1, 0xEE, 0x40, 0xC3, 0x30, 0xD0, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x3D, 0xD1, 0xFA, 0xA6, 0xDE, 0xE2, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xB5, 0xCA, 0xE2, 0xE0, 0x95, 0xC2, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x44, 0x3C, 0x0B, 0x58, 0x1E, 0x90, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xF1, 0x3B, 0x3F, 0xD1, 0x32, 0xD0, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x03, 0x1B, 0xAA, 0x51, 0x04, 0x16, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x7C, 0xDA, 0x2D, 0x9A, 0x03, 0x9C, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xBE, 0xE8, 0x9F, 0x0C, 0xA7, 0xB7, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x2D, 0x91, 0xDA, 0x8E, 0x97, 0xD4, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xB4, 0xA9, 0xBB, 0x20, 0xA4, 0x0F, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xCE, 0xA2, 0xC8, 0xA4, 0x44, 0x03, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x60, 0x12, 0xC8, 0x67, 0xB7, 0x60, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xC8, 0x92, 0x18, 0xB7, 0xD9, 0x43, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xA8, 0xE5, 0xAC, 0x54, 0xE0, 0x35, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x7B, 0xED, 0xC9, 0xCF, 0x17, 0x38, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x70, 0x1B, 0xD0, 0xD8, 0x0F, 0xF2, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xA1, 0xAC, 0x9D, 0xD8, 0xB5, 0x35, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x20, 0x8D, 0xA5, 0xC4, 0x3E, 0xBB, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x08, 0x25, 0x79, 0x91, 0xF9, 0xDF, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x6D, 0x4E, 0xAF, 0x1C, 0x3C, 0x19, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x23, 0x37, 0x6D, 0x49, 0x6C, 0x48, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x7A, 0xBB, 0x93, 0x7D, 0xA1, 0xC2, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x6E, 0x5A, 0xFA, 0x3D, 0x31, 0x5E, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xBD, 0xCB, 0x8A, 0xCE, 0x27, 0x66, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x43, 0xD1, 0xC8, 0x8E, 0x7E, 0x00, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xEC, 0x06, 0x10, 0xC0, 0xB7, 0xDB, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x69, 0xC9, 0x28, 0xAB, 0x9C, 0x5F, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xD9, 0xE3, 0x07, 0x22, 0x24, 0xE2, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x78, 0x62, 0x3E, 0xE3, 0xA6, 0xE6, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x3F, 0x55, 0x6D, 0x0D, 0xCB, 0xDD, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x01, 0x89, 0x6F, 0xC9, 0xF6, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x28, 0x80, 0x4F, 0x7C, 0x36, 0xFB, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC6, 0x07, 0xF1, 0xE3, 0x35, 0x01, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xD1, 0x04, 0xA1, 0x51, 0x83, 0x90, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xC5, 0x2B, 0x53, 0xD5, 0xD8, 0xD7, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xEB, 0x27, 0x2B, 0xB7, 0xFF, 0x00, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xE6, 0x33, 0xA9, 0x1B, 0xD9, 0x17, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x76, 0x09, 0x1E, 0xE2, 0x18, 0xE9, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x93, 0x42, 0xE1, 0x68, 0xD0, 0x44, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xC2, 0xD7, 0x70, 0x49, 0x6E, 0x69, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xD2, 0x8A, 0xBC, 0x09, 0xF3, 0x95, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x7D, 0xDF, 0xEC, 0x65, 0x9C, 0xC4, 0x8B ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_8[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x29, 0x29, 0x9C, 0xE7, 0x87, 0xCB, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xB0, 0x7A, 0x9F, 0x96, 0x13, 0x89, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x6B, 0x78, 0x89, 0x5B, 0x96, 0xE0, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xB8, 0x4E, 0x13, 0xDE, 0x72, 0xBB, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xED, 0xAC, 0x4A, 0xBA, 0x29, 0xC9, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xC6, 0x9F, 0xD1, 0x4B, 0x5F, 0x96, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x18, 0x0E, 0x6E, 0xBA, 0xF9, 0x8C, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xC0, 0x33, 0x6A, 0xD3, 0xB0, 0xC1, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x67, 0xAA, 0x7C, 0x5D, 0xB1, 0x9D, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x08, 0xF7, 0x39, 0x90, 0xEF, 0x32, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x2B, 0xBF, 0x31, 0x11, 0x96, 0xBD, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x98, 0x7F, 0x2B, 0xDF, 0x9C, 0x3A, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x28, 0x90, 0x04, 0x11, 0x40, 0x59, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x70, 0xAF, 0x68, 0x5A, 0x93, 0x80, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x7B, 0xC3, 0xD0, 0xF9, 0xAF, 0x86, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x57, 0xAD, 0x81, 0x5B, 0x2A, 0xBA, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x7A, 0x8F, 0x90, 0x76, 0xC5, 0xD9, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x09, 0xD4, 0x3B, 0xEB, 0xAC, 0x28, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x02, 0xA2, 0x3E, 0x7F, 0xCB, 0x6D, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x1C, 0xDD, 0x7D, 0x7E, 0x0E, 0xF0, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xCD, 0x2A, 0x08, 0x97, 0x96, 0x94, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x45, 0xB2, 0xE7, 0xF1, 0x6B, 0xD3, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x7F, 0x0A, 0xFC, 0x4A, 0x27, 0xD0, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x04, 0xBB, 0x8A, 0x46, 0x90, 0x9F, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x58, 0x26, 0x8D, 0x86, 0xBC, 0x1A, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x4A, 0x0A, 0x32, 0xF4, 0xD4, 0x66, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xD8, 0x3B, 0x8C, 0x39, 0x83, 0xD0, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x11, 0x33, 0xD8, 0x0C, 0xD0, 0x7E, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x97, 0xEF, 0x48, 0x0F, 0x8A, 0x06, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xC3, 0x6E, 0xA6, 0x25, 0x03, 0x5A, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xDE, 0xD0, 0xFF, 0xFC, 0xE2, 0x14, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x7D, 0x47, 0xD5, 0x4D, 0x6A, 0xFF, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xCE, 0xF4, 0x84, 0xC8, 0x59, 0x0F, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xD3, 0xC2, 0x61, 0x01, 0x1A, 0x73, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x2D, 0x7D, 0xD2, 0x90, 0xE5, 0x9B, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xC5, 0xB7, 0x93, 0xCB, 0x28, 0x3E, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x8E, 0x76, 0xB2, 0x17, 0x56, 0x14, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x80, 0xA6, 0x2B, 0x46, 0xE5, 0x01, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xE8, 0x4E, 0x1C, 0x53, 0x98, 0xC6, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x26, 0xA9, 0x1B, 0x47, 0x38, 0xBC, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x38, 0xDD, 0xD4, 0xFA, 0xD4, 0x34, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x10, 0xCE, 0xB7, 0x1B, 0xE4, 0xD8, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xF5, 0xED, 0x63, 0x93, 0xC4, 0xA7, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x26, 0xC3, 0xB8, 0xC2, 0xD1, 0x74, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xB3, 0xD5, 0x14, 0xEA, 0x93, 0x7F, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x1C, 0xBC, 0xA1, 0xD6, 0x85, 0x86, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xC2, 0x33, 0x9E, 0x86, 0x21, 0x21, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x71, 0xFE, 0x5D, 0x6D, 0xEA, 0x03, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x87, 0x9C, 0xE6, 0xCE, 0x2D, 0xE0, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x4A, 0x97, 0xF9, 0x8F, 0xCD, 0xA2, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xB7, 0x2B, 0x60, 0xCE, 0x26, 0x1F, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x8A, 0x44, 0xFF, 0x32, 0xE2, 0xCB, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xEA, 0xE4, 0xEA, 0x2B, 0xD0, 0xDA, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x46, 0xE7, 0x2B, 0xBB, 0x29, 0x0B, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x8F, 0xC1, 0x13, 0x3D, 0x82, 0x2D, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x28, 0xFE, 0x39, 0x3A, 0x83, 0x55, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x4B, 0xFE, 0xB2, 0x42, 0x34, 0xEB, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x73, 0x9B, 0x06, 0xA6, 0x46, 0xBC, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xFE, 0xC9, 0x2A, 0x04, 0xC1, 0x38, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xFF, 0x82, 0x83, 0x0F, 0x14, 0x11, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x1F, 0x99, 0x9A, 0x30, 0x26, 0xA4, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x8C, 0xF9, 0xAF, 0xE3, 0xED, 0x21, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x5C, 0xD1, 0x82, 0x66, 0x43, 0x06, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x29, 0x2A, 0x24, 0x3D, 0x0C, 0xE3, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xAE, 0x89, 0x76, 0xB4, 0xF4, 0x13, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x74, 0x63, 0xBA, 0x04, 0x32, 0xD5, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xCF, 0xA5, 0x91, 0xE9, 0x78, 0xBB, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xAB, 0x9D, 0xDC, 0xB2, 0x4A, 0x67, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xA1, 0x65, 0x9F, 0x6A, 0x5B, 0xCB, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xEF, 0x6F, 0x3F, 0x50, 0xC5, 0x17, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x84, 0x07, 0x25, 0x88, 0x78, 0x57, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x69, 0x13, 0xA9, 0x2A, 0x66, 0x7F, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x79, 0x29, 0x73, 0x6E, 0xBF, 0x56, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x6E, 0x54, 0x74, 0x1F, 0x75, 0x87, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xC4, 0x97, 0xBD, 0xDC, 0xCF, 0x74, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xEB, 0x84, 0x70, 0xFA, 0xC0, 0x8B, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xA4, 0x47, 0xA2, 0x22, 0x30, 0xC1, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x12, 0xDC, 0x90, 0xB0, 0x8F, 0x05, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x6F, 0x97, 0xD7, 0xC0, 0xA6, 0x74, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x90, 0xB9, 0xDE, 0xA3, 0x07, 0xCA, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x8E, 0x5F, 0xBB, 0xE0, 0x6C, 0x88, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x6B, 0x78, 0xC6, 0xC5, 0x27, 0xD4, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xFE, 0xAC, 0xB0, 0xDD, 0x78, 0xB9, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xA9, 0x96, 0x34, 0x17, 0x1E, 0xBE, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x4B, 0xBB, 0x2A, 0xCA, 0x34, 0xB6, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xBB, 0xA3, 0xDF, 0x4F, 0x76, 0x22, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xD2, 0x30, 0x7F, 0xEA, 0xC8, 0x16, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x8B, 0x2E, 0x1F, 0x2D, 0xA1, 0x3E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x70, 0x7F, 0xD8, 0x6B, 0x39, 0xF5, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x86, 0xEF, 0xC7, 0xBE, 0x69, 0x96, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x50, 0x15, 0x57, 0x4F, 0x75, 0x05, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xB1, 0x3F, 0x60, 0xA2, 0x1A, 0xD4, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x81, 0x2F, 0xD5, 0x72, 0x97, 0xCB, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x75, 0xD5, 0x31, 0x2B, 0xEB, 0x53, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xFB, 0x5F, 0x53, 0xF3, 0x4A, 0x2F, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x0E, 0x11, 0xB1, 0x8F, 0x60, 0xA1, 0x1A ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_9[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x53, 0x52, 0x38, 0xCF, 0x0F, 0x97, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x61, 0xF5, 0x3E, 0x2D, 0x27, 0x12, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xD7, 0xF0, 0x12, 0xB7, 0x2C, 0xC1, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x71, 0x9D, 0x26, 0xBC, 0xE5, 0x76, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xDA, 0x59, 0x95, 0x74, 0x53, 0x92, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x8D, 0x3F, 0xA3, 0x97, 0xBE, 0x2C, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x30, 0x1C, 0xDC, 0x74, 0xF3, 0x19, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x81, 0x67, 0xD4, 0xA6, 0x61, 0x83, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xCE, 0x54, 0xF9, 0xBA, 0x62, 0x3B, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x10, 0xEE, 0x73, 0x20, 0xDF, 0x65, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x56, 0x7E, 0x63, 0x22, 0x2C, 0x7B, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x31, 0xFF, 0x56, 0xBE, 0x39, 0x75, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x50, 0x20, 0x09, 0x22, 0x80, 0xB2, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xE0, 0x5E, 0xD1, 0xB4, 0x26, 0x01, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xF6, 0x86, 0xA1, 0xF3, 0x5F, 0x0D, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xAF, 0x5A, 0x03, 0xB7, 0x54, 0x74, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xF5, 0x1E, 0x21, 0xED, 0x8A, 0xB3, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x13, 0xA8, 0x77, 0xD6, 0x59, 0x51, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x05, 0x44, 0x7D, 0xFE, 0x96, 0xDB, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x38, 0xBA, 0xFB, 0xFC, 0x1C, 0xE0, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x9B, 0x55, 0x10, 0x2E, 0x2D, 0x29, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x8A, 0x64, 0xCF, 0xE3, 0xD7, 0xA6, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xFE, 0x14, 0xF8, 0x95, 0x4E, 0xA0, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x09, 0x76, 0x15, 0x8D, 0x20, 0x3F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xB0, 0x4C, 0x1A, 0x0D, 0x79, 0x35, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x95, 0x14, 0x64, 0xE8, 0xA9, 0xCD, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xB0, 0x77, 0x18, 0x73, 0x06, 0xA1, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x23, 0x66, 0xB0, 0x19, 0xA0, 0xFD, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x2F, 0xDF, 0x91, 0x1E, 0x14, 0x0D, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x87, 0xDD, 0x4C, 0x4B, 0x06, 0xB4, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xBC, 0xA1, 0xFF, 0xF9, 0xC5, 0x29, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xFB, 0x8E, 0xAA, 0x9B, 0xD4, 0xFE, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x9C, 0xE9, 0x09, 0x91, 0xB3, 0x1E, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xA7, 0x85, 0xC3, 0x02, 0x34, 0xE6, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x5B, 0xFA, 0xA4, 0x21, 0xCB, 0x37, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x8B, 0x6F, 0x27, 0x97, 0x51, 0x7C, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x1C, 0xED, 0x64, 0x2F, 0xAC, 0x28, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x00, 0x4D, 0x57, 0x8C, 0xCA, 0x03, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xD0, 0x9D, 0x38, 0xA6, 0x30, 0x8D, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x4C, 0x52, 0x37, 0x8E, 0x70, 0x78, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x70, 0xBA, 0xA9, 0xF5, 0xA9, 0x69, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x21, 0x9C, 0x6F, 0x37, 0xC8, 0xB1, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xEA, 0xDB, 0xC7, 0x26, 0x89, 0x4F, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x4D, 0x86, 0x71, 0x85, 0xA3, 0xE9, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x66, 0xAB, 0x29, 0xD4, 0x27, 0xFF, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x38, 0x78, 0x43, 0xAD, 0x0B, 0x0D, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x85, 0x67, 0x3C, 0x0D, 0x43, 0x42, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xE2, 0xFC, 0xBB, 0xDA, 0xD4, 0x07, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x0F, 0x39, 0xCD, 0x9D, 0x5B, 0xC0, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x95, 0x2E, 0xF3, 0x1F, 0x9B, 0x45, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x6E, 0x57, 0xC0, 0x9C, 0x4D, 0x3E, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x15, 0x89, 0xFE, 0x65, 0xC4, 0x97, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xD4, 0xC9, 0xD5, 0x57, 0xA0, 0xB5, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x8C, 0xCE, 0x57, 0x76, 0x53, 0x16, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x1E, 0x83, 0x27, 0x7A, 0x04, 0x5B, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x50, 0xFC, 0x73, 0x74, 0x06, 0xAB, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x96, 0xFC, 0x65, 0x85, 0x68, 0xD6, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xE7, 0x36, 0x0D, 0x4C, 0x8D, 0x78, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xFD, 0x93, 0x55, 0x08, 0x82, 0x71, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xFE, 0x05, 0x07, 0x1F, 0x28, 0x22, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3E, 0x32, 0x35, 0x61, 0x4C, 0x48, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x19, 0xF3, 0x5F, 0xC7, 0xDB, 0x43, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xB8, 0xA2, 0x05, 0xCD, 0x86, 0x0C, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x52, 0x54, 0x48, 0x7A, 0x18, 0xC6, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x5C, 0x13, 0xED, 0x68, 0xE9, 0x27, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xE8, 0xC6, 0x74, 0x09, 0x64, 0xAA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x9F, 0x4B, 0x23, 0xD3, 0xF1, 0x76, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x57, 0x3B, 0xB9, 0x65, 0x95, 0xCE, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x42, 0xCB, 0x3E, 0xD5, 0xB6, 0x96, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xDF, 0xDF, 0x7E, 0xA0, 0x8A, 0x2F, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x09, 0x0F, 0x4A, 0x10, 0xF1, 0xAE, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xD2, 0x26, 0x52, 0x55, 0xCC, 0xFE, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xF2, 0x52, 0xE6, 0xDC, 0x7E, 0xAD, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xDD, 0xA8, 0xE8, 0x3E, 0xEA, 0x0E, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x89, 0x2F, 0x7B, 0xB9, 0x9F, 0xE9, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xD7, 0x09, 0xE1, 0xF4, 0x81, 0x17, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x49, 0x8F, 0x44, 0x45, 0x60, 0x82, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x25, 0xB8, 0x21, 0x61, 0x1F, 0x0B, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xDE, 0x2E, 0xAF, 0x81, 0x4D, 0xE9, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x21, 0x73, 0xBD, 0x47, 0x0F, 0x94, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x1C, 0xBF, 0x76, 0xC1, 0xD9, 0x10, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xD7, 0xF0, 0x8C, 0x8B, 0x4F, 0xA8, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xFC, 0x59, 0x61, 0xBB, 0xF1, 0x72, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x53, 0x2D, 0x69, 0x2E, 0x3C, 0x7C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x97, 0x76, 0x55, 0x94, 0x69, 0x6C, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x77, 0x47, 0xBF, 0x9F, 0xEC, 0x44, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xA4, 0x61, 0xFE, 0xD4, 0x91, 0x2D, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x17, 0x5D, 0x3E, 0x5A, 0x42, 0x7D, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xE1, 0xFE, 0xB0, 0xD7, 0x72, 0xEA, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0C, 0xDF, 0x8F, 0x7D, 0xD3, 0x2C, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xA0, 0x2A, 0xAE, 0x9E, 0xEA, 0x0A, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x63, 0x7F, 0xC0, 0x44, 0x35, 0xA8, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x02, 0x5F, 0xAA, 0xE5, 0x2E, 0x97, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xEA, 0xAA, 0x63, 0x56, 0xD6, 0xA7, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xBF, 0xA6, 0xE6, 0x95, 0x5E, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x1D, 0x22, 0x62, 0x1F, 0xC1, 0x42, 0x35 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_10[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x82, 0x2C, 0xE3, 0x2E, 0xB4, 0xC3, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x94, 0x14, 0x40, 0x36, 0xD9, 0x4C, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xFA, 0x44, 0xC5, 0x18, 0xE2, 0x2E, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xC4, 0x3B, 0xFC, 0x27, 0xDE, 0x4E, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x8D, 0x1E, 0xD6, 0xA2, 0x99, 0x1B, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xE2, 0x7A, 0xE2, 0x40, 0x89, 0x2B, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x62, 0x7D, 0x2B, 0x4D, 0x29, 0x4B, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x76, 0x14, 0x42, 0xDA, 0x03, 0xBD, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x85, 0xD3, 0xE7, 0x74, 0x9B, 0x9F, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xAF, 0x42, 0x94, 0xF2, 0xFE, 0x5B, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x25, 0x46, 0xF1, 0xDD, 0x0B, 0xE5, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x83, 0x82, 0x14, 0x53, 0x65, 0x21, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xF9, 0x25, 0x98, 0x69, 0x32, 0xEB, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x04, 0xFC, 0xBC, 0xDE, 0x74, 0x7D, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x15, 0xCC, 0xEF, 0x8C, 0xA4, 0x21, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x8E, 0x84, 0x86, 0x95, 0x80, 0x2C, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xA5, 0x79, 0x0E, 0xDA, 0x2E, 0xF1, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x9A, 0xDA, 0x98, 0x21, 0x4F, 0xCA, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xFC, 0xA9, 0x42, 0x15, 0xDD, 0x7D, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x04, 0x5F, 0x30, 0x68, 0x78, 0x9C, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8A, 0x2B, 0x70, 0xD9, 0xA9, 0x78, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x05, 0x2A, 0xEB, 0x74, 0x4A, 0xBD, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x56, 0xEC, 0xEC, 0xD0, 0x14, 0xE5, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xF7, 0x7B, 0xB8, 0x80, 0x5E, 0x18, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xE3, 0xDA, 0x67, 0xAD, 0x8F, 0x97, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x00, 0xED, 0xDA, 0x94, 0xE6, 0x39, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xB3, 0xA4, 0x32, 0x4F, 0xDF, 0x6F, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x07, 0x5D, 0x13, 0x12, 0x24, 0x47, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xB8, 0x48, 0xD5, 0xE9, 0x3E, 0x9E, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xBA, 0x95, 0xBE, 0x44, 0xF6, 0x9F, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x29, 0x5B, 0x9D, 0x73, 0x69, 0x97, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA0, 0xBB, 0x15, 0x1A, 0xBE, 0xC4, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xD5, 0x17, 0x3A, 0xC6, 0x75, 0x65, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x29, 0x34, 0xFB, 0x70, 0xAB, 0xA1, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xB4, 0x76, 0x4F, 0x98, 0xA7, 0x73, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x10, 0xAC, 0x2C, 0xB4, 0x75, 0x0E, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x40, 0x25, 0x3C, 0x19, 0x82, 0x01, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x4A, 0x7E, 0xEE, 0x66, 0x30, 0x29, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x9C, 0x2D, 0x86, 0xC5, 0xF6, 0x43, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x0F, 0x75, 0xDD, 0x63, 0x8A, 0x01, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x04, 0xFF, 0x81, 0xE3, 0x43, 0xE9, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x9C, 0xD0, 0x63, 0x03, 0x87, 0xAF, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x65, 0xDB, 0xAE, 0xAA, 0xC3, 0x54, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xF7, 0xC8, 0x9F, 0x86, 0x14, 0x42, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x6A, 0x7A, 0x3A, 0x17, 0xC8, 0xC1, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x1B, 0x60, 0x1C, 0x1D, 0x71, 0x9A, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x0C, 0x70, 0x88, 0xDA, 0xED, 0x5D, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x48, 0x6A, 0xAD, 0x6A, 0x66, 0xB4, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x34, 0x7C, 0xE4, 0x3A, 0x7E, 0x97, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x31, 0x93, 0x63, 0x7E, 0x2C, 0xF5, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x65, 0x25, 0xD9, 0xDF, 0xE1, 0x41, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xB6, 0xC7, 0xC9, 0x2D, 0x6B, 0x6F, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x6A, 0x1C, 0xBF, 0xB3, 0x0F, 0x90, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x2E, 0x54, 0xD3, 0x2C, 0xA1, 0x3B, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x5C, 0x8E, 0x38, 0xAB, 0x21, 0xFF, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x38, 0x9C, 0x24, 0xC7, 0x31, 0x5F, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xF5, 0x1B, 0xA9, 0xD3, 0xFE, 0xC0, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xB1, 0x22, 0xE9, 0x13, 0x72, 0x0B, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x17, 0x59, 0x4A, 0x5F, 0x13, 0xDC, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC2, 0x4D, 0xA5, 0xE8, 0x1F, 0x7D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x82, 0x41, 0x4E, 0x15, 0x7D, 0x27, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x24, 0xC9, 0xD3, 0x03, 0x86, 0x16, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x07, 0xA5, 0x57, 0x60, 0x57, 0x4F, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x68, 0x98, 0x61, 0xA0, 0x8F, 0xF5, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x75, 0x92, 0x8B, 0xAA, 0xF7, 0x91, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xEA, 0x67, 0xD9, 0x76, 0x65, 0xD8, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xE5, 0xC4, 0x90, 0x43, 0x64, 0x9C, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x72, 0xAA, 0xA1, 0x38, 0x1C, 0x51, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xFF, 0x78, 0xA8, 0x55, 0x18, 0xC2, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x61, 0xA0, 0xF4, 0xAF, 0x47, 0x29, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x0F, 0x03, 0x02, 0x82, 0xD6, 0x11, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x01, 0x5E, 0xE4, 0xD2, 0xDC, 0xA4, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x68, 0x88, 0xF9, 0xD6, 0x53, 0x9C, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x24, 0x90, 0x39, 0xCC, 0xA5, 0x6B, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x32, 0x41, 0x0D, 0x89, 0x5F, 0x29, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x4A, 0xD1, 0xBD, 0x7F, 0x70, 0x2E, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x75, 0x55, 0x16, 0xC1, 0xDC, 0x57, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x8B, 0x40, 0xC3, 0x87, 0xEC, 0xD1, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x3E, 0x4A, 0xAC, 0x5D, 0xC2, 0xDC, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x5B, 0x17, 0xD7, 0x7D, 0x0A, 0x6A, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xB9, 0xCB, 0xF5, 0x80, 0xE4, 0xA0, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xE4, 0x77, 0xF5, 0x31, 0x5F, 0xC4, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x84, 0xAD, 0x30, 0x43, 0x9D, 0x2C, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xEE, 0xCE, 0x1E, 0x5C, 0x43, 0x3A, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x71, 0x5C, 0xBC, 0xA5, 0xEC, 0xD1, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xBC, 0x2D, 0x7C, 0xBD, 0x79, 0x43, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xCE, 0x20, 0xB9, 0x94, 0x46, 0x5E, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x43, 0x55, 0xE3, 0x83, 0xD6, 0xDB, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x1D, 0x06, 0xBA, 0xB2, 0xBF, 0xB6, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x6A, 0xF8, 0x3D, 0x90, 0xED, 0xAD, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xFD, 0x5C, 0xB9, 0xD0, 0x45, 0xB2, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x09, 0x7C, 0x0A, 0xC3, 0xF6, 0x4E, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xCD, 0xF4, 0x1A, 0xB3, 0x4C, 0xB2, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x66, 0xD4, 0xFD, 0xB5, 0xF4, 0x18, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x14, 0x6E, 0x08, 0x19, 0x23, 0x24, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x64, 0xA1, 0xEF, 0x91, 0x0E, 0x5D, 0xD2 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_11[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x05, 0x59, 0xC6, 0x5D, 0x68, 0x87, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x1A, 0x45, 0xAF, 0xCF, 0x7F, 0x8B, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x19, 0x51, 0x11, 0x24, 0x6D, 0x40, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x28, 0x46, 0x24, 0x29, 0x27, 0xF7, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xFB, 0x61, 0x11, 0xB7, 0xE8, 0x59, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x44, 0x8A, 0xE8, 0x87, 0xA0, 0x1B, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x9A, 0xD3, 0x90, 0x89, 0x3A, 0xF9, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xF7, 0x59, 0xB9, 0xDE, 0xD9, 0xAA, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x7A, 0x4B, 0x06, 0xB4, 0xE4, 0x9F, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x2B, 0x31, 0x70, 0xB7, 0x35, 0x5A, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xA2, 0x29, 0xCD, 0x8A, 0xEB, 0xA0, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x88, 0x1D, 0xBE, 0x31, 0xC7, 0x17, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x9E, 0x1E, 0xEA, 0xB7, 0x5B, 0x0D, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x8B, 0x51, 0x32, 0x65, 0x0E, 0x12, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x14, 0x37, 0xBD, 0x58, 0x0F, 0x9C, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x01, 0xE1, 0xE2, 0x07, 0x41, 0xAE, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x51, 0x28, 0xA5, 0x95, 0xF8, 0x1B, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x79, 0x02, 0x9D, 0xF7, 0x4F, 0x56, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x1E, 0xDC, 0x84, 0x50, 0x81, 0x7D, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xE5, 0x8D, 0x48, 0x44, 0x51, 0x86, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x72, 0x73, 0xE6, 0xB2, 0x91, 0x32, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xF9, 0x4E, 0xA1, 0x57, 0xA4, 0x6B, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x6B, 0x75, 0xFE, 0x72, 0xF7, 0x74, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x86, 0x4E, 0xC7, 0x09, 0x4B, 0x0C, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x11, 0xB8, 0x82, 0x5F, 0xD7, 0xAD, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xFC, 0x93, 0x67, 0xEB, 0x70, 0x54, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x79, 0x79, 0x68, 0x46, 0xB8, 0x32, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xF2, 0x49, 0xDA, 0xF0, 0xBB, 0xFF, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x74, 0xD0, 0xF8, 0x6E, 0xA0, 0xC0, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x4F, 0xB5, 0xE1, 0x56, 0x98, 0x8B, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x13, 0xC1, 0x6F, 0xA4, 0x8E, 0x74, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x15, 0x24, 0xF3, 0x07, 0xFF, 0x21, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x3D, 0x2C, 0x2F, 0xD6, 0x86, 0xCD, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x7A, 0x5A, 0x98, 0x63, 0x56, 0xB9, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xE5, 0xAB, 0xAA, 0xDE, 0xA6, 0x31, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x7C, 0xCF, 0xD9, 0x0D, 0x36, 0x53, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x04, 0x81, 0xA9, 0x64, 0x72, 0x80, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x8A, 0x6F, 0xE3, 0x23, 0x92, 0x03, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x39, 0x1B, 0x9B, 0x4D, 0x34, 0x6A, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x93, 0x1E, 0x87, 0x24, 0x7B, 0xD9, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x09, 0x51, 0x92, 0xCD, 0x0E, 0x0B, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x07, 0x20, 0x36, 0xFC, 0xAD, 0x57, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x63, 0x18, 0x30, 0x54, 0x69, 0x3F, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xBD, 0xDD, 0x4F, 0x86, 0x60, 0x4E, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x08, 0xC3, 0xF6, 0x88, 0x34, 0x8E, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xF7, 0xBC, 0xE3, 0x1C, 0x13, 0xD1, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xAC, 0x40, 0x3A, 0x72, 0x7C, 0x3E, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x38, 0x4C, 0x75, 0xF0, 0xE2, 0x37, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x73, 0xAA, 0xB2, 0xB2, 0xA9, 0xBF, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x44, 0x88, 0x60, 0xD1, 0x3B, 0x06, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x2C, 0x75, 0x72, 0xD1, 0xA2, 0x68, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x8F, 0x3B, 0x99, 0xEF, 0x05, 0x22, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x8C, 0x74, 0xA8, 0x24, 0x85, 0x60, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x71, 0x9A, 0x0B, 0xC2, 0x20, 0xB2, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x7F, 0xE6, 0x4E, 0x91, 0x17, 0x91, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x79, 0x9A, 0xAC, 0xE2, 0xE0, 0x0F, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x9F, 0x42, 0xE0, 0x88, 0x1B, 0x8F, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x14, 0x6E, 0xEF, 0xD4, 0x9F, 0x19, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xB5, 0x6E, 0xD8, 0x2A, 0x1A, 0xA5, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xF2, 0x87, 0xC5, 0xC7, 0x2C, 0xFC, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x2C, 0xFC, 0xDA, 0x2F, 0x49, 0xC2, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x51, 0x9A, 0x15, 0xE1, 0xEE, 0x53, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x45, 0x63, 0xD8, 0xF6, 0x3E, 0xEA, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xCF, 0x94, 0xC9, 0x61, 0x2A, 0xB6, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xE7, 0x0B, 0xB2, 0x19, 0x94, 0xEE, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x05, 0xB0, 0x51, 0xB5, 0x88, 0x45, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xDA, 0xD6, 0x5F, 0x60, 0x7E, 0x45, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x60, 0x3E, 0xC6, 0xED, 0x46, 0x13, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xDE, 0x2F, 0x22, 0xEF, 0x33, 0xCE, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x15, 0xD1, 0x9C, 0x44, 0x54, 0x54, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x9D, 0x13, 0x15, 0xD1, 0x9A, 0xD4, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x7E, 0x36, 0xDF, 0x08, 0xBB, 0xD6, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA2, 0xDC, 0xCA, 0xE0, 0xA2, 0x04, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x65, 0x28, 0xA5, 0xB6, 0x4E, 0xD4, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xF6, 0x77, 0x2C, 0x49, 0x17, 0x4B, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xDA, 0x2F, 0x18, 0x18, 0xF3, 0x05, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x9D, 0x71, 0x4E, 0xDE, 0x76, 0x60, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x21, 0xA9, 0x25, 0x58, 0xFE, 0x38, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x99, 0xCB, 0xA5, 0x6F, 0xDB, 0xB0, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xBC, 0x09, 0xFB, 0x78, 0x63, 0xC9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xF9, 0x5C, 0xA3, 0xB2, 0xFE, 0x94, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xE2, 0x41, 0xB4, 0xC2, 0x65, 0x97, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x21, 0x6B, 0x6D, 0xAB, 0xB0, 0xB2, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x51, 0xB7, 0x5C, 0x47, 0x7A, 0x25, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x18, 0x61, 0xF9, 0xEC, 0xC5, 0x4C, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x5D, 0x6E, 0xBA, 0x25, 0x8E, 0x23, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x2E, 0x3B, 0x13, 0x0A, 0x98, 0x88, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x21, 0xAD, 0xF0, 0x31, 0x8E, 0xD8, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xD8, 0x47, 0xC5, 0x62, 0xCD, 0xEB, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x5E, 0xE4, 0x18, 0xBD, 0xF7, 0x2B, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xBB, 0x1E, 0x4E, 0xD3, 0xED, 0xD0, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xDE, 0x93, 0x00, 0x45, 0xB7, 0xBC, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x64, 0xBC, 0x67, 0xE2, 0xD3, 0xAA, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x90, 0x6B, 0xD4, 0x4B, 0x93, 0x55, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xDF, 0x20, 0x6E, 0xD9, 0xF1, 0x4F, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xC9, 0x42, 0xDF, 0x23, 0x1D, 0xBA, 0xA4 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_12[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xDE, 0x93, 0x7C, 0xFB, 0x9F, 0x20, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x09, 0x14, 0x3C, 0xB8, 0x91, 0xCF, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xE3, 0x88, 0x90, 0x1C, 0x70, 0xD7, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xF3, 0x4E, 0x22, 0x72, 0xDB, 0x53, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x51, 0x16, 0x2A, 0x79, 0xD9, 0x7C, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xDE, 0x2A, 0xC6, 0x49, 0x40, 0x8B, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x50, 0xBF, 0x97, 0x36, 0x79, 0x9B, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x5B, 0xAC, 0x64, 0xC6, 0x30, 0x8F, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xF3, 0x28, 0xC1, 0xF4, 0xB3, 0xF2, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xCE, 0x5E, 0x05, 0x47, 0xE6, 0x52, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xC2, 0x10, 0x4B, 0x65, 0x90, 0x82, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x94, 0x27, 0xA0, 0x95, 0x8F, 0xBB, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x2D, 0x2E, 0xB8, 0xC8, 0x82, 0xDB, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xA0, 0xAC, 0xAA, 0xDC, 0x6F, 0xDA, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xC5, 0x74, 0x2D, 0xF7, 0x05, 0x44, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x06, 0x2C, 0xF5, 0xB1, 0x3D, 0x0D, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x6F, 0x80, 0xB9, 0xBF, 0x20, 0xC0, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x9B, 0x4E, 0x7B, 0xCE, 0xFF, 0x32, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x8C, 0xF3, 0x32, 0xA6, 0x2F, 0x87, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x58, 0x4E, 0x41, 0x3B, 0xB2, 0xE4, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xB6, 0x50, 0x66, 0xF0, 0x4E, 0x23, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xAD, 0xE5, 0x32, 0x3F, 0x30, 0x4F, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x29, 0x55, 0x00, 0x9E, 0xB8, 0x24, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x72, 0xB1, 0x40, 0x14, 0x2F, 0x57, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xCF, 0x8A, 0x4C, 0xDA, 0x99, 0xB2, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xAF, 0x8A, 0x1D, 0xC0, 0x1B, 0x8F, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x59, 0x09, 0x5F, 0xFF, 0x2C, 0x20, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xE2, 0xD5, 0x10, 0xA9, 0x01, 0x9C, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x96, 0xA5, 0x37, 0xA9, 0x79, 0x18, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xDE, 0x1F, 0xE0, 0x04, 0xBA, 0xA0, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xD7, 0x1B, 0xE3, 0xC2, 0x88, 0x47, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x6E, 0x7A, 0xA2, 0xD5, 0x63, 0x25, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x90, 0x28, 0xCA, 0xB0, 0x5A, 0x2F, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xB1, 0x9F, 0x42, 0xEC, 0x2D, 0xAC, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x6D, 0x33, 0xC5, 0xFF, 0xC1, 0xE3, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x04, 0x8A, 0x0E, 0x35, 0x0D, 0xCF, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xCE, 0x97, 0xA1, 0x1A, 0x86, 0xFA, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xD2, 0xD6, 0xF5, 0x47, 0x66, 0xF1, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xD1, 0x23, 0x40, 0xE0, 0x92, 0x24, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xF7, 0xB3, 0xDF, 0x2F, 0x72, 0xCD, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x78, 0xAD, 0x7A, 0xD8, 0x45, 0x0E, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x3C, 0xD4, 0xB0, 0x61, 0x28, 0x2D, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x9A, 0x47, 0xE0, 0x55, 0x49, 0xFD, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x44, 0x61, 0x78, 0x33, 0x18, 0xF6, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x76, 0x25, 0xD6, 0x92, 0xB3, 0x09, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x12, 0x92, 0xD8, 0xFE, 0xD3, 0x4F, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xB3, 0x82, 0xC9, 0x0A, 0x0C, 0x95, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x45, 0xBC, 0xA5, 0xA9, 0xEB, 0x05, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xF6, 0x54, 0xB2, 0x54, 0x8C, 0xCE, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xF0, 0x46, 0xFC, 0x00, 0x5B, 0x48, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x90, 0x62, 0xDD, 0xE7, 0x72, 0x69, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xCB, 0x86, 0x59, 0x28, 0x75, 0x8B, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x6C, 0x95, 0x5F, 0xF3, 0xE2, 0x25, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xCB, 0x74, 0x10, 0xFF, 0x27, 0xE7, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xDB, 0x7B, 0x71, 0x84, 0x17, 0x13, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x99, 0xD3, 0x76, 0x8D, 0x03, 0x7F, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xA2, 0xAE, 0x8C, 0xF9, 0x6E, 0x83, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x50, 0xE0, 0xE6, 0x57, 0x1F, 0xB8, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xEC, 0x85, 0x11, 0x32, 0xE7, 0x01, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xF1, 0x9F, 0xFE, 0x2C, 0x55, 0x54, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x28, 0x09, 0x7A, 0x93, 0x0B, 0x63, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x0C, 0x8A, 0xED, 0xB8, 0x3D, 0x13, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x2D, 0xD3, 0x76, 0xE4, 0x13, 0x74, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x63, 0x9B, 0x31, 0x47, 0x15, 0xED, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x27, 0x4F, 0xCB, 0x42, 0x2E, 0xB0, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x00, 0x4A, 0x93, 0xEA, 0x01, 0x28, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xCC, 0x1A, 0x1D, 0x7B, 0x22, 0x17, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xE0, 0x32, 0xFE, 0xB3, 0x6B, 0x12, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x95, 0x39, 0xD8, 0x64, 0xFE, 0xCF, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xE5, 0x4F, 0xCF, 0x3D, 0x21, 0xB1, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xA6, 0xAA, 0x8A, 0xFE, 0xA8, 0xD6, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x9A, 0x7C, 0x4A, 0xD5, 0x30, 0x81, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xCD, 0xB1, 0xB7, 0xAF, 0xD8, 0xC8, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x36, 0xC3, 0x61, 0x8F, 0x51, 0x59, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xB8, 0x4D, 0x20, 0x47, 0x02, 0x8E, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x2D, 0x19, 0x8F, 0x86, 0x1E, 0xEB, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x6C, 0xAC, 0x8E, 0x63, 0xED, 0x0B, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x63, 0xFD, 0xC2, 0x91, 0xDF, 0xED, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xA0, 0x76, 0x60, 0x9A, 0x58, 0x0D, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x18, 0xE6, 0x77, 0xA1, 0x6C, 0x34, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x8E, 0x87, 0x87, 0x32, 0x00, 0x05, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x36, 0xDA, 0xFA, 0x92, 0x26, 0xD4, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x10, 0xF4, 0x52, 0x45, 0x77, 0xB2, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xC5, 0x14, 0x34, 0x00, 0x77, 0x4C, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x72, 0x71, 0xDC, 0x72, 0xD5, 0x36, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xBC, 0x48, 0x59, 0xF8, 0xFB, 0x48, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x5A, 0x08, 0xAF, 0xAA, 0x8C, 0x12, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xB8, 0x15, 0x31, 0xCB, 0x93, 0x60, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x6C, 0x82, 0x45, 0x79, 0xE2, 0xC5, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x26, 0xBD, 0x64, 0x28, 0x2F, 0x33, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x53, 0x69, 0x8F, 0xB6, 0x74, 0x64, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x14, 0xA5, 0x1C, 0x69, 0xBE, 0xE6, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x6A, 0xF3, 0xFF, 0x1D, 0xB8, 0xC8, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xD6, 0xDF, 0xF1, 0x07, 0xF8, 0xE6, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x1C, 0x40, 0xD0, 0xB1, 0x11, 0xB8, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x88, 0xF5, 0xBC, 0x49, 0x1F, 0x6B, 0x63 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_13[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xBD, 0x27, 0xF9, 0xF6, 0x3F, 0x41, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x13, 0x28, 0x78, 0x70, 0x23, 0x9F, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xC6, 0x11, 0x21, 0x39, 0xE0, 0xAE, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0x9D, 0x44, 0xE4, 0xB6, 0xA7, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xA2, 0x2C, 0x54, 0xF2, 0xB2, 0xF9, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xBD, 0x55, 0x8C, 0x93, 0x80, 0x16, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xA0, 0x7E, 0x2F, 0x6D, 0xF2, 0x36, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xB6, 0x58, 0xC9, 0x8C, 0x61, 0x1E, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xE7, 0x51, 0x82, 0xE9, 0x67, 0xE5, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x9D, 0xBD, 0x0A, 0x8E, 0xCC, 0xA5, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x85, 0x21, 0x96, 0xCA, 0x20, 0x05, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x28, 0x4F, 0x40, 0x2B, 0x1F, 0x77, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x5A, 0x5C, 0x70, 0x91, 0x05, 0xB7, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x40, 0x59, 0x55, 0xB9, 0xDF, 0xB4, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x8B, 0xE9, 0x5A, 0xEE, 0x0B, 0x88, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x0D, 0x58, 0xEA, 0x63, 0x7B, 0x1A, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xDE, 0x00, 0x73, 0x7F, 0x41, 0x80, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x37, 0x9D, 0xF6, 0x9C, 0xFF, 0x65, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x19, 0xE7, 0x65, 0x4C, 0x5F, 0x0E, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xB1, 0x9C, 0x82, 0x76, 0x64, 0xC9, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x6D, 0xA1, 0xCC, 0xE0, 0x9D, 0x46, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x5B, 0xCB, 0x65, 0x7E, 0x60, 0x9E, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x52, 0xAA, 0x00, 0x3C, 0x71, 0x49, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xE4, 0x62, 0x81, 0x28, 0x5E, 0xAE, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x9E, 0x15, 0x99, 0xB4, 0x33, 0x65, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x5E, 0x15, 0x3B, 0x80, 0x37, 0x1E, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xB2, 0x12, 0xBE, 0xFE, 0x59, 0x40, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xC5, 0xAB, 0x21, 0x52, 0x03, 0x38, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x2D, 0x4B, 0x6F, 0x52, 0xF3, 0x30, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xBC, 0x3F, 0xC0, 0x09, 0x74, 0x41, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xAE, 0x37, 0xC6, 0x85, 0x11, 0x8F, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xDD, 0xF4, 0x44, 0xAB, 0xC7, 0x4A, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x20, 0x51, 0x94, 0x61, 0xB5, 0x5E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x62, 0x3F, 0x85, 0xD8, 0x5B, 0x58, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xDB, 0x66, 0x8A, 0xFF, 0x83, 0xC7, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x09, 0x14, 0x1D, 0x6A, 0x1A, 0x9E, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x9C, 0x2F, 0x43, 0x35, 0x0C, 0xF5, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xA5, 0xAD, 0xEB, 0x8F, 0xCC, 0xE2, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xA2, 0x47, 0x80, 0xC0, 0x25, 0x49, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xEF, 0x67, 0xBF, 0x5F, 0xE4, 0x9A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xF1, 0x5A, 0xF5, 0xB0, 0x8B, 0x1C, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x79, 0xA8, 0x61, 0xC3, 0x50, 0x5A, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x34, 0x8F, 0xC0, 0xAB, 0x92, 0xFA, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x89, 0xC2, 0xF0, 0x66, 0x30, 0xEC, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xED, 0x4A, 0xAC, 0x25, 0x67, 0x13, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x24, 0x24, 0xB1, 0xFD, 0xA7, 0x9F, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x67, 0x05, 0x93, 0x15, 0x18, 0x2A, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x8A, 0x78, 0x4B, 0x53, 0xD7, 0x0B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xED, 0xA9, 0x64, 0xA9, 0x18, 0x9D, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xE1, 0x8D, 0xF8, 0x01, 0xB6, 0x90, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x20, 0xC5, 0xBA, 0xCF, 0xE5, 0xD2, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x96, 0x0D, 0xB3, 0x50, 0xEA, 0x16, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xD9, 0x2A, 0xBF, 0xE6, 0xC5, 0x4B, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x96, 0xE9, 0x20, 0xFE, 0x4F, 0xCE, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xB6, 0xF7, 0xE2, 0x08, 0x2F, 0x26, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x32, 0xA7, 0xED, 0x1A, 0x07, 0xFE, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x45, 0x5D, 0x19, 0xF3, 0xDD, 0x06, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xA1, 0xC0, 0xCD, 0xAF, 0x3E, 0x70, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xD9, 0x0B, 0x23, 0x64, 0xCE, 0x03, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xE2, 0x3F, 0xFD, 0x59, 0xAA, 0xA8, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x51, 0x12, 0xF4, 0x26, 0x17, 0xC6, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x19, 0x14, 0xDB, 0x71, 0x7B, 0x26, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5B, 0xA6, 0xED, 0xC8, 0x27, 0xE8, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xC7, 0x36, 0x63, 0x8E, 0x2A, 0xDA, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x4E, 0x9E, 0x96, 0x85, 0x5C, 0x60, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x00, 0x94, 0x26, 0xD5, 0x03, 0x50, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x99, 0x35, 0x3A, 0xF6, 0x44, 0x2E, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xC0, 0x65, 0xFC, 0x67, 0xD7, 0x24, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x2A, 0x73, 0xB0, 0xC9, 0xFC, 0x9F, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xCA, 0x9F, 0x9E, 0x7B, 0x42, 0x62, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x4D, 0x55, 0x15, 0xFD, 0x51, 0xAD, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x35, 0xF9, 0x94, 0xAA, 0x61, 0x02, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x9A, 0x63, 0x6F, 0x5F, 0xB1, 0x91, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x6C, 0x86, 0xC3, 0x1E, 0xA3, 0xB2, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x70, 0x9B, 0x40, 0x8E, 0x04, 0x1C, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x5A, 0x32, 0x1E, 0x0D, 0x3D, 0xD6, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xD9, 0x58, 0x1D, 0xC7, 0xDA, 0x17, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xC7, 0xFA, 0x85, 0x23, 0xBF, 0xDB, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x40, 0xED, 0xC0, 0x34, 0xB1, 0x1A, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x30, 0xCC, 0xEF, 0x42, 0xD9, 0x68, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x1C, 0x0F, 0x0F, 0x65, 0x00, 0x0A, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x6D, 0xB4, 0xF5, 0x25, 0x4D, 0xA8, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x21, 0xE8, 0xA5, 0x8A, 0xEE, 0x64, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x8A, 0x29, 0x68, 0x00, 0xEE, 0x98, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xE5, 0xE2, 0xB8, 0xE5, 0xAA, 0x6D, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x79, 0x91, 0xB2, 0xF0, 0xF7, 0x91, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xB4, 0x10, 0x5E, 0x55, 0x19, 0x25, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x71, 0x2B, 0x62, 0x96, 0x27, 0xC1, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xD9, 0x04, 0x8B, 0xF2, 0xC4, 0x8B, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x4C, 0x7A, 0xC9, 0x50, 0x5E, 0x66, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xA6, 0xD2, 0x1E, 0x6D, 0xE9, 0xC8, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x29, 0x4A, 0x39, 0xD2, 0x7C, 0xCD, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xD5, 0xE6, 0xFF, 0x3B, 0x70, 0x91, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xAD, 0xBF, 0xE3, 0x0F, 0xF0, 0xCD, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x38, 0x80, 0xA0, 0x63, 0x23, 0x70, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x10, 0xEB, 0x79, 0x93, 0x3E, 0xD6, 0xC6 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_14[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x94, 0x69, 0x75, 0xBF, 0xC3, 0xB3, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x40, 0xA1, 0x6C, 0x4A, 0xA0, 0xA1, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x38, 0xBE, 0xE5, 0xCB, 0x90, 0xDA, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xC4, 0x82, 0xAA, 0x55, 0x0D, 0x27, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xA7, 0xA3, 0x1C, 0x37, 0xB8, 0xE0, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x7F, 0x5E, 0xD3, 0x84, 0x60, 0x77, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x05, 0xC4, 0x0E, 0xF5, 0x11, 0x7B, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x0F, 0x46, 0x39, 0x59, 0xFC, 0x39, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xA5, 0xB4, 0x86, 0xD5, 0x1E, 0x7D, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xBF, 0xC0, 0xF0, 0x3E, 0x31, 0x25, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x94, 0xDE, 0x84, 0x22, 0x6D, 0xEC, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x98, 0x75, 0x6C, 0x80, 0x62, 0x6B, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x87, 0xBA, 0x5E, 0x7D, 0x90, 0xF2, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x7E, 0x8E, 0xE6, 0xDB, 0x7F, 0x40, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x42, 0xA1, 0x79, 0xA0, 0x74, 0x4B, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xEC, 0xA0, 0x78, 0x61, 0xAE, 0xAF, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x5B, 0xC3, 0x5C, 0xE7, 0x9C, 0xF4, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xAB, 0xAF, 0xBB, 0xF2, 0xD0, 0xBE, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x6A, 0x8F, 0xAF, 0x15, 0x16, 0x01, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x69, 0x04, 0x76, 0x01, 0xA3, 0x89, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x41, 0xE5, 0x72, 0x4B, 0xFF, 0xE9, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xF5, 0x87, 0x41, 0xF2, 0x08, 0xFF, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x92, 0xDC, 0x2A, 0xC5, 0x32, 0x11, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xBB, 0x93, 0x35, 0xDE, 0xCE, 0x5D, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x4F, 0x99, 0x69, 0x7C, 0xA9, 0x9D, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xD3, 0x3B, 0x50, 0x0C, 0xC9, 0xDB, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x78, 0xDD, 0x94, 0x22, 0x64, 0x53, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x32, 0xBA, 0x89, 0xF6, 0x0A, 0xA5, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x92, 0x2C, 0x72, 0x6A, 0x16, 0xED, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x95, 0xBE, 0x7F, 0x6B, 0x19, 0xBB, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xD8, 0x79, 0xF8, 0x26, 0x71, 0xB9, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xD9, 0x92, 0x4D, 0xAF, 0xB7, 0x71, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x75, 0xC5, 0xE3, 0x05, 0xEA, 0x79, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x2F, 0x9C, 0x5A, 0x00, 0xF6, 0x52, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x51, 0x33, 0x90, 0x1A, 0xA4, 0xC2, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x96, 0x87, 0x77, 0x40, 0x5D, 0xAD, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x8E, 0x16, 0x9D, 0x38, 0x32, 0x9A, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xA3, 0xF0, 0x99, 0xE3, 0xC2, 0x66, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xFE, 0xAA, 0xC3, 0x3A, 0x69, 0xDD, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xE4, 0x31, 0xFC, 0x16, 0xEF, 0x34, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x29, 0x5A, 0x0A, 0x6B, 0x5B, 0x10, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xD8, 0xED, 0x56, 0xD4, 0x30, 0x67, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x5B, 0x66, 0x68, 0xFF, 0x45, 0x85, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x99, 0x0A, 0xE8, 0x28, 0x80, 0x99, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xFF, 0x95, 0xE2, 0x80, 0x15, 0x01, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x60, 0xC5, 0x44, 0xC2, 0x78, 0x5E, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x88, 0x93, 0x0A, 0x42, 0xAB, 0xA8, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xE1, 0x9B, 0x58, 0xDE, 0x91, 0x82, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xFC, 0xF6, 0x6E, 0x8C, 0xB7, 0x8C, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xDE, 0x15, 0x1B, 0xAE, 0x04, 0x27, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x7F, 0x04, 0x97, 0x89, 0x91, 0x01, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xD3, 0x16, 0x07, 0x19, 0x9A, 0x80, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xEA, 0xBD, 0x07, 0xC5, 0x6C, 0xE8, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x9C, 0x04, 0x92, 0x4B, 0x5C, 0x0C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x51, 0x13, 0x38, 0xE9, 0x3E, 0xA5, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x15, 0x8D, 0xEF, 0xE8, 0x18, 0x70, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x12, 0x86, 0x70, 0xC1, 0xE2, 0x2F, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x04, 0xAB, 0x0A, 0x9A, 0x4D, 0x4F, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xB0, 0x36, 0x8D, 0xD6, 0x84, 0x55, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x98, 0x2F, 0x99, 0x86, 0x85, 0xEE, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xC7, 0x22, 0x0D, 0x4F, 0x53, 0xFA, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xF7, 0xDC, 0x84, 0x53, 0xD7, 0x29, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xA7, 0xF3, 0x4B, 0xC9, 0x36, 0x3C, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xA0, 0xD6, 0xFD, 0x54, 0xE7, 0x4C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x88, 0xD7, 0x1D, 0x4A, 0x68, 0x74, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x6C, 0xFF, 0xAF, 0x99, 0xC7, 0x63, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xBF, 0x46, 0x45, 0x7C, 0x5F, 0x4A, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xDB, 0xB8, 0x2F, 0x76, 0xDC, 0x24, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x42, 0xAF, 0xE8, 0x8C, 0x7E, 0x19, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x8D, 0x80, 0xDB, 0xBE, 0x08, 0xF7, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x6F, 0x11, 0xE3, 0x4C, 0x6C, 0xF0, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xC2, 0x4C, 0xE0, 0xE8, 0x3F, 0x3C, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x92, 0x87, 0xE9, 0xE9, 0x8A, 0x02, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x5C, 0xE3, 0xC0, 0x47, 0x74, 0x0B, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x0C, 0x2B, 0x89, 0xA3, 0x70, 0x50, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x87, 0xA8, 0x26, 0x05, 0x9A, 0x62, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x7F, 0xEC, 0x14, 0x30, 0x87, 0x19, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xDD, 0xD8, 0xC5, 0x97, 0x86, 0xAE, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x42, 0xBB, 0xB1, 0x0A, 0x86, 0x6E, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x77, 0x18, 0x64, 0xF4, 0x7E, 0x84, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x23, 0xB0, 0x3E, 0x13, 0xC5, 0xB1, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x99, 0xC2, 0x39, 0x5B, 0xD6, 0x10, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xF1, 0x33, 0x42, 0xCE, 0xED, 0x97, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xFB, 0xDF, 0xEC, 0x67, 0x12, 0xE4, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xE7, 0x72, 0xF7, 0x13, 0x43, 0xBF, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x2E, 0x58, 0xAA, 0xB9, 0xF7, 0x53, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xCE, 0xAD, 0xF7, 0x60, 0x61, 0x64, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xC7, 0xA8, 0x8B, 0xE7, 0xA1, 0x8A, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xA0, 0x23, 0xF0, 0xF3, 0x13, 0x37, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xD9, 0x92, 0x38, 0x87, 0x84, 0x44, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x16, 0xDF, 0xB6, 0x8B, 0x5E, 0x01, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xD5, 0x20, 0x37, 0x89, 0x31, 0x2F, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x9E, 0x22, 0xDE, 0x9D, 0xE9, 0xEA, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xB3, 0x40, 0x76, 0xDE, 0x4E, 0xE1, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x24, 0xA0, 0x9C, 0xA6, 0xD6, 0xE5, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x72, 0xC1, 0xFB, 0x3B, 0x80, 0x5F, 0xD7 ),
+};
+static const mbedtls_mpi_uint ffdhe6144_T_15[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x29, 0xD3, 0xEA, 0x7E, 0x87, 0x67, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x72, 0x5E, 0x08, 0xF8, 0x0D, 0x35, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x96, 0x43, 0x52, 0x8A, 0xCA, 0x97, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x27, 0xD4, 0x80, 0x84, 0x85, 0xA7, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x30, 0x6C, 0x9E, 0xDF, 0x25, 0xE4, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x7D, 0x51, 0xCA, 0x0F, 0x4F, 0xB3, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xE0, 0x60, 0x57, 0xD9, 0x0B, 0x59, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x2A, 0xBD, 0xA7, 0xDC, 0xCA, 0xA4, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xB9, 0x0D, 0x44, 0x75, 0xEB, 0x5A, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x4C, 0x2D, 0x29, 0x50, 0x9A, 0xEC, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x81, 0x5A, 0xF4, 0x13, 0xAE, 0xAF, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xB1, 0x03, 0x6E, 0x8C, 0xC1, 0xAB, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xBB, 0x47, 0x77, 0xDF, 0x17, 0x1C, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x7F, 0x76, 0x85, 0x5F, 0x24, 0x98, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x6D, 0xE1, 0xD0, 0x7F, 0xAF, 0xEF, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xBD, 0x19, 0xC7, 0x9F, 0x9C, 0xB4, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xBC, 0xBB, 0x41, 0xB0, 0xD4, 0x22, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x9B, 0xAC, 0xE2, 0x99, 0x53, 0x3F, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xFC, 0xA6, 0x5E, 0x51, 0xF3, 0x83, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xAF, 0xD8, 0xD3, 0x76, 0xA6, 0x60, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xE1, 0xE6, 0xEB, 0x96, 0x3C, 0x15, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xD8, 0x0A, 0x4E, 0x52, 0x21, 0xEF, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xE5, 0x55, 0x7A, 0x5B, 0x33, 0xCD, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x0D, 0x7E, 0xC1, 0xC4, 0x2B, 0x97, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xE9, 0x34, 0x86, 0xFD, 0x0A, 0xBA, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xA2, 0x31, 0x52, 0xDA, 0x35, 0x98, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x03, 0xEB, 0x2C, 0xED, 0xC1, 0xF9, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x48, 0x04, 0xC7, 0xB9, 0x89, 0xBB, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x27, 0x98, 0x32, 0x70, 0x4F, 0x5E, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x06, 0x07, 0x64, 0xA4, 0xDE, 0xC1, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x71, 0xFE, 0x25, 0x0B, 0x9E, 0xB8, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x89, 0xD2, 0x62, 0x32, 0xF2, 0x7B, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x7D, 0x87, 0x82, 0x55, 0x6F, 0xF6, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x86, 0x2A, 0x57, 0x82, 0xEB, 0x1B, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x21, 0x25, 0x2C, 0xE3, 0x9F, 0xCF, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x88, 0x86, 0x6F, 0x26, 0x05, 0x91, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x9F, 0x63, 0x6B, 0xA3, 0xD2, 0xB1, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x3B, 0x54, 0x3A, 0x1D, 0xB7, 0x7E, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFD, 0x15, 0x16, 0x38, 0x19, 0x9D, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x3D, 0x98, 0xC4, 0x8A, 0x44, 0x40, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x52, 0x07, 0xA3, 0xDC, 0x3D, 0x59, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x80, 0x5A, 0x1C, 0x9E, 0x01, 0xC7, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x4F, 0x2E, 0xA3, 0xFD, 0x6D, 0xA0, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x01, 0x61, 0xE0, 0xCA, 0x37, 0xFD, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x33, 0xFA, 0x46, 0x5C, 0xCF, 0x0C, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x80, 0x87, 0x34, 0x67, 0x22, 0x59, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA4, 0x87, 0x3E, 0x41, 0xF7, 0xD3, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x6B, 0xAF, 0xCB, 0xD7, 0x39, 0xD4, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x04, 0xA0, 0xC7, 0x55, 0x1C, 0xAA, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x9D, 0x8D, 0xCF, 0x30, 0xEC, 0x69, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x61, 0x33, 0xEE, 0x24, 0x02, 0xE8, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xC9, 0xD9, 0x13, 0xC6, 0x63, 0x44, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x8C, 0xB7, 0x39, 0x47, 0x3F, 0x11, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x4D, 0xFB, 0x88, 0xFF, 0x96, 0x53, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x68, 0xF0, 0x4D, 0x0D, 0x52, 0xDD, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x33, 0x7C, 0x42, 0x26, 0xAF, 0x31, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xD9, 0x16, 0x6F, 0x64, 0xE3, 0x6C, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xBA, 0x7E, 0x32, 0xE1, 0x56, 0xA1, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xE8, 0x29, 0x5E, 0x19, 0xFD, 0x97, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x9E, 0x4B, 0xAD, 0x03, 0xF8, 0xDE, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xB5, 0xBE, 0x58, 0xA3, 0xF5, 0x67, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xF7, 0xC1, 0x77, 0x80, 0x91, 0x7A, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x85, 0x00, 0xC1, 0xC8, 0xFD, 0xC3, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x3E, 0x11, 0x02, 0xCB, 0xD9, 0x64, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x0E, 0x96, 0xD6, 0x58, 0x75, 0xB3, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x09, 0xDF, 0xFE, 0xFA, 0x4C, 0x5C, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x8E, 0xDA, 0xC8, 0xD1, 0x74, 0xA1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x33, 0x5B, 0xE2, 0x68, 0xC7, 0xBA, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x64, 0x9C, 0xA2, 0x5D, 0x00, 0x7D, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x6D, 0x91, 0x6A, 0x62, 0xD6, 0xEF, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x5E, 0x30, 0xD7, 0x66, 0xC6, 0x91, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x01, 0x14, 0xD7, 0x34, 0x81, 0x05, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xF5, 0xDA, 0xAA, 0x06, 0x11, 0xD1, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xD5, 0xCE, 0xB3, 0xAD, 0xEB, 0x13, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xAC, 0x4B, 0x24, 0x7E, 0x39, 0x99, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x54, 0xDE, 0xE9, 0x22, 0x46, 0x6E, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xB0, 0x9F, 0x4B, 0xBC, 0xCB, 0xE3, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xC5, 0xD9, 0x2A, 0x78, 0x32, 0xF2, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xA0, 0xAD, 0xB0, 0xC9, 0x62, 0xD4, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xF3, 0x0B, 0x15, 0x66, 0x4C, 0xFE, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xCD, 0x25, 0x35, 0xD7, 0xBF, 0xB6, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x4C, 0xD7, 0x3C, 0x15, 0x54, 0x30, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xF9, 0x77, 0x90, 0xC1, 0x51, 0x89, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x6A, 0xD9, 0xF8, 0x5E, 0x18, 0x79, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x05, 0x8E, 0x6F, 0xC9, 0x72, 0x27, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x41, 0xC3, 0x16, 0x1E, 0x8A, 0x44, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x2E, 0x55, 0x90, 0xA2, 0xCD, 0x94, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x29, 0x54, 0x41, 0xF9, 0x24, 0x36, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE0, 0x82, 0x31, 0xE5, 0x75, 0xEC, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x3D, 0x19, 0x0E, 0xAB, 0x25, 0x59, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xEE, 0x22, 0x49, 0x49, 0x1F, 0x6F, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x76, 0xDD, 0x59, 0xD1, 0x2C, 0x7D, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x07, 0x18, 0xEE, 0xB7, 0x0D, 0x1C, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x2A, 0x44, 0xC5, 0x9C, 0x47, 0xE6, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xFE, 0x84, 0x96, 0xF4, 0x58, 0xD3, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xE4, 0x82, 0xF7, 0x77, 0x00, 0xBF, 0xAE ),
+};
+static const mbedtls_mpi ffdhe6144_P = DHM_MPI_INIT_ARRAY( ffdhe6144_p );
+static const mbedtls_mpi ffdhe6144_T[15] = {
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_1 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_2 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_3 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_4 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_5 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_6 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_7 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_8 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_9 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_10 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_11 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_12 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_13 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_14 ),
+    DHM_MPI_INIT_ARRAY( ffdhe6144_T_15 ),
+};
+
+static const mbedtls_mpi_uint ffdhe8192_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x42, 0xC6, 0xC5, 0xB7, 0x8B, 0x8C, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xF8, 0x8F, 0x83, 0x94, 0x2A, 0x1E, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x61, 0xF4, 0xA9, 0x06, 0xE5, 0x22, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x44, 0xA8, 0xF7, 0x49, 0x1D, 0xD1, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x7F, 0x67, 0x30, 0xE5, 0xFD, 0xBB, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x86, 0xFE, 0xC1, 0xF8, 0x1E, 0x74, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA8, 0x71, 0x5D, 0x1C, 0xBE, 0xFA, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x8A, 0xE5, 0xFB, 0xAB, 0xFB, 0xD2, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA6, 0xB0, 0x72, 0xFE, 0x5D, 0x85, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x4F, 0x8A, 0xBA, 0xE0, 0x8C, 0xFC, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xA4, 0x2F, 0x3F, 0x4A, 0x1D, 0xF8, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xE2, 0x77, 0xA5, 0x75, 0x30, 0xFE, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xC0, 0xD9, 0x88, 0x94, 0x01, 0xB8, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x95, 0x9A, 0xAD, 0xCD, 0x16, 0x48, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x21, 0xC1, 0x50, 0x16, 0xE3, 0xE9, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x3C, 0x42, 0x0E, 0x1E, 0x69, 0xAA, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE5, 0x26, 0x38, 0x6C, 0x7E, 0x21, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x3F, 0x70, 0x09, 0x31, 0xA9, 0xA8, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x0E, 0x46, 0x6A, 0x87, 0x99, 0x70, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xB0, 0x86, 0x9C, 0x8C, 0xC6, 0x1F, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x82, 0xFD, 0x46, 0xC0, 0x0C, 0x16, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x5F, 0xC3, 0x35, 0xBA, 0xC0, 0x46, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x82, 0x75, 0x8B, 0xC7, 0x4A, 0x50, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x05, 0xAF, 0xD2, 0x39, 0x88, 0x38, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xD7, 0x1B, 0xC0, 0x1C, 0x0F, 0x2C, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x26, 0x93, 0x7C, 0x74, 0x2F, 0x5B, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x88, 0xAB, 0xA3, 0x42, 0x31, 0xB6, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x10, 0x4B, 0xF6, 0xBD, 0xC3, 0x8C, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xCC, 0xD1, 0xED, 0x69, 0xEB, 0x7F, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x9D, 0x50, 0xC9, 0xCE, 0x3F, 0xB2, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xAE, 0x51, 0xD9, 0x31, 0x5A, 0x42, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xC8, 0x00, 0xF6, 0x4C, 0x00, 0xAD, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x6A, 0xF4, 0xCF, 0x9C, 0x32, 0x0E, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xDA, 0x38, 0x79, 0x0D, 0x57, 0x1D, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x61, 0x31, 0xD4, 0x26, 0x95, 0xA6, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x1E, 0xDB, 0x9A, 0x8E, 0x4A, 0xDD, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x80, 0x6B, 0xDC, 0xF9, 0x71, 0x3B, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x2B, 0x27, 0xC6, 0x10, 0x18, 0x9D, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xF4, 0xCE, 0xCA, 0xD5, 0x2D, 0xCF, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x91, 0x5B, 0xC9, 0x35, 0x52, 0x9F, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x33, 0x54, 0xB8, 0x2D, 0xC8, 0x5D, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xA8, 0x62, 0x15, 0x31, 0x2C, 0x29, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x7F, 0xE7, 0x6A, 0x74, 0x03, 0x2B, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x53, 0x2D, 0x46, 0x1B, 0x09, 0xC9, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x7C, 0xA6, 0x47, 0x58, 0xDB, 0xE8, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x16, 0x61, 0x22, 0xC1, 0x39, 0xA7, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x1B, 0x28, 0x2A, 0x23, 0xC0, 0xAA, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xF9, 0xCA, 0x77, 0x1E, 0x65, 0xC6, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xBB, 0xB2, 0x94, 0x4B, 0x4E, 0x3E, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xD9, 0x77, 0x00, 0xDA, 0x38, 0x7E, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x23, 0x30, 0x18, 0x8C, 0x9F, 0xB2, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA2, 0xE3, 0xF9, 0xFF, 0xC1, 0xBE, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x11, 0x05, 0x35, 0x92, 0xF0, 0x0E, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x40, 0x63, 0xDB, 0x2E, 0x32, 0x55, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x69, 0xA9, 0xA9, 0xF7, 0x71, 0x24, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xB4, 0xFD, 0x4C, 0xFB, 0x47, 0x81, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x04, 0x46, 0x4E, 0x3E, 0x5C, 0x1F, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xEC, 0xCF, 0xFC, 0x57, 0x06, 0xAD, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x1C, 0x70, 0x4C, 0x33, 0x8C, 0x8E, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFD, 0xC0, 0xB1, 0x64, 0xDD, 0x7B, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x24, 0x76, 0x9B, 0x32, 0x54, 0xB4, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x3E, 0xF5, 0xCA, 0x42, 0x44, 0xBA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x2A, 0x53, 0x38, 0x2C, 0x7D, 0x67, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x6C, 0x03, 0x45, 0xB6, 0x64, 0xFD, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xD9, 0x0D, 0x5E, 0x7E, 0x00, 0x8A, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x82, 0x41, 0xF4, 0x51, 0xA8, 0xB5, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA4, 0x88, 0x7F, 0x5A, 0xB5, 0xC9, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x7D, 0xC9, 0xCE, 0xCD, 0x91, 0x82, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x0A, 0x8D, 0xF9, 0xA9, 0xCE, 0x4E, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x00, 0x40, 0x71, 0x3D, 0xB9, 0x1D, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x8B, 0xCB, 0x33, 0xA3, 0x99, 0x29, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x00, 0xAD, 0x71, 0xF9, 0x78, 0xC7, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x30, 0x81, 0x91, 0x0A, 0x60, 0x07, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x68, 0x9E, 0x2D, 0x01, 0x1E, 0x6A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x31, 0xB4, 0xEF, 0x86, 0xC8, 0x35, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xCC, 0x31, 0x7E, 0xA5, 0x5B, 0xF5, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x40, 0x03, 0x55, 0x1D, 0xCF, 0x63, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x6D, 0x9F, 0xD6, 0x42, 0x5F, 0x7D, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x57, 0x88, 0xE5, 0xE4, 0xE9, 0x30, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xF4, 0x4D, 0x16, 0xC3, 0x52, 0x6F, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x1E, 0x9E, 0x66, 0x2B, 0x1D, 0xE4, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9D, 0xD5, 0x3F, 0xEE, 0x20, 0x1B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xDD, 0x53, 0xFA, 0x6B, 0xD0, 0xBC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x48, 0xC4, 0xD5, 0x42, 0x9A, 0xBF, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xEA, 0x0D, 0x9B, 0x97, 0x21, 0xC5, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x3A, 0x36, 0x22, 0xC5, 0x2B, 0x6D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF6, 0x9D, 0x9C, 0xAB, 0x82, 0xAE, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x4B, 0xF5, 0x71, 0x1E, 0xE2, 0xF2, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4D, 0xD7, 0xE2, 0x52, 0x44, 0xFD, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x79, 0x43, 0xBC, 0x93, 0x0C, 0x13, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x92, 0x13, 0x85, 0x09, 0x13, 0xFE, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xD9, 0x86, 0xC1, 0xFA, 0xB0, 0x8C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xF7, 0x91, 0x26, 0x1D, 0xD9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xC9, 0xE6, 0xD6, 0xC9, 0x6F, 0xB4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x02, 0x9C, 0xF9, 0xDE, 0xF4, 0x34, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x03, 0x19, 0x65, 0x3B, 0x5B, 0x35, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xCF, 0x1F, 0x61, 0x38, 0x42, 0x6B, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x34, 0x88, 0x51, 0xC6, 0x4F, 0x9E, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x1B, 0x01, 0xAF, 0x09, 0x34, 0xB0, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x7E, 0xA1, 0x4F, 0x05, 0x12, 0xFE, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xEC, 0xB8, 0x9C, 0xAB, 0x0D, 0x96, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x43, 0x53, 0x13, 0x59, 0x3F, 0x6E, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x4B, 0x6E, 0xB8, 0xDA, 0x34, 0x36, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xEB, 0x4F, 0x5C, 0x86, 0xD6, 0x95, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x5B, 0xF9, 0x19, 0x80, 0xC6, 0x1E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x4E, 0x95, 0x95, 0x48, 0xC8, 0xE6, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x9E, 0xE4, 0x08, 0xC6, 0xB2, 0xFB, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xEB, 0xB6, 0xAD, 0xD9, 0x1A, 0x97, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xA4, 0xC6, 0xF8, 0xBB, 0x7E, 0xDC, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x5D, 0xA9, 0x18, 0xEB, 0xC6, 0x4A, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x25, 0xD1, 0x9D, 0x41, 0x2E, 0x05, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x20, 0x87, 0xAC, 0x8B, 0xB7, 0x1A, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xF6, 0x3D, 0xDF, 0x09, 0xF6, 0x79, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x18, 0x67, 0xCB, 0xB4, 0x62, 0x2F, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x86, 0x5C, 0x72, 0x71, 0xE4, 0x3F, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xCF, 0x18, 0x8E, 0xB7, 0x15, 0xF9, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x85, 0x44, 0xE7, 0xA2, 0x5E, 0x30, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x07, 0x17, 0x51, 0x6E, 0x4A, 0xF3, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x4E, 0x31, 0x5D, 0x78, 0xC6, 0xA1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x02, 0x8E, 0xD6, 0x8B, 0x51, 0x47, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x1B, 0x3D, 0x9F, 0x4A, 0x38, 0x23, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x7F, 0x55, 0xA7, 0x26, 0x1E, 0x76, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xB6, 0x4E, 0xF4, 0xDC, 0x3A, 0xAA, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xFF, 0x02, 0x82, 0xBD, 0x4C, 0x60, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xFB, 0x81, 0x2B, 0xE4, 0x44, 0x49, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xE4, 0x90, 0x3B, 0x71, 0xF9, 0x40, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xAE, 0x02, 0xDB, 0xD8, 0xA9, 0x79, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xA6, 0x5D, 0x30, 0x35, 0xE6, 0x3C, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xDA, 0x9B, 0x18, 0x4B, 0x65, 0xFB, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x37, 0x04, 0x2F, 0xE6, 0x70, 0xDD, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x1C, 0x2B, 0x83, 0x33, 0xF1, 0x1E, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x9D, 0x2D, 0x5A, 0xE8, 0x71, 0xDC, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x7C, 0x3D, 0xD8, 0x2B, 0x8E, 0x03, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xF2, 0x82, 0xB9, 0x11, 0xF8, 0xFF, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x5E, 0xD1, 0xF3, 0xE5, 0x80, 0xD7, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x55, 0x45, 0x70, 0x14, 0xD5, 0x78, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xE8, 0x39, 0x84, 0xCB, 0xB8, 0x71, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xAA, 0x8E, 0xA8, 0xEB, 0xAE, 0xC4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x32, 0x0E, 0x3A, 0xF0, 0x32, 0xBC, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xB3, 0xA3, 0xCD, 0xF2, 0x42, 0x18, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x59, 0x5C, 0xE3, 0xA7, 0x5D, 0x6D, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xC3, 0x00, 0x8B, 0x79, 0x4C, 0xBD, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xB8, 0xA2, 0x73, 0x4A, 0xAF, 0xAF, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x67, 0xA0, 0x7F, 0x0E, 0x94, 0x3B, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xDF, 0x6C, 0x13, 0xAD, 0xCD, 0x7D, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x28, 0x0A, 0x62, 0xD6, 0x36, 0xC4, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xC9, 0x2D, 0xB1, 0x9D, 0x17, 0xCE, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x64, 0xCD, 0x7C, 0x9A, 0x77, 0xD6, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x2B, 0xBF, 0x73, 0x80, 0xA8, 0xF1, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x0F, 0x02, 0x0E, 0xA9, 0x40, 0x2C, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x98, 0xE1, 0xAA, 0x8D, 0x2E, 0x34, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xD0, 0x8D, 0x53, 0x00, 0x38, 0x17, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x05, 0xD8, 0xEC, 0x06, 0x82, 0xE1, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xF8, 0x3B, 0x6A, 0xD0, 0x5B, 0xC0, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x9D, 0x01, 0x5D, 0x9D, 0x85, 0x00, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x34, 0x6A, 0xC7, 0x1D, 0x71, 0x07, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xF2, 0x15, 0x97, 0x22, 0x16, 0x6A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xC6, 0x2C, 0x0A, 0x5A, 0xC0, 0xFB, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x9F, 0x9B, 0x02, 0x34, 0x7E, 0xB3, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xB7, 0xF7, 0xFA, 0xCE, 0x2F, 0x01, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x51, 0x6E, 0xFD, 0x4C, 0xB6, 0x16, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x9A, 0x76, 0xCE, 0x8C, 0x5C, 0xF4, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x25, 0x50, 0xCC, 0x45, 0x83, 0xD3, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x88, 0xA3, 0x38, 0x5D, 0xCA, 0xC3, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x39, 0x39, 0x8D, 0xE0, 0x95, 0xD7, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x72, 0xA3, 0x51, 0x71, 0x0C, 0x47, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xBD, 0xD6, 0xDB, 0x26, 0xDD, 0xB5, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xF3, 0x66, 0xBC, 0xB4, 0xE0, 0x86, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x59, 0x5B, 0xF6, 0xF4, 0xFE, 0x65, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xE5, 0x8C, 0x8D, 0x64, 0xBE, 0x80, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x35, 0x13, 0x4A, 0x85, 0x27, 0xE1, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x2B, 0x35, 0xF1, 0x77, 0x61, 0x50, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x5E, 0x7F, 0x14, 0x7B, 0xAE, 0x71, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x76, 0x86, 0xB4, 0xFA, 0x7C, 0xAB, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xA3, 0xB1, 0x51, 0xBA, 0xFB, 0x9D, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x77, 0x8D, 0xFA, 0xB3, 0x86, 0x4C, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xCE, 0x42, 0x5E, 0xC3, 0x5A, 0xC6, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x28, 0xA3, 0x9D, 0xDD, 0xFF, 0xD0, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x96, 0xE5, 0x26, 0xA3, 0x95, 0x91, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x36, 0x57, 0x53, 0xF9, 0xFC, 0x1C, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xE0, 0xCC, 0xCF, 0x45, 0x1C, 0x3E, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x90, 0x2F, 0xA7, 0xAF, 0x13, 0xDF, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x3E, 0x4D, 0x29, 0x0F, 0x7C, 0xD2, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x45, 0xA0, 0xDA, 0x82, 0x8C, 0x16, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x3F, 0x04, 0x6C, 0x25, 0xDA, 0x12, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xD3, 0x20, 0x30, 0xBC, 0xB8, 0xEF, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x41, 0xAF, 0x6D, 0xEB, 0xC1, 0xF7, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xE9, 0x78, 0xA6, 0xD1, 0x3B, 0x1C, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x60, 0x0E, 0x6B, 0xDC, 0x6A, 0x09, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xC4, 0x39, 0x7F, 0x95, 0x6A, 0xF2, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xA6, 0xBE, 0x3E, 0x8C, 0x23, 0xD8, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xF9, 0x67, 0x44, 0xDE, 0xF7, 0xC1, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x47, 0x9D, 0x35, 0x57, 0xEA, 0x51, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x83, 0xC6, 0x93, 0x86, 0xFE, 0x38, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x52, 0xAA, 0x64, 0x90, 0xFA, 0x96, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x5A, 0x36, 0x72, 0x6E, 0xEF, 0x11, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xF2, 0x23, 0xE5, 0x10, 0x43, 0x32, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xCF, 0x57, 0x30, 0x39, 0xF0, 0x0B, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x64, 0x7D, 0xE2, 0xAD, 0xE6, 0xE0, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xE0, 0x5A, 0x71, 0x52, 0x8E, 0x4A, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x3F, 0x3A, 0x8A, 0x79, 0x25, 0xA3, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xF8, 0x7F, 0x62, 0x8B, 0xC2, 0xE4, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x48, 0x32, 0x86, 0x3E, 0xB3, 0xE2, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x29, 0xBD, 0x95, 0xDC, 0x78, 0xB0, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xEC, 0xDF, 0x23, 0x07, 0x86, 0xF2, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xE6, 0xC2, 0x3D, 0x3A, 0xC0, 0xDE, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xE5, 0xA1, 0xEC, 0xBE, 0x22, 0xD4, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x03, 0x8C, 0x67, 0x9C, 0x47, 0xF5, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xC2, 0x25, 0x2C, 0x40, 0x1E, 0x88, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x13, 0xFC, 0x74, 0x7D, 0xBC, 0xBA, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x37, 0x19, 0x16, 0xAE, 0x32, 0x1B, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x79, 0x67, 0xE4, 0xF3, 0x38, 0x84, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x56, 0xF8, 0xF6, 0x29, 0x77, 0x37, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xC3, 0xAD, 0xE3, 0xA0, 0x96, 0x8A, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xAD, 0xFB, 0xEC, 0xF9, 0x89, 0x45, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x1A, 0xBF, 0x92, 0x57, 0xD4, 0x18, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x4C, 0xB7, 0xFB, 0x92, 0x7F, 0xD7, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x83, 0x0E, 0x8F, 0xB9, 0xE1, 0x23, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x44, 0x3B, 0x3C, 0x33, 0x88, 0x92, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x79, 0xA8, 0xC2, 0x0D, 0x48, 0x19, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x1D, 0xA2, 0xDB, 0x79, 0xD9, 0x67, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x26, 0xAB, 0x98, 0xA9, 0x41, 0x23, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xE7, 0xFA, 0x10, 0xDF, 0x79, 0x1A, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x62, 0x64, 0xC1, 0x0C, 0xFE, 0x08, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x45, 0xEF, 0xA4, 0xE5, 0x9A, 0x74, 0x87 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_3[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x69, 0x10, 0xA3, 0x8C, 0x9F, 0x3C, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xF4, 0x3B, 0x98, 0x5B, 0xDC, 0xD3, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x03, 0xB3, 0x1B, 0x76, 0xF9, 0xDD, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x78, 0x7D, 0x8F, 0x50, 0x36, 0x09, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x43, 0xFE, 0x2E, 0x68, 0x61, 0x0B, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x17, 0x75, 0x40, 0xD0, 0x6B, 0xB0, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x50, 0xA1, 0xF6, 0x13, 0x8E, 0xB7, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x0D, 0x81, 0xD6, 0xE3, 0xCE, 0x42, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x13, 0x45, 0x2F, 0xE5, 0x94, 0xFA, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x95, 0x18, 0x9F, 0x8D, 0x07, 0x72, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x87, 0xE3, 0xA0, 0xD2, 0xA8, 0x31, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xA4, 0x5D, 0xB2, 0x2D, 0xE0, 0xC0, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xD9, 0xDA, 0x8B, 0x60, 0x5D, 0x97, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x89, 0xC8, 0xB2, 0xEE, 0x5A, 0x52, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xAB, 0x73, 0xAB, 0x49, 0x58, 0xED, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xCA, 0xBA, 0x6D, 0xFD, 0x08, 0x0A, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xF4, 0x8B, 0x88, 0x4B, 0x5C, 0xB4, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x28, 0x92, 0xAC, 0x76, 0x4A, 0x5E, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x5F, 0xC1, 0x12, 0x3E, 0x82, 0x49, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xFD, 0x42, 0x64, 0xBE, 0x23, 0xF0, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x5E, 0xA7, 0x05, 0x50, 0xCE, 0xC6, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x19, 0x65, 0x73, 0x30, 0x80, 0x2D, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xA4, 0x58, 0x77, 0x5D, 0xE2, 0x47, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xB4, 0x04, 0xB3, 0xCD, 0x25, 0xF6, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xF9, 0xFB, 0x7B, 0x13, 0xB4, 0xB3, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x95, 0x81, 0x28, 0x9D, 0x66, 0x28, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xD7, 0x72, 0x87, 0x06, 0x6A, 0x65, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x6E, 0x58, 0xB3, 0x85, 0x58, 0xDC, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xB7, 0xD6, 0x80, 0x24, 0x2F, 0xF5, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x90, 0x33, 0xC8, 0x47, 0x68, 0x73, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xB0, 0x6A, 0x97, 0x9B, 0x8C, 0xC7, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x07, 0xE6, 0x57, 0x64, 0x70, 0xB4, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xA7, 0x07, 0x68, 0x7F, 0xE1, 0x0D, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xCF, 0x61, 0x36, 0xCA, 0xAF, 0x2F, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x60, 0x22, 0x3B, 0xC3, 0x8C, 0x9B, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x97, 0x49, 0xDC, 0x30, 0x87, 0x60, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xC6, 0x2A, 0xD8, 0x94, 0xA5, 0x22, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x3D, 0x37, 0x0B, 0xD2, 0x8F, 0x73, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x80, 0x63, 0x1A, 0x18, 0x92, 0x54, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xDC, 0xA4, 0x3D, 0xC1, 0x43, 0x14, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xC4, 0xC1, 0x87, 0xA1, 0x0B, 0xEA, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x32, 0xC8, 0xBB, 0xB2, 0x9D, 0x1A, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xBD, 0xE4, 0x85, 0xB4, 0x59, 0x07, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x34, 0xD1, 0x5B, 0xDB, 0xB7, 0xAF, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x32, 0xD4, 0xCF, 0xD7, 0x8F, 0xB1, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xF5, 0x9E, 0x9F, 0x3C, 0x83, 0x76, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xB7, 0xDF, 0xDC, 0x5B, 0xEE, 0xCF, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xA3, 0xB1, 0xFC, 0x36, 0xDB, 0x50, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x56, 0x49, 0x4C, 0x8E, 0x08, 0xC2, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xD8, 0xA8, 0xCD, 0xEF, 0xE0, 0x5D, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xEE, 0x22, 0xF9, 0x5A, 0xB6, 0x2E, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x33, 0x4E, 0xCF, 0x74, 0xB1, 0x30, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x7D, 0x20, 0x22, 0x52, 0xBF, 0x99, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x1F, 0xBE, 0x20, 0x89, 0x6C, 0x59, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x61, 0xB8, 0xCB, 0xD1, 0x3D, 0xD9, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xA1, 0x06, 0x30, 0x16, 0x92, 0x9E, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x3C, 0x7A, 0x87, 0xA5, 0x6F, 0xFF, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x36, 0xBD, 0x6B, 0xFC, 0xAE, 0xE1, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x7C, 0x04, 0x92, 0xE3, 0xDB, 0x61, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xC9, 0xBB, 0xE1, 0x11, 0xA0, 0x45, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x90, 0x98, 0x62, 0x4F, 0xA3, 0x7B, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x1A, 0xC1, 0x69, 0x35, 0xA8, 0xB2, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x30, 0xFA, 0x2A, 0x5B, 0x1B, 0x48, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x77, 0x89, 0xC2, 0x6D, 0xEF, 0xC5, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xC8, 0xE9, 0x57, 0x63, 0x54, 0xEB, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x72, 0x92, 0x3A, 0x0D, 0x06, 0x1D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x8E, 0x05, 0x7D, 0x68, 0xEC, 0xD1, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xCE, 0xE9, 0x9A, 0x66, 0x76, 0xE5, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x68, 0x7D, 0xD4, 0x14, 0x87, 0x0B, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x70, 0x20, 0xBE, 0xA3, 0xEB, 0x1C, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xE6, 0x8D, 0x07, 0x2C, 0x08, 0xF0, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x27, 0xEB, 0xB8, 0x46, 0x64, 0xA2, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xCB, 0x6C, 0xA9, 0xCF, 0x03, 0x3A, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x3A, 0xA5, 0x02, 0x00, 0xEF, 0xBA, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xEE, 0xCB, 0xB4, 0xEE, 0xA4, 0x36, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x8A, 0x4A, 0x39, 0x6F, 0x94, 0xAD, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x21, 0xDB, 0xEA, 0x4F, 0x9E, 0x61, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x07, 0x60, 0x4E, 0x57, 0x28, 0xD8, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x81, 0x7B, 0x1E, 0x25, 0xAE, 0x1B, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x44, 0xFD, 0xD6, 0xA1, 0xCB, 0x5B, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x5C, 0xF8, 0x24, 0xF8, 0xAC, 0x32, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x0D, 0x2D, 0xE7, 0x1A, 0x0E, 0x3F, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xCF, 0xD8, 0x66, 0x04, 0xD9, 0x1E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xE3, 0x45, 0xA5, 0x1F, 0x68, 0xBF, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xD8, 0x9A, 0x78, 0x1C, 0x8D, 0xFE, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x92, 0x8C, 0xB7, 0x86, 0xD6, 0xDF, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x50, 0x0A, 0x93, 0x40, 0xED, 0xBF, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x87, 0x6A, 0x3B, 0x9F, 0x31, 0x77, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x5B, 0x4C, 0xEE, 0x59, 0x8F, 0xEC, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x35, 0x87, 0xF8, 0x83, 0x3F, 0xF2, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x59, 0xAE, 0x90, 0x0F, 0x6B, 0x25, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x2F, 0x09, 0x51, 0xAF, 0xC2, 0x14, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xAE, 0xEC, 0x3C, 0x30, 0x24, 0x58, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x55, 0x85, 0xEB, 0xF1, 0x29, 0xD7, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x29, 0xE9, 0xB1, 0xF2, 0x7F, 0xCF, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x8C, 0x9E, 0x71, 0xCF, 0xDF, 0x6E, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x03, 0x74, 0xC2, 0xD1, 0xA1, 0x3C, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xD5, 0x34, 0x68, 0xE8, 0xB2, 0xC2, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xC4, 0xB9, 0x22, 0xB6, 0x94, 0x30, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x60, 0x31, 0x4D, 0x9E, 0x94, 0xD5, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x7E, 0xED, 0x31, 0xB6, 0xE3, 0x61, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x1C, 0x8B, 0x78, 0x40, 0x92, 0xC3, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x3E, 0xC3, 0xF3, 0x71, 0x0A, 0x46, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xFA, 0xEE, 0x2A, 0x56, 0x4C, 0xD3, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xC1, 0xCB, 0x9C, 0x49, 0x80, 0x95, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xAE, 0x6C, 0x3E, 0x9B, 0x69, 0xC2, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xE5, 0x6F, 0x3D, 0xF0, 0x49, 0x59, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x1E, 0x4D, 0xE4, 0x26, 0x1E, 0x8E, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x7F, 0x4C, 0x9D, 0xD0, 0x3D, 0x6E, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xD7, 0x6B, 0x78, 0xC6, 0x6A, 0x3D, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x22, 0x4F, 0x1C, 0xED, 0xE5, 0xE1, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x8A, 0x26, 0xA5, 0xFD, 0x8A, 0x05, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xAC, 0xBD, 0xA1, 0xAB, 0xAE, 0xC8, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x87, 0x84, 0xF5, 0xBA, 0x0C, 0x45, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x0B, 0xDF, 0xD4, 0x0C, 0xE8, 0x61, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x21, 0x0A, 0x0D, 0xE3, 0xE1, 0x1F, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xBE, 0x03, 0x48, 0xE3, 0x19, 0xBE, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x40, 0x0A, 0x9C, 0x9E, 0xAE, 0x27, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xC6, 0x77, 0xC6, 0x8F, 0xB3, 0xFD, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x33, 0x71, 0x21, 0x50, 0xE0, 0xCF, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xA5, 0x58, 0x6F, 0x70, 0x11, 0xC6, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x12, 0x6A, 0x15, 0x03, 0x2D, 0xF5, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xB4, 0xB5, 0x60, 0x4D, 0xF2, 0x9E, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x06, 0xE0, 0xA2, 0xB2, 0x7C, 0xEE, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x15, 0x29, 0x63, 0xCF, 0xBD, 0x8C, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x92, 0xB8, 0xFA, 0x9D, 0x9D, 0x58, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x7B, 0x0D, 0xE0, 0xC0, 0xA7, 0x19, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x8B, 0xDE, 0x49, 0xCB, 0x35, 0xE9, 0x0E ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_4[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x62, 0x4E, 0xD2, 0x40, 0xBE, 0x18, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x77, 0x33, 0x7A, 0x4A, 0x7D, 0xBE, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x34, 0x1C, 0xC2, 0x01, 0x88, 0x27, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xD1, 0x3C, 0xE6, 0x9D, 0x72, 0xED, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xC1, 0xC1, 0x81, 0xE0, 0x1E, 0xB5, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x0D, 0x66, 0x06, 0x9C, 0x63, 0x8A, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xDB, 0x1D, 0xF9, 0x7E, 0x61, 0xFF, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x7A, 0xA4, 0x46, 0x08, 0x6F, 0x9E, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x2B, 0x42, 0x07, 0x59, 0x55, 0x3A, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xDF, 0xF4, 0x25, 0xAC, 0x49, 0x26, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x09, 0x37, 0x54, 0x6F, 0xCD, 0xDD, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xD0, 0x7A, 0xF9, 0xD2, 0x8F, 0xED, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xF7, 0x2F, 0x17, 0x71, 0x90, 0x1B, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xE7, 0xEB, 0x46, 0x69, 0xB2, 0x7E, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x77, 0xA7, 0xB8, 0x03, 0x0D, 0xAA, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x55, 0x9F, 0xB9, 0x91, 0xAC, 0x00, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xE0, 0x59, 0x93, 0xDA, 0x72, 0x67, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xF6, 0x65, 0xDC, 0xD6, 0xA9, 0xBC, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xCA, 0x69, 0x1E, 0x4A, 0x2A, 0x04, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x76, 0xEF, 0x03, 0x74, 0xA3, 0xB1, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xCD, 0xD5, 0x60, 0xDB, 0x3F, 0xF8, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xDC, 0x17, 0xBB, 0x73, 0x0C, 0xB6, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x6E, 0xAB, 0x4B, 0x7E, 0x80, 0x6C, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x3E, 0x5E, 0x40, 0x9B, 0x2C, 0xED, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xC7, 0x39, 0x06, 0xD2, 0x44, 0x8D, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xE5, 0x6C, 0xCE, 0x98, 0xE2, 0x82, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xBB, 0xCD, 0xF1, 0x53, 0xBD, 0x19, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x61, 0x6B, 0x52, 0x7E, 0xED, 0x90, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xCF, 0x85, 0x20, 0x5C, 0xC7, 0x4F, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x2F, 0xD0, 0xC8, 0x65, 0x38, 0xF4, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x87, 0x0F, 0xB8, 0xD8, 0x16, 0x49, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xD5, 0x08, 0xBF, 0xDA, 0xBD, 0x13, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xD0, 0xF3, 0xCC, 0xEB, 0x14, 0x1B, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xE1, 0x89, 0x1D, 0xFD, 0x99, 0x3A, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xF6, 0x39, 0x6C, 0xD4, 0x8F, 0x13, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xD5, 0x9F, 0x4E, 0x3D, 0x02, 0xDF, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x43, 0xBA, 0x8E, 0x05, 0xC4, 0x76, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xF5, 0xC2, 0x0A, 0xB1, 0xA5, 0x34, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xE9, 0x78, 0xB1, 0x6A, 0xBF, 0x5F, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x04, 0x12, 0x52, 0x71, 0x1E, 0xC3, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x6C, 0x0B, 0xD6, 0xAC, 0xF8, 0x0D, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x83, 0xF3, 0x14, 0x8E, 0xE8, 0x87, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x4A, 0x04, 0x23, 0x73, 0x7D, 0x83, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x60, 0x70, 0x1D, 0xDA, 0x48, 0xA1, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xDC, 0x4C, 0x7D, 0xBC, 0x51, 0x77, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x3F, 0xAC, 0x98, 0xB5, 0x93, 0x16, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xCF, 0x65, 0xD2, 0x2B, 0x4A, 0x41, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x85, 0x51, 0xBC, 0x04, 0xDF, 0xC3, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x7D, 0x66, 0x30, 0x1E, 0x99, 0x84, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x58, 0x9D, 0x39, 0x69, 0x07, 0x05, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x40, 0x91, 0xF4, 0x5A, 0xE2, 0xF7, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x95, 0x7F, 0xB5, 0x8D, 0x1C, 0x43, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC2, 0xA3, 0x6D, 0x8C, 0x65, 0x05, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x46, 0x56, 0x02, 0xDF, 0xF6, 0xE2, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x5A, 0x72, 0x16, 0xA0, 0x3B, 0x13, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x8A, 0x8B, 0x4A, 0x53, 0x5C, 0x0A, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xFB, 0x77, 0x14, 0x8D, 0x0B, 0xCE, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x2B, 0x87, 0xA2, 0xF0, 0x64, 0xFF, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x49, 0x8A, 0x76, 0x7E, 0xED, 0x10, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xA2, 0x6B, 0x24, 0x78, 0x8D, 0xC6, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x0E, 0x7D, 0xFA, 0x6B, 0x8C, 0x29, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xD6, 0x02, 0x97, 0x00, 0x91, 0xEF, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x80, 0xBC, 0xC8, 0xA5, 0xC4, 0x5C, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x21, 0x9E, 0x79, 0xEA, 0xD7, 0xB2, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x11, 0x81, 0x60, 0xB8, 0x29, 0x40, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x33, 0x2D, 0x65, 0x21, 0x02, 0x17, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x2D, 0x07, 0x44, 0xBD, 0xBB, 0xBF, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x8E, 0x0C, 0x71, 0xE7, 0x3A, 0x6F, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x44, 0x61, 0xFD, 0x69, 0xAB, 0xEA, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xB6, 0x76, 0x3F, 0x24, 0x4E, 0x69, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x3F, 0xFB, 0xFA, 0x64, 0x88, 0x61, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x58, 0xAA, 0x19, 0x6F, 0xD2, 0x85, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xAB, 0x12, 0x57, 0xA2, 0x62, 0x4F, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x64, 0x00, 0xE7, 0xD0, 0x1F, 0x32, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x5A, 0x84, 0x48, 0x44, 0x67, 0xDC, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xEC, 0xD9, 0xFC, 0x23, 0x28, 0x1C, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x4B, 0xFB, 0x23, 0x76, 0x1D, 0x05, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x5B, 0x06, 0xCE, 0x4F, 0xE1, 0xB9, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xF6, 0x49, 0x98, 0xF7, 0x32, 0xE6, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x0C, 0x54, 0x52, 0x81, 0x06, 0xB3, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xB5, 0x98, 0x4E, 0x43, 0x83, 0x0B, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x80, 0x26, 0xF4, 0x86, 0xC4, 0x36, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x31, 0x9C, 0xEA, 0x6E, 0x84, 0xF9, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x53, 0x03, 0x82, 0x4E, 0x4C, 0x08, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x31, 0x89, 0x01, 0xC7, 0x34, 0x8D, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xDD, 0x44, 0x08, 0x29, 0xE9, 0x07, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA2, 0x0C, 0xA1, 0x4A, 0x87, 0x93, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xB1, 0x09, 0x3D, 0x30, 0xF1, 0xDD, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x18, 0xAB, 0x8C, 0x86, 0xC3, 0x7D, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x2D, 0x2A, 0xB1, 0x5A, 0x16, 0x67, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x14, 0xA5, 0x1F, 0x3D, 0xAF, 0xAB, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x80, 0xE1, 0x21, 0x80, 0xCF, 0x9F, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x3F, 0xE2, 0x09, 0x1E, 0xC7, 0x72, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x3B, 0x77, 0xB7, 0x8C, 0x73, 0x45, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x89, 0x3A, 0xD5, 0xEE, 0xD0, 0xBA, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x54, 0xBC, 0xA6, 0xA1, 0xE1, 0x37, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xE6, 0xC9, 0xCB, 0xA0, 0x5E, 0x63, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xD6, 0x9A, 0x1B, 0x5F, 0xF8, 0x44, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xCD, 0x4F, 0x53, 0x2E, 0xF0, 0xCE, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x07, 0x10, 0x12, 0x6B, 0x79, 0x0E, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x32, 0x33, 0xB3, 0x82, 0xF0, 0x5C, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x1F, 0xDC, 0x47, 0x6F, 0x7B, 0x46, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x12, 0xF7, 0xC7, 0xD7, 0xDA, 0x6C, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA3, 0xBB, 0x33, 0x16, 0x98, 0x78, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x03, 0x13, 0x6A, 0xA5, 0x22, 0x1F, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xE8, 0x51, 0x9F, 0x7E, 0x0F, 0xD9, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x24, 0xBD, 0x42, 0xE4, 0xF6, 0xAF, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x7D, 0xF5, 0x43, 0x10, 0xE4, 0x35, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x34, 0x98, 0x55, 0xD2, 0xA2, 0xFD, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xCE, 0x00, 0x58, 0xA6, 0xCA, 0xA7, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xDF, 0xB1, 0xCD, 0x8D, 0xF6, 0xDE, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xD2, 0x2C, 0x1F, 0x50, 0x75, 0xA8, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE3, 0x15, 0x8E, 0x5E, 0xE4, 0xEE, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x76, 0xC3, 0x79, 0xF5, 0x9D, 0x72, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x54, 0xC2, 0xB3, 0x38, 0x1A, 0xD8, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xA4, 0x6F, 0x3D, 0x52, 0xAD, 0xF9, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x0C, 0x74, 0xCD, 0x05, 0x18, 0xFF, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x71, 0xA8, 0xDF, 0x5E, 0x7F, 0xB6, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xA4, 0xB3, 0x0F, 0x6C, 0xDF, 0x03, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x6B, 0x41, 0x8B, 0x94, 0x0F, 0xA9, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xCB, 0x21, 0xD0, 0x0C, 0xC2, 0xF0, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xA3, 0xBB, 0xB8, 0x99, 0x23, 0xCE, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x45, 0x38, 0xAD, 0x6E, 0x8E, 0xB9, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x72, 0x1E, 0xDD, 0xC9, 0x07, 0xBE, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x31, 0xA5, 0xC7, 0xA3, 0xCA, 0xE8, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x0C, 0xCB, 0xBE, 0x64, 0xC5, 0x22, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x3A, 0xFE, 0xEB, 0x48, 0x7E, 0x16, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xF9, 0x3E, 0x51, 0xEA, 0xA9, 0x2F, 0x79 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_5[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xC5, 0x9C, 0xA4, 0x81, 0x7C, 0x31, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xEE, 0x66, 0xF4, 0x94, 0xFA, 0x7C, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x68, 0x38, 0x84, 0x03, 0x10, 0x4F, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xA3, 0x79, 0xCC, 0x3B, 0xE5, 0xDA, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x83, 0x83, 0x03, 0xC1, 0x3D, 0x6A, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x1A, 0xCC, 0x0C, 0x38, 0xC7, 0x14, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xB7, 0x3B, 0xF2, 0xFD, 0xC2, 0xFE, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xF4, 0x48, 0x8D, 0x10, 0xDE, 0x3C, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x57, 0x84, 0x0E, 0xB2, 0xAA, 0x74, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xBF, 0xE9, 0x4B, 0x58, 0x93, 0x4C, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x12, 0x6E, 0xA8, 0xDE, 0x9A, 0xBB, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xA1, 0xF5, 0xF2, 0xA5, 0x1F, 0xDB, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xEE, 0x5F, 0x2E, 0xE2, 0x20, 0x37, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xCE, 0xD7, 0x8D, 0xD2, 0x64, 0xFD, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xEE, 0x4E, 0x71, 0x07, 0x1A, 0x54, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xAA, 0x3E, 0x73, 0x23, 0x59, 0x01, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xC0, 0xB3, 0x26, 0xB5, 0xE5, 0xCE, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xED, 0xCB, 0xB8, 0xAD, 0x53, 0x79, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x94, 0xD3, 0x3C, 0x94, 0x54, 0x08, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xEC, 0xDE, 0x07, 0xE8, 0x46, 0x63, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x9A, 0xAB, 0xC1, 0xB6, 0x7F, 0xF0, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xB8, 0x2F, 0x76, 0xE7, 0x18, 0x6C, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xDD, 0x56, 0x97, 0xFC, 0x00, 0xD9, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x7C, 0xBC, 0x80, 0x36, 0x59, 0xDA, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x8F, 0x73, 0x0C, 0xA4, 0x89, 0x1A, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xCB, 0xD9, 0x9C, 0x31, 0xC5, 0x05, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x76, 0x9B, 0xE3, 0xA7, 0x7A, 0x33, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xC2, 0xD6, 0xA4, 0xFC, 0xDA, 0x21, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x9F, 0x0B, 0x41, 0xB8, 0x8E, 0x9F, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x5E, 0xA0, 0x91, 0xCB, 0x70, 0xE8, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x0F, 0x1F, 0x70, 0xB1, 0x2D, 0x92, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xAB, 0x11, 0x7E, 0xB5, 0x7B, 0x27, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xA1, 0xE7, 0x99, 0xD7, 0x29, 0x36, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xC3, 0x13, 0x3B, 0xFA, 0x33, 0x75, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xED, 0x73, 0xD8, 0xA8, 0x1F, 0x27, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xAA, 0x3F, 0x9D, 0x7A, 0x04, 0xBE, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x86, 0x74, 0x1D, 0x0B, 0x88, 0xED, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xEB, 0x85, 0x15, 0x62, 0x4B, 0x69, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xD2, 0xF1, 0x62, 0xD5, 0x7E, 0xBF, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x08, 0x24, 0xA4, 0xE2, 0x3C, 0x86, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xD9, 0x16, 0xAC, 0x59, 0xF1, 0x1B, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x07, 0xE7, 0x29, 0x1C, 0xD1, 0x0F, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x94, 0x08, 0x46, 0xE6, 0xFA, 0x06, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xC1, 0xE0, 0x3A, 0xB4, 0x91, 0x42, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB8, 0x99, 0xFA, 0x78, 0xA3, 0xEE, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x7F, 0x58, 0x31, 0x6B, 0x27, 0x2D, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x9E, 0xCB, 0xA4, 0x57, 0x94, 0x82, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x0A, 0xA3, 0x78, 0x09, 0xBE, 0x87, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xFA, 0xCC, 0x60, 0x3C, 0x32, 0x09, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xB0, 0x3A, 0x73, 0xD2, 0x0E, 0x0A, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x81, 0x22, 0xE9, 0xB5, 0xC4, 0xEF, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x2A, 0xFF, 0x6A, 0x1B, 0x39, 0x86, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x84, 0x47, 0xDB, 0x18, 0xCB, 0x0A, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x8C, 0xAC, 0x04, 0xBE, 0xED, 0xC5, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xB5, 0xE4, 0x2C, 0x40, 0x77, 0x26, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x15, 0x17, 0x95, 0xA6, 0xB8, 0x14, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xF7, 0xEF, 0x28, 0x1A, 0x17, 0x9C, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x57, 0x0E, 0x45, 0xE1, 0xC9, 0xFE, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x93, 0x14, 0xED, 0xFC, 0xDA, 0x21, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x45, 0xD7, 0x48, 0xF0, 0x1A, 0x8D, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x1D, 0xFA, 0xF4, 0xD7, 0x18, 0x53, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xAC, 0x05, 0x2E, 0x01, 0x22, 0xDF, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x00, 0x79, 0x91, 0x4B, 0x89, 0xB9, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x43, 0x3C, 0xF3, 0xD4, 0xAF, 0x65, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x23, 0x02, 0xC1, 0x70, 0x53, 0x80, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x67, 0x5A, 0xCA, 0x42, 0x04, 0x2E, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x5B, 0x0E, 0x88, 0x7A, 0x77, 0x7F, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x1C, 0x19, 0xE2, 0xCE, 0x75, 0xDE, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x89, 0xC2, 0xFA, 0xD3, 0x56, 0xD5, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x6D, 0xED, 0x7E, 0x48, 0x9C, 0xD2, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x7F, 0xF6, 0xF5, 0xC9, 0x10, 0xC3, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xB0, 0x54, 0x33, 0xDE, 0xA4, 0x0B, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x56, 0x25, 0xAE, 0x44, 0xC5, 0x9E, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xC9, 0x00, 0xCE, 0xA1, 0x3F, 0x64, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xB5, 0x08, 0x91, 0x88, 0xCE, 0xB8, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xD9, 0xB3, 0xF9, 0x47, 0x50, 0x38, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x97, 0xF6, 0x47, 0xEC, 0x3A, 0x0A, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xB7, 0x0C, 0x9C, 0x9F, 0xC2, 0x73, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xEC, 0x93, 0x30, 0xEF, 0x65, 0xCC, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x19, 0xA8, 0xA4, 0x02, 0x0D, 0x66, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x6A, 0x31, 0x9D, 0x86, 0x06, 0x17, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x00, 0x4D, 0xE8, 0x0D, 0x89, 0x6D, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x62, 0x38, 0xD5, 0xDD, 0x08, 0xF3, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xA6, 0x06, 0x04, 0x9D, 0x98, 0x10, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x63, 0x12, 0x03, 0x8E, 0x69, 0x1A, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xBB, 0x89, 0x10, 0x52, 0xD2, 0x0F, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x45, 0x19, 0x42, 0x95, 0x0E, 0x27, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x63, 0x13, 0x7A, 0x60, 0xE2, 0xBB, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x30, 0x56, 0x19, 0x0D, 0x87, 0xFB, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x5B, 0x54, 0x62, 0xB5, 0x2C, 0xCE, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x29, 0x4A, 0x3F, 0x7A, 0x5E, 0x57, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x01, 0xC3, 0x43, 0x00, 0x9F, 0x3F, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x7F, 0xC4, 0x13, 0x3C, 0x8E, 0xE5, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x76, 0xEE, 0x6E, 0x19, 0xE7, 0x8A, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x12, 0x75, 0xAA, 0xDD, 0xA1, 0x75, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xA9, 0x78, 0x4D, 0x43, 0xC3, 0x6F, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xCD, 0x93, 0x97, 0x41, 0xBD, 0xC6, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xAD, 0x35, 0x37, 0xBE, 0xF0, 0x89, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x9A, 0x9F, 0xA6, 0x5C, 0xE0, 0x9D, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x0E, 0x20, 0x24, 0xD6, 0xF2, 0x1C, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x65, 0x66, 0x66, 0x05, 0xE1, 0xB9, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x3E, 0xB8, 0x8F, 0xDE, 0xF6, 0x8C, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x25, 0xEE, 0x8F, 0xAF, 0xB5, 0xD9, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x46, 0x77, 0x67, 0x2C, 0x30, 0xF1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x06, 0x26, 0xD4, 0x4A, 0x45, 0x3E, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xD0, 0xA3, 0x3E, 0xFD, 0x1E, 0xB2, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x49, 0x7A, 0x85, 0xC8, 0xED, 0x5F, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xFA, 0xEA, 0x87, 0x20, 0xC8, 0x6B, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x68, 0x30, 0xAB, 0xA4, 0x45, 0xFB, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x9C, 0x01, 0xB0, 0x4C, 0x95, 0x4F, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xBE, 0x63, 0x9B, 0x1B, 0xED, 0xBD, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xA5, 0x59, 0x3E, 0xA0, 0xEA, 0x50, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xC7, 0x2B, 0x1C, 0xBD, 0xC8, 0xDD, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xEC, 0x86, 0xF3, 0xEA, 0x3B, 0xE5, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xA9, 0x84, 0x67, 0x71, 0x34, 0xB0, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x48, 0xDF, 0x7A, 0xA4, 0x5A, 0xF3, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x18, 0xE8, 0x9A, 0x0B, 0x30, 0xFE, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xE2, 0x50, 0xBF, 0xBD, 0xFE, 0x6C, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x49, 0x67, 0x1F, 0xD8, 0xBE, 0x07, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xD7, 0x82, 0x16, 0x29, 0x1F, 0x52, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x97, 0x43, 0xA0, 0x19, 0x84, 0xE1, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x46, 0x77, 0x71, 0x33, 0x47, 0x9C, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x8A, 0x70, 0x5A, 0xDD, 0x1C, 0x73, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xE4, 0x3C, 0xBA, 0x93, 0x0F, 0x7C, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x63, 0x4A, 0x8F, 0x47, 0x95, 0xD1, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x19, 0x96, 0x7D, 0xC9, 0x8A, 0x45, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x74, 0xFC, 0xD7, 0x91, 0xFC, 0x2C, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xF3, 0x7D, 0xA2, 0xD4, 0x53, 0x5F, 0xF2 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_6[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x40, 0xCB, 0x46, 0x36, 0xCE, 0x71, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x50, 0x0E, 0xAE, 0x36, 0x07, 0x94, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xBE, 0x66, 0x35, 0xFB, 0x90, 0x06, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x26, 0x99, 0x19, 0x9F, 0x9F, 0x33, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xA4, 0xA6, 0xAC, 0x6B, 0xE7, 0x7F, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x19, 0x8B, 0x07, 0xCC, 0x9D, 0x2D, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x82, 0x41, 0x7E, 0xB2, 0x96, 0x5A, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x18, 0xD2, 0x67, 0x8C, 0x6B, 0x0F, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x76, 0x1A, 0xED, 0x2A, 0xC4, 0xB7, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x9D, 0x67, 0x9B, 0xC8, 0x02, 0x15, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xCA, 0xAE, 0xBB, 0x9D, 0xFB, 0xD3, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xC2, 0x4E, 0x17, 0xA6, 0xB1, 0x7E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x3A, 0x23, 0x8C, 0x15, 0x78, 0x14, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x88, 0x15, 0xF8, 0xF6, 0x8F, 0x0A, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xB4, 0x17, 0x2D, 0xD0, 0x5F, 0xAB, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xD1, 0x4A, 0x1B, 0x28, 0xCA, 0x0B, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x16, 0x87, 0x9A, 0xED, 0x1C, 0x0D, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xFE, 0x72, 0x18, 0x3C, 0xA5, 0xB6, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x56, 0x70, 0xD9, 0x70, 0xD8, 0x63, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xC4, 0x80, 0x0D, 0xA5, 0x4C, 0x46, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xAF, 0x11, 0x0E, 0xAF, 0x0F, 0x2B, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xEB, 0x97, 0x24, 0x4A, 0xE7, 0x26, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x56, 0xE7, 0xA0, 0x44, 0x2A, 0xD3, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xAF, 0x5C, 0x69, 0xDF, 0xFA, 0xB8, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xD7, 0xAA, 0x2E, 0xC4, 0xB2, 0x5F, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xB4, 0x16, 0x62, 0x8A, 0x59, 0xBC, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xDC, 0xDF, 0x3A, 0xDB, 0x5D, 0x66, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x4A, 0x1C, 0xDC, 0x43, 0x5A, 0xCD, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xEC, 0x59, 0x5E, 0xC2, 0xD8, 0x5D, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x61, 0x87, 0x35, 0xCC, 0x83, 0x41, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xB8, 0x5B, 0x47, 0xC5, 0x63, 0x55, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xEF, 0xAC, 0x49, 0xFD, 0xD7, 0x95, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x22, 0x55, 0xB9, 0xC3, 0xE0, 0x24, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xCE, 0x68, 0xCF, 0x4D, 0x6B, 0x80, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xE6, 0xB0, 0x1D, 0xC5, 0x88, 0xB7, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xB6, 0x30, 0x6F, 0x00, 0xC4, 0x08, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x08, 0x1D, 0x9E, 0x83, 0xB8, 0xD8, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xA5, 0xBC, 0x45, 0xD3, 0xA0, 0xE2, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x48, 0x13, 0xC0, 0x2D, 0x30, 0xE4, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x3A, 0x1E, 0x73, 0x33, 0x5E, 0x4E, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x41, 0xE7, 0x93, 0xDA, 0x50, 0x94, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x2C, 0xEC, 0x78, 0xEE, 0xBE, 0x40, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xDF, 0x0C, 0x5E, 0xE7, 0x79, 0x8C, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xAE, 0xBE, 0xB3, 0x6C, 0xB2, 0xE1, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x2C, 0x62, 0x69, 0x39, 0x7B, 0x54, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x28, 0xCF, 0x90, 0x8B, 0x70, 0x11, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xA5, 0x75, 0xB2, 0xAF, 0x76, 0x8D, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x9D, 0xB7, 0x18, 0x8A, 0xCA, 0x81, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xFC, 0xA4, 0x7C, 0x5A, 0x73, 0x42, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x3A, 0x02, 0xB1, 0x0B, 0x5F, 0xCC, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x5A, 0x77, 0xA7, 0xE9, 0x9F, 0x14, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x5C, 0xD5, 0xA8, 0x63, 0xF0, 0x4D, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x87, 0xA7, 0xFA, 0x2F, 0x2D, 0xDB, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x59, 0xCD, 0x73, 0x16, 0x04, 0x9E, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x66, 0xCF, 0x42, 0xF9, 0xFF, 0xDE, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xC5, 0x5B, 0xB5, 0xA9, 0x0A, 0x7B, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xAA, 0x6C, 0x60, 0xE4, 0x00, 0xBB, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x22, 0x20, 0x4D, 0x25, 0x20, 0x01, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x78, 0x64, 0xB5, 0x8D, 0x50, 0x6B, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xF1, 0xAB, 0x0D, 0xDA, 0x69, 0xB8, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x37, 0x72, 0x70, 0x62, 0xC0, 0x1B, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x56, 0x68, 0x62, 0x87, 0x80, 0x0F, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7B, 0x68, 0x7F, 0x2E, 0xE7, 0xFD, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x48, 0x91, 0x51, 0x44, 0xDB, 0xCD, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x0F, 0xED, 0xC2, 0xFF, 0xF0, 0x69, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x72, 0x0D, 0xE1, 0xB6, 0x80, 0x1C, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xD6, 0x09, 0x48, 0xC3, 0x23, 0xDD, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xE0, 0x92, 0x6A, 0x3E, 0x7A, 0x89, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x6C, 0x16, 0xCC, 0xDB, 0xCE, 0xC1, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x2D, 0x39, 0x8D, 0x12, 0x3E, 0xA4, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xD2, 0xA9, 0x4E, 0xF6, 0x1B, 0x31, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x68, 0xF9, 0xF0, 0x70, 0x49, 0xA3, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x08, 0x39, 0xD6, 0x8F, 0x85, 0x8D, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x8E, 0x8A, 0x8A, 0x98, 0x77, 0x6C, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x5C, 0x44, 0xD0, 0xF1, 0xC6, 0xBE, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x4C, 0x5E, 0x24, 0xBD, 0x6F, 0x26, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x48, 0x9D, 0xA8, 0x20, 0x4F, 0x2B, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x0E, 0x9D, 0x88, 0x32, 0x74, 0x35, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x6F, 0x4E, 0xEF, 0x7B, 0xF1, 0x3C, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x44, 0x4A, 0x74, 0x7B, 0xA7, 0x48, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xB6, 0x0A, 0xA6, 0x72, 0xE8, 0x05, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x13, 0xE9, 0x7B, 0x03, 0x87, 0xE8, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xED, 0xE8, 0xDF, 0xDF, 0xB2, 0xE3, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xAF, 0xA0, 0x08, 0xCD, 0x64, 0x00, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x59, 0x68, 0x18, 0x94, 0xDD, 0xBE, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x69, 0x25, 0xAD, 0xAC, 0x35, 0x20, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x14, 0x48, 0xA4, 0x10, 0xEC, 0xFD, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x7E, 0x2B, 0xD0, 0xF2, 0xD3, 0x91, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xEB, 0x17, 0x30, 0x01, 0x88, 0x13, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x96, 0x11, 0xA1, 0x63, 0x8C, 0xD1, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xCE, 0x4F, 0xC4, 0x69, 0x35, 0xF9, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x23, 0x49, 0x23, 0x5B, 0x98, 0x9D, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xF6, 0xD0, 0x76, 0xD7, 0xE5, 0xA4, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x32, 0x11, 0xC8, 0xB8, 0x0C, 0x53, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x37, 0x33, 0xBC, 0xF6, 0x80, 0xA4, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x4B, 0x37, 0x63, 0x06, 0x94, 0xB1, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x13, 0xF9, 0xB3, 0xA2, 0xE3, 0x5C, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x7C, 0x09, 0x56, 0xB9, 0xB2, 0x02, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xBD, 0xF4, 0x07, 0x67, 0x23, 0x4C, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x2A, 0x4D, 0xFA, 0xEE, 0x04, 0xC0, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x6A, 0x1B, 0x71, 0xDE, 0x18, 0xFB, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x89, 0x80, 0x61, 0xF7, 0xD6, 0xD7, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x65, 0x2F, 0x9C, 0xDB, 0x4E, 0x4B, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xD7, 0xE2, 0xE8, 0xDC, 0x2C, 0x45, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x2B, 0x90, 0x33, 0x97, 0x0F, 0x08, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x9F, 0x2C, 0xC0, 0x56, 0xD1, 0x14, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x5F, 0xDA, 0xE0, 0x8F, 0xB7, 0x3C, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x26, 0x2F, 0xE8, 0xAC, 0xAC, 0x84, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xB0, 0x33, 0x9E, 0x54, 0x08, 0xDB, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xA5, 0xF8, 0x5F, 0x95, 0x54, 0xE3, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x1D, 0xDE, 0xBC, 0xCB, 0x49, 0xF0, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xEA, 0xB1, 0x5C, 0x40, 0x36, 0x3B, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x81, 0xCB, 0x3D, 0x79, 0xA2, 0x0C, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xD8, 0x6A, 0x50, 0x80, 0xC7, 0xA1, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xC2, 0xB7, 0x67, 0x3D, 0x89, 0x1E, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x20, 0xAE, 0x06, 0x1D, 0xAF, 0xCA, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xFC, 0xA9, 0x5D, 0x05, 0x2E, 0x85, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x65, 0xCE, 0x51, 0x94, 0x16, 0x15, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x55, 0xBD, 0x3D, 0xA3, 0x4C, 0x90, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x19, 0x23, 0x37, 0x76, 0xA6, 0x56, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x9E, 0xCB, 0x10, 0x32, 0x35, 0x36, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x91, 0x23, 0xC0, 0x70, 0x3F, 0x5C, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x9E, 0xBA, 0x06, 0xB3, 0x2A, 0x8F, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xE9, 0xF1, 0x66, 0xD6, 0x53, 0x2D, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x55, 0x79, 0x15, 0xB2, 0x68, 0x0D, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x45, 0x3F, 0x58, 0x02, 0xAB, 0x7E, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xC8, 0x71, 0x5A, 0xBF, 0x2D, 0xFC, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xA4, 0x2E, 0x46, 0xD6, 0x0F, 0x3D, 0xB1 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_7[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x81, 0x96, 0x8D, 0x6C, 0x9C, 0xE3, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x5D, 0x56, 0x96, 0xB5, 0x82, 0x9B, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x84, 0x3D, 0xE7, 0x61, 0xF7, 0xEE, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xEB, 0x3D, 0x89, 0x37, 0x5A, 0x44, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x04, 0xA5, 0x61, 0x8D, 0xB1, 0x2E, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xB4, 0xAE, 0xDE, 0xB2, 0x3D, 0x9F, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x7D, 0x84, 0x3A, 0x6C, 0x0E, 0x41, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x87, 0x32, 0x72, 0xFC, 0x18, 0x24, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x62, 0x4F, 0xDE, 0xA9, 0x8C, 0x9C, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x95, 0x1E, 0xC4, 0x92, 0xA7, 0xA4, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x45, 0xD3, 0xBC, 0x5A, 0x6A, 0xAB, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xE0, 0x6D, 0xEF, 0x01, 0x46, 0x05, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x92, 0xCE, 0x72, 0xB5, 0xBF, 0x2A, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x50, 0x51, 0x67, 0x59, 0x1E, 0x5D, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xD2, 0x94, 0xAC, 0xD2, 0xA8, 0x0E, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x81, 0xD4, 0xE5, 0x39, 0xB1, 0x2D, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xF0, 0xCB, 0x26, 0xBD, 0xD0, 0x6F, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x16, 0xBF, 0xF8, 0x0B, 0xCC, 0x4B, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x6C, 0x70, 0xA9, 0xB0, 0x07, 0x1F, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x7B, 0xBB, 0xB0, 0xC2, 0xFF, 0x1B, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xAE, 0x9C, 0x7F, 0xD1, 0x58, 0x36, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x55, 0x32, 0x02, 0xD4, 0xC1, 0x37, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x4D, 0x0B, 0x0C, 0xCF, 0x93, 0x5F, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xDC, 0x43, 0x47, 0xF7, 0xAA, 0x21, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xA9, 0xA6, 0x8A, 0x4E, 0xDD, 0x86, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x91, 0x11, 0x04, 0xF8, 0xA3, 0x4C, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x92, 0x2C, 0xF9, 0x41, 0x8C, 0x71, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x0B, 0x8D, 0x14, 0x45, 0x83, 0xE4, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xC8, 0x68, 0xC6, 0xC6, 0xED, 0x2E, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xF7, 0x3C, 0x7D, 0x2E, 0x1C, 0x03, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xD3, 0x66, 0xC5, 0xBB, 0x87, 0xF8, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x30, 0x08, 0xBA, 0xC8, 0x55, 0xE9, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x7D, 0xA9, 0x7C, 0x3A, 0xC1, 0x9C, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x33, 0xDD, 0xCE, 0xFE, 0xA3, 0xF2, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xF1, 0x28, 0xC2, 0x7C, 0xBA, 0x51, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x0B, 0x30, 0x0A, 0xDA, 0xF2, 0x6A, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF2, 0x5E, 0xA1, 0x78, 0x26, 0xD4, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xCA, 0x0D, 0xAF, 0xAC, 0xCF, 0x89, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x66, 0xFF, 0xB9, 0x4A, 0x48, 0x2B, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x81, 0x6D, 0x1B, 0x91, 0x8E, 0xCD, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xF1, 0x72, 0x5E, 0x7F, 0x4F, 0x89, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x24, 0x84, 0x39, 0xAF, 0xB5, 0x23, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x15, 0xB7, 0xA6, 0x9D, 0xC7, 0xEF, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xDD, 0x95, 0xFC, 0x64, 0x61, 0x98, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x05, 0x97, 0x8C, 0x57, 0xED, 0xDF, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xD3, 0xF7, 0xD9, 0xBE, 0x05, 0x3A, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x34, 0x8A, 0x42, 0x9E, 0xB3, 0x73, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x1E, 0x47, 0x07, 0xF1, 0xD4, 0x58, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xFE, 0x7E, 0x81, 0x96, 0x81, 0xBE, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xB9, 0x51, 0xCD, 0xCB, 0x6F, 0x5A, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xDB, 0x76, 0x4E, 0xF9, 0x06, 0xAB, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x94, 0x7A, 0x39, 0x3B, 0x41, 0xE9, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x6B, 0x6B, 0xFB, 0x5F, 0x98, 0xF7, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xA2, 0x95, 0xB2, 0x9A, 0x17, 0x2D, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x8B, 0x3B, 0xAA, 0xC3, 0xCD, 0x68, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x21, 0x0E, 0xC1, 0x5B, 0xA3, 0xD1, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xA0, 0xDB, 0x73, 0xCD, 0xB9, 0xF4, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x40, 0xFA, 0x4B, 0x0C, 0xE4, 0xE2, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x05, 0xF9, 0x6D, 0xC3, 0x9A, 0x29, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xC7, 0xE7, 0xCE, 0x80, 0x47, 0xE2, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x72, 0x23, 0x2F, 0x60, 0xA3, 0xBB, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x88, 0x5A, 0x29, 0xDC, 0xAC, 0x6A, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xB8, 0xDB, 0x33, 0x1A, 0x8A, 0x41, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x67, 0xCF, 0x6A, 0x5C, 0x39, 0x34, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xB2, 0xD6, 0x40, 0x49, 0x7D, 0xD6, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x0B, 0x0D, 0x64, 0xEF, 0x00, 0xAF, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x2A, 0xD2, 0x9B, 0x34, 0x9F, 0x04, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x1C, 0x9D, 0x55, 0x22, 0x3F, 0x49, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x5A, 0x63, 0xC9, 0xE9, 0x0B, 0x01, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x4F, 0xE5, 0x20, 0x7B, 0xAD, 0xF9, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xA4, 0x13, 0x2C, 0xAF, 0x7E, 0x44, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x46, 0x27, 0xAE, 0x3E, 0xF9, 0x1C, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x11, 0xC5, 0x3A, 0x26, 0x92, 0x53, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xEC, 0x93, 0x83, 0x26, 0x8F, 0xD1, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x50, 0xEA, 0x72, 0xE2, 0x6F, 0x13, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x68, 0x08, 0x59, 0xF3, 0x16, 0x17, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xC4, 0x08, 0xD3, 0x9B, 0x42, 0x61, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xDC, 0x36, 0xBC, 0x47, 0x19, 0x07, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x72, 0xFD, 0x07, 0xB5, 0x83, 0xFC, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x31, 0x0C, 0x03, 0x12, 0x65, 0x60, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x78, 0xC7, 0x35, 0x22, 0x7E, 0x9C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x08, 0x34, 0x91, 0xDB, 0xF0, 0xEC, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x3C, 0xFC, 0x7F, 0xD1, 0x44, 0xAC, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x80, 0xED, 0x16, 0x2E, 0xF9, 0x43, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x6B, 0x0C, 0x5B, 0xE5, 0x20, 0xBE, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xE8, 0x3C, 0xBF, 0xC1, 0x49, 0x7B, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xEE, 0x59, 0x26, 0x5C, 0xAC, 0x8E, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x05, 0xB9, 0x03, 0x3A, 0x25, 0x75, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x8B, 0x3A, 0xEE, 0xE3, 0x2D, 0x34, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xDF, 0x4B, 0x5F, 0x74, 0xD4, 0xA5, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x23, 0x5C, 0xCC, 0x3F, 0x5E, 0xDF, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xB4, 0x7E, 0xC1, 0xAC, 0x1D, 0x3D, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x14, 0x1B, 0x2C, 0xB4, 0x1A, 0xBD, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x6C, 0x2A, 0xFE, 0x4A, 0xFC, 0xCC, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xA5, 0x7F, 0xA1, 0x23, 0x92, 0x94, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x95, 0xD2, 0xCC, 0x2D, 0x33, 0x2E, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x23, 0xD9, 0x02, 0x0A, 0x6C, 0x84, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x28, 0xF3, 0x4A, 0x3A, 0x23, 0x9A, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x8A, 0x36, 0x4E, 0xA7, 0xFC, 0xA4, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xD1, 0x83, 0x77, 0x5A, 0x18, 0xF1, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xB5, 0x74, 0xB3, 0x00, 0x35, 0x40, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x65, 0x91, 0x76, 0xD3, 0x72, 0xB1, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x49, 0x6C, 0x49, 0x84, 0x8B, 0x47, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x2A, 0x40, 0xE8, 0x1C, 0x5B, 0x17, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x27, 0xEC, 0x3E, 0x61, 0x1A, 0xDC, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x5C, 0x61, 0xB2, 0xCB, 0xA5, 0x26, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x50, 0xAA, 0xD3, 0x56, 0xC7, 0x71, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x91, 0xEB, 0x6C, 0x72, 0x6B, 0xB2, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x13, 0x2E, 0x5E, 0x05, 0xCE, 0x66, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x55, 0x19, 0x5F, 0x73, 0xCE, 0x5B, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x56, 0xF3, 0xC6, 0x4B, 0xEA, 0xD7, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xD9, 0x3E, 0x06, 0xFE, 0xBA, 0x6B, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x89, 0x5C, 0x33, 0xA3, 0x7A, 0x6C, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xCA, 0x27, 0x6A, 0x5F, 0x36, 0x52, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x9C, 0x7F, 0xDB, 0x9F, 0x88, 0x96, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xB6, 0x75, 0x2C, 0xC9, 0x51, 0x46, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x30, 0xFC, 0x3B, 0xAC, 0x48, 0xB3, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xAF, 0xAF, 0x65, 0xD3, 0xC7, 0xC6, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x3C, 0x74, 0x1C, 0x27, 0xA4, 0xEC, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xCD, 0x48, 0x98, 0x16, 0x2E, 0xCE, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xDB, 0xD2, 0x72, 0x61, 0xB8, 0xEA, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xAE, 0x3A, 0x1D, 0x7E, 0x9B, 0x88, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xFD, 0xD9, 0xE8, 0x97, 0xB7, 0x8A, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x9F, 0x7F, 0xB9, 0x6B, 0x71, 0x79, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x75, 0xC5, 0x5C, 0xE0, 0x0B, 0x61, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x4D, 0x41, 0x89, 0xE4, 0xFF, 0x20, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x45, 0x28, 0x12, 0x26, 0x07, 0x00, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x48, 0x5D, 0x8C, 0xAC, 0x1F, 0x7A, 0x62 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_8[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xF9, 0xE1, 0x3D, 0x76, 0xA8, 0xB4, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xE1, 0x02, 0x34, 0xC2, 0x56, 0x9C, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x0F, 0x9E, 0xF4, 0x2D, 0xBD, 0x62, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xCC, 0xEF, 0xE1, 0x41, 0xBF, 0x5C, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xE3, 0x59, 0xC3, 0x6F, 0x68, 0xA5, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x33, 0xD1, 0xF2, 0xE5, 0x21, 0xBE, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xAE, 0x42, 0x9C, 0x4F, 0xB6, 0x06, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xC1, 0xB2, 0x84, 0x29, 0x11, 0x64, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xCB, 0x27, 0x5F, 0x5F, 0xAD, 0x77, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xC6, 0xCB, 0xA2, 0xB4, 0x7C, 0x0F, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x6B, 0x46, 0xDA, 0x4A, 0x4D, 0x2C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x1C, 0xEF, 0xD7, 0xF2, 0xB5, 0x86, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x71, 0xAA, 0xFD, 0x07, 0x03, 0xD4, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x13, 0xC6, 0xA1, 0x02, 0xFC, 0x01, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xA5, 0x1E, 0x4F, 0xEC, 0x92, 0xCF, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x7D, 0xE0, 0x03, 0x2B, 0x8C, 0x86, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x67, 0x64, 0xBE, 0x90, 0x67, 0x36, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x6D, 0xC7, 0x17, 0xEF, 0x90, 0x81, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x03, 0x21, 0x22, 0xA6, 0x9B, 0x68, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xC4, 0x3D, 0x7A, 0x75, 0xE9, 0x61, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xC2, 0xB3, 0xD0, 0x65, 0x25, 0xE9, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x40, 0x19, 0x5C, 0x5C, 0x17, 0x5A, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xE2, 0x81, 0x69, 0x0F, 0x53, 0x78, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x38, 0x11, 0xCF, 0x41, 0x85, 0xA4, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xDE, 0x6B, 0x61, 0x02, 0xC3, 0x49, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xDD, 0x4D, 0x0C, 0xDE, 0x28, 0x09, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x93, 0x0C, 0x6F, 0x93, 0x9C, 0x0B, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x0A, 0x68, 0x34, 0x50, 0x43, 0x97, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x38, 0x9E, 0xCB, 0x9E, 0x3D, 0x89, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x25, 0xD0, 0xD3, 0x64, 0x64, 0x26, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xCE, 0xDC, 0x7E, 0xD5, 0xE6, 0x99, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xFB, 0x74, 0xC1, 0xE1, 0x8B, 0x59, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x42, 0x44, 0x02, 0xBB, 0x03, 0xD1, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xC2, 0x95, 0x72, 0xE3, 0xE4, 0x28, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xC5, 0x9D, 0x79, 0xA9, 0x15, 0x29, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xD4, 0xC5, 0xCD, 0x62, 0x4B, 0xC9, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x51, 0xDA, 0x3B, 0x89, 0x4D, 0x1D, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xC2, 0xB2, 0x58, 0x36, 0xE4, 0x33, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x70, 0xD2, 0x10, 0xFA, 0x86, 0x43, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xF1, 0xC0, 0x5D, 0x07, 0x09, 0x75, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xB4, 0xAE, 0x90, 0x89, 0xAB, 0xE6, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x12, 0x0A, 0xD2, 0x80, 0x37, 0x75, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xF2, 0x32, 0x9A, 0x52, 0x5B, 0x36, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xBC, 0x85, 0x73, 0x8A, 0x73, 0x60, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xBA, 0xCE, 0x78, 0xB7, 0x62, 0x27, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x5B, 0x6D, 0x7C, 0xCF, 0x12, 0xBE, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x1A, 0xB2, 0x83, 0x61, 0x1A, 0x70, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x42, 0xDA, 0x72, 0x8B, 0xBA, 0x6A, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xB0, 0xDD, 0x3B, 0x1E, 0x43, 0xBF, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x08, 0xFC, 0x37, 0xAC, 0xFD, 0x7F, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xE5, 0x8B, 0xAC, 0x82, 0xB9, 0x98, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x92, 0x89, 0xB0, 0xF0, 0x9B, 0xF8, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x16, 0xDE, 0xBE, 0xCB, 0xA6, 0x81, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x5F, 0xC0, 0x50, 0xC3, 0xDB, 0xB6, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x18, 0x95, 0x17, 0xA7, 0x46, 0x8B, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xCF, 0xFB, 0x14, 0xEE, 0xDB, 0x71, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xAF, 0x10, 0xBF, 0xBB, 0x71, 0x71, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x02, 0xD8, 0x19, 0x08, 0xB2, 0xC1, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xEC, 0x91, 0xB0, 0xB3, 0xD0, 0xD6, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xC0, 0x1A, 0x38, 0xE5, 0x66, 0x1A, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x2A, 0xD5, 0x11, 0xDE, 0xAF, 0x0D, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xA7, 0xD9, 0xC7, 0x48, 0x8B, 0x76, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x61, 0x7A, 0x6B, 0xEF, 0xB1, 0x98, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x46, 0xDF, 0xFA, 0x36, 0x6D, 0x8C, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x95, 0x3A, 0x0D, 0x02, 0xE4, 0x38, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xA7, 0xD0, 0xC9, 0xC6, 0x33, 0x8E, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xC5, 0xD5, 0x66, 0x55, 0x77, 0x7A, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xE6, 0xE6, 0x86, 0xF6, 0x42, 0x30, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x41, 0x77, 0xAC, 0x45, 0x44, 0x16, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x2A, 0x76, 0x13, 0x08, 0x91, 0x3C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x05, 0x8B, 0x4F, 0xC4, 0xB5, 0xB3, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xA6, 0xC6, 0x74, 0x16, 0x3E, 0xB1, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xF3, 0x7E, 0xD6, 0x6E, 0x26, 0x34, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xAB, 0x0E, 0x0F, 0x63, 0x13, 0x2E, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xF4, 0xDA, 0xC8, 0x6A, 0x27, 0x4E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xF3, 0x5E, 0x51, 0x40, 0x45, 0xDA, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x61, 0x39, 0x25, 0x46, 0xFA, 0xA4, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xFA, 0x58, 0x34, 0x5A, 0xF5, 0x7F, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x74, 0xA7, 0x6D, 0x8D, 0x43, 0xDB, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x6D, 0x52, 0xE0, 0xA5, 0xB3, 0xA4, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x21, 0x50, 0xB9, 0xBA, 0x2C, 0xE9, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x3A, 0x6F, 0xFB, 0x69, 0xE4, 0x5B, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x72, 0x28, 0x96, 0x2B, 0x4A, 0x3B, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x26, 0x5D, 0x36, 0x1A, 0x08, 0xFB, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x57, 0x8F, 0x8C, 0x1F, 0x64, 0xF8, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xE3, 0xF5, 0x4C, 0x40, 0xC8, 0x2D, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xBB, 0x47, 0x85, 0x7D, 0x35, 0xA8, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x31, 0xCC, 0xB2, 0x9D, 0xA8, 0xE9, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xC0, 0xCC, 0x05, 0x90, 0x46, 0x78, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x8A, 0x02, 0x05, 0x8C, 0x00, 0xBD, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x40, 0xC6, 0xEE, 0x56, 0x23, 0x86, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x9A, 0x9E, 0xC3, 0x39, 0x18, 0x5A, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x0F, 0x3A, 0x7A, 0x5C, 0x1F, 0xBF, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x8A, 0xCD, 0x79, 0xAE, 0xE1, 0x02, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x0F, 0xFF, 0xF7, 0xD9, 0xE7, 0x96, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x45, 0xDF, 0xEB, 0x42, 0xF1, 0x5C, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x7D, 0x35, 0x8D, 0xE6, 0x57, 0xBF, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x6B, 0x71, 0x5B, 0x6A, 0x27, 0x6D, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xFD, 0x6F, 0x28, 0xE3, 0xF2, 0x90, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x5A, 0x65, 0x2F, 0x30, 0xB6, 0x63, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x1A, 0xC8, 0x28, 0xC3, 0x56, 0x54, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x36, 0xE2, 0xAD, 0x64, 0x5E, 0x06, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x77, 0x01, 0x04, 0xC3, 0x1A, 0x79, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x32, 0x38, 0xDE, 0xE7, 0x32, 0x79, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x21, 0xC1, 0x1A, 0x5E, 0x2C, 0x2B, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x6E, 0x87, 0x47, 0x64, 0x11, 0x41, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x29, 0xE6, 0xB4, 0x62, 0x18, 0x81, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xED, 0x92, 0xED, 0x20, 0x5A, 0xEF, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x3A, 0xF9, 0x10, 0xEA, 0x91, 0xC5, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x59, 0x55, 0x03, 0x82, 0xB6, 0x33, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x2D, 0x89, 0x91, 0xEE, 0xB1, 0x42, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xA7, 0x9A, 0x5C, 0x1B, 0xA0, 0xF8, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x1C, 0x32, 0x11, 0x4E, 0xCB, 0x75, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xDA, 0x34, 0xE6, 0xC8, 0xDE, 0x8C, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF4, 0x46, 0xF8, 0x59, 0xE1, 0x85, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x71, 0xD8, 0x9C, 0x34, 0xC7, 0x12, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xB3, 0xB7, 0xA5, 0x1F, 0x72, 0x38, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x62, 0xD9, 0x38, 0xA6, 0x22, 0x9F, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xC4, 0x7D, 0x0B, 0x93, 0x0C, 0xA4, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x4A, 0x79, 0x98, 0xA5, 0x36, 0xA6, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xB5, 0xD7, 0xA4, 0xA4, 0x20, 0x91, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xEF, 0xB1, 0xA6, 0x11, 0xE6, 0x8D, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x7E, 0x1D, 0x2B, 0x81, 0x63, 0xCC, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x2A, 0xF4, 0x8B, 0x5A, 0xF6, 0xBE, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x3B, 0x79, 0x1D, 0xAD, 0xBC, 0x86, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xDF, 0x19, 0x7E, 0xE5, 0x30, 0xB3, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xE3, 0x4B, 0x88, 0xA9, 0x24, 0xA4, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x97, 0xF0, 0xA3, 0x60, 0x00, 0x4E, 0x0A ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_9[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xF3, 0xC3, 0x7B, 0xEC, 0x50, 0x69, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xC3, 0x05, 0x68, 0x84, 0xAD, 0x38, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x1F, 0x3C, 0xE9, 0x5B, 0x7A, 0xC5, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x99, 0xDF, 0xC3, 0x83, 0x7E, 0xB9, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xC6, 0xB3, 0x86, 0xDF, 0xD0, 0x4A, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x66, 0xA2, 0xE5, 0xCB, 0x43, 0x7C, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x5D, 0x85, 0x38, 0x9F, 0x6C, 0x0D, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x82, 0x65, 0x09, 0x53, 0x22, 0xC8, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x97, 0x4F, 0xBE, 0xBE, 0x5A, 0xEF, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x8C, 0x97, 0x45, 0x69, 0xF9, 0x1E, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xD6, 0x8C, 0xB4, 0x95, 0x9A, 0x58, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x38, 0xDE, 0xAF, 0xE5, 0x6B, 0x0D, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xE2, 0x54, 0xFB, 0x0F, 0x06, 0xA8, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x26, 0x8C, 0x43, 0x05, 0xF8, 0x03, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x4A, 0x3D, 0x9E, 0xD8, 0x25, 0x9F, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xFA, 0xC0, 0x07, 0x56, 0x18, 0x0D, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xCE, 0xC8, 0x7C, 0x21, 0xCF, 0x6C, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xDB, 0x8E, 0x2F, 0xDE, 0x21, 0x03, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x07, 0x42, 0x44, 0x4C, 0x37, 0xD1, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x88, 0x7B, 0xF4, 0xEA, 0xD2, 0xC3, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x84, 0x67, 0xA1, 0xCB, 0x4A, 0xD2, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x80, 0x32, 0xB8, 0xB8, 0x2E, 0xB4, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xC4, 0x03, 0xD3, 0x1E, 0xA6, 0xF0, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x70, 0x22, 0x9E, 0x83, 0x0A, 0x49, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xBD, 0xD7, 0xC2, 0x04, 0x86, 0x93, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xBB, 0x9B, 0x18, 0xBC, 0x51, 0x12, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x26, 0x19, 0xDE, 0x26, 0x39, 0x17, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x14, 0xD0, 0x68, 0xA0, 0x86, 0x2E, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x70, 0x3C, 0x97, 0x3D, 0x7B, 0x12, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x4A, 0xA0, 0xA7, 0xC9, 0xC8, 0x4C, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x9D, 0xB9, 0xFD, 0xAA, 0xCD, 0x33, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xF6, 0xE9, 0x82, 0xC3, 0x17, 0xB3, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x85, 0x88, 0x04, 0x76, 0x07, 0xA2, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x85, 0x2B, 0xE5, 0xC6, 0xC9, 0x51, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x8A, 0x3B, 0xF3, 0x52, 0x2B, 0x52, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xA8, 0x8B, 0x9B, 0xC5, 0x96, 0x92, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xA3, 0xB4, 0x77, 0x12, 0x9B, 0x3A, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x85, 0x65, 0xB1, 0x6C, 0xC8, 0x67, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xE1, 0xA4, 0x21, 0xF4, 0x0D, 0x87, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xE2, 0x81, 0xBB, 0x0E, 0x12, 0xEA, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x68, 0x5D, 0x21, 0x13, 0x57, 0xCD, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x25, 0x14, 0xA4, 0x01, 0x6F, 0xEA, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xE5, 0x65, 0x34, 0xA5, 0xB6, 0x6C, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x79, 0x0B, 0xE7, 0x14, 0xE7, 0xC0, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x75, 0x9D, 0xF1, 0x6E, 0xC5, 0x4E, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xB6, 0xDA, 0xF8, 0x9E, 0x25, 0x7C, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x35, 0x64, 0x07, 0xC3, 0x34, 0xE0, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x84, 0xB4, 0xE5, 0x16, 0x75, 0xD5, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x60, 0xBB, 0x77, 0x3C, 0x86, 0x7E, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x10, 0xF8, 0x6F, 0x58, 0xFB, 0xFF, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xCA, 0x17, 0x59, 0x05, 0x73, 0x31, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x24, 0x13, 0x61, 0xE1, 0x37, 0xF1, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x2C, 0xBC, 0x7D, 0x97, 0x4D, 0x03, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xBE, 0x80, 0xA1, 0x86, 0xB7, 0x6D, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x31, 0x2A, 0x2F, 0x4E, 0x8D, 0x16, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x9E, 0xF7, 0x29, 0xDC, 0xB7, 0xE3, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x5F, 0x21, 0x7E, 0x77, 0xE3, 0xE2, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x04, 0xB0, 0x33, 0x10, 0x64, 0x83, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xD9, 0x23, 0x61, 0x67, 0xA1, 0xAD, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x80, 0x35, 0x70, 0xCA, 0xCD, 0x34, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x54, 0xAA, 0x23, 0xBC, 0x5F, 0x1B, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x4E, 0xB3, 0x8F, 0x91, 0x16, 0xED, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xC2, 0xF4, 0xD6, 0xDE, 0x63, 0x31, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x8C, 0xBE, 0xF5, 0x6D, 0xDA, 0x18, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x2B, 0x75, 0x1A, 0x04, 0xC8, 0x71, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x4F, 0xA1, 0x93, 0x8D, 0x67, 0x1C, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x8A, 0xAB, 0xCD, 0xAA, 0xEE, 0xF4, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xCD, 0xCD, 0x0D, 0xED, 0x85, 0x60, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x82, 0xEE, 0x58, 0x8B, 0x88, 0x2C, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x54, 0xEC, 0x26, 0x10, 0x22, 0x79, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x0B, 0x16, 0x9F, 0x88, 0x6B, 0x67, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4D, 0x8D, 0xE9, 0x2C, 0x7C, 0x62, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xE7, 0xFD, 0xAC, 0xDD, 0x4C, 0x68, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x56, 0x1D, 0x1E, 0xC6, 0x26, 0x5C, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xE8, 0xB5, 0x91, 0xD5, 0x4E, 0x9C, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xE7, 0xBD, 0xA2, 0x80, 0x8A, 0xB4, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xC2, 0x72, 0x4A, 0x8C, 0xF4, 0x49, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xF5, 0xB1, 0x68, 0xB4, 0xEA, 0xFF, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xE8, 0x4E, 0xDB, 0x1A, 0x87, 0xB6, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xDA, 0xA4, 0xC0, 0x4B, 0x67, 0x49, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x43, 0xA0, 0x72, 0x75, 0x59, 0xD2, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x74, 0xDE, 0xF6, 0xD3, 0xC8, 0xB7, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xE5, 0x50, 0x2C, 0x57, 0x94, 0x76, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x4D, 0xBA, 0x6C, 0x34, 0x10, 0xF6, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xAF, 0x1E, 0x19, 0x3F, 0xC8, 0xF0, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xC7, 0xEB, 0x99, 0x80, 0x90, 0x5B, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x76, 0x8F, 0x0A, 0xFB, 0x6A, 0x50, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x62, 0x98, 0x65, 0x3B, 0x51, 0xD3, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x80, 0x99, 0x0B, 0x20, 0x8D, 0xF0, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x15, 0x05, 0x0A, 0x18, 0x01, 0x7A, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x80, 0x8C, 0xDD, 0xAD, 0x46, 0x0C, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x35, 0x3D, 0x87, 0x73, 0x30, 0xB4, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x1E, 0x74, 0xF4, 0xB8, 0x3E, 0x7E, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x15, 0x9B, 0xF3, 0x5C, 0xC3, 0x05, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x1F, 0xFE, 0xEF, 0xB3, 0xCF, 0x2D, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x8A, 0xBE, 0xD7, 0x85, 0xE2, 0xB9, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xFB, 0x6A, 0x1A, 0xCD, 0xAF, 0x7E, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xD7, 0xE2, 0xB6, 0xD4, 0x4E, 0xDA, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xFA, 0xDF, 0x50, 0xC6, 0xE5, 0x21, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xB4, 0xCA, 0x5E, 0x60, 0x6C, 0xC7, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x34, 0x90, 0x51, 0x86, 0xAD, 0xA8, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x6D, 0xC4, 0x5B, 0xC9, 0xBC, 0x0C, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xEE, 0x02, 0x08, 0x86, 0x35, 0xF2, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x65, 0x70, 0xBC, 0xCF, 0x65, 0xF2, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x43, 0x82, 0x35, 0xBC, 0x58, 0x56, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xDC, 0x0E, 0x8F, 0xC8, 0x22, 0x82, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x52, 0xCC, 0x69, 0xC5, 0x30, 0x02, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xDB, 0x25, 0xDB, 0x41, 0xB4, 0xDE, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x74, 0xF2, 0x21, 0xD4, 0x23, 0x8B, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xB2, 0xAA, 0x06, 0x04, 0x6D, 0x67, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x5A, 0x12, 0x23, 0xDD, 0x63, 0x85, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x4F, 0x35, 0xB9, 0x36, 0x40, 0xF1, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x38, 0x64, 0x22, 0x9C, 0x96, 0xEB, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xB4, 0x69, 0xCC, 0x91, 0xBD, 0x19, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xE9, 0x8D, 0xF0, 0xB3, 0xC2, 0x0B, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xE2, 0xB0, 0x39, 0x69, 0x8E, 0x25, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x66, 0x6F, 0x4B, 0x3F, 0xE4, 0x70, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xC5, 0xB2, 0x71, 0x4C, 0x45, 0x3E, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x89, 0xFB, 0x16, 0x26, 0x19, 0x48, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x94, 0xF2, 0x30, 0x4B, 0x6D, 0x4C, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x6B, 0xAF, 0x49, 0x49, 0x41, 0x22, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xDE, 0x63, 0x4D, 0x23, 0xCC, 0x1B, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xFD, 0x3A, 0x56, 0x02, 0xC7, 0x98, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x54, 0xE8, 0x17, 0xB5, 0xEC, 0x7D, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x76, 0xF2, 0x3A, 0x5A, 0x79, 0x0D, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xBE, 0x33, 0xFC, 0xCA, 0x61, 0x66, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xC6, 0x97, 0x10, 0x53, 0x49, 0x48, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x2E, 0xE1, 0x47, 0xC1, 0x00, 0x9C, 0x14 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_10[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x91, 0xAB, 0x42, 0x69, 0x94, 0xA8, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xDE, 0x6D, 0xD2, 0xEF, 0x01, 0x4A, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xD9, 0x93, 0xF0, 0x26, 0x06, 0xD8, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xC7, 0x63, 0xE6, 0x67, 0x80, 0x18, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xF6, 0x30, 0x86, 0xD0, 0x93, 0xA2, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xCA, 0x49, 0x3C, 0x56, 0xE5, 0x80, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xF0, 0x90, 0xC1, 0x94, 0xF2, 0x15, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xC0, 0x6D, 0x8B, 0xC1, 0xC1, 0x20, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x16, 0x80, 0x80, 0xBF, 0x5D, 0xCC, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x87, 0xAD, 0xBA, 0x50, 0xD5, 0xF3, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xFF, 0x29, 0x8B, 0x3A, 0x0D, 0xF4, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x7E, 0x51, 0xA9, 0xC5, 0x8C, 0xAD, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x8C, 0xC5, 0x10, 0xCD, 0xCC, 0x9F, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xAB, 0xBF, 0x27, 0x3C, 0xFE, 0xD1, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x38, 0x6D, 0xF6, 0x78, 0x4F, 0x63, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x0F, 0x87, 0xB3, 0x05, 0xAC, 0x81, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xCE, 0x58, 0xC6, 0x88, 0xAC, 0x04, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x0A, 0x24, 0x58, 0xF0, 0xC1, 0x4C, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x46, 0x7B, 0xED, 0x8E, 0x58, 0xB9, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xD9, 0x18, 0xB8, 0x8F, 0xA9, 0x54, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x36, 0xA9, 0x82, 0x3C, 0x1E, 0x38, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x49, 0xD3, 0x03, 0xFE, 0x56, 0xD8, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x48, 0xA1, 0x69, 0xC0, 0xB7, 0x92, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x76, 0x12, 0xEA, 0xB5, 0x12, 0xB0, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xD2, 0xC7, 0x13, 0x68, 0x77, 0x11, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x76, 0x8B, 0xB5, 0xA1, 0x53, 0x5D, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xB3, 0x96, 0x8F, 0xFF, 0xE7, 0x3B, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xD0, 0x78, 0x18, 0xB4, 0x1C, 0x11, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x27, 0xAA, 0xA9, 0x85, 0x4F, 0xB3, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x46, 0xB6, 0x63, 0x1C, 0xDA, 0x5C, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x0D, 0x09, 0x95, 0x39, 0x67, 0x7D, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x57, 0x85, 0xD4, 0x95, 0x02, 0xA2, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x26, 0x68, 0xAE, 0xCA, 0x41, 0x6D, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x27, 0xB4, 0xCF, 0x85, 0x3D, 0x94, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xE8, 0xE2, 0xE3, 0x0B, 0xDF, 0x41, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x86, 0x61, 0x3D, 0x8D, 0x0B, 0x55, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x9C, 0xDE, 0xE8, 0xBB, 0x45, 0x74, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x14, 0x57, 0x98, 0x6B, 0x86, 0xE0, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x03, 0x50, 0xC9, 0xA2, 0xA1, 0x6D, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x74, 0xDE, 0x8F, 0xE2, 0x8D, 0xB3, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x3A, 0xBB, 0xA7, 0x7A, 0x4C, 0xFC, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xDC, 0x86, 0xB9, 0x7A, 0x0E, 0xFB, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x1A, 0x3C, 0x3C, 0x51, 0xA9, 0xC1, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xA9, 0x0B, 0x70, 0xF6, 0x77, 0x79, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x60, 0xA7, 0x0E, 0xF2, 0x9B, 0x68, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xBF, 0x9E, 0x5B, 0x25, 0x67, 0x85, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x4B, 0xCF, 0xCB, 0x81, 0x24, 0x30, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x2F, 0x61, 0xE8, 0xA8, 0x0E, 0xF2, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x18, 0x65, 0x99, 0xEC, 0x9D, 0x88, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x8B, 0xD3, 0x81, 0x6B, 0x62, 0xE9, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xFF, 0x13, 0xB9, 0x6C, 0x99, 0xB0, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x9A, 0x38, 0x5D, 0xE9, 0x07, 0x2D, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xB7, 0x73, 0xEF, 0x40, 0xE1, 0x2C, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x39, 0x3D, 0x02, 0xB0, 0xE6, 0x05, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x16, 0x09, 0xFF, 0xAD, 0xE4, 0x5D, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xF5, 0x7E, 0xC0, 0x33, 0x94, 0xA3, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x1D, 0x1B, 0xD0, 0xDE, 0xDA, 0x40, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x0F, 0x5E, 0x6F, 0x84, 0x5C, 0x75, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xB5, 0x32, 0x30, 0x25, 0x19, 0xCC, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xA4, 0x2D, 0xA7, 0xD4, 0x91, 0x10, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xE4, 0x0A, 0x38, 0x81, 0xA2, 0x7B, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x47, 0x83, 0x6C, 0x5B, 0x7C, 0x7C, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xD5, 0x4A, 0xA8, 0x26, 0x2A, 0x63, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xF8, 0x13, 0x3E, 0x2A, 0x64, 0xD3, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xEF, 0xC0, 0x93, 0x3F, 0x7A, 0x78, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x97, 0x60, 0x1B, 0xFE, 0x51, 0xB5, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x64, 0x21, 0x4E, 0xEA, 0x2F, 0xAA, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xBD, 0x05, 0xAF, 0xB2, 0x48, 0x9F, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xF3, 0xA8, 0x5E, 0x77, 0xE1, 0x56, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xA6, 0x15, 0x81, 0x6F, 0x8E, 0xFD, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xFB, 0x6A, 0x80, 0x8F, 0x5E, 0xCC, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x5E, 0xF0, 0xF5, 0x97, 0xB2, 0xF9, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xB5, 0xC3, 0x30, 0x54, 0x94, 0x97, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x11, 0xE7, 0x97, 0x4A, 0x32, 0xD7, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x41, 0x78, 0xD1, 0xE8, 0xCB, 0xE9, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xB6, 0xB2, 0x5D, 0xCC, 0x5E, 0x53, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x34, 0x02, 0x8A, 0x0B, 0x60, 0x3A, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x49, 0x02, 0x60, 0xDC, 0xCB, 0x92, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x29, 0xB1, 0xF7, 0xF6, 0x4E, 0x8B, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x8B, 0xC7, 0x6C, 0x65, 0xF8, 0x95, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x11, 0x26, 0x31, 0xD2, 0x83, 0x30, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x96, 0x18, 0x54, 0x0A, 0xA5, 0x1F, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x59, 0xAA, 0x23, 0x77, 0x9F, 0x52, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x2D, 0x42, 0x95, 0x7B, 0x3E, 0x9C, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x3D, 0xD4, 0xEF, 0x03, 0x6A, 0x79, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x57, 0x35, 0x90, 0x65, 0x72, 0xF9, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x86, 0x7B, 0x2C, 0xFA, 0x0A, 0xCC, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xF3, 0x92, 0x35, 0xFD, 0xF1, 0xA2, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xCC, 0x66, 0xC1, 0x70, 0x5A, 0x37, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xA8, 0x0F, 0xEE, 0x54, 0x2C, 0xB9, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x17, 0x3A, 0x2A, 0x5E, 0x1F, 0x6B, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x7B, 0x6E, 0xF7, 0x8C, 0x41, 0x01, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x2A, 0x54, 0x47, 0x05, 0xEE, 0x5C, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xB3, 0xFE, 0x24, 0x93, 0x36, 0x2A, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x8D, 0x58, 0x59, 0x8A, 0x8D, 0x01, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x61, 0x36, 0x09, 0xA5, 0xD7, 0x23, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xEA, 0x3E, 0xCB, 0xED, 0xAC, 0xA2, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x75, 0x2C, 0x67, 0x2E, 0x0E, 0x6F, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xBB, 0x9A, 0x5D, 0xEE, 0xC3, 0x9D, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x0E, 0x84, 0xF2, 0xDA, 0x69, 0x5B, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x1E, 0x4E, 0x3C, 0xDC, 0x23, 0x98, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x97, 0xC0, 0x86, 0xBA, 0x66, 0x6E, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xB9, 0xB0, 0xC5, 0x07, 0xE1, 0xF2, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x8D, 0x18, 0xF4, 0x3D, 0x0E, 0x21, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x1C, 0x15, 0x27, 0x45, 0x9C, 0x86, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x1E, 0x8D, 0x25, 0x0A, 0x1F, 0x87, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x6F, 0xD1, 0xC7, 0x56, 0x33, 0x9F, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xBB, 0x0F, 0x34, 0x2E, 0x9D, 0x1A, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x8A, 0x64, 0x80, 0x2F, 0xB6, 0xAA, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xA1, 0xAD, 0xED, 0x63, 0xFE, 0x27, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xBC, 0x67, 0x79, 0x10, 0x4C, 0x1D, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x72, 0x0D, 0xA3, 0x6C, 0xB6, 0x2D, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x70, 0x39, 0xF2, 0x20, 0x2F, 0x08, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x54, 0xD1, 0x82, 0xE8, 0x79, 0x35, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xD1, 0x5D, 0x70, 0xD8, 0x8B, 0x4D, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xBA, 0x1B, 0xBB, 0xF7, 0xDC, 0xC5, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x2F, 0x3D, 0xCD, 0x68, 0xFD, 0x5A, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x5E, 0xCA, 0xAF, 0x2E, 0xBE, 0xD0, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x73, 0x07, 0xD6, 0xC5, 0xE1, 0x28, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xBD, 0x0A, 0x70, 0x6E, 0x48, 0x19, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x0E, 0x6C, 0x18, 0x27, 0xA2, 0x8A, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x83, 0x7F, 0xA5, 0x15, 0xCA, 0x24, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x86, 0xC4, 0xF3, 0xE0, 0x7A, 0x2B, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x9D, 0x6E, 0xA2, 0x28, 0x6E, 0xBA, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x90, 0x06, 0x18, 0x82, 0xCF, 0xE9, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x4D, 0x95, 0xE1, 0x94, 0x71, 0xF0, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x60, 0x9D, 0xB7, 0xBB, 0x93, 0x8E, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x0D, 0xC2, 0x81, 0xC5, 0xEA, 0xCB, 0xC7 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_11[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x22, 0x57, 0x85, 0xD2, 0x28, 0x51, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x7A, 0x15, 0xDF, 0x27, 0x78, 0x07, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xB9, 0x97, 0x5D, 0xB9, 0xE1, 0x91, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x2D, 0xD3, 0x22, 0xC9, 0x1B, 0x0E, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xA9, 0xB9, 0x14, 0x57, 0x0A, 0x74, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x15, 0x2C, 0x48, 0xC7, 0xCC, 0x45, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x5A, 0x23, 0xC1, 0x30, 0xC6, 0xB7, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xD8, 0x69, 0xB9, 0x66, 0xC5, 0x46, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xA2, 0x1A, 0x05, 0xD3, 0xBF, 0xC5, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x67, 0xAA, 0x02, 0xA3, 0x4C, 0x62, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xAF, 0xC9, 0x5B, 0x94, 0x8D, 0xEB, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x59, 0x73, 0x13, 0x41, 0xFC, 0x62, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x37, 0x13, 0x7C, 0x24, 0x69, 0x41, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x96, 0xA5, 0xC6, 0xE3, 0xFA, 0xEB, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xDA, 0x3F, 0x3F, 0x24, 0x88, 0x7E, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xFD, 0x4C, 0x16, 0xF5, 0x74, 0x19, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x5F, 0x6F, 0x7E, 0xF3, 0xEF, 0x5E, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x2F, 0x21, 0x78, 0x74, 0x05, 0x78, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x4D, 0x86, 0xD1, 0xEC, 0x07, 0xCA, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xA4, 0xEB, 0x05, 0x98, 0xB9, 0x38, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xBC, 0xCB, 0x68, 0xEC, 0x75, 0x50, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x10, 0xA9, 0xC0, 0x3B, 0xA1, 0x9A, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x31, 0x7F, 0x9D, 0xC6, 0xAE, 0xDE, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x6A, 0xAF, 0x48, 0xA4, 0xDA, 0x0F, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x9E, 0xE0, 0x54, 0x96, 0x66, 0xEA, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x15, 0xFB, 0xAA, 0x26, 0x98, 0x8E, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x3F, 0x9A, 0xA2, 0x8A, 0xA0, 0x1C, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x18, 0x46, 0x8D, 0x25, 0x08, 0x6C, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x3E, 0x09, 0x5D, 0x4D, 0xDB, 0xD9, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xC0, 0x9A, 0xD9, 0xCE, 0xC8, 0x39, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x7E, 0xC1, 0x60, 0xA4, 0x8E, 0x48, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xFF, 0xB8, 0xCF, 0xF9, 0xAA, 0x01, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x85, 0xCF, 0x66, 0x48, 0x83, 0x2D, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xE3, 0x73, 0xCF, 0x6E, 0x48, 0x1A, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xF6, 0x8C, 0x4E, 0x0A, 0x67, 0x66, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xAA, 0x91, 0xA6, 0xF3, 0x81, 0x03, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x1A, 0xE2, 0x36, 0xE9, 0x40, 0x0B, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xA7, 0x42, 0x54, 0xDD, 0x9A, 0x85, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xDC, 0x78, 0xCC, 0x34, 0x2B, 0x3E, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xF5, 0xED, 0x54, 0xEF, 0xED, 0x97, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xE3, 0x1A, 0x86, 0xBF, 0x46, 0x59, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x85, 0xB9, 0xBA, 0xC7, 0x54, 0x98, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x8C, 0x15, 0x63, 0x71, 0x26, 0x5A, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xD2, 0x2F, 0x75, 0x78, 0xEC, 0xC7, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x6D, 0x21, 0xD7, 0xC8, 0x2E, 0x08, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x02, 0x97, 0x6F, 0xF2, 0xF2, 0x21, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x81, 0x3D, 0x75, 0x42, 0x0F, 0xB9, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x43, 0x9A, 0xA6, 0x2E, 0x5D, 0x39, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x38, 0xFF, 0xBA, 0xBA, 0xD6, 0x4A, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x5A, 0xF4, 0x6E, 0x8B, 0x76, 0x94, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x24, 0xB0, 0x71, 0xFF, 0xF9, 0xE2, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x11, 0x41, 0xA2, 0x46, 0x70, 0xA7, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xCB, 0x03, 0xE5, 0x81, 0x00, 0x9B, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x60, 0x75, 0xCF, 0xCD, 0xDC, 0xFC, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xEB, 0xAE, 0x22, 0x2D, 0x97, 0x66, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x81, 0x54, 0xD7, 0x6F, 0xB6, 0x22, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x86, 0x38, 0x53, 0xC2, 0x6D, 0x00, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x1B, 0x76, 0x90, 0xCA, 0x5C, 0xCB, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x7D, 0x95, 0x63, 0xF2, 0x2B, 0xEB, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x2C, 0xEB, 0x01, 0x76, 0x97, 0x92, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xCC, 0x54, 0xBE, 0x9D, 0x67, 0x7B, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x6A, 0x90, 0x3D, 0x84, 0xA4, 0x44, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x6C, 0xA0, 0x85, 0x0A, 0x10, 0x0C, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xC6, 0xD4, 0x43, 0x28, 0x4B, 0x3F, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x71, 0x7E, 0xE2, 0xC8, 0x8F, 0xF3, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x55, 0xB3, 0xD8, 0x7D, 0xA3, 0xE0, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x46, 0x01, 0xA8, 0x82, 0xB7, 0x9E, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xD7, 0x82, 0xDE, 0x0A, 0xDC, 0x74, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x68, 0x88, 0xEE, 0x20, 0x31, 0x2B, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x42, 0x9E, 0x08, 0x35, 0x4E, 0xAC, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xF6, 0x95, 0x8F, 0xE1, 0x03, 0x7B, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x31, 0x15, 0xB8, 0x8C, 0xCB, 0xC9, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x6B, 0xDA, 0xEF, 0xAE, 0xAF, 0x67, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xF2, 0x4C, 0x9E, 0x8A, 0x04, 0xA7, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x1A, 0x52, 0x75, 0xD0, 0x79, 0x69, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x3B, 0xB1, 0xCB, 0x11, 0xF5, 0x70, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x9B, 0xD2, 0x95, 0x71, 0x64, 0x7F, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x52, 0x01, 0x6B, 0x9B, 0xC8, 0xC1, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xE5, 0xC2, 0x18, 0xAB, 0x3E, 0x99, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xBF, 0x06, 0xF4, 0xE5, 0x06, 0xFB, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x2E, 0xFE, 0x4B, 0xE1, 0xB4, 0xF1, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x0D, 0x93, 0x41, 0xE9, 0x2C, 0x5B, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x15, 0x7F, 0x07, 0x00, 0x1E, 0x8A, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x7C, 0x30, 0x30, 0x8B, 0xAC, 0x7B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x32, 0xE4, 0x09, 0xC5, 0x39, 0x33, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC5, 0x5C, 0x85, 0x33, 0xC3, 0x2D, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xD2, 0xC0, 0x36, 0x2F, 0xEA, 0x2A, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xEF, 0x87, 0xCE, 0x4E, 0x61, 0x97, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x4C, 0xD8, 0x10, 0xC3, 0xD2, 0x7B, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x02, 0x48, 0xF9, 0x56, 0x14, 0x75, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xB5, 0x30, 0x98, 0x28, 0x32, 0xC3, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x64, 0xC9, 0x69, 0x10, 0x70, 0x04, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x7C, 0x21, 0xCD, 0x0F, 0x2B, 0x2D, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x6F, 0x05, 0xB8, 0xFF, 0x4F, 0x7B, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x52, 0xCA, 0xDB, 0x4A, 0xAB, 0x4E, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xC0, 0xD0, 0x18, 0x6B, 0xBA, 0x12, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xD1, 0x64, 0x31, 0xA0, 0xFE, 0x0F, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x1B, 0x39, 0x6D, 0x24, 0xDA, 0x72, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x86, 0x82, 0xF9, 0xB5, 0x3D, 0x48, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x9A, 0xF1, 0x67, 0x32, 0xE2, 0x27, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x1B, 0xDA, 0x49, 0xFC, 0x4A, 0x7A, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x81, 0x11, 0xC1, 0x59, 0x92, 0xDE, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xF0, 0x6E, 0x9C, 0xDC, 0xAF, 0x96, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x96, 0xAB, 0xFE, 0xDE, 0x1D, 0xCF, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x09, 0xF6, 0x25, 0xBD, 0x33, 0xD9, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x59, 0x22, 0x7D, 0x32, 0x41, 0x0B, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x70, 0x98, 0xA1, 0xE4, 0xBE, 0x36, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xBB, 0xAC, 0x04, 0x75, 0x4C, 0xDE, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xC6, 0x8F, 0x22, 0xBB, 0x29, 0x06, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x4E, 0x83, 0x7A, 0x10, 0x22, 0xE5, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x95, 0x06, 0x40, 0xD5, 0xEE, 0x31, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xE9, 0xF5, 0x92, 0x56, 0xBB, 0x50, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x68, 0x38, 0x9C, 0xF2, 0x93, 0x63, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xC1, 0xF4, 0xCE, 0x2F, 0x9B, 0x79, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xBA, 0xCB, 0xEC, 0xD5, 0x8D, 0xF4, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xE8, 0x50, 0x95, 0x7E, 0xAD, 0x3C, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x95, 0x22, 0x1B, 0x73, 0xE7, 0x5E, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xA2, 0xA7, 0x21, 0x08, 0x17, 0x3E, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x77, 0x08, 0x4D, 0x6C, 0xCE, 0x1D, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x16, 0x18, 0x0A, 0x07, 0x72, 0x53, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xBC, 0x13, 0x82, 0x4B, 0x92, 0x93, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x90, 0xF2, 0xE7, 0xC7, 0xB0, 0x19, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xCD, 0xED, 0xC2, 0xF3, 0x57, 0xC3, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x07, 0x79, 0x30, 0x10, 0xA6, 0x93, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xEA, 0xDF, 0x61, 0x80, 0xD9, 0x19, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x5E, 0xED, 0x9B, 0x09, 0x8D, 0x04, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x77, 0x7F, 0xCC, 0x1E, 0xD3, 0x24, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x1A, 0x84, 0x03, 0x8B, 0xD5, 0x97, 0x8F ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_12[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x3D, 0x1E, 0x91, 0x9E, 0x64, 0xFF, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x0E, 0xFC, 0x5F, 0xF8, 0x99, 0xCF, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x2A, 0x63, 0x95, 0x52, 0xFB, 0x7F, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x8D, 0xE4, 0x40, 0x1F, 0xDB, 0xBC, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xB0, 0xB7, 0xC9, 0xFC, 0xFC, 0x36, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xA7, 0xCC, 0x97, 0x01, 0xF6, 0x16, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xB1, 0xDE, 0xC7, 0x19, 0xD2, 0xDC, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xBA, 0x9B, 0xE7, 0x14, 0x86, 0x4C, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x7F, 0xC5, 0x75, 0x60, 0x9A, 0x7B, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x57, 0x33, 0xD6, 0x47, 0x46, 0x67, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x3E, 0x01, 0x4E, 0x9A, 0x96, 0x25, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x63, 0x66, 0x75, 0xE8, 0x0E, 0x1F, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x3A, 0x91, 0xA0, 0x17, 0x32, 0x60, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x49, 0xF3, 0x0E, 0x3A, 0xE0, 0x6F, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x22, 0x34, 0x1B, 0x93, 0x65, 0x63, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x5E, 0x0A, 0x45, 0x12, 0x69, 0x7E, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x52, 0x0F, 0xCE, 0x52, 0x80, 0x70, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x8D, 0xBE, 0x9F, 0x80, 0xF0, 0x62, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xFE, 0x51, 0x3F, 0x44, 0x8A, 0x4B, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xA5, 0x94, 0x6E, 0xB5, 0xB9, 0xE6, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x6E, 0xFF, 0xA3, 0xCA, 0x07, 0xF8, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xF8, 0xB4, 0xCB, 0x7D, 0xD2, 0x28, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x6B, 0x9D, 0xF4, 0x26, 0x43, 0x03, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x1A, 0x9A, 0x65, 0x82, 0xC9, 0x73, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x2D, 0x3A, 0x2E, 0xAA, 0xA2, 0x5B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x2D, 0x59, 0x00, 0xC3, 0xF5, 0x21, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x1A, 0xB0, 0x16, 0x70, 0x58, 0x8E, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x7A, 0xAA, 0x40, 0x70, 0x6A, 0xFC, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xA5, 0x5E, 0x31, 0x8A, 0xFF, 0x17, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xD0, 0xAE, 0xB5, 0x67, 0xFE, 0x38, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xE0, 0xDF, 0xD7, 0xFF, 0x3C, 0x96, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x81, 0xFA, 0xD0, 0x84, 0x65, 0xC0, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xE1, 0xF5, 0xC5, 0x23, 0x62, 0x42, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x64, 0x51, 0xAF, 0xF6, 0xFA, 0x28, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xC7, 0x3C, 0x8F, 0x1F, 0xA7, 0x42, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x65, 0xBA, 0xC3, 0x22, 0xC4, 0x6E, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x86, 0xA1, 0x27, 0x2F, 0xAD, 0x58, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x9D, 0x5F, 0xDA, 0x41, 0x54, 0xCC, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x25, 0x8A, 0xAA, 0xC3, 0xF0, 0x0B, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xAF, 0xDF, 0xEA, 0x1F, 0x7F, 0x26, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x61, 0xCC, 0xDC, 0x7E, 0xDF, 0xBB, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xE5, 0x6B, 0xCA, 0x14, 0x6C, 0xE4, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x3E, 0x38, 0x50, 0xFB, 0x9D, 0x89, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x1A, 0x56, 0x72, 0x04, 0x05, 0xBD, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x95, 0x2F, 0xF4, 0x18, 0xA8, 0x1C, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7E, 0x95, 0x55, 0xE1, 0x88, 0xA3, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xE4, 0x36, 0x74, 0x5E, 0x09, 0x50, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x4E, 0xE4, 0x12, 0x0D, 0x02, 0xD6, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x66, 0x8E, 0xFD, 0xEE, 0xDF, 0x11, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xB5, 0x41, 0xB6, 0x04, 0x41, 0x9B, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x2A, 0xF9, 0x21, 0x7F, 0x6F, 0x3C, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xE1, 0x95, 0x15, 0xBB, 0x33, 0x4D, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC7, 0x29, 0x58, 0x16, 0xB6, 0x34, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x83, 0x93, 0x7D, 0x53, 0x73, 0xED, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x47, 0x18, 0xD3, 0x6F, 0x77, 0x69, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xD7, 0xFD, 0x3B, 0x08, 0x45, 0xAC, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x58, 0xB3, 0x67, 0x56, 0x3E, 0x52, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xEE, 0xBF, 0x29, 0xD6, 0x45, 0x78, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x76, 0x10, 0x17, 0xBB, 0x0A, 0x97, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xB0, 0xE8, 0x52, 0xAE, 0x34, 0x86, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xC9, 0x74, 0x1C, 0xE0, 0x96, 0x8E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xB4, 0xF0, 0x01, 0x24, 0xBE, 0xD9, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x1D, 0xF5, 0x54, 0xD4, 0x21, 0xFE, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x26, 0x5A, 0x7E, 0x07, 0xE0, 0x66, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x32, 0x25, 0x99, 0x4B, 0x30, 0x62, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x87, 0x4B, 0x29, 0xF0, 0xBB, 0xCC, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x10, 0x1F, 0x3C, 0x2D, 0x31, 0x18, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x99, 0xD4, 0x88, 0x47, 0xFD, 0x54, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x53, 0x53, 0xA3, 0xF4, 0x7B, 0x2E, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x33, 0x73, 0x67, 0xF1, 0xE8, 0xB0, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x67, 0x7C, 0xBC, 0x85, 0xCC, 0xB1, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xBE, 0x2B, 0x3E, 0xDE, 0x31, 0xD0, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x90, 0xF7, 0xFD, 0xD1, 0x79, 0x6F, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x33, 0x82, 0x4A, 0xA7, 0x93, 0xD1, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x07, 0xD8, 0xD1, 0x8A, 0xFE, 0xA0, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x05, 0xE1, 0x5D, 0xE8, 0x28, 0x2B, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x30, 0x6E, 0x7A, 0xAC, 0x02, 0xD2, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x43, 0xA5, 0x35, 0x50, 0xE7, 0x14, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4C, 0xD8, 0x09, 0xE0, 0xA1, 0xBE, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x08, 0xCF, 0x18, 0x23, 0x15, 0x91, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA7, 0x02, 0x04, 0xA2, 0x7F, 0x53, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x05, 0xA4, 0x57, 0xCE, 0x15, 0xF8, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xF5, 0xD0, 0x56, 0x9F, 0x3A, 0xB2, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xC7, 0x4D, 0x62, 0x80, 0x39, 0xE4, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x64, 0x79, 0x15, 0xFF, 0x61, 0xDE, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x14, 0xC4, 0x89, 0xC3, 0x37, 0xF5, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x79, 0xFE, 0xC9, 0x4C, 0xD6, 0x95, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xC9, 0xE3, 0xBD, 0x30, 0xAD, 0xB4, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x24, 0x86, 0x54, 0x4D, 0x52, 0x34, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x0B, 0x63, 0x6C, 0x21, 0xF2, 0x2D, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xB9, 0xEA, 0x0F, 0xB3, 0x09, 0x12, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xFE, 0x98, 0x5A, 0xB4, 0x1E, 0xEA, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x4E, 0xC9, 0xE1, 0x23, 0xB4, 0xB5, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xF4, 0x34, 0x03, 0x28, 0x17, 0x69, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xA9, 0x19, 0x92, 0x5D, 0xC4, 0x4B, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x98, 0x05, 0x4D, 0xE3, 0xDF, 0xDA, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x79, 0x8F, 0x19, 0xBA, 0x48, 0x1F, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x4B, 0xF1, 0x87, 0x7E, 0xE0, 0xA8, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x1A, 0x58, 0x63, 0xE8, 0xDD, 0x76, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x6F, 0x47, 0xCB, 0x0F, 0x06, 0xC7, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x52, 0x06, 0x5E, 0x06, 0x2B, 0x15, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x34, 0xAE, 0x3A, 0x00, 0x93, 0x53, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xFD, 0x6B, 0x0F, 0x0C, 0xBA, 0x5F, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x1C, 0xA5, 0xAF, 0x91, 0x3B, 0x6B, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xFC, 0xC2, 0x09, 0xF0, 0x3F, 0x48, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x65, 0x52, 0x4B, 0xF8, 0x27, 0x9C, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x2B, 0x81, 0xBB, 0xC9, 0xE0, 0x8C, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x3C, 0x89, 0xBB, 0x6E, 0x63, 0x2C, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x44, 0x98, 0x56, 0x56, 0x56, 0xC5, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x95, 0x2C, 0x4F, 0x0B, 0xC1, 0x13, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x19, 0x24, 0x36, 0x99, 0xBF, 0x0B, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x98, 0xC9, 0xB5, 0x9F, 0x07, 0xDF, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x56, 0xE9, 0xB9, 0x8F, 0xE8, 0x59, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xB6, 0xA5, 0x08, 0x23, 0xDF, 0xF0, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x4B, 0xF5, 0xEE, 0xCC, 0x72, 0x9F, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x05, 0x00, 0x4A, 0x51, 0x51, 0x5A, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x8C, 0x88, 0x70, 0x12, 0x56, 0xAA, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xD3, 0x1A, 0x76, 0xAA, 0xAC, 0xB6, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xE8, 0x2C, 0xA4, 0x18, 0x21, 0x12, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x59, 0x2F, 0x00, 0xF5, 0xA2, 0xCB, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xDC, 0x1D, 0xE1, 0xEC, 0x22, 0x47, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xD4, 0x0C, 0xB2, 0xB6, 0xE7, 0x49, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xA6, 0x6A, 0xF1, 0x49, 0xB1, 0xDA, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x95, 0x7E, 0x3C, 0xD3, 0x36, 0x71, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xF1, 0x04, 0x6C, 0x7D, 0x38, 0xC5, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xA2, 0x2E, 0xC7, 0xF8, 0x42, 0x31, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x30, 0x43, 0xE0, 0xCE, 0x1F, 0xF9, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x75, 0x3E, 0xBF, 0xCE, 0x49, 0xAC, 0x05 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_13[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x7B, 0x3C, 0x22, 0x3D, 0xC9, 0xFE, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x1D, 0xF8, 0xBF, 0xF0, 0x33, 0x9F, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x54, 0xC6, 0x2A, 0xA5, 0xF6, 0xFF, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x1A, 0xC9, 0x81, 0x3E, 0xB6, 0x79, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x60, 0x6F, 0x93, 0xF9, 0xF9, 0x6D, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x4F, 0x99, 0x2F, 0x03, 0xEC, 0x2D, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x62, 0xBD, 0x8F, 0x33, 0xA4, 0xB9, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x74, 0x37, 0xCF, 0x29, 0x0C, 0x99, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFE, 0x8A, 0xEB, 0xC0, 0x34, 0xF7, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xAE, 0x66, 0xAC, 0x8F, 0x8C, 0xCE, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x7C, 0x02, 0x9C, 0x34, 0x2D, 0x4B, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xC7, 0xCC, 0xEA, 0xD0, 0x1D, 0x3E, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x74, 0x22, 0x41, 0x2F, 0x64, 0xC0, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x92, 0xE6, 0x1D, 0x74, 0xC0, 0xDF, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x44, 0x68, 0x36, 0x26, 0xCB, 0xC6, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xBD, 0x14, 0x8A, 0x24, 0xD2, 0xFC, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xA4, 0x1E, 0x9C, 0xA5, 0x00, 0xE1, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x1B, 0x7D, 0x3F, 0x01, 0xE1, 0xC5, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xFD, 0xA3, 0x7E, 0x88, 0x14, 0x97, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x4B, 0x29, 0xDD, 0x6A, 0x73, 0xCD, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xDD, 0xFE, 0x47, 0x95, 0x0F, 0xF0, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xF1, 0x69, 0x97, 0xFB, 0xA4, 0x51, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xD6, 0x3A, 0xE9, 0x4D, 0x86, 0x06, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x35, 0x34, 0xCB, 0x04, 0x93, 0xE7, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x5B, 0x74, 0x5C, 0x54, 0x45, 0xB7, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x5A, 0xB2, 0x00, 0x86, 0xEB, 0x43, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x35, 0x60, 0x2D, 0xE0, 0xB0, 0x1C, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xF4, 0x54, 0x81, 0xE0, 0xD4, 0xF8, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x4B, 0xBD, 0x62, 0x14, 0xFF, 0x2F, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xA1, 0x5D, 0x6B, 0xCF, 0xFC, 0x71, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xC1, 0xBF, 0xAF, 0xFF, 0x79, 0x2C, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x03, 0xF5, 0xA1, 0x09, 0xCB, 0x80, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xC3, 0xEB, 0x8B, 0x47, 0xC4, 0x84, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xC9, 0xA2, 0x5E, 0xED, 0xF5, 0x51, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x8E, 0x79, 0x1E, 0x3F, 0x4E, 0x85, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xCB, 0x74, 0x87, 0x45, 0x88, 0xDD, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x0C, 0x43, 0x4F, 0x5E, 0x5A, 0xB1, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x3A, 0xBF, 0xB4, 0x83, 0xA8, 0x98, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x4B, 0x14, 0x55, 0x87, 0xE1, 0x17, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x5F, 0xBF, 0xD5, 0x3F, 0xFE, 0x4C, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xC3, 0x98, 0xB9, 0xFD, 0xBE, 0x77, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xCB, 0xD7, 0x94, 0x29, 0xD8, 0xC8, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x7D, 0x70, 0xA0, 0xF6, 0x3B, 0x13, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x34, 0xAC, 0xE4, 0x08, 0x0A, 0x7A, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x2B, 0x5F, 0xE8, 0x31, 0x50, 0x39, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xFD, 0x2A, 0xAB, 0xC2, 0x11, 0x47, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xC8, 0x6D, 0xE8, 0xBC, 0x12, 0xA0, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x9D, 0xC8, 0x25, 0x1A, 0x04, 0xAC, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xCC, 0x1C, 0xFB, 0xDD, 0xBF, 0x23, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x6A, 0x83, 0x6C, 0x09, 0x82, 0x36, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x55, 0xF2, 0x43, 0xFE, 0xDE, 0x78, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xC3, 0x2B, 0x2B, 0x76, 0x67, 0x9A, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x8F, 0x53, 0xB0, 0x2C, 0x6C, 0x69, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x06, 0x27, 0xFB, 0xA6, 0xE6, 0xDA, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x8F, 0x30, 0xA6, 0xDF, 0xEE, 0xD2, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xAF, 0xFB, 0x77, 0x10, 0x8A, 0x58, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xB1, 0x66, 0xCF, 0xAC, 0x7C, 0xA4, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xDC, 0x7F, 0x53, 0xAC, 0x8B, 0xF0, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xEC, 0x20, 0x2E, 0x76, 0x15, 0x2E, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x60, 0xD1, 0xA5, 0x5C, 0x69, 0x0C, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x92, 0xE9, 0x38, 0xC0, 0x2D, 0x1D, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x68, 0xE1, 0x03, 0x48, 0x7C, 0xB3, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x3A, 0xEA, 0xA9, 0xA8, 0x43, 0xFC, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x4D, 0xB4, 0xFC, 0x0E, 0xC0, 0xCD, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x64, 0x4A, 0x32, 0x97, 0x60, 0xC4, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x0E, 0x97, 0x52, 0xE0, 0x77, 0x99, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x21, 0x3E, 0x78, 0x5A, 0x62, 0x30, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x32, 0xA9, 0x11, 0x8F, 0xFA, 0xA9, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xA6, 0xA6, 0x46, 0xE9, 0xF7, 0x5C, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x67, 0xE6, 0xCE, 0xE2, 0xD1, 0x61, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xCF, 0xF8, 0x78, 0x0B, 0x99, 0x63, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x7D, 0x57, 0x7C, 0xBC, 0x63, 0xA0, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x21, 0xEF, 0xFB, 0xA3, 0xF3, 0xDE, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x67, 0x04, 0x95, 0x4E, 0x27, 0xA3, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x0E, 0xB0, 0xA3, 0x15, 0xFD, 0x41, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x0B, 0xC2, 0xBB, 0xD0, 0x51, 0x56, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x60, 0xDC, 0xF4, 0x58, 0x05, 0xA4, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x86, 0x4A, 0x6B, 0xA0, 0xCE, 0x29, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x99, 0xB0, 0x13, 0xC0, 0x43, 0x7D, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x10, 0x9E, 0x31, 0x46, 0x2A, 0x22, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x4F, 0x05, 0x08, 0x44, 0xFF, 0xA6, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x0A, 0x48, 0xAF, 0x9C, 0x2B, 0xF0, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xEA, 0xA1, 0xAD, 0x3E, 0x75, 0x64, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8F, 0x9B, 0xC4, 0x00, 0x73, 0xC8, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xC8, 0xF2, 0x2A, 0xFE, 0xC3, 0xBC, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x29, 0x88, 0x13, 0x87, 0x6F, 0xEA, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xF2, 0xFC, 0x93, 0x99, 0xAC, 0x2B, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x93, 0xC7, 0x7B, 0x61, 0x5A, 0x69, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x49, 0x0C, 0xA9, 0x9A, 0xA4, 0x68, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x17, 0xC6, 0xD8, 0x42, 0xE4, 0x5B, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x73, 0xD5, 0x1F, 0x66, 0x13, 0x24, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xFD, 0x31, 0xB5, 0x68, 0x3D, 0xD4, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x9D, 0x92, 0xC3, 0x47, 0x68, 0x6B, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xE8, 0x69, 0x06, 0x50, 0x2E, 0xD2, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x53, 0x33, 0x24, 0xBB, 0x88, 0x97, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x31, 0x0B, 0x9A, 0xC6, 0xBF, 0xB5, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xF3, 0x1E, 0x33, 0x74, 0x91, 0x3E, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x96, 0xE2, 0x0F, 0xFD, 0xC0, 0x51, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x35, 0xB0, 0xC6, 0xD0, 0xBB, 0xED, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xDE, 0x8E, 0x96, 0x1F, 0x0C, 0x8E, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xA5, 0x0C, 0xBC, 0x0C, 0x56, 0x2A, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x68, 0x5C, 0x75, 0x00, 0x26, 0xA7, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xFB, 0xD7, 0x1E, 0x18, 0x74, 0xBF, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x39, 0x4A, 0x5F, 0x23, 0x77, 0xD6, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xF8, 0x85, 0x13, 0xE0, 0x7F, 0x90, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xCB, 0xA4, 0x96, 0xF0, 0x4F, 0x38, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x57, 0x02, 0x77, 0x93, 0xC1, 0x19, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x78, 0x12, 0x77, 0xDD, 0xC6, 0x58, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x89, 0x30, 0xAD, 0xAC, 0xAC, 0x8A, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x2B, 0x59, 0x9E, 0x16, 0x82, 0x27, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x32, 0x48, 0x6C, 0x32, 0x7F, 0x17, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x30, 0x93, 0x6B, 0x3F, 0x0F, 0xBE, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xAC, 0xD2, 0x73, 0x1F, 0xD1, 0xB3, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x6C, 0x4B, 0x11, 0x46, 0xBE, 0xE1, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x96, 0xEA, 0xDD, 0x99, 0xE5, 0x3E, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x0A, 0x00, 0x94, 0xA2, 0xA2, 0xB4, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x19, 0x11, 0xE1, 0x24, 0xAC, 0x54, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xA7, 0x35, 0xEC, 0x54, 0x59, 0x6D, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xD1, 0x59, 0x48, 0x31, 0x42, 0x24, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xB2, 0x5E, 0x00, 0xEA, 0x45, 0x97, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xB9, 0x3B, 0xC2, 0xD9, 0x45, 0x8E, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xA8, 0x19, 0x64, 0x6D, 0xCF, 0x93, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x4D, 0xD5, 0xE2, 0x93, 0x62, 0xB5, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2B, 0xFD, 0x78, 0xA6, 0x6D, 0xE2, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xE2, 0x09, 0xD8, 0xFA, 0x70, 0x8A, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x44, 0x5D, 0x8E, 0xF1, 0x85, 0x62, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x60, 0x86, 0xC0, 0x9D, 0x3F, 0xF2, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xEA, 0x7C, 0x7E, 0x9D, 0x93, 0x58, 0x0B ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_14[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xCB, 0xC8, 0xDE, 0xA5, 0xD0, 0xC3, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x8E, 0xE6, 0xAA, 0xFE, 0xBA, 0x61, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x2D, 0x4F, 0x64, 0x8E, 0xD4, 0xFE, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x3F, 0x3D, 0x4C, 0x32, 0xB1, 0xC6, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x41, 0x7E, 0x3A, 0xAB, 0xAB, 0x04, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x2A, 0xC6, 0x65, 0xB6, 0x7D, 0x91, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x00, 0x32, 0xE2, 0x6E, 0x3D, 0x22, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x22, 0x58, 0x5B, 0x6E, 0x8F, 0xC4, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x42, 0x75, 0x2F, 0x5F, 0x55, 0xE0, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x23, 0x0D, 0x59, 0x98, 0x39, 0x85, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x3C, 0x39, 0x9E, 0x0E, 0xAB, 0x8A, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x67, 0xE7, 0xCC, 0x53, 0xF4, 0xEA, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xF3, 0x50, 0xA8, 0x33, 0xD5, 0xEF, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x9F, 0xF9, 0xFA, 0x14, 0x54, 0x4D, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xBA, 0xC7, 0x7B, 0x23, 0x26, 0x96, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x0F, 0x32, 0xEF, 0xE7, 0x48, 0x93, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xB9, 0x21, 0xFC, 0x47, 0xCB, 0x79, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x39, 0xF9, 0x92, 0x13, 0x80, 0xB6, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xB1, 0xC0, 0x95, 0xCE, 0x7F, 0xD0, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x55, 0x81, 0x89, 0xC9, 0x68, 0x50, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x5B, 0x48, 0x53, 0x16, 0xF6, 0x6E, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xE6, 0xC5, 0x99, 0xD8, 0xCA, 0x69, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x28, 0xF4, 0x4A, 0xB4, 0xFE, 0x06, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x92, 0x22, 0x29, 0xC4, 0x88, 0x8F, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xA3, 0xE2, 0x97, 0xEA, 0xB0, 0xD5, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x91, 0x6F, 0x7E, 0xFE, 0xAD, 0xBE, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xC4, 0x48, 0x9A, 0xF2, 0xCE, 0x31, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x0C, 0xFB, 0x05, 0x46, 0x9F, 0x14, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x1C, 0x35, 0xE7, 0x89, 0xDE, 0x34, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x3A, 0xA7, 0x45, 0x85, 0x9F, 0x93, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x99, 0xBC, 0xA8, 0xFC, 0xB3, 0x25, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xFC, 0xBD, 0xE1, 0x12, 0x6B, 0x75, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x0B, 0xD0, 0xDF, 0x0C, 0x2D, 0xD6, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x02, 0xD7, 0x01, 0x00, 0x0D, 0x71, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x4E, 0xC5, 0x5C, 0x89, 0xD8, 0x0D, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x39, 0x2B, 0xA6, 0xC1, 0xB9, 0x4C, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x63, 0x28, 0x29, 0x68, 0x04, 0x64, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x15, 0xC2, 0x02, 0x09, 0x20, 0xF0, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xA1, 0xE5, 0x4C, 0xED, 0xFA, 0xC2, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x5F, 0x76, 0x99, 0x8E, 0x8D, 0x9B, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x3B, 0x89, 0xD5, 0x96, 0x11, 0x65, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x70, 0x85, 0xB3, 0x8E, 0xA2, 0xD5, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x4B, 0x01, 0xBA, 0xEB, 0x8B, 0x5C, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xF5, 0x7B, 0x9C, 0xC2, 0x31, 0x16, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xCD, 0xFD, 0xFD, 0xB2, 0x65, 0xBE, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x27, 0xEC, 0xBB, 0x50, 0xCB, 0x52, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xEE, 0x64, 0x5F, 0xD2, 0x4F, 0xC6, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x00, 0xB5, 0xCA, 0x2B, 0xA8, 0xC0, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x82, 0x27, 0x31, 0x0A, 0x1A, 0x4E, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x82, 0xD5, 0xA1, 0xB3, 0xE2, 0x8F, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xE9, 0x9D, 0xCC, 0xF1, 0x34, 0x49, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x02, 0xAD, 0x6E, 0x30, 0xB2, 0x9C, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x93, 0x4B, 0x73, 0x1B, 0x26, 0xE9, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xA0, 0xF0, 0x73, 0xBD, 0xF6, 0x06, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x42, 0xB3, 0x22, 0xE4, 0x01, 0xA5, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x13, 0x0A, 0x73, 0x0A, 0x0F, 0x15, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xF3, 0xA7, 0xDF, 0x0E, 0xCA, 0x2B, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x98, 0xFC, 0xD5, 0x04, 0xDE, 0x60, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x9B, 0xBB, 0xFC, 0x88, 0x52, 0xA6, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x4A, 0x44, 0x02, 0xA5, 0x7A, 0xBB, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xA8, 0xE5, 0xAE, 0x47, 0x41, 0xAA, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x6F, 0x28, 0x48, 0xF5, 0x81, 0x96, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x83, 0x39, 0x80, 0x47, 0x8B, 0x0A, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x67, 0x78, 0x24, 0x5B, 0x60, 0x6B, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x48, 0x66, 0x37, 0x12, 0x18, 0xFE, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x23, 0xB4, 0xDE, 0x89, 0xED, 0xFD, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x9B, 0xFF, 0xC7, 0xB2, 0xE8, 0xDF, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xE0, 0x78, 0xF8, 0x4B, 0xD3, 0x8B, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x0E, 0x1A, 0x63, 0x9F, 0x54, 0x9A, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x0A, 0x9B, 0xD7, 0xFB, 0x16, 0x4E, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x61, 0xF7, 0x20, 0x28, 0xC4, 0x3F, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x19, 0x8E, 0x76, 0x97, 0xE1, 0x6B, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x7B, 0xD3, 0xE0, 0xC0, 0x73, 0x95, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xC2, 0x3E, 0x03, 0x0A, 0xA3, 0xB2, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xF5, 0xE6, 0x23, 0xE6, 0xB5, 0x35, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x84, 0x4C, 0xF1, 0xC5, 0x47, 0x7C, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x7A, 0x02, 0xCA, 0xA0, 0xDB, 0x2D, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xE5, 0x3E, 0x12, 0xD0, 0x8D, 0x9E, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xD8, 0x70, 0x3B, 0x83, 0x68, 0x7F, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x59, 0x34, 0xEA, 0x73, 0x4A, 0xF8, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x08, 0x69, 0xBB, 0x65, 0xCB, 0x6C, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x05, 0x64, 0x12, 0xD3, 0xB8, 0x4D, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x95, 0x73, 0x12, 0x95, 0xE8, 0x27, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xC3, 0x5A, 0xA2, 0x32, 0x93, 0x0B, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x11, 0xCC, 0x4C, 0x4F, 0x7B, 0x8C, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xAC, 0x6B, 0x88, 0x14, 0x80, 0x1F, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x63, 0x93, 0x75, 0xD2, 0xC3, 0x2D, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x15, 0x7B, 0xFE, 0x08, 0x1B, 0xDA, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xCC, 0x5A, 0x25, 0xD2, 0xFE, 0x5F, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x14, 0xF3, 0x67, 0xB6, 0x2F, 0xAB, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x50, 0x50, 0x1E, 0xBF, 0x1B, 0x80, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x94, 0x61, 0x50, 0x23, 0x59, 0xA1, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x67, 0x9D, 0xF2, 0x1D, 0x31, 0xFD, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xED, 0x60, 0x8E, 0x80, 0x80, 0xFA, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x2C, 0xE8, 0x7C, 0x0E, 0x81, 0x31, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xDB, 0x50, 0xD0, 0x0B, 0x00, 0xFA, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x59, 0xE3, 0x81, 0x67, 0xCE, 0x82, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x0D, 0xD2, 0x79, 0x47, 0x8B, 0x20, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xD2, 0x89, 0xE0, 0xBF, 0x8B, 0x86, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x51, 0x2D, 0x51, 0x4E, 0x12, 0xB5, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x1B, 0x5D, 0xF6, 0x9C, 0xCB, 0x3C, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xE8, 0xAC, 0xDF, 0x9E, 0x05, 0x3F, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x41, 0xCD, 0x85, 0xCD, 0x49, 0xEA, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xAC, 0x68, 0x03, 0xB6, 0x82, 0xD7, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x22, 0x45, 0xE1, 0xEB, 0x34, 0x62, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x5A, 0x43, 0x89, 0x68, 0x08, 0x1E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x76, 0xF4, 0x16, 0x9A, 0x40, 0x1A, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x15, 0xEB, 0xE6, 0x9F, 0x83, 0x32, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xD1, 0x23, 0x10, 0x10, 0x4D, 0x72, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x61, 0x94, 0x26, 0x9B, 0x51, 0x90, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x01, 0x87, 0xF6, 0x05, 0x5A, 0xA9, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x54, 0x60, 0x7A, 0x32, 0x31, 0xCF, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xCD, 0x32, 0x37, 0x9F, 0x7F, 0xCE, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xE0, 0x33, 0x15, 0x9C, 0x2D, 0xF3, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x99, 0x28, 0x26, 0xC0, 0xBA, 0x50, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xEB, 0x8B, 0xEC, 0xCD, 0x0C, 0x93, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xF8, 0x07, 0xF3, 0xB9, 0x8F, 0xBD, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x57, 0x34, 0xDB, 0x82, 0x4A, 0x2D, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x37, 0xF9, 0x03, 0x61, 0x63, 0x36, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x22, 0xC1, 0x50, 0x08, 0xCC, 0x84, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x7D, 0xF7, 0x49, 0x13, 0xB9, 0xFD, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xD2, 0x1F, 0x10, 0xED, 0xC8, 0xE5, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x5B, 0xCE, 0x88, 0x24, 0xFD, 0xA0, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x1D, 0xC4, 0xF4, 0xB6, 0x19, 0xA0, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xE8, 0xC2, 0x28, 0xA6, 0x90, 0x08, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xD0, 0x09, 0x7D, 0x5E, 0x9D, 0xBC, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x8E, 0x30, 0x07, 0xA7, 0xDC, 0xBE, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xBA, 0x52, 0x34, 0xB3, 0xD2, 0x10, 0x32 ),
+};
+static const mbedtls_mpi_uint ffdhe8192_T_15[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x97, 0x91, 0xBD, 0x4B, 0xA1, 0x87, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x1C, 0xCD, 0x55, 0xFD, 0x75, 0xC3, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x5B, 0x9E, 0xC8, 0x1C, 0xA9, 0xFD, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x7F, 0x7A, 0x98, 0x64, 0x62, 0x8D, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x83, 0xFC, 0x74, 0x56, 0x57, 0x09, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x55, 0x8C, 0xCB, 0x6C, 0xFB, 0x22, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x00, 0x64, 0xC4, 0xDD, 0x7A, 0x44, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x44, 0xB0, 0xB6, 0xDC, 0x1E, 0x89, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x84, 0xEA, 0x5E, 0xBE, 0xAA, 0xC0, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x46, 0x1A, 0xB2, 0x30, 0x73, 0x0A, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x78, 0x72, 0x3C, 0x1D, 0x56, 0x15, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xCE, 0xCE, 0x99, 0xA7, 0xE8, 0xD5, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xE6, 0xA1, 0x50, 0x67, 0xAA, 0xDF, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x3E, 0xF3, 0xF5, 0x29, 0xA8, 0x9A, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x75, 0x8F, 0xF7, 0x46, 0x4C, 0x2C, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x1F, 0x64, 0xDE, 0xCF, 0x91, 0x26, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x73, 0x43, 0xF8, 0x8F, 0x96, 0xF3, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x73, 0xF2, 0x25, 0x27, 0x00, 0x6D, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x62, 0x81, 0x2B, 0x9D, 0xFF, 0xA0, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xAA, 0x02, 0x13, 0x93, 0xD1, 0xA0, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xB7, 0x90, 0xA6, 0x2C, 0xEC, 0xDD, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xCD, 0x8B, 0x33, 0xB1, 0x95, 0xD3, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x50, 0xE8, 0x95, 0x68, 0xFD, 0x0D, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x25, 0x45, 0x52, 0x88, 0x11, 0x1F, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x46, 0xC5, 0x2F, 0xD5, 0x61, 0xAB, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x22, 0xDF, 0xFC, 0xFC, 0x5B, 0x7D, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x88, 0x91, 0x34, 0xE5, 0x9D, 0x63, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x18, 0xF6, 0x0B, 0x8C, 0x3E, 0x29, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x38, 0x6A, 0xCE, 0x13, 0xBD, 0x69, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x75, 0x4E, 0x8B, 0x0A, 0x3F, 0x27, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x33, 0x79, 0x51, 0xF9, 0x67, 0x4B, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xF9, 0x7B, 0xC3, 0x25, 0xD6, 0xEA, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x16, 0xA0, 0xBF, 0x19, 0x5A, 0xAC, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x04, 0xAE, 0x03, 0x00, 0x1A, 0xE2, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x9D, 0x8A, 0xB9, 0x12, 0xB1, 0x1B, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x73, 0x56, 0x4C, 0x83, 0x73, 0x99, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xC6, 0x50, 0x52, 0xD0, 0x08, 0xC8, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x2A, 0x84, 0x05, 0x12, 0x40, 0xE0, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x42, 0xCB, 0x99, 0xDA, 0xF5, 0x85, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xBE, 0xEC, 0x32, 0x1D, 0x1B, 0x37, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x77, 0x12, 0xAB, 0x2D, 0x23, 0xCA, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE0, 0x0A, 0x67, 0x1D, 0x45, 0xAB, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x96, 0x02, 0x74, 0xD7, 0x17, 0xB9, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xEB, 0xF7, 0x38, 0x85, 0x63, 0x2C, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x9A, 0xFB, 0xFB, 0x65, 0xCB, 0x7C, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x4E, 0xD8, 0x77, 0xA1, 0x96, 0xA5, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xDD, 0xC9, 0xBE, 0xA4, 0x9F, 0x8C, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x01, 0x6A, 0x95, 0x57, 0x50, 0x81, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x05, 0x4F, 0x62, 0x14, 0x34, 0x9C, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x04, 0xAB, 0x43, 0x67, 0xC5, 0x1F, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xD2, 0x3B, 0x99, 0xE3, 0x69, 0x92, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x04, 0x5A, 0xDD, 0x60, 0x64, 0x39, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x27, 0x97, 0xE6, 0x36, 0x4C, 0xD2, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x41, 0xE1, 0xE7, 0x7A, 0xED, 0x0D, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x84, 0x66, 0x45, 0xC8, 0x03, 0x4A, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x27, 0x14, 0xE6, 0x14, 0x1E, 0x2A, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xE7, 0x4F, 0xBF, 0x1D, 0x94, 0x57, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x31, 0xF9, 0xAB, 0x09, 0xBC, 0xC1, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x36, 0x77, 0xF9, 0x11, 0xA5, 0x4C, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x94, 0x88, 0x04, 0x4A, 0xF5, 0x76, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x50, 0xCB, 0x5D, 0x8F, 0x82, 0x54, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xDE, 0x50, 0x90, 0xEA, 0x03, 0x2D, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x06, 0x73, 0x00, 0x8F, 0x16, 0x15, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xCF, 0xF0, 0x48, 0xB6, 0xC0, 0xD6, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x90, 0xCC, 0x6E, 0x24, 0x30, 0xFC, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x47, 0x68, 0xBD, 0x13, 0xDB, 0xFB, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x37, 0xFF, 0x8F, 0x65, 0xD1, 0xBF, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xC1, 0xF1, 0xF0, 0x97, 0xA6, 0x17, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x1D, 0x34, 0xC6, 0x3E, 0xA9, 0x34, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x14, 0x36, 0xAF, 0xF7, 0x2D, 0x9C, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC2, 0xEE, 0x41, 0x50, 0x88, 0x7F, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x33, 0x1C, 0xED, 0x2E, 0xC3, 0xD7, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xF6, 0xA6, 0xC1, 0x81, 0xE7, 0x2A, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x85, 0x7D, 0x06, 0x14, 0x46, 0x65, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xEA, 0xCD, 0x47, 0xCC, 0x6B, 0x6B, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x09, 0x99, 0xE2, 0x8B, 0x8F, 0xF8, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xF4, 0x04, 0x94, 0x41, 0xB7, 0x5B, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xCA, 0x7D, 0x24, 0xA0, 0x1B, 0x3D, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xB0, 0xE1, 0x76, 0x06, 0xD1, 0xFE, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xB2, 0x68, 0xD4, 0xE7, 0x94, 0xF0, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x11, 0xD2, 0x76, 0xCB, 0x96, 0xD9, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x0A, 0xC8, 0x24, 0xA6, 0x71, 0x9B, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x2B, 0xE7, 0x24, 0x2A, 0xD1, 0x4F, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x86, 0xB5, 0x44, 0x65, 0x26, 0x17, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x23, 0x98, 0x99, 0x9E, 0xF6, 0x18, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x59, 0xD7, 0x10, 0x29, 0x00, 0x3F, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xC7, 0x26, 0xEB, 0xA4, 0x87, 0x5B, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x2A, 0xF6, 0xFC, 0x11, 0x36, 0xB4, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x99, 0xB5, 0x4A, 0xA4, 0xFD, 0xBF, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x29, 0xE6, 0xCF, 0x6C, 0x5F, 0x56, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xA1, 0xA0, 0x3C, 0x7E, 0x37, 0x00, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x29, 0xC3, 0xA0, 0x46, 0xB2, 0x42, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xCE, 0x3A, 0xE5, 0x3B, 0x62, 0xFA, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xDA, 0xC1, 0x1C, 0x01, 0x01, 0xF5, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x59, 0xD0, 0xF9, 0x1C, 0x02, 0x63, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xB7, 0xA1, 0xA0, 0x17, 0x00, 0xF4, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xB2, 0xC6, 0x03, 0xCF, 0x9C, 0x05, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x1A, 0xA4, 0xF3, 0x8E, 0x16, 0x41, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xA4, 0x13, 0xC1, 0x7F, 0x17, 0x0D, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xA3, 0x5A, 0xA2, 0x9C, 0x24, 0x6A, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x36, 0xBA, 0xEC, 0x39, 0x97, 0x79, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xD1, 0x59, 0xBF, 0x3D, 0x0B, 0x7E, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x83, 0x9A, 0x0B, 0x9B, 0x93, 0xD4, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x58, 0xD1, 0x06, 0x6C, 0x05, 0xAF, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x45, 0x8A, 0xC2, 0xD7, 0x69, 0xC4, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xB4, 0x86, 0x12, 0xD1, 0x10, 0x3C, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xED, 0xE8, 0x2D, 0x34, 0x81, 0x34, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x2B, 0xD6, 0xCD, 0x3F, 0x07, 0x65, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xA3, 0x47, 0x20, 0x20, 0x9A, 0xE4, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xC2, 0x28, 0x4D, 0x36, 0xA3, 0x20, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x02, 0x0E, 0xED, 0x0B, 0xB4, 0x52, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xA8, 0xC0, 0xF4, 0x64, 0x62, 0x9E, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x9B, 0x65, 0x6E, 0x3E, 0xFF, 0x9C, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xC0, 0x67, 0x2A, 0x38, 0x5B, 0xE6, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x32, 0x51, 0x4C, 0x80, 0x75, 0xA1, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xD7, 0x17, 0xD9, 0x9B, 0x19, 0x26, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xF0, 0x0F, 0xE6, 0x73, 0x1F, 0x7B, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xAE, 0x68, 0xB6, 0x05, 0x95, 0x5A, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x6E, 0xF2, 0x07, 0xC2, 0xC6, 0x6C, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x45, 0x82, 0xA1, 0x10, 0x98, 0x09, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xFA, 0xEE, 0x93, 0x26, 0x72, 0xFB, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xA5, 0x3F, 0x20, 0xDA, 0x91, 0xCB, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xB6, 0x9C, 0x11, 0x49, 0xFA, 0x41, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x3B, 0x88, 0xE9, 0x6D, 0x33, 0x40, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xD1, 0x85, 0x51, 0x4C, 0x21, 0x11, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xA0, 0x13, 0xFA, 0xBC, 0x3A, 0x79, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x1C, 0x61, 0x0E, 0x4E, 0xB9, 0x7D, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x75, 0xA5, 0x68, 0x66, 0xA5, 0x21, 0x64 ),
+};
+static const mbedtls_mpi ffdhe8192_P = DHM_MPI_INIT_ARRAY( ffdhe8192_p );
+static const mbedtls_mpi ffdhe8192_T[15] = {
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_1 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_2 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_3 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_4 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_5 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_6 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_7 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_8 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_9 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_10 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_11 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_12 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_13 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_14 ),
+    DHM_MPI_INIT_ARRAY( ffdhe8192_T_15 ),
+};
+
+typedef struct
+{
+    const mbedtls_mpi *P;       /*!< prime modulus, with generator 2 */
+    const mbedtls_mpi *T;       /*!< comb table of the generator     */
+}
+dhm_comb_table;
+
+static const dhm_comb_table dhm_comb_tables[] =
+{
+    { &ffdhe2048_P, ffdhe2048_T },
+    { &ffdhe3072_P, ffdhe3072_T },
+    { &ffdhe4096_P, ffdhe4096_T },
+    { &ffdhe6144_P, ffdhe6144_T },
+    { &ffdhe8192_P, ffdhe8192_T },
+};
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM == 1 */
+
 /*
  * helper to validate the mbedtls_mpi size and import it
  */
@@ -203,6 +6381,44 @@ cleanup:
     return( ret );
 }
 
+/*
+ * GX = G^X mod P, using a precomputed comb table when P is one of the
+ * RFC 7919 groups and G is its generator 2.
+ */
+static int dhm_exp_mod_generator( mbedtls_dhm_context *ctx )
+{
+#if MBEDTLS_DHM_FIXED_BASE_OPTIM == 1
+    size_t i, d;
+
+    if( mbedtls_mpi_cmp_int( &ctx->G, 2 ) == 0 )
+    {
+        for( i = 0; i < sizeof( dhm_comb_tables ) /
+                        sizeof( dhm_comb_tables[0] ); i++ )
+        {
+            if( mbedtls_mpi_cmp_mpi( &ctx->P, dhm_comb_tables[i].P ) != 0 )
+                continue;
+
+            /* The comb always processes all d columns, which only pays
+             * off against the sliding window when the exponent has at
+             * least half the bits of P. Shorter exponents, as used with
+             * a small x_size, are faster with mbedtls_mpi_exp_mod(). */
+            d = ( mbedtls_mpi_bitlen( &ctx->P ) + DHM_COMB_WIDTH - 1 ) /
+                DHM_COMB_WIDTH;
+            if( mbedtls_mpi_bitlen( &ctx->X ) > DHM_COMB_WIDTH * d ||
+                mbedtls_mpi_bitlen( &ctx->X ) < DHM_COMB_WIDTH * d / 2 )
+                break;
+
+            return( mbedtls_mpi_exp_mod_comb( &ctx->GX, dhm_comb_tables[i].T,
+                                              DHM_COMB_WIDTH, d, &ctx->X,
+                                              &ctx->P, &ctx->RP ) );
+        }
+    }
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM == 1 */
+
+    return( mbedtls_mpi_exp_mod( &ctx->GX, &ctx->G, &ctx->X,
+                                 &ctx->P , &ctx->RP ) );
+}
+
 static int dhm_make_common( mbedtls_dhm_context *ctx, int x_size,
                             int (*f_rng)(void *, unsigned char *, size_t),
                             void *p_rng )
@@ -231,8 +6447,7 @@ static int dhm_make_common( mbedtls_dhm_context *ctx, int x_size,
     /*
      * Calculate GX = G^X mod P
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->GX, &ctx->G, &ctx->X,
-                          &ctx->P , &ctx->RP ) );
+    MBEDTLS_MPI_CHK( dhm_exp_mod_generator( ctx ) );
 
     if( ( ret = dhm_check_range( &ctx->GX, &ctx->P ) ) != 0 )
         return( ret );
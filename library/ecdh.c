@@ -259,6 +259,21 @@ void mbedtls_ecdh_enable_restart( mbedtls_ecdh_context *ctx )
 
     ctx->restart_enabled = 1;
 }
+
+/*
+ * Set the ops budget of restartable operations for context
+ */
+void mbedtls_ecdh_set_max_ops( mbedtls_ecdh_context *ctx, unsigned max_ops )
+{
+    ECDH_VALIDATE( ctx != NULL );
+
+#if defined(MBEDTLS_ECDH_LEGACY_CONTEXT)
+    mbedtls_ecp_restart_set_max_ops( &ctx->rs, max_ops );
+#else
+    if( ctx->var == MBEDTLS_ECDH_VARIANT_MBEDTLS_2_0 )
+        mbedtls_ecp_restart_set_max_ops( &ctx->ctx.mbed_ecdh.rs, max_ops );
+#endif
+}
 #endif
 
 /*
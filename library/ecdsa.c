@@ -180,8 +180,8 @@ static void ecdsa_restart_det_free( mbedtls_ecdsa_restart_det_ctx *ctx )
         rs_ctx->ecp.ops_done = 0;                                    \
                                                                      \
     /* set up our own sub-context if needed */                       \
-    if( mbedtls_ecp_restart_is_enabled() &&                          \
-        rs_ctx != NULL && rs_ctx->SUB == NULL )                      \
+    if( rs_ctx != NULL && rs_ctx->SUB == NULL &&                     \
+        mbedtls_ecp_restart_get_max_ops( &rs_ctx->ecp ) != 0 )       \
     {                                                                \
         rs_ctx->SUB = mbedtls_calloc( 1, sizeof( *rs_ctx->SUB ) );   \
         if( rs_ctx->SUB == NULL )                                    \
@@ -218,6 +218,7 @@ static void ecdsa_restart_det_free( mbedtls_ecdsa_restart_det_ctx *ctx )
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC) || \
+    defined(MBEDTLS_ECDSA_PRESIG_POOL)   || \
     !defined(MBEDTLS_ECDSA_SIGN_ALT)     || \
     !defined(MBEDTLS_ECDSA_VERIFY_ALT)
 /*
@@ -242,7 +243,7 @@ static int derive_mpi( const mbedtls_ecp_group *grp, mbedtls_mpi *x,
 cleanup:
     return( ret );
 }
-#endif /* ECDSA_DETERMINISTIC || !ECDSA_SIGN_ALT || !ECDSA_VERIFY_ALT */
+#endif /* ECDSA_DETERMINISTIC || ECDSA_PRESIG_POOL || !ECDSA_SIGN_ALT || !ECDSA_VERIFY_ALT */
 
 #if !defined(MBEDTLS_ECDSA_SIGN_ALT)
 /*
@@ -591,8 +592,19 @@ muladd:
     /*
      * Step 5: R = u1 G + u2 Q
      */
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && !defined(MBEDTLS_ECP_ALT)
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* The cached path is not restartable */
+    if( mbedtls_ecp_restart_get_max_ops( ECDSA_RS_ECP ) != 0 )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_restartable( grp,
+                         &R, pu1, &grp->G, pu2, Q, ECDSA_RS_ECP ) );
+    else
+#endif
+        MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_cached( grp, &R, pu1, pu2, Q ) );
+#else
     MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_restartable( grp,
                      &R, pu1, &grp->G, pu2, Q, ECDSA_RS_ECP ) );
+#endif
 
     if( mbedtls_ecp_is_zero( &R ) )
     {
@@ -744,6 +756,332 @@ int mbedtls_ecdsa_write_signature( mbedtls_ecdsa_context *ctx,
                 f_rng, p_rng, NULL ) );
 }
 
+#if defined(MBEDTLS_ECDSA_PRESIG_POOL)
+static void ecdsa_presig_init( mbedtls_ecdsa_presig *ps )
+{
+    mbedtls_mpi_init( &ps->r );
+    mbedtls_mpi_init( &ps->t );
+    mbedtls_mpi_init( &ps->u );
+}
+
+static void ecdsa_presig_free( mbedtls_ecdsa_presig *ps )
+{
+    mbedtls_mpi_free( &ps->r );
+    mbedtls_mpi_free( &ps->t );
+    mbedtls_mpi_free( &ps->u );
+}
+
+static void ecdsa_presig_swap( mbedtls_ecdsa_presig *a, mbedtls_ecdsa_presig *b )
+{
+    mbedtls_mpi_swap( &a->r, &b->r );
+    mbedtls_mpi_swap( &a->t, &b->t );
+    mbedtls_mpi_swap( &a->u, &b->u );
+}
+
+void mbedtls_ecdsa_presig_pool_init( mbedtls_ecdsa_presig_pool *pool )
+{
+    ECDSA_VALIDATE( pool != NULL );
+
+    memset( pool, 0, sizeof( mbedtls_ecdsa_presig_pool ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &pool->mutex );
+#endif
+}
+
+int mbedtls_ecdsa_presig_pool_setup( mbedtls_ecdsa_presig_pool *pool,
+                                     mbedtls_ecp_group_id gid,
+                                     size_t capacity,
+                                     int (*f_rng)(void *, unsigned char *, size_t),
+                                     void *p_rng )
+{
+    size_t i;
+    ECDSA_VALIDATE_RET( pool != NULL );
+
+    if( f_rng == NULL || capacity == 0 || pool->entries != NULL ||
+        ! mbedtls_ecdsa_can_do( gid ) ||
+        mbedtls_ecp_curve_info_from_grp_id( gid ) == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    pool->entries = mbedtls_calloc( capacity, sizeof( mbedtls_ecdsa_presig ) );
+    if( pool->entries == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < capacity; i++ )
+        ecdsa_presig_init( &pool->entries[i] );
+
+    pool->grp_id = gid;
+    pool->capacity = capacity;
+    pool->head = 0;
+    pool->count = 0;
+    pool->f_rng = f_rng;
+    pool->p_rng = p_rng;
+
+    return( 0 );
+}
+
+/*
+ * Steps 1-3 of SEC1 4.1.3 plus the inversion of step 6, i.e. everything
+ * that does not depend on the message or the key.
+ */
+static int ecdsa_presig_compute( mbedtls_ecp_group *grp,
+                                 mbedtls_ecdsa_presig *ps,
+                                 int (*f_rng)(void *, unsigned char *, size_t),
+                                 void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int key_tries = 0;
+    mbedtls_ecp_point R;
+    mbedtls_mpi k;
+
+    mbedtls_ecp_point_init( &R );
+    mbedtls_mpi_init( &k );
+
+    do
+    {
+        if( key_tries++ > 10 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, &k, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, &R, &k, &grp->G,
+                                          f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ps->r, &R.X, &grp->N ) );
+    }
+    while( mbedtls_mpi_cmp_int( &ps->r, 0 ) == 0 );
+
+    /* u = 1 / (kt), blinded as in ecdsa_sign_restartable() */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, &ps->t, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &k, &k, &ps->t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &k, &k, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &ps->u, &k, &grp->N ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &R );
+    mbedtls_mpi_free( &k );
+
+    return( ret );
+}
+
+int mbedtls_ecdsa_presig_pool_refill( mbedtls_ecdsa_presig_pool *pool,
+                                      size_t max )
+{
+    int ret = 0;
+    size_t done = 0;
+    int full;
+    mbedtls_ecp_group grp;
+    mbedtls_ecdsa_presig ps;
+    ECDSA_VALIDATE_RET( pool != NULL );
+
+    if( pool->entries == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    mbedtls_ecp_group_init( &grp );
+    ecdsa_presig_init( &ps );
+
+    /* Private group copy: its comb table is written lazily and refills
+     * may run concurrently with each other. */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_group_load( &grp, pool->grp_id ) );
+
+    while( max == 0 || done < max )
+    {
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_lock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        full = ( pool->count == pool->capacity );
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_unlock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        if( full )
+            break;
+
+        MBEDTLS_MPI_CHK( ecdsa_presig_compute( &grp, &ps, pool->f_rng,
+                                               pool->p_rng ) );
+        done++;
+
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_lock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        if( pool->count < pool->capacity )
+        {
+            ecdsa_presig_swap( &pool->entries[( pool->head + pool->count ) %
+                                              pool->capacity], &ps );
+            pool->count++;
+        }
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_unlock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+    }
+
+cleanup:
+    mbedtls_ecp_group_free( &grp );
+    ecdsa_presig_free( &ps );
+
+    return( ret );
+}
+
+void mbedtls_ecdsa_presig_pool_free( mbedtls_ecdsa_presig_pool *pool )
+{
+    size_t i;
+
+    if( pool == NULL )
+        return;
+
+    if( pool->entries != NULL )
+    {
+        for( i = 0; i < pool->capacity; i++ )
+            ecdsa_presig_free( &pool->entries[i] );
+        mbedtls_free( pool->entries );
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &pool->mutex );
+#endif
+
+    mbedtls_platform_zeroize( pool, sizeof( mbedtls_ecdsa_presig_pool ) );
+}
+
+/*
+ * Move the oldest presignature out of the pool into ps, wiping its slot.
+ * Return 1 if there is none.
+ */
+static int ecdsa_presig_take( mbedtls_ecdsa_presig_pool *pool,
+                              mbedtls_ecp_group_id gid,
+                              mbedtls_ecdsa_presig *ps )
+{
+    int ret = 1;
+    mbedtls_ecdsa_presig *slot;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &pool->mutex ) != 0 )
+        return( 1 );
+#endif
+
+    if( pool->grp_id == gid && pool->count > 0 )
+    {
+        slot = &pool->entries[pool->head];
+        ecdsa_presig_swap( slot, ps );
+        ecdsa_presig_free( slot );
+
+        pool->head = ( pool->head + 1 ) % pool->capacity;
+        pool->count--;
+        ret = 0;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &pool->mutex ) != 0 )
+        ret = 1;
+#endif
+
+    return( ret );
+}
+
+/*
+ * Signature from a presignature: s = u * t (e + r * d) mod n
+ */
+int mbedtls_ecdsa_sign_presig( mbedtls_ecp_group *grp, mbedtls_mpi *r,
+                               mbedtls_mpi *s, const mbedtls_mpi *d,
+                               const unsigned char *buf, size_t blen,
+                               mbedtls_ecdsa_presig_pool *pool,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_ecdsa_presig ps;
+    mbedtls_mpi e;
+    ECDSA_VALIDATE_RET( grp   != NULL );
+    ECDSA_VALIDATE_RET( r     != NULL );
+    ECDSA_VALIDATE_RET( s     != NULL );
+    ECDSA_VALIDATE_RET( d     != NULL );
+    ECDSA_VALIDATE_RET( pool  != NULL );
+    ECDSA_VALIDATE_RET( f_rng != NULL );
+    ECDSA_VALIDATE_RET( buf   != NULL || blen == 0 );
+
+    if( ! mbedtls_ecdsa_can_do( grp->id ) || grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_cmp_int( d, 1 ) < 0 || mbedtls_mpi_cmp_mpi( d, &grp->N ) >= 0 )
+        return( MBEDTLS_ERR_ECP_INVALID_KEY );
+
+    ecdsa_presig_init( &ps );
+    mbedtls_mpi_init( &e );
+
+    if( ecdsa_presig_take( pool, grp->id, &ps ) != 0 )
+    {
+        ret = mbedtls_ecdsa_sign( grp, r, s, d, buf, blen, f_rng, p_rng );
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( derive_mpi( grp, &e, buf, blen ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &ps.r, d ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &e, &e, s ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &e, &e, &ps.t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &e, &e, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &e, &ps.u ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
+
+    /* Negligible, but a zero s must not be output: use a fresh nonce. */
+    if( mbedtls_mpi_cmp_int( s, 0 ) == 0 )
+    {
+        ret = mbedtls_ecdsa_sign( grp, r, s, d, buf, blen, f_rng, p_rng );
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( r, &ps.r ) );
+
+cleanup:
+    ecdsa_presig_free( &ps );
+    mbedtls_mpi_free( &e );
+
+    return( ret );
+}
+
+/*
+ * Compute and write signature using a presignature
+ */
+int mbedtls_ecdsa_write_signature_presig( mbedtls_ecdsa_context *ctx,
+                           mbedtls_md_type_t md_alg,
+                           const unsigned char *hash, size_t hlen,
+                           unsigned char *sig, size_t sig_size, size_t *slen,
+                           mbedtls_ecdsa_presig_pool *pool,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi r, s;
+    ECDSA_VALIDATE_RET( ctx   != NULL );
+    ECDSA_VALIDATE_RET( hash  != NULL );
+    ECDSA_VALIDATE_RET( sig   != NULL );
+    ECDSA_VALIDATE_RET( slen  != NULL );
+    ECDSA_VALIDATE_RET( pool  != NULL );
+
+    (void) md_alg;
+
+    if( f_rng == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &r );
+    mbedtls_mpi_init( &s );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign_presig( &ctx->grp, &r, &s, &ctx->d,
+                                                hash, hlen, pool,
+                                                f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( ecdsa_signature_to_asn1( &r, &s, sig, sig_size, slen ) );
+
+cleanup:
+    mbedtls_mpi_free( &r );
+    mbedtls_mpi_free( &s );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECDSA_PRESIG_POOL */
+
 /*
  * Read and check signature
  */
@@ -78,6 +78,7 @@
 #include "mbedtls/error.h"
 
 #include "bn_mul.h"
+#include "constant_time_internal.h"
 #include "ecp_invasive.h"
 
 #include <string.h>
@@ -136,12 +137,95 @@ void mbedtls_ecp_set_max_ops( unsigned max_ops )
     ecp_max_ops = max_ops;
 }
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Per-thread default of ecp_max_ops. The value itself is stored in the
+ * thread-specific pointer, so that nothing needs to be allocated or freed.
+ */
+static pthread_once_t ecp_thread_max_ops_once = PTHREAD_ONCE_INIT;
+static pthread_key_t ecp_thread_max_ops_key;
+static int ecp_thread_max_ops_ready = 0;
+
+static void ecp_thread_max_ops_setup( void )
+{
+    ecp_thread_max_ops_ready =
+        ( pthread_key_create( &ecp_thread_max_ops_key, NULL ) == 0 );
+}
+
+/*
+ * Set the default budget of the calling thread
+ */
+int mbedtls_ecp_set_thread_max_ops( unsigned max_ops )
+{
+    if( pthread_once( &ecp_thread_max_ops_once,
+                      ecp_thread_max_ops_setup ) != 0 ||
+        ! ecp_thread_max_ops_ready )
+    {
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+    }
+
+    if( pthread_setspecific( ecp_thread_max_ops_key,
+                             (void *) (uintptr_t) max_ops ) != 0 )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    return( 0 );
+}
+
+/*
+ * Get the default budget of the calling thread, or the global one
+ */
+static unsigned ecp_default_max_ops( void )
+{
+    unsigned max_ops = 0;
+
+    if( pthread_once( &ecp_thread_max_ops_once,
+                      ecp_thread_max_ops_setup ) == 0 &&
+        ecp_thread_max_ops_ready )
+    {
+        max_ops = (unsigned) (uintptr_t)
+                  pthread_getspecific( ecp_thread_max_ops_key );
+    }
+
+    return( max_ops != 0 ? max_ops : ecp_max_ops );
+}
+#else
+#define ecp_default_max_ops( )  ( ecp_max_ops )
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 /*
  * Check if restart is enabled
  */
 int mbedtls_ecp_restart_is_enabled( void )
 {
-    return( ecp_max_ops != 0 );
+    return( ecp_default_max_ops( ) != 0 );
+}
+
+/*
+ * Set the budget of a single restart context
+ */
+void mbedtls_ecp_restart_set_max_ops( mbedtls_ecp_restart_ctx *ctx,
+                                      unsigned max_ops )
+{
+    ECP_VALIDATE( ctx != NULL );
+    ctx->max_ops = max_ops;
+}
+
+/*
+ * Get the effective budget of a restart context
+ *
+ * Without a restart context, an operation cannot yield whatever the
+ * budget is, so report 0: the callers then keep their faster,
+ * non-restartable code paths.
+ */
+unsigned mbedtls_ecp_restart_get_max_ops( const mbedtls_ecp_restart_ctx *rs_ctx )
+{
+    if( rs_ctx == NULL )
+        return( 0 );
+
+    if( rs_ctx->max_ops != 0 )
+        return( rs_ctx->max_ops );
+
+    return( ecp_default_max_ops( ) );
 }
 
 /*
@@ -245,6 +329,7 @@ void mbedtls_ecp_restart_init( mbedtls_ecp_restart_ctx *ctx )
     ECP_VALIDATE( ctx != NULL );
     ctx->ops_done = 0;
     ctx->depth = 0;
+    ctx->max_ops = 0;
     ctx->rsm = NULL;
     ctx->ma = NULL;
 }
@@ -254,6 +339,8 @@ void mbedtls_ecp_restart_init( mbedtls_ecp_restart_ctx *ctx )
  */
 void mbedtls_ecp_restart_free( mbedtls_ecp_restart_ctx *ctx )
 {
+    unsigned max_ops;
+
     if( ctx == NULL )
         return;
 
@@ -263,7 +350,10 @@ void mbedtls_ecp_restart_free( mbedtls_ecp_restart_ctx *ctx )
     ecp_restart_ma_free( ctx->ma );
     mbedtls_free( ctx->ma );
 
+    /* The budget is a setting, not part of the state of the operation */
+    max_ops = ctx->max_ops;
     mbedtls_ecp_restart_init( ctx );
+    ctx->max_ops = max_ops;
 }
 
 /*
@@ -273,9 +363,11 @@ int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
                               mbedtls_ecp_restart_ctx *rs_ctx,
                               unsigned ops )
 {
+    unsigned max_ops = mbedtls_ecp_restart_get_max_ops( rs_ctx );
+
     ECP_VALIDATE_RET( grp != NULL );
 
-    if( rs_ctx != NULL && ecp_max_ops != 0 )
+    if( rs_ctx != NULL && max_ops != 0 )
     {
         /* scale depending on curve size: the chosen reference is 256-bit,
          * and multiplication is quadratic. Round to the closest integer. */
@@ -286,11 +378,11 @@ int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
 
         /* Avoid infinite loops: always allow first step.
          * Because of that, however, it's not generally true
-         * that ops_done <= ecp_max_ops, so the check
-         * ops_done > ecp_max_ops below is mandatory. */
+         * that ops_done <= max_ops, so the check
+         * ops_done > max_ops below is mandatory. */
         if( ( rs_ctx->ops_done != 0 ) &&
-            ( rs_ctx->ops_done > ecp_max_ops ||
-              ops > ecp_max_ops - rs_ctx->ops_done ) )
+            ( rs_ctx->ops_done > max_ops ||
+              ops > max_ops - rs_ctx->ops_done ) )
         {
             return( MBEDTLS_ERR_ECP_IN_PROGRESS );
         }
@@ -309,8 +401,8 @@ int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
         rs_ctx->ops_done = 0;                                           \
                                                                         \
     /* set up our own sub-context if needed */                          \
-    if( mbedtls_ecp_restart_is_enabled() &&                             \
-        rs_ctx != NULL && rs_ctx->SUB == NULL )                         \
+    if( rs_ctx != NULL && rs_ctx->SUB == NULL &&                        \
+        mbedtls_ecp_restart_get_max_ops( rs_ctx ) != 0 )                \
     {                                                                   \
         rs_ctx->SUB = mbedtls_calloc( 1, sizeof( *rs_ctx->SUB ) );      \
         if( rs_ctx->SUB == NULL )                                       \
@@ -354,6 +446,13 @@ static void mpi_free_many( mbedtls_mpi *arr, size_t size )
         mbedtls_mpi_free( arr++ );
 }
 
+/*
+ * Constant MPIs initialized from static arrays of limbs
+ */
+#define ECP_MPI_INIT(s, n, p) {s, (n), (mbedtls_mpi_uint *)(p)}
+#define ECP_MPI_INIT_ARRAY(x)   \
+    ECP_MPI_INIT(1, sizeof(x) / sizeof(mbedtls_mpi_uint), x)
+
 /*
  * List of supported curves:
  *  - internal ID
@@ -2359,6 +2458,560 @@ cleanup:
     return( ret );
 }
 
+
+#if defined(MBEDTLS_ECP_COMPLETE_FORMULAS)
+/*
+ * Alternative core for short Weierstrass curves whose prime has no dedicated
+ * reduction function, such as the Brainpool curves.
+ *
+ * Field elements are fixed-width arrays of limbs in Montgomery
+ * representation, so the arithmetic never allocates, and a multiplication
+ * costs a single Montgomery reduction rather than a full division by P.
+ * Additions and subtractions are reduced with a conditional subtraction
+ * done in constant time.
+ *
+ * Points are in homogeneous projective coordinates (X:Y:Z), and are added
+ * and doubled with the complete formulas of Renes, Costello and Batina,
+ * "Complete addition formulas for prime order elliptic curves" (EUROCRYPT
+ * 2016), Algorithms 1 and 3. These have no exceptional case, so the
+ * scalar multiplication below needs no branch on the value of the points.
+ * They are only valid on curves of odd order, hence the check of the
+ * cofactor in ecp_use_complete_formulas().
+ */
+/* Used by the MULADDC macros from bn_mul.h */
+#define ciL    (sizeof(mbedtls_mpi_uint))         /* chars in limb  */
+#define biL    (ciL << 3)               /* bits  in limb  */
+#define biH    (ciL << 2)               /* half limb size */
+
+#define ECP_FE_LIMBS        ( ( MBEDTLS_ECP_MAX_BITS + biL - 1 ) / biL )
+
+/* Window size of the fixed-window scalar multiplication */
+#define ECP_FE_W            4
+
+typedef struct
+{
+    size_t n;                               /* number of limbs of P     */
+    mbedtls_mpi_uint mm;                    /* -P^-1 mod 2^biL          */
+    mbedtls_mpi_uint P[ECP_FE_LIMBS];
+    mbedtls_mpi_uint RR[ECP_FE_LIMBS];      /* R^2 mod P                */
+    mbedtls_mpi_uint one[ECP_FE_LIMBS];     /* 1 in Montgomery form     */
+    mbedtls_mpi_uint a[ECP_FE_LIMBS];       /* A in Montgomery form     */
+    mbedtls_mpi_uint b3[ECP_FE_LIMBS];      /* 3 * B in Montgomery form */
+} ecp_fe_ctx;
+
+typedef struct
+{
+    mbedtls_mpi_uint X[ECP_FE_LIMBS];
+    mbedtls_mpi_uint Y[ECP_FE_LIMBS];
+    mbedtls_mpi_uint Z[ECP_FE_LIMBS];
+} ecp_fe_point;
+
+/*
+ * Can the group use this core?
+ */
+static int ecp_use_complete_formulas( const mbedtls_ecp_group *grp )
+{
+    return( grp->modp == NULL && grp->h == 1 &&
+            grp->pbits <= MBEDTLS_ECP_MAX_BITS &&
+            mbedtls_mpi_get_bit( &grp->P, 0 ) == 1 );
+}
+
+/*
+ * d[0..n-1] += s[0..n-1] * b, returning the carry out of d[n-1]
+ */
+static mbedtls_mpi_uint ecp_fe_mla( size_t n, mbedtls_mpi_uint *d,
+                                    const mbedtls_mpi_uint *s,
+                                    mbedtls_mpi_uint b )
+{
+    mbedtls_mpi_uint c = 0, t = 0;
+    size_t i = n;
+
+#if defined(MULADDC_HUIT)
+    for( ; i >= 8; i -= 8 )
+    {
+        MULADDC_INIT
+        MULADDC_HUIT
+        MULADDC_STOP
+    }
+#endif
+
+    for( ; i > 0; i-- )
+    {
+        MULADDC_INIT
+        MULADDC_CORE
+        MULADDC_STOP
+    }
+
+    (void) t;
+    return( c );
+}
+
+/*
+ * X = A + B and X = A - B on n limbs, returning the carry or borrow
+ */
+static mbedtls_mpi_uint ecp_fe_add_n( size_t n, mbedtls_mpi_uint *X,
+                                      const mbedtls_mpi_uint *A,
+                                      const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint a, b, t, c = 0;
+    size_t i;
+
+    for( i = 0; i < n; i++ )
+    {
+        a = A[i]; b = B[i];
+        t = a + c; c = ( t < c );
+        t += b; c += ( t < b );
+        X[i] = t;
+    }
+
+    return( c );
+}
+
+static mbedtls_mpi_uint ecp_fe_sub_n( size_t n, mbedtls_mpi_uint *X,
+                                      const mbedtls_mpi_uint *A,
+                                      const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint a, b, t, c = 0;
+    size_t i;
+
+    for( i = 0; i < n; i++ )
+    {
+        a = A[i]; b = B[i];
+        t = a - c; c = ( a < c );
+        c |= ( t < b ); t -= b;
+        X[i] = t;
+    }
+
+    return( c );
+}
+
+/*
+ * X = A + B mod P, A and B in [0, P)
+ */
+static void ecp_fe_add( const ecp_fe_ctx *ctx, mbedtls_mpi_uint *X,
+                        const mbedtls_mpi_uint *A, const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint T[ECP_FE_LIMBS];
+    mbedtls_mpi_uint c, b;
+
+    c = ecp_fe_add_n( ctx->n, X, A, B );
+    b = ecp_fe_sub_n( ctx->n, T, X, ctx->P );
+
+    /* The sum is at least P iff it overflowed or the subtraction didn't */
+    mbedtls_ct_mpi_uint_cond_assign( ctx->n, X, T,
+                                     (unsigned char) ( c | ( b ^ 1 ) ) );
+}
+
+/*
+ * X = A - B mod P, A and B in [0, P)
+ */
+static void ecp_fe_sub( const ecp_fe_ctx *ctx, mbedtls_mpi_uint *X,
+                        const mbedtls_mpi_uint *A, const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint T[ECP_FE_LIMBS];
+    mbedtls_mpi_uint b;
+
+    b = ecp_fe_sub_n( ctx->n, X, A, B );
+    (void) ecp_fe_add_n( ctx->n, T, X, ctx->P );
+
+    mbedtls_ct_mpi_uint_cond_assign( ctx->n, X, T, (unsigned char) b );
+}
+
+/*
+ * X = A * B * R^-1 mod P, A and B in [0, P) (HAC 14.36, interleaved)
+ */
+static void ecp_fe_mul( const ecp_fe_ctx *ctx, mbedtls_mpi_uint *X,
+                        const mbedtls_mpi_uint *A, const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint T[ECP_FE_LIMBS + 2];
+    mbedtls_mpi_uint c, u, b;
+    size_t i, j, n = ctx->n;
+
+    memset( T, 0, sizeof( T ) );
+
+    for( i = 0; i < n; i++ )
+    {
+        c = ecp_fe_mla( n, T, A, B[i] );
+        T[n] += c; T[n + 1] = ( T[n] < c );
+
+        u = T[0] * ctx->mm;
+        c = ecp_fe_mla( n, T, ctx->P, u );
+        T[n] += c; T[n + 1] += ( T[n] < c );
+
+        /* T[0] is now zero: divide by 2^biL */
+        for( j = 0; j <= n; j++ )
+            T[j] = T[j + 1];
+        T[n + 1] = 0;
+    }
+
+    /* T < 2P: subtract P if T >= P, without branching on the result */
+    b = ecp_fe_sub_n( n, X, T, ctx->P );
+    mbedtls_ct_mpi_uint_cond_assign( n, X, T,
+                                     (unsigned char) ( ( T[n] ^ 1 ) & b ) );
+}
+
+/*
+ * Is A zero? Only used on public values.
+ */
+static int ecp_fe_is_zero( const ecp_fe_ctx *ctx, const mbedtls_mpi_uint *A )
+{
+    mbedtls_mpi_uint acc = 0;
+    size_t i;
+
+    for( i = 0; i < ctx->n; i++ )
+        acc |= A[i];
+
+    return( acc == 0 );
+}
+
+/*
+ * X = A * R mod P, with 0 <= A < P
+ */
+static void ecp_fe_from_mpi( const ecp_fe_ctx *ctx, mbedtls_mpi_uint *X,
+                             const mbedtls_mpi *A )
+{
+    mbedtls_mpi_uint T[ECP_FE_LIMBS];
+    size_t n = ( A->n < ctx->n ) ? A->n : ctx->n;
+
+    memset( T, 0, sizeof( T ) );
+    memcpy( T, A->p, n * sizeof( mbedtls_mpi_uint ) );
+
+    ecp_fe_mul( ctx, X, T, ctx->RR );
+}
+
+/*
+ * X = A * R^-1 mod P
+ */
+static int ecp_fe_to_mpi( const ecp_fe_ctx *ctx, mbedtls_mpi *X,
+                          const mbedtls_mpi_uint *A )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi_uint one[ECP_FE_LIMBS];
+    mbedtls_mpi_uint T[ECP_FE_LIMBS];
+
+    memset( one, 0, sizeof( one ) );
+    one[0] = 1;
+    ecp_fe_mul( ctx, T, A, one );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, ctx->n ) );
+    memcpy( X->p, T, ctx->n * sizeof( mbedtls_mpi_uint ) );
+
+cleanup:
+    mbedtls_platform_zeroize( T, sizeof( T ) );
+    return( ret );
+}
+
+/*
+ * X = A^-1 mod P = A^(P-2) mod P, A non-zero (Fermat, fixed window)
+ */
+static void ecp_fe_inv( const ecp_fe_ctx *ctx, mbedtls_mpi_uint *X,
+                        const mbedtls_mpi_uint *A )
+{
+    mbedtls_mpi_uint W[1 << ECP_FE_W][ECP_FE_LIMBS];
+    mbedtls_mpi_uint E[ECP_FE_LIMBS];
+    mbedtls_mpi_uint two[ECP_FE_LIMBS];
+    size_t i, j, nbits = ctx->n * biL;
+    unsigned k;
+
+    memset( two, 0, sizeof( two ) );
+    two[0] = 2;
+    (void) ecp_fe_sub_n( ctx->n, E, ctx->P, two );
+
+    memcpy( W[0], ctx->one, sizeof( W[0] ) );
+    for( k = 1; k < ( 1U << ECP_FE_W ); k++ )
+        ecp_fe_mul( ctx, W[k], W[k - 1], A );
+
+    /* The exponent is public: no need to hide the window values */
+    memcpy( X, ctx->one, sizeof( W[0] ) );
+    for( i = nbits; i > 0; i -= ECP_FE_W )
+    {
+        for( j = 0; j < ECP_FE_W; j++ )
+            ecp_fe_mul( ctx, X, X, X );
+
+        k = 0;
+        for( j = 1; j <= ECP_FE_W; j++ )
+        {
+            k = ( k << 1 ) | ( ( E[( i - j ) / biL] >>
+                                 ( ( i - j ) % biL ) ) & 1 );
+        }
+
+        ecp_fe_mul( ctx, X, X, W[k] );
+    }
+
+    mbedtls_platform_zeroize( W, sizeof( W ) );
+}
+
+/*
+ * R = P + Q, complete formula for any curve of odd order
+ * (RCB, Algorithm 1). Cost: 12M + 3m_a + 2m_3b + 23A
+ */
+static void ecp_fe_point_add( const ecp_fe_ctx *ctx, ecp_fe_point *R,
+                              const ecp_fe_point *P, const ecp_fe_point *Q )
+{
+    mbedtls_mpi_uint t0[ECP_FE_LIMBS], t1[ECP_FE_LIMBS], t2[ECP_FE_LIMBS];
+    mbedtls_mpi_uint t3[ECP_FE_LIMBS], t4[ECP_FE_LIMBS], t5[ECP_FE_LIMBS];
+    mbedtls_mpi_uint X3[ECP_FE_LIMBS], Y3[ECP_FE_LIMBS], Z3[ECP_FE_LIMBS];
+
+    ecp_fe_mul( ctx, t0, P->X, Q->X );
+    ecp_fe_mul( ctx, t1, P->Y, Q->Y );
+    ecp_fe_mul( ctx, t2, P->Z, Q->Z );
+    ecp_fe_add( ctx, t3, P->X, P->Y );
+    ecp_fe_add( ctx, t4, Q->X, Q->Y );
+    ecp_fe_mul( ctx, t3, t3, t4 );
+    ecp_fe_add( ctx, t4, t0, t1 );
+    ecp_fe_sub( ctx, t3, t3, t4 );
+    ecp_fe_add( ctx, t4, P->X, P->Z );
+    ecp_fe_add( ctx, t5, Q->X, Q->Z );
+    ecp_fe_mul( ctx, t4, t4, t5 );
+    ecp_fe_add( ctx, t5, t0, t2 );
+    ecp_fe_sub( ctx, t4, t4, t5 );
+    ecp_fe_add( ctx, t5, P->Y, P->Z );
+    ecp_fe_add( ctx, X3, Q->Y, Q->Z );
+    ecp_fe_mul( ctx, t5, t5, X3 );
+    ecp_fe_add( ctx, X3, t1, t2 );
+    ecp_fe_sub( ctx, t5, t5, X3 );
+    ecp_fe_mul( ctx, Z3, ctx->a, t4 );
+    ecp_fe_mul( ctx, X3, ctx->b3, t2 );
+    ecp_fe_add( ctx, Z3, X3, Z3 );
+    ecp_fe_sub( ctx, X3, t1, Z3 );
+    ecp_fe_add( ctx, Z3, t1, Z3 );
+    ecp_fe_mul( ctx, Y3, X3, Z3 );
+    ecp_fe_add( ctx, t1, t0, t0 );
+    ecp_fe_add( ctx, t1, t1, t0 );
+    ecp_fe_mul( ctx, t2, ctx->a, t2 );
+    ecp_fe_mul( ctx, t4, ctx->b3, t4 );
+    ecp_fe_add( ctx, t1, t1, t2 );
+    ecp_fe_sub( ctx, t2, t0, t2 );
+    ecp_fe_mul( ctx, t2, ctx->a, t2 );
+    ecp_fe_add( ctx, t4, t4, t2 );
+    ecp_fe_mul( ctx, t0, t1, t4 );
+    ecp_fe_add( ctx, Y3, Y3, t0 );
+    ecp_fe_mul( ctx, t0, t5, t4 );
+    ecp_fe_mul( ctx, X3, X3, t3 );
+    ecp_fe_sub( ctx, X3, X3, t0 );
+    ecp_fe_mul( ctx, t0, t3, t1 );
+    ecp_fe_mul( ctx, Z3, Z3, t5 );
+    ecp_fe_add( ctx, Z3, Z3, t0 );
+
+    memcpy( R->X, X3, sizeof( X3 ) );
+    memcpy( R->Y, Y3, sizeof( Y3 ) );
+    memcpy( R->Z, Z3, sizeof( Z3 ) );
+}
+
+/*
+ * R = 2 P, complete formula for any curve of odd order
+ * (RCB, Algorithm 3). Cost: 8M + 3S + 3m_a + 2m_3b + 15A
+ */
+static void ecp_fe_point_double( const ecp_fe_ctx *ctx, ecp_fe_point *R,
+                                 const ecp_fe_point *P )
+{
+    mbedtls_mpi_uint t0[ECP_FE_LIMBS], t1[ECP_FE_LIMBS], t2[ECP_FE_LIMBS];
+    mbedtls_mpi_uint t3[ECP_FE_LIMBS];
+    mbedtls_mpi_uint X3[ECP_FE_LIMBS], Y3[ECP_FE_LIMBS], Z3[ECP_FE_LIMBS];
+
+    ecp_fe_mul( ctx, t0, P->X, P->X );
+    ecp_fe_mul( ctx, t1, P->Y, P->Y );
+    ecp_fe_mul( ctx, t2, P->Z, P->Z );
+    ecp_fe_mul( ctx, t3, P->X, P->Y );
+    ecp_fe_add( ctx, t3, t3, t3 );
+    ecp_fe_mul( ctx, Z3, P->X, P->Z );
+    ecp_fe_add( ctx, Z3, Z3, Z3 );
+    ecp_fe_mul( ctx, X3, ctx->a, Z3 );
+    ecp_fe_mul( ctx, Y3, ctx->b3, t2 );
+    ecp_fe_add( ctx, Y3, X3, Y3 );
+    ecp_fe_sub( ctx, X3, t1, Y3 );
+    ecp_fe_add( ctx, Y3, t1, Y3 );
+    ecp_fe_mul( ctx, Y3, X3, Y3 );
+    ecp_fe_mul( ctx, X3, t3, X3 );
+    ecp_fe_mul( ctx, Z3, ctx->b3, Z3 );
+    ecp_fe_mul( ctx, t2, ctx->a, t2 );
+    ecp_fe_sub( ctx, t3, t0, t2 );
+    ecp_fe_mul( ctx, t3, ctx->a, t3 );
+    ecp_fe_add( ctx, t3, t3, Z3 );
+    ecp_fe_add( ctx, Z3, t0, t0 );
+    ecp_fe_add( ctx, t0, Z3, t0 );
+    ecp_fe_add( ctx, t0, t0, t2 );
+    ecp_fe_mul( ctx, t0, t0, t3 );
+    ecp_fe_add( ctx, Y3, Y3, t0 );
+    ecp_fe_mul( ctx, t2, P->Y, P->Z );
+    ecp_fe_add( ctx, t2, t2, t2 );
+    ecp_fe_mul( ctx, t0, t2, t3 );
+    ecp_fe_sub( ctx, X3, X3, t0 );
+    ecp_fe_mul( ctx, Z3, t2, t1 );
+    ecp_fe_add( ctx, Z3, Z3, Z3 );
+    ecp_fe_add( ctx, Z3, Z3, Z3 );
+
+    memcpy( R->X, X3, sizeof( X3 ) );
+    memcpy( R->Y, Y3, sizeof( Y3 ) );
+    memcpy( R->Z, Z3, sizeof( Z3 ) );
+}
+
+/*
+ * Set up the field constants for a group.
+ * This is the only place that allocates, once per multiplication.
+ */
+static int ecp_fe_ctx_setup( ecp_fe_ctx *ctx, const mbedtls_ecp_group *grp )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi_uint x, m0;
+    mbedtls_mpi T;
+    unsigned int i;
+
+    mbedtls_mpi_init( &T );
+
+    memset( ctx, 0, sizeof( *ctx ) );
+    ctx->n = ( grp->pbits + biL - 1 ) / biL;
+    memcpy( ctx->P, grp->P.p, ctx->n * sizeof( mbedtls_mpi_uint ) );
+
+    /* mm = -P^-1 mod 2^biL, see mpi_montg_init() */
+    m0 = ctx->P[0];
+    x  = m0;
+    x += ( ( m0 + 2 ) & 4 ) << 1;
+    for( i = biL; i >= 8; i /= 2 )
+        x *= ( 2 - ( m0 * x ) );
+    ctx->mm = ~x + 1;
+
+    /* RR = 2^(2 * n * biL) mod P */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &T, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T, 2 * ctx->n * biL ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &grp->P ) );
+    memcpy( ctx->RR, T.p, ctx->n * sizeof( mbedtls_mpi_uint ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &T, 1 ) );
+    ecp_fe_from_mpi( ctx, ctx->one, &T );
+
+    /* A == NULL means A = -3 */
+    if( grp->A.p == NULL )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &T, &grp->P, 3 ) );
+    else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &T, &grp->A ) );
+    ecp_fe_from_mpi( ctx, ctx->a, &T );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T, &grp->B, 3 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &grp->P ) );
+    ecp_fe_from_mpi( ctx, ctx->b3, &T );
+
+cleanup:
+    mbedtls_mpi_free( &T );
+    return( ret );
+}
+
+/*
+ * Multiplication R = m * P with complete formulas and a fixed window:
+ * for each window of ECP_FE_W bits of m, from the top, double ECP_FE_W
+ * times then add the precomputed multiple of P selected by the window,
+ * which is read in constant time. The number of operations only depends
+ * on the size of the group.
+ */
+static int ecp_mul_complete( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             int (*f_rng)(void *, unsigned char *, size_t),
+                             void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    ecp_fe_ctx ctx;
+    ecp_fe_point *T = NULL, Q, S;
+    mbedtls_mpi_uint Zi[ECP_FE_LIMBS];
+    mbedtls_mpi l;
+    size_t i, j, nbits;
+    unsigned k, digit;
+
+    mbedtls_mpi_init( &l );
+
+    T = mbedtls_calloc( 1U << ECP_FE_W, sizeof( ecp_fe_point ) );
+    if( T == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    MBEDTLS_MPI_CHK( ecp_fe_ctx_setup( &ctx, grp ) );
+
+    /* T[0] = 0 = (0:1:0), T[1] = P */
+    memcpy( T[0].Y, ctx.one, sizeof( ctx.one ) );
+    ecp_fe_from_mpi( &ctx, T[1].X, &P->X );
+    ecp_fe_from_mpi( &ctx, T[1].Y, &P->Y );
+    memcpy( T[1].Z, ctx.one, sizeof( ctx.one ) );
+
+    /* Randomize the projective representation of P (countermeasure
+     * against DPA): (X:Y:Z) = (lX:lY:lZ) for a random non-zero l */
+    if( f_rng != NULL )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_random( &l, 1, &grp->P, f_rng, p_rng ) );
+        ecp_fe_from_mpi( &ctx, Zi, &l );
+        ecp_fe_mul( &ctx, T[1].X, T[1].X, Zi );
+        ecp_fe_mul( &ctx, T[1].Y, T[1].Y, Zi );
+        ecp_fe_mul( &ctx, T[1].Z, T[1].Z, Zi );
+    }
+
+    /* T[k] = k * P */
+    for( k = 2; k < ( 1U << ECP_FE_W ); k++ )
+    {
+        if( k % 2 == 0 )
+            ecp_fe_point_double( &ctx, &T[k], &T[k / 2] );
+        else
+            ecp_fe_point_add( &ctx, &T[k], &T[k - 1], &T[1] );
+    }
+
+    /* Q = 0 */
+    memset( &Q, 0, sizeof( Q ) );
+    memset( &S, 0, sizeof( S ) );
+    memcpy( Q.Y, ctx.one, sizeof( ctx.one ) );
+
+    nbits = ( grp->nbits + ECP_FE_W - 1 ) / ECP_FE_W * ECP_FE_W;
+    for( i = nbits; i > 0; i -= ECP_FE_W )
+    {
+        for( j = 0; j < ECP_FE_W; j++ )
+            ecp_fe_point_double( &ctx, &Q, &Q );
+
+        digit = 0;
+        for( j = 1; j <= ECP_FE_W; j++ )
+            digit = ( digit << 1 ) | mbedtls_mpi_get_bit( m, i - j );
+
+        /* S = T[digit], reading the whole table */
+        for( k = 0; k < ( 1U << ECP_FE_W ); k++ )
+        {
+            mbedtls_ct_mpi_uint_cond_assign(
+                    3 * ECP_FE_LIMBS, (mbedtls_mpi_uint *) &S,
+                    (const mbedtls_mpi_uint *) &T[k],
+                    (unsigned char) mbedtls_ct_size_bool_eq( k, digit ) );
+        }
+
+        ecp_fe_point_add( &ctx, &Q, &Q, &S );
+    }
+
+    /* Back to affine coordinates */
+    if( ecp_fe_is_zero( &ctx, Q.Z ) )
+    {
+        ret = mbedtls_ecp_set_zero( R );
+        goto cleanup;
+    }
+
+    ecp_fe_inv( &ctx, Zi, Q.Z );
+    ecp_fe_mul( &ctx, Q.X, Q.X, Zi );
+    ecp_fe_mul( &ctx, Q.Y, Q.Y, Zi );
+
+    MBEDTLS_MPI_CHK( ecp_fe_to_mpi( &ctx, &R->X, Q.X ) );
+    MBEDTLS_MPI_CHK( ecp_fe_to_mpi( &ctx, &R->Y, Q.Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+
+cleanup:
+    mbedtls_platform_zeroize( T, ( 1U << ECP_FE_W ) * sizeof( ecp_fe_point ) );
+    mbedtls_free( T );
+    mbedtls_platform_zeroize( &Q, sizeof( Q ) );
+    mbedtls_platform_zeroize( &S, sizeof( S ) );
+    mbedtls_platform_zeroize( Zi, sizeof( Zi ) );
+    mbedtls_mpi_free( &l );
+
+    if( ret == MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+
+    /* prevent caller from using invalid value */
+    if( ret != 0 )
+        mbedtls_ecp_point_free( R );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_COMPLETE_FORMULAS */
+
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
 #if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
@@ -2615,6 +3268,20 @@ static int ecp_mul_restartable_internal( mbedtls_ecp_group *grp, mbedtls_ecp_poi
         MBEDTLS_MPI_CHK( ecp_mul_mxz( grp, R, m, P, f_rng, p_rng ) );
 #endif
 #if defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
+#if defined(MBEDTLS_ECP_COMPLETE_FORMULAS)
+    if( mbedtls_ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS &&
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+        ! is_grp_capable &&
+#endif
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+        mbedtls_ecp_restart_get_max_ops( rs_ctx ) == 0 &&
+#endif
+        ecp_use_complete_formulas( grp ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_mul_complete( grp, R, m, P, f_rng, p_rng ) );
+        goto cleanup;
+    }
+#endif /* MBEDTLS_ECP_COMPLETE_FORMULAS */
     if( mbedtls_ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
         MBEDTLS_MPI_CHK( ecp_mul_comb( grp, R, m, P, f_rng, p_rng, rs_ctx ) );
 #endif
@@ -2757,12 +3424,290 @@ cleanup:
     return( ret );
 }
 
+#if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
 /*
- * Restartable linear combination
- * NOT constant-time
+ * GLV method for secp256k1: Gallant, Lambert and Vanstone, "Faster point
+ * multiplication on elliptic curves with efficient endomorphisms", 2001.
+ *
+ * phi(x, y) = (beta * x, y) is an endomorphism of the curve, and
+ * phi(P) = lambda * P for all points P of order N. A scalar k is split into
+ * k1 + k2 * lambda mod N, with k1 and k2 of about 128 bits, so that
+ * k * P = k1 * P + k2 * phi(P) only needs half as many doublings.
+ *
+ * This is used by mbedtls_ecp_muladd(), whose scalars are public, so the
+ * half-size scalars are processed with interleaved width-w NAF, which is
+ * NOT constant-time.
  */
-int mbedtls_ecp_muladd_restartable(
-             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+static const mbedtls_mpi_uint secp256k1_glv_beta[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x01, 0x95, 0x71, 0x28, 0x6C, 0x39, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x89, 0xF5, 0x12, 0x75, 0x49, 0xF0, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x34, 0x34, 0xAC, 0x9E, 0x47, 0x64, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x07, 0x7C, 0x65, 0x2B, 0x6A, 0xE9, 0x7A ),
+};
+/*
+ * Short basis of the lattice { (x, y) : x + y * lambda = 0 mod N }:
+ * (a1, b1) and (a2, b2), with b2 = a1 and b1 < 0  (GECC 3.5)
+ */
+static const mbedtls_mpi_uint secp256k1_glv_a1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xEB, 0x84, 0x92, 0xE4, 0x90, 0x6C, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x6B, 0xD4, 0xA7, 0x21, 0xD2, 0x86, 0x30 ),
+};
+static const mbedtls_mpi_uint secp256k1_glv_minus_b1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xE4, 0xBF, 0x0A, 0xA9, 0x7F, 0x54, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x88, 0x0E, 0x01, 0xD6, 0x7E, 0x43, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp256k1_glv_a2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xCF, 0x44, 0x9D, 0x8D, 0x10, 0xC1, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xF3, 0xE2, 0xA8, 0xF7, 0x50, 0xCA, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi ecp_glv_beta = ECP_MPI_INIT_ARRAY( secp256k1_glv_beta );
+static const mbedtls_mpi ecp_glv_a1 = ECP_MPI_INIT_ARRAY( secp256k1_glv_a1 );
+static const mbedtls_mpi ecp_glv_minus_b1 = ECP_MPI_INIT_ARRAY( secp256k1_glv_minus_b1 );
+static const mbedtls_mpi ecp_glv_a2 = ECP_MPI_INIT_ARRAY( secp256k1_glv_a2 );
+
+/* Window size of the NAF representation of the half-size scalars */
+#define ECP_GLV_W           5
+/* Number of precomputed points P, 3P, ..., (2^(w-1) - 1)P per base point */
+#define ECP_GLV_PRE         ( 1 << ( ECP_GLV_W - 2 ) )
+/* Upper bound on the length of the NAF of a half-size scalar */
+#define ECP_GLV_NAF_LEN     136
+
+/*
+ * Split k in [0, N) into k1 + k2 * lambda mod N, with
+ *   c1 = round( b2 * k / N), c2 = round( -b1 * k / N ),
+ *   k1 = k - c1 * a1 - c2 * a2, k2 = - c1 * b1 - c2 * b2
+ * (GECC 3.5, Algorithm 3.74). k1 and k2 may be negative.
+ */
+static int ecp_glv_split( const mbedtls_ecp_group *grp, mbedtls_mpi *k1,
+                          mbedtls_mpi *k2, const mbedtls_mpi *k )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi c1, c2, t, half;
+
+    mbedtls_mpi_init( &c1 ); mbedtls_mpi_init( &c2 );
+    mbedtls_mpi_init( &t ); mbedtls_mpi_init( &half );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &half, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &half, 1 ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, k, &ecp_glv_a1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &t, &t, &half ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_div_mpi( &c1, NULL, &t, &grp->N ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, k, &ecp_glv_minus_b1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &t, &t, &half ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_div_mpi( &c2, NULL, &t, &grp->N ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c1, &ecp_glv_a1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &ecp_glv_a2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k1, &t ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( k2, &c1, &ecp_glv_minus_b1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &ecp_glv_a1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k2, k2, &t ) );
+
+cleanup:
+    mbedtls_mpi_free( &c1 ); mbedtls_mpi_free( &c2 );
+    mbedtls_mpi_free( &t ); mbedtls_mpi_free( &half );
+
+    return( ret );
+}
+
+/*
+ * Width-w NAF of |k|: digits are 0 or odd in (-2^(w-1), 2^(w-1)), and any w
+ * consecutive digits contain at most one non-zero digit.  (GECC 3.35)
+ */
+static int ecp_glv_wnaf( signed char naf[ECP_GLV_NAF_LEN], size_t *len,
+                         const mbedtls_mpi *k )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi K;
+    mbedtls_mpi_sint d;
+    size_t i = 0;
+
+    mbedtls_mpi_init( &K );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &K, k ) );
+    K.s = 1;
+
+    while( mbedtls_mpi_cmp_int( &K, 0 ) != 0 )
+    {
+        if( i == ECP_GLV_NAF_LEN )
+        {
+            ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+            goto cleanup;
+        }
+
+        d = 0;
+        if( ( K.p[0] & 1 ) != 0 )
+        {
+            d = (mbedtls_mpi_sint) ( K.p[0] & ( ( 1 << ECP_GLV_W ) - 1 ) );
+            if( d >= ( 1 << ( ECP_GLV_W - 1 ) ) )
+                d -= 1 << ECP_GLV_W;
+
+            MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &K, &K, d ) );
+        }
+
+        naf[i++] = (signed char) d;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &K, 1 ) );
+    }
+
+    *len = i;
+
+cleanup:
+    mbedtls_mpi_free( &K );
+
+    return( ret );
+}
+
+/*
+ * R = m * P + n * Q on secp256k1, for m, n in [1, N) and valid points P, Q,
+ * as k[0] * P + k[1] * phi(P) + k[2] * Q + k[3] * phi(Q).
+ * NOT constant-time
+ */
+static int ecp_muladd_glv( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                           const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                           const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_ecp_point *T = NULL, *TT[2 * ( ECP_GLV_PRE - 1 )], D[2], A, B;
+    mbedtls_ecp_point *pD[2] = { &D[0], &D[1] };
+    const mbedtls_ecp_point *pt;
+    mbedtls_mpi k[4], tmp[4];
+    signed char naf[4][ECP_GLV_NAF_LEN];
+    size_t len[4], maxlen = 0, i, j;
+    int d;
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    char is_grp_capable = 0;
+#endif
+
+    mpi_init_many( k, 4 );
+    mpi_init_many( tmp, 4 );
+    mbedtls_ecp_point_init( &D[0] ); mbedtls_ecp_point_init( &D[1] );
+    mbedtls_ecp_point_init( &A ); mbedtls_ecp_point_init( &B );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, Q ) );
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
+        MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    MBEDTLS_MPI_CHK( ecp_glv_split( grp, &k[0], &k[1], m ) );
+    MBEDTLS_MPI_CHK( ecp_glv_split( grp, &k[2], &k[3], n ) );
+
+    for( j = 0; j < 4; j++ )
+    {
+        MBEDTLS_MPI_CHK( ecp_glv_wnaf( naf[j], &len[j], &k[j] ) );
+        if( len[j] > maxlen )
+            maxlen = len[j];
+    }
+
+    /*
+     * T[j * PRE + i] = (2 * i + 1) * B_j for the base points
+     * B_0 = P, B_1 = phi(P), B_2 = Q, B_3 = phi(Q), all normalized
+     */
+    T = mbedtls_calloc( 4 * ECP_GLV_PRE, sizeof( mbedtls_ecp_point ) );
+    if( T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+    for( i = 0; i < 4 * ECP_GLV_PRE; i++ )
+        mbedtls_ecp_point_init( &T[i] );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[0], P ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[2 * ECP_GLV_PRE], Q ) );
+
+    MBEDTLS_MPI_CHK( ecp_double_jac( grp, &D[0], P, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_double_jac( grp, &D[1], Q, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, pD, 2 ) );
+
+    for( i = 1; i < ECP_GLV_PRE; i++ )
+    {
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i], &T[i - 1], &D[0], tmp ) );
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[2 * ECP_GLV_PRE + i],
+                                        &T[2 * ECP_GLV_PRE + i - 1], &D[1], tmp ) );
+        TT[2 * ( i - 1 )] = &T[i];
+        TT[2 * ( i - 1 ) + 1] = &T[2 * ECP_GLV_PRE + i];
+    }
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, 2 * ( ECP_GLV_PRE - 1 ) ) );
+
+    for( j = 0; j < 4; j += 2 )
+    {
+        for( i = 0; i < ECP_GLV_PRE; i++ )
+        {
+            MPI_ECP_MUL( &T[( j + 1 ) * ECP_GLV_PRE + i].X,
+                         &T[j * ECP_GLV_PRE + i].X, &ecp_glv_beta );
+            MPI_ECP_MOV( &T[( j + 1 ) * ECP_GLV_PRE + i].Y,
+                         &T[j * ECP_GLV_PRE + i].Y );
+            MPI_ECP_LSET( &T[( j + 1 ) * ECP_GLV_PRE + i].Z, 1 );
+        }
+    }
+
+    /*
+     * Interleaved left-to-right evaluation of the four NAFs,
+     * accumulating into A with B as the negation buffer
+     */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &A ) );
+
+    for( i = maxlen; i-- > 0; )
+    {
+        if( MPI_ECP_CMP_INT( &A.Z, 0 ) != 0 )
+            MBEDTLS_MPI_CHK( ecp_double_jac( grp, &A, &A, tmp ) );
+
+        for( j = 0; j < 4; j++ )
+        {
+            if( i >= len[j] || naf[j][i] == 0 )
+                continue;
+
+            d = naf[j][i] * k[j].s;
+            pt = &T[j * ECP_GLV_PRE + ( ( d < 0 ? -d : d ) - 1 ) / 2];
+            if( d < 0 )
+            {
+                /* Y != 0 since the points have odd order */
+                MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &B, pt ) );
+                MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &B.Y, &grp->P, &B.Y ) );
+                pt = &B;
+            }
+
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &A, &A, pt, tmp ) );
+        }
+    }
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &A ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, &A ) );
+
+cleanup:
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( is_grp_capable )
+        mbedtls_internal_ecp_free( grp );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    if( T != NULL )
+    {
+        for( i = 0; i < 4 * ECP_GLV_PRE; i++ )
+            mbedtls_ecp_point_free( &T[i] );
+        mbedtls_free( T );
+    }
+    mbedtls_ecp_point_free( &D[0] ); mbedtls_ecp_point_free( &D[1] );
+    mbedtls_ecp_point_free( &A ); mbedtls_ecp_point_free( &B );
+    mpi_free_many( k, 4 );
+    mpi_free_many( tmp, 4 );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_DP_SECP256K1_ENABLED */
+
+/*
+ * Restartable linear combination
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_restartable(
+             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
              const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
              mbedtls_ecp_restart_ctx *rs_ctx )
@@ -2785,6 +3730,22 @@ int mbedtls_ecp_muladd_restartable(
     if( mbedtls_ecp_get_type( grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
         return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
 
+#if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+    /* The GLV path is not restartable, and leaves the trivial scalars and
+     * the error cases to the generic path. */
+    if( grp->id == MBEDTLS_ECP_DP_SECP256K1 &&
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+        mbedtls_ecp_restart_get_max_ops( rs_ctx ) == 0 &&
+#endif
+        mbedtls_mpi_cmp_int( m, 1 ) > 0 &&
+        mbedtls_mpi_cmp_mpi( m, &grp->N ) < 0 &&
+        mbedtls_mpi_cmp_int( n, 1 ) > 0 &&
+        mbedtls_mpi_cmp_mpi( n, &grp->N ) < 0 )
+    {
+        return( ecp_muladd_glv( grp, R, m, P, n, Q ) );
+    }
+#endif /* MBEDTLS_ECP_DP_SECP256K1_ENABLED */
+
     mbedtls_ecp_point_init( &mP );
     mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
 
@@ -2875,13 +3836,315 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     ECP_VALIDATE_RET( Q   != NULL );
     return( mbedtls_ecp_muladd_restartable( grp, R, m, P, n, Q, NULL ) );
 }
+
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/*
+ * Cache of comb tables for public keys, keyed by the uncompressed encoding
+ * of the point.
+ *
+ * Tables are computed without holding the lock. An entry that is being used
+ * has a non-zero reference count and is never evicted, so its table may be
+ * read without the lock. If every entry is in use, a new table is used once
+ * and freed.
+ */
+static mbedtls_ecp_precomp_cache *ecp_precomp_cache = NULL;
+
+void mbedtls_ecp_set_precomp_cache( mbedtls_ecp_precomp_cache *cache )
+{
+    ecp_precomp_cache = cache;
+}
+
+void mbedtls_ecp_precomp_cache_init( mbedtls_ecp_precomp_cache *cache )
+{
+    ECP_VALIDATE( cache != NULL );
+
+    memset( cache, 0, sizeof( mbedtls_ecp_precomp_cache ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &cache->mutex );
+#endif
+}
+
+int mbedtls_ecp_precomp_cache_setup( mbedtls_ecp_precomp_cache *cache,
+                                     size_t capacity )
+{
+    ECP_VALIDATE_RET( cache != NULL );
+
+    if( capacity == 0 || cache->entries != NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    cache->entries = mbedtls_calloc( capacity,
+                                     sizeof( mbedtls_ecp_precomp_entry ) );
+    if( cache->entries == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    cache->capacity = capacity;
+
+    return( 0 );
+}
+
+static void ecp_precomp_table_free( mbedtls_ecp_point *T,
+                                    unsigned char T_size )
+{
+    unsigned char i;
+
+    if( T == NULL )
+        return;
+
+    for( i = 0; i < T_size; i++ )
+        mbedtls_ecp_point_free( &T[i] );
+    mbedtls_free( T );
+}
+
+void mbedtls_ecp_precomp_cache_free( mbedtls_ecp_precomp_cache *cache )
+{
+    size_t i;
+
+    if( cache == NULL )
+        return;
+
+    if( cache->entries != NULL )
+    {
+        for( i = 0; i < cache->capacity; i++ )
+            ecp_precomp_table_free( cache->entries[i].T,
+                                    cache->entries[i].T_size );
+        mbedtls_free( cache->entries );
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &cache->mutex );
+#endif
+
+    mbedtls_platform_zeroize( cache, sizeof( mbedtls_ecp_precomp_cache ) );
+}
+
+/*
+ * Look up the table of a key and take a reference to it.
+ * Must be called with the cache locked.
+ */
+static mbedtls_ecp_precomp_entry *ecp_precomp_cache_get(
+                                    mbedtls_ecp_precomp_cache *cache,
+                                    mbedtls_ecp_group_id grp_id,
+                                    const unsigned char *key, size_t key_len )
+{
+    size_t i;
+    mbedtls_ecp_precomp_entry *entry;
+
+    for( i = 0; i < cache->capacity; i++ )
+    {
+        entry = &cache->entries[i];
+        if( entry->T != NULL && entry->grp_id == grp_id &&
+            entry->key_len == key_len &&
+            memcmp( entry->key, key, key_len ) == 0 )
+        {
+            entry->refs++;
+            entry->last_use = ++cache->clock;
+            return( entry );
+        }
+    }
+
+    return( NULL );
+}
+
+/*
+ * Store a table in a free entry, or in place of the least recently used
+ * table that is not in use, and take a reference to it.
+ * Must be called with the cache locked. Returns NULL if every entry is in
+ * use, in which case the caller keeps ownership of T.
+ */
+static mbedtls_ecp_precomp_entry *ecp_precomp_cache_put(
+                                    mbedtls_ecp_precomp_cache *cache,
+                                    mbedtls_ecp_group_id grp_id,
+                                    const unsigned char *key, size_t key_len,
+                                    mbedtls_ecp_point *T, unsigned char T_size,
+                                    unsigned char w )
+{
+    size_t i;
+    mbedtls_ecp_precomp_entry *entry, *victim = NULL;
+
+    for( i = 0; i < cache->capacity; i++ )
+    {
+        entry = &cache->entries[i];
+        if( entry->refs != 0 )
+            continue;
+
+        if( entry->T == NULL )
+        {
+            victim = entry;
+            break;
+        }
+
+        if( victim == NULL || entry->last_use < victim->last_use )
+            victim = entry;
+    }
+
+    if( victim == NULL )
+        return( NULL );
+
+    ecp_precomp_table_free( victim->T, victim->T_size );
+
+    victim->grp_id = grp_id;
+    memcpy( victim->key, key, key_len );
+    victim->key_len = key_len;
+    victim->T = T;
+    victim->T_size = T_size;
+    victim->w = w;
+    victim->refs = 1;
+    victim->last_use = ++cache->clock;
+
+    return( victim );
+}
+
+/*
+ * Linear combination with the base point, using the cache for Q
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_cached( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                               const mbedtls_mpi *m,
+                               const mbedtls_mpi *n,
+                               const mbedtls_ecp_point *Q )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_ecp_precomp_cache *cache = ecp_precomp_cache;
+    mbedtls_ecp_precomp_entry *entry = NULL;
+    unsigned char key[MBEDTLS_ECP_MAX_PT_LEN];
+    size_t key_len, d = 0;
+    unsigned char i, w = 0, T_size = 0;
+    mbedtls_ecp_point *T = NULL;
+    mbedtls_ecp_point mP;
+    mbedtls_mpi tmp[4];
+    ECP_VALIDATE_RET( grp != NULL );
+    ECP_VALIDATE_RET( R   != NULL );
+    ECP_VALIDATE_RET( m   != NULL );
+    ECP_VALIDATE_RET( n   != NULL );
+    ECP_VALIDATE_RET( Q   != NULL );
+
+    /* Leave the unusual cases to the generic code: n outside of 1..N-1 is
+     * either handled by a shortcut or rejected there. */
+    if( cache == NULL || grp->id == MBEDTLS_ECP_DP_NONE ||
+        mbedtls_ecp_get_type( grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS ||
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+        mbedtls_internal_ecp_grp_capable( grp ) ||
+#endif
+#if defined(MBEDTLS_ECP_COMPLETE_FORMULAS)
+        ecp_use_complete_formulas( grp ) ||
+#endif
+        mbedtls_mpi_cmp_int( &Q->Z, 1 ) != 0 ||
+        mbedtls_mpi_cmp_int( n, 1 ) < 0 ||
+        mbedtls_mpi_cmp_mpi( n, &grp->N ) >= 0 )
+    {
+        return( mbedtls_ecp_muladd( grp, R, m, &grp->G, n, Q ) );
+    }
+
+    mbedtls_ecp_point_init( &mP );
+    mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_point_write_binary( grp, Q,
+                                    MBEDTLS_ECP_PF_UNCOMPRESSED,
+                                    &key_len, key, sizeof( key ) ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &cache->mutex ) ) != 0 )
+        goto cleanup;
+#endif
+    entry = ecp_precomp_cache_get( cache, grp->id, key, key_len );
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_unlock( &cache->mutex ) ) != 0 )
+        goto cleanup;
+#endif
+
+    if( entry == NULL )
+    {
+        /* The key is checked once, when its table is computed. */
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, Q ) );
+
+        /* The table is meant to be reused, so afford a larger window
+         * than for a one-off multiplication, within the configured bound. */
+        w = ecp_pick_window_size( grp, 0 );
+        if( w < MBEDTLS_ECP_WINDOW_SIZE )
+            w++;
+        T_size = 1U << ( w - 1 );
+        d = ( grp->nbits + w - 1 ) / w;
+
+        T = mbedtls_calloc( T_size, sizeof( mbedtls_ecp_point ) );
+        if( T == NULL )
+        {
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+            goto cleanup;
+        }
+
+        for( i = 0; i < T_size; i++ )
+            mbedtls_ecp_point_init( &T[i] );
+
+        MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, Q, w, d, NULL ) );
+
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_lock( &cache->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        /* Another thread may have added the same key meanwhile. */
+        entry = ecp_precomp_cache_get( cache, grp->id, key, key_len );
+        if( entry == NULL )
+        {
+            entry = ecp_precomp_cache_put( cache, grp->id, key, key_len,
+                                           T, T_size, w );
+            if( entry != NULL )
+                T = NULL;
+        }
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_unlock( &cache->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, &mP, m, &grp->G, NULL ) );
+
+    if( entry != NULL )
+    {
+        w = entry->w;
+        d = ( grp->nbits + w - 1 ) / w;
+        MBEDTLS_MPI_CHK( ecp_mul_comb_after_precomp( grp, R, n,
+                                                     entry->T, entry->T_size,
+                                                     w, d, NULL, NULL, NULL ) );
+    }
+    else
+    {
+        MBEDTLS_MPI_CHK( ecp_mul_comb_after_precomp( grp, R, n,
+                                                     T, T_size,
+                                                     w, d, NULL, NULL, NULL ) );
+    }
+
+    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, &mP, R, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R ) );
+
+cleanup:
+    if( entry != NULL )
+    {
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_lock( &cache->mutex ) == 0 )
+        {
+            entry->refs--;
+            if( mbedtls_mutex_unlock( &cache->mutex ) != 0 )
+                ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+        }
+        else
+            ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+#else
+        entry->refs--;
+#endif
+    }
+
+    ecp_precomp_table_free( T, T_size );
+    mpi_free_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+    mbedtls_ecp_point_free( &mP );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
 #if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
 #if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
-#define ECP_MPI_INIT(s, n, p) {s, (n), (mbedtls_mpi_uint *)(p)}
-#define ECP_MPI_INIT_ARRAY(x)   \
-    ECP_MPI_INIT(1, sizeof(x) / sizeof(mbedtls_mpi_uint), x)
 /*
  * Constants for the two points other than 0, 1, -1 (mod p) in
  * https://cr.yp.to/ecdh.html#validate
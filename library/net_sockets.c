@@ -95,6 +95,20 @@ static int wsa_init_done = 0;
 
 #define IS_EINTR( ret ) ( ( ret ) == EINTR )
 
+#if defined(MBEDTLS_SSL_KTLS) && defined(__linux__)
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+
+#if !defined(SOL_TLS)
+#define SOL_TLS 282
+#endif
+#if !defined(TCP_ULP)
+#define TCP_ULP 31
+#endif
+
+#define NET_HAVE_KTLS
+#endif /* MBEDTLS_SSL_KTLS && __linux__ */
+
 #endif /* ( _WIN32 || _WIN32_WCE ) && !EFIX64 && !EFI32 */
 
 /* Some MS functions want int and MSVC warns if we pass size_t,
@@ -683,6 +697,330 @@ int mbedtls_net_send( void *ctx, const unsigned char *buf, size_t len )
     return( ret );
 }
 
+#if defined(MBEDTLS_SSL_KTLS)
+#if defined(NET_HAVE_KTLS)
+/*
+ * Pass the traffic secrets of one direction to the kernel
+ */
+static int net_ktls_set_crypto_info( int fd, int direction,
+                                     const mbedtls_ssl_ktls_info *info )
+{
+    union
+    {
+        struct tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+        struct tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+#if defined(TLS_CIPHER_CHACHA20_POLY1305)
+        struct tls12_crypto_info_chacha20_poly1305 chacha20_poly1305;
+#endif
+    } crypto_info;
+    socklen_t crypto_info_len;
+    unsigned char nonce[12];
+    uint16_t version;
+    int ret = MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+
+    if( info->tls_version == 0x0303 )
+        version = TLS_1_2_VERSION;
+#if defined(TLS_1_3_VERSION)
+    else if( info->tls_version == 0x0304 )
+        version = TLS_1_3_VERSION;
+#endif
+    else
+        return( MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE );
+
+    /* The kernel takes the nonce of the next record, split into the part
+     * that is fixed and the part that changes with each record. With
+     * AES-GCM in TLS 1.2, the latter is the explicit nonce, which we set to
+     * the sequence number. */
+    if( info->iv_len == 4 )
+    {
+        memcpy( nonce, info->iv, 4 );
+        memcpy( nonce + 4, info->rec_seq, 8 );
+    }
+    else if( info->iv_len == sizeof( nonce ) )
+        memcpy( nonce, info->iv, sizeof( nonce ) );
+    else
+        return( MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE );
+
+    memset( &crypto_info, 0, sizeof( crypto_info ) );
+
+    switch( info->cipher )
+    {
+        case MBEDTLS_CIPHER_AES_128_GCM:
+            if( info->key_len != TLS_CIPHER_AES_GCM_128_KEY_SIZE )
+                goto cleanup;
+            crypto_info.aes_gcm_128.info.version = version;
+            crypto_info.aes_gcm_128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+            memcpy( crypto_info.aes_gcm_128.key, info->key,
+                    TLS_CIPHER_AES_GCM_128_KEY_SIZE );
+            memcpy( crypto_info.aes_gcm_128.salt, nonce,
+                    TLS_CIPHER_AES_GCM_128_SALT_SIZE );
+            memcpy( crypto_info.aes_gcm_128.iv,
+                    nonce + TLS_CIPHER_AES_GCM_128_SALT_SIZE,
+                    TLS_CIPHER_AES_GCM_128_IV_SIZE );
+            memcpy( crypto_info.aes_gcm_128.rec_seq, info->rec_seq,
+                    TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE );
+            crypto_info_len = sizeof( crypto_info.aes_gcm_128 );
+            break;
+
+        case MBEDTLS_CIPHER_AES_256_GCM:
+            if( info->key_len != TLS_CIPHER_AES_GCM_256_KEY_SIZE )
+                goto cleanup;
+            crypto_info.aes_gcm_256.info.version = version;
+            crypto_info.aes_gcm_256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+            memcpy( crypto_info.aes_gcm_256.key, info->key,
+                    TLS_CIPHER_AES_GCM_256_KEY_SIZE );
+            memcpy( crypto_info.aes_gcm_256.salt, nonce,
+                    TLS_CIPHER_AES_GCM_256_SALT_SIZE );
+            memcpy( crypto_info.aes_gcm_256.iv,
+                    nonce + TLS_CIPHER_AES_GCM_256_SALT_SIZE,
+                    TLS_CIPHER_AES_GCM_256_IV_SIZE );
+            memcpy( crypto_info.aes_gcm_256.rec_seq, info->rec_seq,
+                    TLS_CIPHER_AES_GCM_256_REC_SEQ_SIZE );
+            crypto_info_len = sizeof( crypto_info.aes_gcm_256 );
+            break;
+
+#if defined(TLS_CIPHER_CHACHA20_POLY1305)
+        case MBEDTLS_CIPHER_CHACHA20_POLY1305:
+            if( info->key_len != TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE )
+                goto cleanup;
+            crypto_info.chacha20_poly1305.info.version = version;
+            crypto_info.chacha20_poly1305.info.cipher_type =
+                TLS_CIPHER_CHACHA20_POLY1305;
+            memcpy( crypto_info.chacha20_poly1305.key, info->key,
+                    TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE );
+            memcpy( crypto_info.chacha20_poly1305.iv, nonce,
+                    TLS_CIPHER_CHACHA20_POLY1305_IV_SIZE );
+            memcpy( crypto_info.chacha20_poly1305.rec_seq, info->rec_seq,
+                    TLS_CIPHER_CHACHA20_POLY1305_REC_SEQ_SIZE );
+            crypto_info_len = sizeof( crypto_info.chacha20_poly1305 );
+            break;
+#endif /* TLS_CIPHER_CHACHA20_POLY1305 */
+
+        default:
+            goto cleanup;
+    }
+
+    if( setsockopt( fd, SOL_TLS,
+                    direction == MBEDTLS_SSL_KTLS_TX ? TLS_TX : TLS_RX,
+                    &crypto_info, crypto_info_len ) != 0 )
+        goto cleanup;
+
+    ret = 0;
+
+cleanup:
+    mbedtls_platform_zeroize( &crypto_info, sizeof( crypto_info ) );
+    mbedtls_platform_zeroize( nonce, sizeof( nonce ) );
+    return( ret );
+}
+#endif /* NET_HAVE_KTLS */
+
+/*
+ * Offload the record protection of a TLS connection to the kernel
+ */
+int mbedtls_net_ktls_enable( mbedtls_net_context *ctx,
+                             mbedtls_ssl_context *ssl,
+                             int directions )
+{
+#if defined(NET_HAVE_KTLS)
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    static const int all[2] = { MBEDTLS_SSL_KTLS_TX, MBEDTLS_SSL_KTLS_RX };
+    mbedtls_ssl_ktls_info info[2];
+    int offloaded = 0;
+    size_t i;
+
+    memset( info, 0, sizeof( info ) );
+
+    if( ssl == NULL || ssl->p_bio != (void *) ctx || directions == 0 ||
+        ( directions & ~( MBEDTLS_SSL_KTLS_TX | MBEDTLS_SSL_KTLS_RX ) ) != 0 )
+    {
+        return( MBEDTLS_ERR_NET_BAD_INPUT_DATA );
+    }
+
+    if( ( ret = check_fd( ctx->fd, 0 ) ) != 0 )
+        return( ret );
+
+    /* Fail before changing the socket if a direction can't be offloaded. */
+    for( i = 0; i < 2; i++ )
+    {
+        if( ( directions & all[i] ) == 0 )
+            continue;
+        if( ( ret = mbedtls_ssl_get_ktls_info( ssl, all[i], &info[i] ) ) != 0 )
+            goto cleanup;
+    }
+
+    /* The TLS ULP is already there if a direction was offloaded before. */
+    if( setsockopt( ctx->fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof( "tls" ) ) != 0 &&
+        errno != EEXIST )
+    {
+        ret = MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+        goto cleanup;
+    }
+
+    for( i = 0; i < 2; i++ )
+    {
+        if( ( directions & all[i] ) == 0 )
+            continue;
+        if( ( ret = net_ktls_set_crypto_info( ctx->fd, all[i], &info[i] ) ) != 0 )
+            break;
+        offloaded |= all[i];
+    }
+
+    if( offloaded != 0 )
+    {
+        int ret2 = mbedtls_ssl_set_ktls( ssl, offloaded,
+                                         mbedtls_net_send_record,
+                                         mbedtls_net_recv_record );
+        if( ret2 != 0 )
+            ret = ret2;
+    }
+
+cleanup:
+    mbedtls_platform_zeroize( info, sizeof( info ) );
+    return( ret );
+#else
+    ((void) ctx);
+    ((void) ssl);
+    ((void) directions);
+    return( MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE );
+#endif /* NET_HAVE_KTLS */
+}
+
+/*
+ * Send (part of) a record of the given type
+ */
+int mbedtls_net_send_record( void *ctx, int type,
+                             const unsigned char *buf, size_t len )
+{
+#if defined(NET_HAVE_KTLS)
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int fd = ((mbedtls_net_context *) ctx)->fd;
+    union
+    {
+        struct cmsghdr align;
+        unsigned char buf[CMSG_SPACE( sizeof( unsigned char ) )];
+    } control;
+    struct cmsghdr *cmsg;
+    struct msghdr msg;
+    struct iovec iov;
+
+    ret = check_fd( fd, 0 );
+    if( ret != 0 )
+        return( ret );
+
+    memset( &msg, 0, sizeof( msg ) );
+    memset( &control, 0, sizeof( control ) );
+    iov.iov_base = (void *) buf;
+    iov.iov_len = len;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof( control.buf );
+
+    cmsg = CMSG_FIRSTHDR( &msg );
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN( sizeof( unsigned char ) );
+    *CMSG_DATA( cmsg ) = (unsigned char) type;
+
+    ret = (int) sendmsg( fd, &msg, 0 );
+
+    if( ret < 0 )
+    {
+        if( net_would_block( ctx ) != 0 )
+            return( MBEDTLS_ERR_SSL_WANT_WRITE );
+
+        if( errno == EPIPE || errno == ECONNRESET )
+            return( MBEDTLS_ERR_NET_CONN_RESET );
+
+        if( errno == EINTR )
+            return( MBEDTLS_ERR_SSL_WANT_WRITE );
+
+        return( MBEDTLS_ERR_NET_SEND_FAILED );
+    }
+
+    return( ret );
+#else
+    ((void) ctx);
+    ((void) type);
+    ((void) buf);
+    ((void) len);
+    return( MBEDTLS_ERR_NET_SEND_FAILED );
+#endif /* NET_HAVE_KTLS */
+}
+
+/*
+ * Receive records, along with their type
+ */
+int mbedtls_net_recv_record( void *ctx, int *type,
+                             unsigned char *buf, size_t len )
+{
+#if defined(NET_HAVE_KTLS)
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int fd = ((mbedtls_net_context *) ctx)->fd;
+    union
+    {
+        struct cmsghdr align;
+        unsigned char buf[CMSG_SPACE( sizeof( unsigned char ) )];
+    } control;
+    struct cmsghdr *cmsg;
+    struct msghdr msg;
+    struct iovec iov;
+
+    ret = check_fd( fd, 0 );
+    if( ret != 0 )
+        return( ret );
+
+    memset( &msg, 0, sizeof( msg ) );
+    memset( &control, 0, sizeof( control ) );
+    iov.iov_base = buf;
+    iov.iov_len = len;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof( control.buf );
+
+    ret = (int) recvmsg( fd, &msg, 0 );
+
+    if( ret < 0 )
+    {
+        if( net_would_block( ctx ) != 0 )
+            return( MBEDTLS_ERR_SSL_WANT_READ );
+
+        if( errno == EPIPE || errno == ECONNRESET )
+            return( MBEDTLS_ERR_NET_CONN_RESET );
+
+        if( errno == EINTR )
+            return( MBEDTLS_ERR_SSL_WANT_READ );
+
+        /* The kernel could not authenticate a record. */
+        if( errno == EBADMSG )
+            return( MBEDTLS_ERR_SSL_INVALID_MAC );
+
+        return( MBEDTLS_ERR_NET_RECV_FAILED );
+    }
+
+    *type = MBEDTLS_SSL_MSG_APPLICATION_DATA;
+    for( cmsg = CMSG_FIRSTHDR( &msg ); cmsg != NULL;
+         cmsg = CMSG_NXTHDR( &msg, cmsg ) )
+    {
+        if( cmsg->cmsg_level == SOL_TLS &&
+            cmsg->cmsg_type == TLS_GET_RECORD_TYPE )
+        {
+            *type = *CMSG_DATA( cmsg );
+        }
+    }
+
+    return( ret );
+#else
+    ((void) ctx);
+    ((void) type);
+    ((void) buf);
+    ((void) len);
+    return( MBEDTLS_ERR_NET_RECV_FAILED );
+#endif /* NET_HAVE_KTLS */
+}
+#endif /* MBEDTLS_SSL_KTLS */
+
 /*
  * Close the connection
  */
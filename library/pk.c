@@ -83,6 +83,7 @@ void mbedtls_pk_restart_init( mbedtls_pk_restart_ctx *ctx )
     PK_VALIDATE( ctx != NULL );
     ctx->pk_info = NULL;
     ctx->rs_ctx = NULL;
+    ctx->max_ops = 0;
 }
 
 /*
@@ -101,6 +102,16 @@ void mbedtls_pk_restart_free( mbedtls_pk_restart_ctx *ctx )
     ctx->pk_info = NULL;
     ctx->rs_ctx = NULL;
 }
+
+/*
+ * Set the ops budget of a restart context
+ */
+void mbedtls_pk_restart_set_max_ops( mbedtls_pk_restart_ctx *ctx,
+                                     unsigned max_ops )
+{
+    PK_VALIDATE( ctx != NULL );
+    ctx->max_ops = max_ops;
+}
 #endif /* MBEDTLS_ECDSA_C && MBEDTLS_ECP_RESTARTABLE */
 
 /*
@@ -260,7 +271,7 @@ static int pk_restart_setup( mbedtls_pk_restart_ctx *ctx,
     if( info->rs_alloc_func == NULL || info->rs_free_func == NULL )
         return( MBEDTLS_ERR_PK_BAD_INPUT_DATA );
 
-    if( ( ctx->rs_ctx = info->rs_alloc_func() ) == NULL )
+    if( ( ctx->rs_ctx = info->rs_alloc_func( ctx->max_ops ) ) == NULL )
         return( MBEDTLS_ERR_PK_ALLOC_FAILED );
 
     ctx->pk_info = info;
@@ -290,7 +301,7 @@ int mbedtls_pk_verify_restartable( mbedtls_pk_context *ctx,
 #if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_ECP_RESTARTABLE)
     /* optimization: use non-restartable version if restart disabled */
     if( rs_ctx != NULL &&
-        mbedtls_ecp_restart_is_enabled() &&
+        ( rs_ctx->max_ops != 0 || mbedtls_ecp_restart_is_enabled() ) &&
         ctx->pk_info->verify_rs_func != NULL )
     {
         int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
@@ -474,7 +485,7 @@ int mbedtls_pk_sign_restartable( mbedtls_pk_context *ctx,
 #if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_ECP_RESTARTABLE)
     /* optimization: use non-restartable version if restart disabled */
     if( rs_ctx != NULL &&
-        mbedtls_ecp_restart_is_enabled() &&
+        ( rs_ctx->max_ops != 0 || mbedtls_ecp_restart_is_enabled() ) &&
         ctx->pk_info->sign_rs_func != NULL )
     {
         int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
@@ -469,7 +469,7 @@ typedef struct
     mbedtls_ecdsa_context ecdsa_ctx;
 } eckey_restart_ctx;
 
-static void *eckey_rs_alloc( void )
+static void *eckey_rs_alloc( unsigned max_ops )
 {
     eckey_restart_ctx *rs_ctx;
 
@@ -479,6 +479,7 @@ static void *eckey_rs_alloc( void )
     {
         rs_ctx = ctx;
         mbedtls_ecdsa_restart_init( &rs_ctx->ecdsa_rs );
+        mbedtls_ecp_restart_set_max_ops( &rs_ctx->ecdsa_rs.ecp, max_ops );
         mbedtls_ecdsa_init( &rs_ctx->ecdsa_ctx );
     }
 
@@ -869,12 +870,16 @@ static void ecdsa_free_wrap( void *ctx )
 }
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
-static void *ecdsa_rs_alloc( void )
+static void *ecdsa_rs_alloc( unsigned max_ops )
 {
-    void *ctx = mbedtls_calloc( 1, sizeof( mbedtls_ecdsa_restart_ctx ) );
+    mbedtls_ecdsa_restart_ctx *ctx =
+        mbedtls_calloc( 1, sizeof( mbedtls_ecdsa_restart_ctx ) );
 
     if( ctx != NULL )
+    {
         mbedtls_ecdsa_restart_init( ctx );
+        mbedtls_ecp_restart_set_max_ops( &ctx->ecp, max_ops );
+    }
 
     return( ctx );
 }
@@ -92,8 +92,8 @@ struct mbedtls_pk_info_t
     void (*ctx_free_func)( void *ctx );
 
 #if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_ECP_RESTARTABLE)
-    /** Allocate the restart context */
-    void * (*rs_alloc_func)( void );
+    /** Allocate the restart context, with the given ops budget */
+    void * (*rs_alloc_func)( unsigned max_ops );
 
     /** Free the restart context */
     void (*rs_free_func)( void *rs_ctx );
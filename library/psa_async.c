@@ -0,0 +1,491 @@
+/*
+ *  Asynchronous execution of PSA cryptography operations
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/*
+ * Submitted operations are kept in a FIFO list. A worker takes the oldest
+ * operation together with later operations on the same key, and runs them
+ * back to back without going through the queue lock again. Operations on
+ * other keys are left in place.
+ *
+ * A worker takes at most its share of the queued operations, so that the
+ * other workers also get some: operations on a single key, such as the
+ * signatures of a TLS server with one certificate, still run in parallel.
+ * Batches are only as long as MBEDTLS_PSA_ASYNC_BATCH_MAX when the queue
+ * is long enough to keep every worker busy.
+ *
+ * The worker pool needs condition variables and thread creation, which
+ * the threading abstraction layer does not provide, so this module uses
+ * pthread directly.
+ */
+
+#include "common.h"
+
+#if defined(MBEDTLS_PSA_ASYNC_C)
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free      free
+#endif
+
+#include "mbedtls/psa_async.h"
+
+#include <string.h>
+
+/* Values of mbedtls_psa_async_op::type */
+#define PSA_ASYNC_SIGN_HASH             1
+#define PSA_ASYNC_VERIFY_HASH           2
+#define PSA_ASYNC_ASYMMETRIC_DECRYPT    3
+#define PSA_ASYNC_RAW_KEY_AGREEMENT     4
+#define PSA_ASYNC_AEAD_ENCRYPT          5
+#define PSA_ASYNC_AEAD_DECRYPT          6
+
+/*
+ * Call the PSA function that an operation stands for.
+ */
+static psa_status_t psa_async_execute( mbedtls_psa_async_op *op )
+{
+    op->output_length = 0;
+
+    switch( op->type )
+    {
+        case PSA_ASYNC_SIGN_HASH:
+            return( psa_sign_hash( op->key, op->alg,
+                                   op->input, op->input_length,
+                                   op->output, op->output_size,
+                                   &op->output_length ) );
+        case PSA_ASYNC_VERIFY_HASH:
+            return( psa_verify_hash( op->key, op->alg,
+                                     op->input, op->input_length,
+                                     op->input2, op->input2_length ) );
+        case PSA_ASYNC_ASYMMETRIC_DECRYPT:
+            return( psa_asymmetric_decrypt( op->key, op->alg,
+                                            op->input, op->input_length,
+                                            op->input2, op->input2_length,
+                                            op->output, op->output_size,
+                                            &op->output_length ) );
+        case PSA_ASYNC_RAW_KEY_AGREEMENT:
+            return( psa_raw_key_agreement( op->alg, op->key,
+                                           op->input2, op->input2_length,
+                                           op->output, op->output_size,
+                                           &op->output_length ) );
+        case PSA_ASYNC_AEAD_ENCRYPT:
+            return( psa_aead_encrypt( op->key, op->alg,
+                                      op->input2, op->input2_length,
+                                      op->input3, op->input3_length,
+                                      op->input, op->input_length,
+                                      op->output, op->output_size,
+                                      &op->output_length ) );
+        case PSA_ASYNC_AEAD_DECRYPT:
+            return( psa_aead_decrypt( op->key, op->alg,
+                                      op->input2, op->input2_length,
+                                      op->input3, op->input3_length,
+                                      op->input, op->input_length,
+                                      op->output, op->output_size,
+                                      &op->output_length ) );
+        default:
+            return( PSA_ERROR_CORRUPTION_DETECTED );
+    }
+}
+
+/*
+ * Take the oldest queued operation and the following operations on the
+ * same key off the queue, up to the worker's share of the queue. Must be
+ * called with the queue mutex held and a non-empty queue.
+ */
+static mbedtls_psa_async_op *psa_async_take_batch(
+    mbedtls_psa_async_queue *queue )
+{
+    mbedtls_psa_async_op *batch = queue->head;
+    mbedtls_psa_async_op *batch_tail = batch;
+    mbedtls_psa_async_op **p;
+    mbedtls_psa_async_op *prev = NULL;
+    size_t count = 1;
+    size_t max = ( queue->queued + queue->worker_count - 1 ) /
+                 queue->worker_count;
+
+    if( max > MBEDTLS_PSA_ASYNC_BATCH_MAX )
+        max = MBEDTLS_PSA_ASYNC_BATCH_MAX;
+
+    queue->head = batch->next;
+
+    /* Scan the rest of the queue, unlinking operations on the same key.
+     * p always points to the link to the operation being examined and
+     * prev to the last operation that stays queued. */
+    p = &queue->head;
+    while( *p != NULL && count < max )
+    {
+        mbedtls_psa_async_op *op = *p;
+        if( mbedtls_svc_key_id_equal( op->key, batch->key ) )
+        {
+            *p = op->next;
+            batch_tail->next = op;
+            batch_tail = op;
+            count++;
+        }
+        else
+        {
+            prev = op;
+            p = &op->next;
+        }
+    }
+    batch_tail->next = NULL;
+    queue->queued -= count;
+
+    /* Fix up the tail if we took the last queued operations. */
+    if( queue->head == NULL )
+        queue->tail = NULL;
+    else if( *p == NULL )
+        queue->tail = prev;
+
+    return( batch );
+}
+
+static void *psa_async_worker( void *arg )
+{
+    mbedtls_psa_async_queue *queue = arg;
+    mbedtls_psa_async_op *op, *next;
+    mbedtls_psa_async_cb_t *cb;
+    void *cb_ctx;
+    psa_status_t status;
+    size_t output_length;
+
+    pthread_mutex_lock( &queue->mutex );
+    for( ;; )
+    {
+        while( queue->head == NULL && ! queue->stopping )
+            pthread_cond_wait( &queue->work, &queue->mutex );
+        /* Finish the queued operations before stopping. */
+        if( queue->head == NULL )
+            break;
+
+        op = psa_async_take_batch( queue );
+        pthread_mutex_unlock( &queue->mutex );
+
+        for( ; op != NULL; op = next )
+        {
+            next = op->next;
+            status = psa_async_execute( op );
+            if( op->cb != NULL )
+            {
+                /* The callback may free the operation object. */
+                cb = op->cb;
+                cb_ctx = op->cb_ctx;
+                output_length = status == PSA_SUCCESS ? op->output_length : 0;
+                cb( cb_ctx, status, output_length );
+            }
+            else
+            {
+                pthread_mutex_lock( &queue->mutex );
+                op->status = status;
+                op->done = 1;
+                pthread_cond_broadcast( &queue->done );
+                pthread_mutex_unlock( &queue->mutex );
+            }
+        }
+
+        pthread_mutex_lock( &queue->mutex );
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    return( NULL );
+}
+
+void mbedtls_psa_async_init( mbedtls_psa_async_queue *queue )
+{
+    memset( queue, 0, sizeof( *queue ) );
+    pthread_mutex_init( &queue->mutex, NULL );
+    pthread_cond_init( &queue->work, NULL );
+    pthread_cond_init( &queue->done, NULL );
+}
+
+psa_status_t mbedtls_psa_async_setup( mbedtls_psa_async_queue *queue,
+                                      size_t workers )
+{
+    size_t i;
+
+    if( workers == 0 )
+        return( PSA_ERROR_INVALID_ARGUMENT );
+    if( queue->workers != NULL )
+        return( PSA_ERROR_BAD_STATE );
+
+    queue->workers = mbedtls_calloc( workers, sizeof( pthread_t ) );
+    if( queue->workers == NULL )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+
+    for( i = 0; i < workers; i++ )
+    {
+        if( pthread_create( &queue->workers[i], NULL,
+                            psa_async_worker, queue ) != 0 )
+        {
+            /* Stop the workers that did start. */
+            queue->worker_count = i;
+            mbedtls_psa_async_free( queue );
+            mbedtls_psa_async_init( queue );
+            return( PSA_ERROR_INSUFFICIENT_MEMORY );
+        }
+    }
+    queue->worker_count = workers;
+
+    return( PSA_SUCCESS );
+}
+
+void mbedtls_psa_async_free( mbedtls_psa_async_queue *queue )
+{
+    size_t i;
+
+    if( queue == NULL )
+        return;
+
+    pthread_mutex_lock( &queue->mutex );
+    queue->stopping = 1;
+    pthread_cond_broadcast( &queue->work );
+    pthread_mutex_unlock( &queue->mutex );
+
+    for( i = 0; i < queue->worker_count; i++ )
+        pthread_join( queue->workers[i], NULL );
+    mbedtls_free( queue->workers );
+
+    pthread_cond_destroy( &queue->done );
+    pthread_cond_destroy( &queue->work );
+    pthread_mutex_destroy( &queue->mutex );
+    memset( queue, 0, sizeof( *queue ) );
+}
+
+/*
+ * Fill in the common fields of an operation and append it to the queue.
+ * The caller sets the type-specific fields beforehand.
+ */
+static psa_status_t psa_async_submit( mbedtls_psa_async_queue *queue,
+                                      mbedtls_psa_async_op *op,
+                                      int type,
+                                      mbedtls_svc_key_id_t key,
+                                      psa_algorithm_t alg,
+                                      mbedtls_psa_async_cb_t *cb,
+                                      void *cb_ctx )
+{
+    psa_status_t status = PSA_SUCCESS;
+
+    op->type = type;
+    op->key = key;
+    op->alg = alg;
+    op->output_length = 0;
+    op->status = PSA_ERROR_BAD_STATE;
+    op->done = 0;
+    op->cb = cb;
+    op->cb_ctx = cb_ctx;
+    op->queue = queue;
+    op->next = NULL;
+
+    pthread_mutex_lock( &queue->mutex );
+    if( queue->worker_count == 0 || queue->stopping )
+    {
+        status = PSA_ERROR_BAD_STATE;
+    }
+    else
+    {
+        if( queue->tail == NULL )
+            queue->head = op;
+        else
+            queue->tail->next = op;
+        queue->tail = op;
+        queue->queued++;
+        pthread_cond_signal( &queue->work );
+    }
+    pthread_mutex_unlock( &queue->mutex );
+
+    return( status );
+}
+
+psa_status_t mbedtls_psa_async_sign_hash( mbedtls_psa_async_queue *queue,
+                                          mbedtls_psa_async_op *op,
+                                          mbedtls_svc_key_id_t key,
+                                          psa_algorithm_t alg,
+                                          const uint8_t *hash,
+                                          size_t hash_length,
+                                          uint8_t *signature,
+                                          size_t signature_size,
+                                          mbedtls_psa_async_cb_t *cb,
+                                          void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input = hash;
+    op->input_length = hash_length;
+    op->output = signature;
+    op->output_size = signature_size;
+    return( psa_async_submit( queue, op, PSA_ASYNC_SIGN_HASH,
+                              key, alg, cb, cb_ctx ) );
+}
+
+psa_status_t mbedtls_psa_async_verify_hash( mbedtls_psa_async_queue *queue,
+                                            mbedtls_psa_async_op *op,
+                                            mbedtls_svc_key_id_t key,
+                                            psa_algorithm_t alg,
+                                            const uint8_t *hash,
+                                            size_t hash_length,
+                                            const uint8_t *signature,
+                                            size_t signature_length,
+                                            mbedtls_psa_async_cb_t *cb,
+                                            void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input = hash;
+    op->input_length = hash_length;
+    op->input2 = signature;
+    op->input2_length = signature_length;
+    return( psa_async_submit( queue, op, PSA_ASYNC_VERIFY_HASH,
+                              key, alg, cb, cb_ctx ) );
+}
+
+psa_status_t mbedtls_psa_async_asymmetric_decrypt(
+    mbedtls_psa_async_queue *queue,
+    mbedtls_psa_async_op *op,
+    mbedtls_svc_key_id_t key,
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    const uint8_t *salt,
+    size_t salt_length,
+    uint8_t *output,
+    size_t output_size,
+    mbedtls_psa_async_cb_t *cb,
+    void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input = input;
+    op->input_length = input_length;
+    op->input2 = salt;
+    op->input2_length = salt_length;
+    op->output = output;
+    op->output_size = output_size;
+    return( psa_async_submit( queue, op, PSA_ASYNC_ASYMMETRIC_DECRYPT,
+                              key, alg, cb, cb_ctx ) );
+}
+
+psa_status_t mbedtls_psa_async_raw_key_agreement(
+    mbedtls_psa_async_queue *queue,
+    mbedtls_psa_async_op *op,
+    psa_algorithm_t alg,
+    mbedtls_svc_key_id_t private_key,
+    const uint8_t *peer_key,
+    size_t peer_key_length,
+    uint8_t *output,
+    size_t output_size,
+    mbedtls_psa_async_cb_t *cb,
+    void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input2 = peer_key;
+    op->input2_length = peer_key_length;
+    op->output = output;
+    op->output_size = output_size;
+    return( psa_async_submit( queue, op, PSA_ASYNC_RAW_KEY_AGREEMENT,
+                              private_key, alg, cb, cb_ctx ) );
+}
+
+psa_status_t mbedtls_psa_async_aead_encrypt( mbedtls_psa_async_queue *queue,
+                                             mbedtls_psa_async_op *op,
+                                             mbedtls_svc_key_id_t key,
+                                             psa_algorithm_t alg,
+                                             const uint8_t *nonce,
+                                             size_t nonce_length,
+                                             const uint8_t *additional_data,
+                                             size_t additional_data_length,
+                                             const uint8_t *plaintext,
+                                             size_t plaintext_length,
+                                             uint8_t *ciphertext,
+                                             size_t ciphertext_size,
+                                             mbedtls_psa_async_cb_t *cb,
+                                             void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input = plaintext;
+    op->input_length = plaintext_length;
+    op->input2 = nonce;
+    op->input2_length = nonce_length;
+    op->input3 = additional_data;
+    op->input3_length = additional_data_length;
+    op->output = ciphertext;
+    op->output_size = ciphertext_size;
+    return( psa_async_submit( queue, op, PSA_ASYNC_AEAD_ENCRYPT,
+                              key, alg, cb, cb_ctx ) );
+}
+
+psa_status_t mbedtls_psa_async_aead_decrypt( mbedtls_psa_async_queue *queue,
+                                             mbedtls_psa_async_op *op,
+                                             mbedtls_svc_key_id_t key,
+                                             psa_algorithm_t alg,
+                                             const uint8_t *nonce,
+                                             size_t nonce_length,
+                                             const uint8_t *additional_data,
+                                             size_t additional_data_length,
+                                             const uint8_t *ciphertext,
+                                             size_t ciphertext_length,
+                                             uint8_t *plaintext,
+                                             size_t plaintext_size,
+                                             mbedtls_psa_async_cb_t *cb,
+                                             void *cb_ctx )
+{
+    memset( op, 0, sizeof( *op ) );
+    op->input = ciphertext;
+    op->input_length = ciphertext_length;
+    op->input2 = nonce;
+    op->input2_length = nonce_length;
+    op->input3 = additional_data;
+    op->input3_length = additional_data_length;
+    op->output = plaintext;
+    op->output_size = plaintext_size;
+    return( psa_async_submit( queue, op, PSA_ASYNC_AEAD_DECRYPT,
+                              key, alg, cb, cb_ctx ) );
+}
+
+int mbedtls_psa_async_poll( mbedtls_psa_async_op *op,
+                            psa_status_t *status,
+                            size_t *output_length )
+{
+    int done;
+
+    pthread_mutex_lock( &op->queue->mutex );
+    done = op->done;
+    pthread_mutex_unlock( &op->queue->mutex );
+
+    if( done )
+    {
+        *status = op->status;
+        if( output_length != NULL )
+            *output_length = op->status == PSA_SUCCESS ? op->output_length : 0;
+    }
+    return( done );
+}
+
+psa_status_t mbedtls_psa_async_wait( mbedtls_psa_async_op *op,
+                                     size_t *output_length )
+{
+    pthread_mutex_lock( &op->queue->mutex );
+    while( ! op->done )
+        pthread_cond_wait( &op->queue->done, &op->queue->mutex );
+    pthread_mutex_unlock( &op->queue->mutex );
+
+    if( output_length != NULL )
+        *output_length = op->status == PSA_SUCCESS ? op->output_length : 0;
+    return( op->status );
+}
+
+#endif /* MBEDTLS_PSA_ASYNC_C */
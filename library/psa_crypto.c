@@ -32,6 +32,7 @@
 #include "psa_crypto_core.h"
 #include "psa_crypto_invasive.h"
 #include "psa_crypto_driver_wrappers.h"
+#include "psa_crypto_driver_wrappers_inline.h"
 #include "psa_crypto_ecp.h"
 #include "psa_crypto_hash.h"
 #include "psa_crypto_mac.h"
@@ -41,9 +42,13 @@
 #include "psa_crypto_se.h"
 #endif
 #include "psa_crypto_slot_management.h"
+#include "psa_crypto_stats.h"
 /* Include internal declarations that are useful for implementing persistently
  * stored keys. */
 #include "psa_crypto_storage.h"
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+#include "psa_crypto_its.h"
+#endif
 
 #include "psa_crypto_random_impl.h"
 
@@ -110,7 +115,8 @@ typedef struct
 
 static psa_global_data_t global_data;
 
-#if !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+#if !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) && \
+    !defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
 mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state =
     &global_data.rng.drbg;
 #endif
@@ -1005,9 +1011,9 @@ psa_status_t psa_wipe_key_slot( psa_key_slot_t *slot )
      * phase, they have a copy of the key. Note that this means that
      * key material can linger until all operations are completed. */
     /* At this point, key material and other type-specific content has
-     * been wiped. Clear remaining metadata. We can call memset and not
-     * zeroize because the metadata is not particularly sensitive. */
-    memset( slot, 0, sizeof( *slot ) );
+     * been wiped. Clear remaining metadata and make the slot available
+     * again. */
+    psa_free_key_slot( slot );
     return( status );
 }
 
@@ -1039,12 +1045,24 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
      * library (apart from the present access), the key cannot be destroyed
      * yet. For the time being, just return in error. Eventually (to be
      * implemented), the key should be destroyed when all accesses have
-     * stopped.
+     * stopped. Otherwise, hide the key from lookups while it is destroyed.
      */
+    status = psa_lock_key_store( );
+    if( status != PSA_SUCCESS )
+    {
+        psa_unlock_key_slot( slot );
+        return( status );
+    }
     if( slot->lock_count > 1 )
+        status = PSA_ERROR_GENERIC_ERROR;
+    else
+        slot->state = PSA_SLOT_PENDING_DELETION;
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+    if( status != PSA_SUCCESS )
     {
-       psa_unlock_key_slot( slot );
-       return( PSA_ERROR_GENERIC_ERROR );
+        psa_unlock_key_slot( slot );
+        return( status );
     }
 
     if( PSA_KEY_LIFETIME_IS_READ_ONLY( slot->attr.lifetime ) )
@@ -1120,7 +1138,13 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
 
 exit:
-    status = psa_wipe_key_slot( slot );
+    status = psa_lock_key_store( );
+    if( status == PSA_SUCCESS )
+    {
+        status = psa_wipe_key_slot( slot );
+        if( psa_unlock_key_store( ) != PSA_SUCCESS )
+            status = PSA_ERROR_BAD_STATE;
+    }
     /* Prioritize CORRUPTION_DETECTED from wiping over a storage error */
     if( status != PSA_SUCCESS )
         overall_status = status;
@@ -1579,9 +1603,16 @@ static psa_status_t psa_start_key_creation(
     if( status != PSA_SUCCESS )
         return( status );
 
+    status = psa_lock_key_store( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
     status = psa_get_empty_key_slot( &volatile_key_id, p_slot );
     if( status != PSA_SUCCESS )
+    {
+        (void) psa_unlock_key_store( );
         return( status );
+    }
     slot = *p_slot;
 
     /* We're storing the declared bit-size of the key. It's up to each
@@ -1601,6 +1632,20 @@ static psa_status_t psa_start_key_creation(
         slot->attr.id.key_id = volatile_key_id;
 #endif
     }
+    else
+    {
+        /* Reserve the key identifier, so that the key cannot be created
+         * twice concurrently. */
+        status = psa_index_key_slot( slot );
+    }
+
+    /* The rest of the key creation happens without holding the key store
+     * lock. The key cannot be found until psa_finish_key_creation()
+     * succeeds. */
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+    if( status != PSA_SUCCESS )
+        return( status );
 
     /* Erase external-only flags from the internal copy. To access
      * external-only flags, query `attributes`. Thanks to the check
@@ -1756,7 +1801,7 @@ static psa_status_t psa_finish_key_creation(
     if( status == PSA_SUCCESS )
     {
         *key = slot->attr.id;
-        status = psa_unlock_key_slot( slot );
+        status = psa_unlock_filled_key_slot( slot );
         if( status != PSA_SUCCESS )
             *key = MBEDTLS_SVC_KEY_ID_INIT;
     }
@@ -1801,7 +1846,10 @@ static void psa_fail_key_creation( psa_key_slot_t *slot,
     (void) psa_crypto_stop_transaction( );
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
 
+    if( psa_lock_key_store( ) != PSA_SUCCESS )
+        return;
     psa_wipe_key_slot( slot );
+    (void) psa_unlock_key_store( );
 }
 
 /** Validate optional attributes during key creation.
@@ -2110,6 +2158,7 @@ psa_status_t psa_hash_abort( psa_hash_operation_t *operation )
 
     psa_status_t status = psa_driver_wrapper_hash_abort( operation );
     operation->id = 0;
+    PSA_STATS_SET_ALG( operation, 0 );
 
     return( status );
 }
@@ -2137,6 +2186,7 @@ psa_status_t psa_hash_setup( psa_hash_operation_t *operation,
     memset( &operation->ctx, 0, sizeof( operation->ctx ) );
 
     status = psa_driver_wrapper_hash_setup( operation, alg );
+    PSA_STATS_SET_ALG( operation, alg );
 
 exit:
     if( status != PSA_SUCCESS )
@@ -2150,6 +2200,7 @@ psa_status_t psa_hash_update( psa_hash_operation_t *operation,
                               size_t input_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     if( operation->id == 0 )
     {
@@ -2160,11 +2211,16 @@ psa_status_t psa_hash_update( psa_hash_operation_t *operation,
     /* Don't require hash implementations to behave correctly on a
      * zero-length input, which may have an invalid pointer. */
     if( input_length == 0 )
-        return( PSA_SUCCESS );
+    {
+        status = PSA_SUCCESS;
+        goto exit;
+    }
 
     status = psa_driver_wrapper_hash_update( operation, input, input_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_HASH_UPDATE, operation->stats_alg,
+                      operation->id, input_length, status, stats_start );
     if( status != PSA_SUCCESS )
         psa_hash_abort( operation );
 
@@ -2176,12 +2232,22 @@ psa_status_t psa_hash_finish( psa_hash_operation_t *operation,
                               size_t hash_size,
                               size_t *hash_length )
 {
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
     *hash_length = 0;
     if( operation->id == 0 )
-        return( PSA_ERROR_BAD_STATE );
+    {
+        status = PSA_ERROR_BAD_STATE;
+        goto exit;
+    }
 
-    psa_status_t status = psa_driver_wrapper_hash_finish(
-                            operation, hash, hash_size, hash_length );
+    status = psa_driver_wrapper_hash_finish(
+                 operation, hash, hash_size, hash_length );
+
+exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_HASH_FINISH, operation->stats_alg,
+                      operation->id, 0, status, stats_start );
     psa_hash_abort( operation );
     return( status );
 }
@@ -2222,28 +2288,41 @@ psa_status_t psa_hash_compute( psa_algorithm_t alg,
                                uint8_t *hash, size_t hash_size,
                                size_t *hash_length )
 {
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
     *hash_length = 0;
     if( !PSA_ALG_IS_HASH( alg ) )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+        status = PSA_ERROR_INVALID_ARGUMENT;
+    else
+        status = psa_driver_wrapper_hash_compute( alg, input, input_length,
+                                                  hash, hash_size,
+                                                  hash_length );
 
-    return( psa_driver_wrapper_hash_compute( alg, input, input_length,
-                                             hash, hash_size, hash_length ) );
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_HASH_COMPUTE, alg, 0,
+                      input_length, status, stats_start );
+    return( status );
 }
 
 psa_status_t psa_hash_compare( psa_algorithm_t alg,
                                const uint8_t *input, size_t input_length,
                                const uint8_t *hash, size_t hash_length )
 {
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     uint8_t actual_hash[PSA_HASH_MAX_SIZE];
     size_t actual_hash_length;
+    PSA_STATS_START( stats_start );
 
     if( !PSA_ALG_IS_HASH( alg ) )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
 
-    psa_status_t status = psa_driver_wrapper_hash_compute(
-                            alg, input, input_length,
-                            actual_hash, sizeof(actual_hash),
-                            &actual_hash_length );
+    status = psa_driver_wrapper_hash_compute(
+                 alg, input, input_length,
+                 actual_hash, sizeof(actual_hash),
+                 &actual_hash_length );
     if( status != PSA_SUCCESS )
         goto exit;
     if( actual_hash_length != hash_length )
@@ -2255,6 +2334,8 @@ psa_status_t psa_hash_compare( psa_algorithm_t alg,
         status = PSA_ERROR_INVALID_SIGNATURE;
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_HASH_COMPUTE, alg, 0,
+                      input_length, status, stats_start );
     mbedtls_platform_zeroize( actual_hash, sizeof( actual_hash ) );
     return( status );
 }
@@ -2270,6 +2351,7 @@ psa_status_t psa_hash_clone( const psa_hash_operation_t *source_operation,
 
     psa_status_t status = psa_driver_wrapper_hash_clone( source_operation,
                                                          target_operation );
+    PSA_STATS_SET_ALG( target_operation, source_operation->stats_alg );
     if( status != PSA_SUCCESS )
         psa_hash_abort( target_operation );
 
@@ -2291,6 +2373,7 @@ psa_status_t psa_mac_abort( psa_mac_operation_t *operation )
     operation->mac_size = 0;
     operation->is_sign = 0;
     operation->id = 0;
+    PSA_STATS_SET_ALG( operation, 0 );
 
     return( status );
 }
@@ -2386,6 +2469,7 @@ static psa_status_t psa_mac_setup( psa_mac_operation_t *operation,
                                                       slot->key.bytes,
                                                       alg );
     }
+    PSA_STATS_SET_ALG( operation, alg );
 
 exit:
     if( status != PSA_SUCCESS )
@@ -2414,16 +2498,28 @@ psa_status_t psa_mac_update( psa_mac_operation_t *operation,
                              const uint8_t *input,
                              size_t input_length )
 {
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
     if( operation->id == 0 )
-        return( PSA_ERROR_BAD_STATE );
+    {
+        status = PSA_ERROR_BAD_STATE;
+        goto exit;
+    }
 
     /* Don't require hash implementations to behave correctly on a
      * zero-length input, which may have an invalid pointer. */
     if( input_length == 0 )
-        return( PSA_SUCCESS );
+    {
+        status = PSA_SUCCESS;
+        goto exit;
+    }
 
-    psa_status_t status = psa_driver_wrapper_mac_update( operation,
-                                                         input, input_length );
+    status = psa_driver_wrapper_mac_update( operation, input, input_length );
+
+exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_MAC_UPDATE, operation->stats_alg,
+                      operation->id, input_length, status, stats_start );
     if( status != PSA_SUCCESS )
         psa_mac_abort( operation );
 
@@ -2437,6 +2533,7 @@ psa_status_t psa_mac_sign_finish( psa_mac_operation_t *operation,
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t abort_status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     if( operation->id == 0 )
     {
@@ -2469,6 +2566,9 @@ psa_status_t psa_mac_sign_finish( psa_mac_operation_t *operation,
                                                  mac_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_MAC_FINISH, operation->stats_alg,
+                      operation->id, 0, status, stats_start );
+
     /* In case of success, set the potential excess room in the output buffer
      * to an invalid value, to avoid potentially leaking a longer MAC.
      * In case of error, set the output length and content to a safe default,
@@ -2496,6 +2596,7 @@ psa_status_t psa_mac_verify_finish( psa_mac_operation_t *operation,
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t abort_status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     if( operation->id == 0 )
     {
@@ -2519,6 +2620,8 @@ psa_status_t psa_mac_verify_finish( psa_mac_operation_t *operation,
                                                    mac, mac_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_MAC_FINISH, operation->stats_alg,
+                      operation->id, 0, status, stats_start );
     abort_status = psa_mac_abort( operation );
 
     return( status == PSA_SUCCESS ? abort_status : status );
@@ -2596,9 +2699,16 @@ psa_status_t psa_mac_compute( mbedtls_svc_key_id_t key,
                               size_t mac_size,
                               size_t *mac_length)
 {
-    return( psa_mac_compute_internal( key, alg,
-                                      input, input_length,
-                                      mac, mac_size, mac_length, 1 ) );
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_mac_compute_internal( key, alg,
+                                       input, input_length,
+                                       mac, mac_size, mac_length, 1 );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_MAC_COMPUTE, alg, 0,
+                      input_length, status, stats_start );
+    return( status );
 }
 
 psa_status_t psa_mac_verify( mbedtls_svc_key_id_t key,
@@ -2611,6 +2721,7 @@ psa_status_t psa_mac_verify( mbedtls_svc_key_id_t key,
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     uint8_t actual_mac[PSA_MAC_MAX_SIZE];
     size_t actual_mac_length;
+    PSA_STATS_START( stats_start );
 
     status = psa_mac_compute_internal( key, alg,
                                        input, input_length,
@@ -2631,6 +2742,8 @@ psa_status_t psa_mac_verify( mbedtls_svc_key_id_t key,
     }
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_MAC_VERIFY, alg, 0,
+                      input_length, status, stats_start );
     mbedtls_platform_zeroize( actual_mac, sizeof( actual_mac ) );
 
     return ( status );
@@ -2836,9 +2949,16 @@ psa_status_t psa_sign_message( mbedtls_svc_key_id_t key,
                                size_t signature_size,
                                size_t * signature_length )
 {
-    return psa_sign_internal(
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_sign_internal(
         key, 1, alg, input, input_length,
         signature, signature_size, signature_length );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_SIGN_MESSAGE, alg, 0,
+                      input_length, status, stats_start );
+    return( status );
 }
 
 psa_status_t psa_verify_message_builtin(
@@ -2882,9 +3002,16 @@ psa_status_t psa_verify_message( mbedtls_svc_key_id_t key,
                                  const uint8_t * signature,
                                  size_t signature_length )
 {
-    return psa_verify_internal(
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_verify_internal(
         key, 1, alg, input, input_length,
         signature, signature_length );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_VERIFY_MESSAGE, alg, 0,
+                      input_length, status, stats_start );
+    return( status );
 }
 
 psa_status_t psa_sign_hash_builtin(
@@ -2952,9 +3079,16 @@ psa_status_t psa_sign_hash( mbedtls_svc_key_id_t key,
                             size_t signature_size,
                             size_t *signature_length )
 {
-    return psa_sign_internal(
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_sign_internal(
         key, 0, alg, hash, hash_length,
         signature, signature_size, signature_length );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_SIGN_HASH, alg, 0,
+                      hash_length, status, stats_start );
+    return( status );
 }
 
 psa_status_t psa_verify_hash_builtin(
@@ -3020,9 +3154,16 @@ psa_status_t psa_verify_hash( mbedtls_svc_key_id_t key,
                               const uint8_t *signature,
                               size_t signature_length )
 {
-    return psa_verify_internal(
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_verify_internal(
         key, 0, alg, hash, hash_length,
         signature, signature_length );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_VERIFY_HASH, alg, 0,
+                      hash_length, status, stats_start );
+    return( status );
 }
 
 #if defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP)
@@ -3049,7 +3190,8 @@ psa_status_t psa_asymmetric_encrypt( mbedtls_svc_key_id_t key,
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
-    psa_key_slot_t *slot;
+    psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     (void) input;
     (void) input_length;
@@ -3060,12 +3202,15 @@ psa_status_t psa_asymmetric_encrypt( mbedtls_svc_key_id_t key,
     *output_length = 0;
 
     if( ! PSA_ALG_IS_RSA_OAEP( alg ) && salt_length != 0 )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
 
     status = psa_get_and_lock_transparent_key_slot_with_policy(
                  key, &slot, PSA_KEY_USAGE_ENCRYPT, alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
     if( ! ( PSA_KEY_TYPE_IS_PUBLIC_KEY( slot->attr.type ) ||
             PSA_KEY_TYPE_IS_KEY_PAIR( slot->attr.type ) ) )
     {
@@ -3148,6 +3293,8 @@ rsa_exit:
     }
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_ASYMMETRIC_ENCRYPT, alg, 0,
+                      input_length, status, stats_start );
     unlock_status = psa_unlock_key_slot( slot );
 
     return( ( status == PSA_SUCCESS ) ? unlock_status : status );
@@ -3165,7 +3312,8 @@ psa_status_t psa_asymmetric_decrypt( mbedtls_svc_key_id_t key,
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
-    psa_key_slot_t *slot;
+    psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     (void) input;
     (void) input_length;
@@ -3176,12 +3324,15 @@ psa_status_t psa_asymmetric_decrypt( mbedtls_svc_key_id_t key,
     *output_length = 0;
 
     if( ! PSA_ALG_IS_RSA_OAEP( alg ) && salt_length != 0 )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
 
     status = psa_get_and_lock_transparent_key_slot_with_policy(
                  key, &slot, PSA_KEY_USAGE_DECRYPT, alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
     if( ! PSA_KEY_TYPE_IS_KEY_PAIR( slot->attr.type ) )
     {
         status = PSA_ERROR_INVALID_ARGUMENT;
@@ -3264,6 +3415,8 @@ rsa_exit:
     }
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_ASYMMETRIC_DECRYPT, alg, 0,
+                      input_length, status, stats_start );
     unlock_status = psa_unlock_key_slot( slot );
 
     return( ( status == PSA_SUCCESS ) ? unlock_status : status );
@@ -3332,6 +3485,7 @@ static psa_status_t psa_cipher_setup( psa_cipher_operation_t *operation,
                                                           slot->key.data,
                                                           slot->key.bytes,
                                                           alg );
+    PSA_STATS_SET_ALG( operation, alg );
 
 exit:
     if( status != PSA_SUCCESS )
@@ -3457,6 +3611,7 @@ psa_status_t psa_cipher_update( psa_cipher_operation_t *operation,
                                 size_t *output_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     if( operation->id == 0 )
     {
@@ -3478,6 +3633,8 @@ psa_status_t psa_cipher_update( psa_cipher_operation_t *operation,
                                                output_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_CIPHER_UPDATE, operation->stats_alg,
+                      operation->id, input_length, status, stats_start );
     if( status != PSA_SUCCESS )
         psa_cipher_abort( operation );
 
@@ -3490,6 +3647,7 @@ psa_status_t psa_cipher_finish( psa_cipher_operation_t *operation,
                                 size_t *output_length )
 {
     psa_status_t status = PSA_ERROR_GENERIC_ERROR;
+    PSA_STATS_START( stats_start );
 
     if( operation->id == 0 )
     {
@@ -3509,6 +3667,8 @@ psa_status_t psa_cipher_finish( psa_cipher_operation_t *operation,
                                                output_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_CIPHER_FINISH, operation->stats_alg,
+                      operation->id, 0, status, stats_start );
     if( status == PSA_SUCCESS )
         return( psa_cipher_abort( operation ) );
     else
@@ -3535,6 +3695,7 @@ psa_status_t psa_cipher_abort( psa_cipher_operation_t *operation )
     operation->id = 0;
     operation->iv_set = 0;
     operation->iv_required = 0;
+    PSA_STATS_SET_ALG( operation, 0 );
 
     return( PSA_SUCCESS );
 }
@@ -3552,6 +3713,7 @@ psa_status_t psa_cipher_encrypt( mbedtls_svc_key_id_t key,
     psa_key_slot_t *slot = NULL;
     uint8_t local_iv[PSA_CIPHER_IV_MAX_SIZE];
     size_t default_iv_length = 0;
+    PSA_STATS_START( stats_start );
 
     if( ! PSA_ALG_IS_CIPHER( alg ) )
     {
@@ -3609,6 +3771,8 @@ exit:
     else
         *output_length = 0;
 
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_CIPHER_ENCRYPT, alg, 0,
+                      input_length, status, stats_start );
     return( status );
 }
 
@@ -3623,6 +3787,7 @@ psa_status_t psa_cipher_decrypt( mbedtls_svc_key_id_t key,
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     if( ! PSA_ALG_IS_CIPHER( alg ) )
     {
@@ -3664,6 +3829,8 @@ exit:
     if( status != PSA_SUCCESS )
         *output_length = 0;
 
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_CIPHER_DECRYPT, alg, 0,
+                      input_length, status, stats_start );
     return( status );
 }
 
@@ -3740,18 +3907,19 @@ psa_status_t psa_aead_encrypt( mbedtls_svc_key_id_t key,
                                size_t *ciphertext_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    psa_key_slot_t *slot;
+    psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     *ciphertext_length = 0;
 
     status = psa_aead_check_algorithm( alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
 
     status = psa_get_and_lock_key_slot_with_policy(
                  key, &slot, PSA_KEY_USAGE_ENCRYPT, alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
 
     psa_key_attributes_t attributes = {
       .core = slot->attr
@@ -3773,6 +3941,8 @@ psa_status_t psa_aead_encrypt( mbedtls_svc_key_id_t key,
         memset( ciphertext, 0, ciphertext_size );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_AEAD_ENCRYPT, alg, 0,
+                      plaintext_length, status, stats_start );
     psa_unlock_key_slot( slot );
 
     return( status );
@@ -3791,18 +3961,19 @@ psa_status_t psa_aead_decrypt( mbedtls_svc_key_id_t key,
                                size_t *plaintext_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    psa_key_slot_t *slot;
+    psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     *plaintext_length = 0;
 
     status = psa_aead_check_algorithm( alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
 
     status = psa_get_and_lock_key_slot_with_policy(
                  key, &slot, PSA_KEY_USAGE_DECRYPT, alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
 
     psa_key_attributes_t attributes = {
       .core = slot->attr
@@ -3824,6 +3995,8 @@ psa_status_t psa_aead_decrypt( mbedtls_svc_key_id_t key,
         memset( plaintext, 0, plaintext_size );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_AEAD_DECRYPT, alg, 0,
+                      ciphertext_length, status, stats_start );
     psa_unlock_key_slot( slot );
 
     return( status );
@@ -4191,6 +4364,7 @@ psa_status_t psa_aead_update( psa_aead_operation_t *operation,
                               size_t *output_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     *output_length = 0;
 
@@ -4238,6 +4412,8 @@ psa_status_t psa_aead_update( psa_aead_operation_t *operation,
                                              output_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_AEAD_UPDATE, operation->alg,
+                      operation->id, input_length, status, stats_start );
     if( status == PSA_SUCCESS )
         operation->body_started = 1;
     else
@@ -4268,6 +4444,7 @@ psa_status_t psa_aead_finish( psa_aead_operation_t *operation,
                               size_t *tag_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     *ciphertext_length = 0;
     *tag_length = tag_size;
@@ -4301,6 +4478,8 @@ exit:
             memset( tag + *tag_length, '!', ( tag_size - *tag_length ) );
     }
 
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_AEAD_FINISH, operation->alg,
+                      operation->id, 0, status, stats_start );
     psa_aead_abort( operation );
 
     return( status );
@@ -4316,6 +4495,7 @@ psa_status_t psa_aead_verify( psa_aead_operation_t *operation,
                               size_t tag_length )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
 
     *plaintext_length = 0;
 
@@ -4335,6 +4515,8 @@ psa_status_t psa_aead_verify( psa_aead_operation_t *operation,
                                              tag, tag_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_AEAD_VERIFY, operation->alg,
+                      operation->id, 0, status, stats_start );
     psa_aead_abort( operation );
 
     return( status );
@@ -5503,14 +5685,19 @@ psa_status_t psa_key_derivation_key_agreement( psa_key_derivation_operation_t *o
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
-    psa_key_slot_t *slot;
+    psa_key_slot_t *slot = NULL;
+    psa_algorithm_t alg = operation->alg;
+    PSA_STATS_START( stats_start );
 
-    if( ! PSA_ALG_IS_KEY_AGREEMENT( operation->alg ) )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    if( ! PSA_ALG_IS_KEY_AGREEMENT( alg ) )
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
     status = psa_get_and_lock_transparent_key_slot_with_policy(
-                 private_key, &slot, PSA_KEY_USAGE_DERIVE, operation->alg );
+                 private_key, &slot, PSA_KEY_USAGE_DERIVE, alg );
     if( status != PSA_SUCCESS )
-        return( status );
+        goto exit;
     status = psa_key_agreement_internal( operation, step,
                                          slot,
                                          peer_key, peer_key_length );
@@ -5524,6 +5711,9 @@ psa_status_t psa_key_derivation_key_agreement( psa_key_derivation_operation_t *o
             operation->can_output_key = 1;
     }
 
+exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_KEY_AGREEMENT, alg, 0,
+                      peer_key_length, status, stats_start );
     unlock_status = psa_unlock_key_slot( slot );
 
     return( ( status == PSA_SUCCESS ) ? unlock_status : status );
@@ -5540,6 +5730,7 @@ psa_status_t psa_raw_key_agreement( psa_algorithm_t alg,
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_slot_t *slot = NULL;
+    PSA_STATS_START( stats_start );
 
     if( ! PSA_ALG_IS_KEY_AGREEMENT( alg ) )
     {
@@ -5557,6 +5748,8 @@ psa_status_t psa_raw_key_agreement( psa_algorithm_t alg,
                                              output_length );
 
 exit:
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_KEY_AGREEMENT, alg, 0,
+                      peer_key_length, status, stats_start );
     if( status != PSA_SUCCESS )
     {
         /* If an error happens and is not handled properly, the output
@@ -5581,6 +5774,95 @@ exit:
 /* Random generation */
 /****************************************************************/
 
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+/** Free the DRBG of a thread.
+ *
+ * This is the destructor associated with the thread-specific data key,
+ * so it runs when a thread that has used the PSA random generator exits.
+ * It does nothing if mbedtls_psa_crypto_free() has already freed the DRBG.
+ */
+static void psa_thread_drbg_free( void *data )
+{
+    mbedtls_psa_thread_drbg_t *thread_drbg = data;
+    mbedtls_psa_thread_drbg_t **p;
+
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_rngdata_mutex ) != 0 )
+        return;
+
+    for( p = &global_data.rng.threads; *p != NULL; p = &( *p )->next )
+    {
+        if( *p == thread_drbg )
+        {
+            *p = thread_drbg->next;
+            mbedtls_psa_drbg_free( &thread_drbg->drbg );
+            mbedtls_free( thread_drbg );
+            break;
+        }
+    }
+
+    mbedtls_mutex_unlock( &mbedtls_threading_psa_rngdata_mutex );
+}
+
+/** Get the DRBG of the calling thread, creating and seeding it
+ * from the shared entropy context if this is the first time that the
+ * thread needs random data.
+ *
+ * \param[in] rng       The PSA random generator context.
+ * \param[out] p_drbg   On success, the DRBG of the calling thread.
+ *
+ * \return              \c 0 on success.
+ * \return              An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
+ */
+static int psa_get_thread_drbg( mbedtls_psa_random_context_t *rng,
+                                mbedtls_psa_drbg_context_t **p_drbg )
+{
+    const unsigned char drbg_seed[] = "PSA thread";
+    mbedtls_psa_thread_drbg_t *thread_drbg;
+    int ret;
+
+    thread_drbg = pthread_getspecific( rng->thread_key );
+    if( thread_drbg != NULL )
+    {
+        *p_drbg = &thread_drbg->drbg;
+        return( 0 );
+    }
+
+    thread_drbg = mbedtls_calloc( 1, sizeof( *thread_drbg ) );
+    if( thread_drbg == NULL )
+        return( MBEDTLS_ERR_ENTROPY_SOURCE_FAILED );
+
+    /* Seeding reads from the shared entropy context, which has its own
+     * mutex. */
+    mbedtls_psa_drbg_init( &thread_drbg->drbg );
+    ret = mbedtls_psa_drbg_seed( &thread_drbg->drbg, &rng->entropy,
+                                 drbg_seed, sizeof( drbg_seed ) - 1 );
+    if( ret != 0 )
+        goto error;
+
+    ret = mbedtls_mutex_lock( &mbedtls_threading_psa_rngdata_mutex );
+    if( ret != 0 )
+        goto error;
+    thread_drbg->next = rng->threads;
+    rng->threads = thread_drbg;
+    ret = mbedtls_mutex_unlock( &mbedtls_threading_psa_rngdata_mutex );
+    if( ret != 0 )
+        return( ret );
+
+    /* If this fails, the DRBG stays in the list and is freed by
+     * mbedtls_psa_crypto_free(). */
+    if( pthread_setspecific( rng->thread_key, thread_drbg ) != 0 )
+        return( MBEDTLS_ERR_ENTROPY_SOURCE_FAILED );
+
+    *p_drbg = &thread_drbg->drbg;
+    return( 0 );
+
+error:
+    mbedtls_psa_drbg_free( &thread_drbg->drbg );
+    mbedtls_free( thread_drbg );
+    return( ret );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+
 /** Initialize the PSA random generator.
  */
 static void mbedtls_psa_random_init( mbedtls_psa_random_context_t *rng )
@@ -5607,7 +5889,12 @@ static void mbedtls_psa_random_init( mbedtls_psa_random_context_t *rng )
                                 MBEDTLS_ENTROPY_SOURCE_STRONG );
 #endif
 
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    rng->thread_key_created = 0;
+    rng->threads = NULL;
+#else
     mbedtls_psa_drbg_init( MBEDTLS_PSA_RANDOM_STATE );
+#endif
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
 
@@ -5618,7 +5905,27 @@ static void mbedtls_psa_random_free( mbedtls_psa_random_context_t *rng )
 #if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
     memset( rng, 0, sizeof( *rng ) );
 #else /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    mbedtls_psa_thread_drbg_t *thread_drbg;
+
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_rngdata_mutex ) == 0 )
+    {
+        while( ( thread_drbg = rng->threads ) != NULL )
+        {
+            rng->threads = thread_drbg->next;
+            mbedtls_psa_drbg_free( &thread_drbg->drbg );
+            mbedtls_free( thread_drbg );
+        }
+        mbedtls_mutex_unlock( &mbedtls_threading_psa_rngdata_mutex );
+    }
+    if( rng->thread_key_created )
+    {
+        pthread_key_delete( rng->thread_key );
+        rng->thread_key_created = 0;
+    }
+#else
     mbedtls_psa_drbg_free( MBEDTLS_PSA_RANDOM_STATE );
+#endif
     rng->entropy_free( &rng->entropy );
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
@@ -5631,16 +5938,25 @@ static psa_status_t mbedtls_psa_random_seed( mbedtls_psa_random_context_t *rng )
     /* Do nothing: the external RNG seeds itself. */
     (void) rng;
     return( PSA_SUCCESS );
+#elif defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    mbedtls_psa_drbg_context_t *drbg;
+    if( pthread_key_create( &rng->thread_key, psa_thread_drbg_free ) != 0 )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+    rng->thread_key_created = 1;
+    /* Other threads seed their DRBG on first use. Seed the calling
+     * thread's DRBG now so that a lack of entropy is reported by
+     * psa_crypto_init(). */
+    return( mbedtls_to_psa_error( psa_get_thread_drbg( rng, &drbg ) ) );
 #else /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
     const unsigned char drbg_seed[] = "PSA";
-    int ret = mbedtls_psa_drbg_seed( &rng->entropy,
+    int ret = mbedtls_psa_drbg_seed( MBEDTLS_PSA_RANDOM_STATE, &rng->entropy,
                                      drbg_seed, sizeof( drbg_seed ) - 1 );
     return mbedtls_to_psa_error( ret );
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
 
-psa_status_t psa_generate_random( uint8_t *output,
-                                  size_t output_size )
+static psa_status_t psa_generate_random_internal( uint8_t *output,
+                                                  size_t output_size )
 {
     GUARD_MODULE_INITIALIZED;
 
@@ -5677,6 +5993,19 @@ psa_status_t psa_generate_random( uint8_t *output,
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
 
+psa_status_t psa_generate_random( uint8_t *output,
+                                  size_t output_size )
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    PSA_STATS_START( stats_start );
+
+    status = psa_generate_random_internal( output, output_size );
+
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_GENERATE_RANDOM, 0, 0,
+                      output_size, status, stats_start );
+    return( status );
+}
+
 /* Wrapper function allowing the classic API to use the PSA RNG.
  *
  * `mbedtls_psa_get_random(MBEDTLS_PSA_RANDOM_STATE, ...)` calls
@@ -5709,6 +6038,29 @@ int mbedtls_psa_get_random( void *p_rng,
 }
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+/* With per-thread DRBGs, mbedtls_psa_get_random() looks up the DRBG of
+ * the calling thread and generates from it directly. This does not
+ * take the DRBG mutex, since no other thread uses that DRBG. */
+int mbedtls_psa_get_random( void *p_rng,
+                            unsigned char *output,
+                            size_t output_size )
+{
+    mbedtls_psa_drbg_context_t *drbg;
+    int ret;
+
+    (void) p_rng;
+    if( global_data.rng_state != RNG_SEEDED )
+        return( MBEDTLS_ERR_ENTROPY_SOURCE_FAILED );
+
+    ret = psa_get_thread_drbg( &global_data.rng, &drbg );
+    if( ret != 0 )
+        return( ret );
+
+    return( mbedtls_psa_drbg_random( drbg, output, output_size ) );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+
 #if defined(MBEDTLS_PSA_INJECT_ENTROPY)
 #include "entropy_poll.h"
 
@@ -5843,17 +6195,24 @@ psa_status_t psa_generate_key( const psa_key_attributes_t *attributes,
     psa_key_slot_t *slot = NULL;
     psa_se_drv_table_entry_t *driver = NULL;
     size_t key_buffer_size;
+    PSA_STATS_START( stats_start );
 
     *key = MBEDTLS_SVC_KEY_ID_INIT;
 
     /* Reject any attempt to create a zero-length key so that we don't
      * risk tripping up later, e.g. on a malloc(0) that returns NULL. */
     if( psa_get_key_bits( attributes ) == 0 )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
 
     /* Reject any attempt to create a public key. */
     if( PSA_KEY_TYPE_IS_PUBLIC_KEY(attributes->core.type) )
-        return( PSA_ERROR_INVALID_ARGUMENT );
+    {
+        status = PSA_ERROR_INVALID_ARGUMENT;
+        goto exit;
+    }
 
     status = psa_start_key_creation( PSA_KEY_CREATION_GENERATE, attributes,
                                      &slot, &driver );
@@ -5903,6 +6262,9 @@ exit:
     if( status != PSA_SUCCESS )
         psa_fail_key_creation( slot, driver );
 
+    PSA_STATS_RECORD( MBEDTLS_PSA_STATS_GENERATE_KEY,
+                      psa_get_key_algorithm( attributes ), 0,
+                      0, status, stats_start );
     return( status );
 }
 
@@ -5937,6 +6299,11 @@ void mbedtls_psa_crypto_free( void )
 
     /* Terminate drivers */
     psa_driver_wrapper_free( );
+
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+    /* Release the persistent storage index. */
+    psa_its_log_close( );
+#endif
 }
 
 #if defined(PSA_CRYPTO_STORAGE_HAS_TRANSACTIONS)
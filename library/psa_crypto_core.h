@@ -46,13 +46,28 @@ static inline int mbedtls_psa_safer_memcmp(
     return( diff );
 }
 
+/** The state of a key slot.
+ *
+ * Only slots in the #PSA_SLOT_FULL state are returned by key lookups, so
+ * that a key is never used while it is being created or destroyed.
+ */
+typedef enum
+{
+    PSA_SLOT_EMPTY = 0,         /*!< The slot is free. */
+    PSA_SLOT_FILLING,           /*!< A key is being created or loaded. */
+    PSA_SLOT_FULL,              /*!< The slot contains a usable key. */
+    PSA_SLOT_PENDING_DELETION   /*!< The key is being destroyed. */
+} psa_key_slot_state_t;
+
 /** The data structure representing a key slot, containing key material
  * and metadata for one key.
  */
-typedef struct
+typedef struct psa_key_slot_s
 {
     psa_core_key_attributes_t attr;
 
+    psa_key_slot_state_t state;
+
     /*
      * Number of locks on the key slot held by the library.
      *
@@ -75,6 +90,13 @@ typedef struct
      * . In case of a multi-threaded application where one thread asks to close
      *   or purge or destroy a key while it is in used by the library through
      *   another thread.
+     *
+     * If MBEDTLS_THREADING_C is enabled, the slot state only changes with
+     * exclusive access to the key store. This counter changes either with
+     * exclusive access, or with shared access while holding the lock
+     * stripe of the slot (see psa_crypto_slot_management.c). The key
+     * material and attributes of a locked slot in the #PSA_SLOT_FULL state
+     * do not change, so they can be read without holding any lock.
      */
     size_t lock_count;
 
@@ -85,6 +107,17 @@ typedef struct
         uint8_t *data;
         size_t bytes;
     } key;
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    /* Position of the slot in the key store. It determines the volatile
+     * key identifier of the key held in the slot, and is kept when the slot
+     * is wiped. */
+    size_t slot_index;
+
+    /* Next slot in the same bucket of the index of non-volatile key
+     * identifiers, or in the list of free slots. */
+    struct psa_key_slot_s *next;
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
 } psa_key_slot_t;
 
 /* A mask of key attribute flags used only internally.
@@ -187,6 +220,9 @@ static inline psa_key_slot_number_t psa_key_slot_get_slot_number(
  *
  * Persistent storage is not affected.
  *
+ * The caller must hold the key store lock, and the key slot must be
+ * locked exactly once.
+ *
  * \param[in,out] slot  The key slot to wipe.
  *
  * \retval #PSA_SUCCESS
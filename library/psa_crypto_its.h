@@ -142,6 +142,27 @@ psa_status_t psa_its_get_info(psa_storage_uid_t uid,
  */
 psa_status_t psa_its_remove(psa_storage_uid_t uid);
 
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+/**
+ * \brief Write all the records appended to the log to stable storage
+ *
+ * Appends are only synchronized every #MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL
+ * records. Call this function to make sure that all the changes made so
+ * far survive a power failure.
+ *
+ * \retval      #PSA_SUCCESS                  The operation completed successfully
+ * \retval      #PSA_ERROR_STORAGE_FAILURE    The operation failed because the physical storage has failed (Fatal error)
+ */
+psa_status_t psa_its_log_sync(void);
+
+/**
+ * \brief Synchronize and close the log, and free the in-memory index
+ *
+ * The log is opened and replayed again on the next access.
+ */
+void psa_its_log_close(void);
+#endif /* MBEDTLS_PSA_ITS_LOG_C */
+
 #ifdef __cplusplus
 }
 #endif
@@ -85,6 +85,16 @@ int mbedtls_psa_get_random( void *p_rng,
 
 #include "mbedtls/entropy.h"
 
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+/* include/mbedtls/psa_util.h only defines this type when all threads share
+ * the DRBG, since the DRBG state is not visible to applications otherwise. */
+#if defined(MBEDTLS_CTR_DRBG_C)
+typedef mbedtls_ctr_drbg_context mbedtls_psa_drbg_context_t;
+#elif defined(MBEDTLS_HMAC_DRBG_C)
+typedef mbedtls_hmac_drbg_context mbedtls_psa_drbg_context_t;
+#endif
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+
 /** Initialize the PSA DRBG.
  *
  * \param p_rng        Pointer to the Mbed TLS DRBG state.
@@ -111,17 +121,64 @@ static inline void mbedtls_psa_drbg_free( mbedtls_psa_drbg_context_t *p_rng )
 #endif
 }
 
+/** Generate random data with the PSA DRBG, without locking its mutex.
+ *
+ * \param p_rng        Pointer to the Mbed TLS DRBG state. It must not be
+ *                     used concurrently by another thread.
+ * \param output       The buffer to fill.
+ * \param output_size  The number of bytes to write to \p output.
+ *
+ * \return             \c 0 on success.
+ * \return             An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
+ */
+static inline int mbedtls_psa_drbg_random( mbedtls_psa_drbg_context_t *p_rng,
+                                           unsigned char *output,
+                                           size_t output_size )
+{
+#if defined(MBEDTLS_CTR_DRBG_C)
+    return( mbedtls_ctr_drbg_random_with_add( p_rng, output, output_size,
+                                              NULL, 0 ) );
+#elif defined(MBEDTLS_HMAC_DRBG_C)
+    return( mbedtls_hmac_drbg_random_with_add( p_rng, output, output_size,
+                                               NULL, 0 ) );
+#endif
+}
+
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+#include <pthread.h>
+#include "mbedtls/threading.h"
+
+/** The DRBG of one thread. */
+typedef struct mbedtls_psa_thread_drbg
+{
+    mbedtls_psa_drbg_context_t drbg;
+    struct mbedtls_psa_thread_drbg *next;
+} mbedtls_psa_thread_drbg_t;
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+
 /** The type of the PSA random generator context.
  *
  * The random generator context is composed of an entropy context and
- * a DRBG context.
+ * a DRBG context. With #MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG, each thread
+ * has its own DRBG context instead, seeded from the shared entropy
+ * context when the thread first needs random data.
  */
 typedef struct
 {
     void (* entropy_init )( mbedtls_entropy_context *ctx );
     void (* entropy_free )( mbedtls_entropy_context *ctx );
     mbedtls_entropy_context entropy;
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    /* The calling thread's DRBG, as a mbedtls_psa_thread_drbg_t. */
+    pthread_key_t thread_key;
+    /* Nonzero once thread_key has been created. */
+    int thread_key_created;
+    /* All the thread DRBGs, protected by
+     * mbedtls_threading_psa_rngdata_mutex. */
+    mbedtls_psa_thread_drbg_t *threads;
+#else
     mbedtls_psa_drbg_context_t drbg;
+#endif /* MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
 } mbedtls_psa_random_context_t;
 
 /* Defined in include/mbedtls/psa_util.h so that it's visible to
@@ -134,7 +191,11 @@ typedef struct
  * Observed with Visual Studio 2013. A known bug apparently:
  * https://stackoverflow.com/questions/8146541/duplicate-external-static-declarations-not-allowed-in-visual-studio
  */
-#if !defined(_MSC_VER)
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+int mbedtls_psa_get_random( void *p_rng,
+                            unsigned char *output,
+                            size_t output_size );
+#elif !defined(_MSC_VER)
 static mbedtls_f_rng_t *const mbedtls_psa_get_random;
 #endif
 
@@ -147,6 +208,7 @@ static mbedtls_f_rng_t *const mbedtls_psa_get_random;
 #define MBEDTLS_PSA_RANDOM_MAX_REQUEST MBEDTLS_HMAC_DRBG_MAX_REQUEST
 #endif
 
+#if !defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
 /** A pointer to the PSA DRBG state.
  *
  * This variable is only intended to be used through the macro
@@ -168,9 +230,15 @@ extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
  * enabled. Its expansion depends on the configuration.
  */
 #define MBEDTLS_PSA_RANDOM_STATE mbedtls_psa_random_state
+#else /* !MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
+/* Each thread uses its own DRBG, which mbedtls_psa_get_random() looks up
+ * by itself. */
+#define MBEDTLS_PSA_RANDOM_STATE NULL
+#endif /* !MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG */
 
 /** Seed the PSA DRBG.
  *
+ * \param p_rng         Pointer to the Mbed TLS DRBG state.
  * \param entropy       An entropy context to read the seed from.
  * \param custom        The personalization string.
  *                      This can be \c NULL, in which case the personalization
@@ -181,18 +249,19 @@ extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
  * \return              An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
  */
 static inline int mbedtls_psa_drbg_seed(
+    mbedtls_psa_drbg_context_t *p_rng,
     mbedtls_entropy_context *entropy,
     const unsigned char *custom, size_t len )
 {
 #if defined(MBEDTLS_CTR_DRBG_C)
-    return( mbedtls_ctr_drbg_seed( MBEDTLS_PSA_RANDOM_STATE,
+    return( mbedtls_ctr_drbg_seed( p_rng,
                                    mbedtls_entropy_func,
                                    entropy,
                                    custom, len ) );
 #elif defined(MBEDTLS_HMAC_DRBG_C)
     const mbedtls_md_info_t *md_info =
         mbedtls_md_info_from_type( MBEDTLS_PSA_HMAC_DRBG_MD_TYPE );
-    return( mbedtls_hmac_drbg_seed( MBEDTLS_PSA_RANDOM_STATE,
+    return( mbedtls_hmac_drbg_seed( p_rng,
                                     md_info,
                                     mbedtls_entropy_func,
                                     entropy,
@@ -30,7 +30,7 @@
 
 #include "psa_crypto_se.h"
 
-#if defined(MBEDTLS_PSA_ITS_FILE_C)
+#if defined(MBEDTLS_PSA_ITS_FILE_C) || defined(MBEDTLS_PSA_ITS_LOG_C)
 #include "psa_crypto_its.h"
 #else /* Native ITS implementation */
 #include "psa/error.h"
@@ -0,0 +1,784 @@
+/*
+ *  PSA transparent driver using SIMD instructions
+ */
+/*  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "common.h"
+
+#if defined(MBEDTLS_PSA_SIMD_DRIVER_C)
+
+#include <psa/crypto.h>
+#include "psa_crypto_core.h"
+#include "psa_crypto_simd.h"
+
+#include "mbedtls/aes.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+/*
+ * The kernels are written with compiler intrinsics and compiled for their
+ * target instruction set extension with a function attribute, so that the
+ * rest of the library does not need to be built with -msha, -maes, etc.
+ * The extensions are only used after checking with CPUID that the CPU
+ * supports them. On other platforms, every entry point reports
+ * PSA_ERROR_NOT_SUPPORTED and the built-in implementation is used.
+ */
+#if defined(__x86_64__) && \
+    ( defined(__clang__) || ( defined(__GNUC__) && __GNUC__ >= 5 ) )
+#define PSA_SIMD_HAVE_X86_64
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#if defined(PSA_SIMD_HAVE_X86_64)
+
+#if defined(PSA_WANT_ALG_SHA_224) || defined(PSA_WANT_ALG_SHA_256)
+#define PSA_SIMD_HAVE_SHA256
+#endif
+
+/* The AES-CTR kernel reads the round keys from mbedtls_aes_context, so it
+ * needs the built-in context layout and key schedule. */
+#if defined(MBEDTLS_AES_C) && \
+    !defined(MBEDTLS_AES_ALT) && !defined(MBEDTLS_AES_SETKEY_ENC_ALT) && \
+    defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_CTR)
+#define PSA_SIMD_HAVE_AES_CTR
+#endif
+
+#if defined(PSA_WANT_KEY_TYPE_CHACHA20) && defined(PSA_WANT_ALG_STREAM_CIPHER)
+#define PSA_SIMD_HAVE_CHACHA20
+#endif
+
+#if defined(PSA_SIMD_HAVE_SHA256) || defined(PSA_SIMD_HAVE_AES_CTR)
+#define PSA_SIMD_CPU_AES    0x01u   /* AES-NI */
+#define PSA_SIMD_CPU_SHA    0x02u   /* SHA extensions, SSSE3 and SSE4.1 */
+
+/*
+ * Detect the relevant instruction set extensions once.
+ *
+ * As in aesni.c, the result is cached in static variables; concurrent first
+ * calls compute and store the same value.
+ */
+static unsigned int psa_simd_cpu_features( void )
+{
+    static int done = 0;
+    static unsigned int features = 0;
+
+    if( ! done )
+    {
+        unsigned int eax, ebx, ecx, edx;
+        unsigned int found = 0;
+
+        if( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) )
+        {
+            if( ecx & ( 1u << 25 ) )
+                found |= PSA_SIMD_CPU_AES;
+
+            /* SSSE3 (bit 9) and SSE4.1 (bit 19) are used around the
+             * SHA instructions, which are reported in leaf 7. */
+            if( ( ecx & ( 1u << 9 ) ) != 0 && ( ecx & ( 1u << 19 ) ) != 0 &&
+                __get_cpuid_max( 0, NULL ) >= 7 )
+            {
+                __cpuid_count( 7, 0, eax, ebx, ecx, edx );
+                if( ebx & ( 1u << 29 ) )
+                    found |= PSA_SIMD_CPU_SHA;
+            }
+        }
+
+        features = found;
+        done = 1;
+    }
+
+    return( features );
+}
+#endif /* PSA_SIMD_HAVE_SHA256 || PSA_SIMD_HAVE_AES_CTR */
+
+#endif /* PSA_SIMD_HAVE_X86_64 */
+
+/****************************************************************/
+/* SHA-224 and SHA-256 */
+/****************************************************************/
+
+#if defined(PSA_SIMD_HAVE_SHA256)
+
+static const uint32_t psa_simd_sha256_k[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+#if defined(PSA_WANT_ALG_SHA_224)
+static const uint32_t psa_simd_sha224_iv[8] =
+{
+    0xC1059ED8, 0x367CD507, 0x3070DD17, 0xF70E5939,
+    0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4,
+};
+#endif
+
+#if defined(PSA_WANT_ALG_SHA_256)
+static const uint32_t psa_simd_sha256_iv[8] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+#endif
+
+/* Four rounds, consuming the message schedule words in w. */
+#define PSA_SIMD_SHA256_ROUNDS( k, w )                                      \
+    do                                                                      \
+    {                                                                       \
+        tmp = _mm_add_epi32( w, _mm_loadu_si128(                            \
+                  (const __m128i *) &psa_simd_sha256_k[k] ) );              \
+        state1 = _mm_sha256rnds2_epu32( state1, state0, tmp );              \
+        tmp = _mm_shuffle_epi32( tmp, 0x0E );                               \
+        state0 = _mm_sha256rnds2_epu32( state0, state1, tmp );              \
+    } while( 0 )
+
+/* Compute the next four schedule words into w0, given the previous
+ * sixteen in w0 (oldest) to w3 (newest). */
+#define PSA_SIMD_SHA256_SCHEDULE( w0, w1, w2, w3 )                          \
+    do                                                                      \
+    {                                                                       \
+        w0 = _mm_sha256msg1_epu32( w0, w1 );                                \
+        w0 = _mm_add_epi32( w0, _mm_alignr_epi8( w3, w2, 4 ) );             \
+        w0 = _mm_sha256msg2_epu32( w0, w3 );                                \
+    } while( 0 )
+
+__attribute__((target("sha,sse4.1")))
+static void psa_simd_sha256_blocks( uint32_t state[8],
+                                    const uint8_t *data, size_t blocks )
+{
+    const __m128i bswap = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL,
+                                          0x0405060700010203ULL );
+    __m128i state0, state1, save0, save1, tmp;
+    __m128i w0, w1, w2, w3;
+    int i;
+
+    /* The SHA instructions work on the state as ABEF and CDGH. */
+    tmp = _mm_loadu_si128( (const __m128i *) &state[0] );
+    state1 = _mm_loadu_si128( (const __m128i *) &state[4] );
+    tmp = _mm_shuffle_epi32( tmp, 0xB1 );
+    state1 = _mm_shuffle_epi32( state1, 0x1B );
+    state0 = _mm_alignr_epi8( tmp, state1, 8 );
+    state1 = _mm_blend_epi16( state1, tmp, 0xF0 );
+
+    for( ; blocks > 0; blocks--, data += 64 )
+    {
+        save0 = state0;
+        save1 = state1;
+
+        w0 = _mm_shuffle_epi8( _mm_loadu_si128(
+                 (const __m128i *) ( data + 0 ) ), bswap );
+        w1 = _mm_shuffle_epi8( _mm_loadu_si128(
+                 (const __m128i *) ( data + 16 ) ), bswap );
+        w2 = _mm_shuffle_epi8( _mm_loadu_si128(
+                 (const __m128i *) ( data + 32 ) ), bswap );
+        w3 = _mm_shuffle_epi8( _mm_loadu_si128(
+                 (const __m128i *) ( data + 48 ) ), bswap );
+
+        PSA_SIMD_SHA256_ROUNDS( 0, w0 );
+        PSA_SIMD_SHA256_ROUNDS( 4, w1 );
+        PSA_SIMD_SHA256_ROUNDS( 8, w2 );
+        PSA_SIMD_SHA256_ROUNDS( 12, w3 );
+
+        for( i = 16; i < 64; i += 16 )
+        {
+            PSA_SIMD_SHA256_SCHEDULE( w0, w1, w2, w3 );
+            PSA_SIMD_SHA256_ROUNDS( i, w0 );
+            PSA_SIMD_SHA256_SCHEDULE( w1, w2, w3, w0 );
+            PSA_SIMD_SHA256_ROUNDS( i + 4, w1 );
+            PSA_SIMD_SHA256_SCHEDULE( w2, w3, w0, w1 );
+            PSA_SIMD_SHA256_ROUNDS( i + 8, w2 );
+            PSA_SIMD_SHA256_SCHEDULE( w3, w0, w1, w2 );
+            PSA_SIMD_SHA256_ROUNDS( i + 12, w3 );
+        }
+
+        state0 = _mm_add_epi32( state0, save0 );
+        state1 = _mm_add_epi32( state1, save1 );
+    }
+
+    /* Back from ABEF/CDGH to ABCD/EFGH. */
+    tmp = _mm_shuffle_epi32( state0, 0x1B );
+    state1 = _mm_shuffle_epi32( state1, 0xB1 );
+    state0 = _mm_blend_epi16( tmp, state1, 0xF0 );
+    state1 = _mm_alignr_epi8( state1, tmp, 8 );
+    _mm_storeu_si128( (__m128i *) &state[0], state0 );
+    _mm_storeu_si128( (__m128i *) &state[4], state1 );
+}
+
+#endif /* PSA_SIMD_HAVE_SHA256 */
+
+psa_status_t mbedtls_psa_simd_hash_setup(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    psa_algorithm_t alg )
+{
+#if defined(PSA_SIMD_HAVE_SHA256)
+    const uint32_t *iv;
+
+    switch( alg )
+    {
+#if defined(PSA_WANT_ALG_SHA_224)
+        case PSA_ALG_SHA_224:
+            iv = psa_simd_sha224_iv;
+            break;
+#endif
+#if defined(PSA_WANT_ALG_SHA_256)
+        case PSA_ALG_SHA_256:
+            iv = psa_simd_sha256_iv;
+            break;
+#endif
+        default:
+            return( PSA_ERROR_NOT_SUPPORTED );
+    }
+
+    if( ( psa_simd_cpu_features( ) & PSA_SIMD_CPU_SHA ) == 0 )
+        return( PSA_ERROR_NOT_SUPPORTED );
+
+    operation->alg = alg;
+    memcpy( operation->state, iv, sizeof( operation->state ) );
+    operation->total = 0;
+
+    return( PSA_SUCCESS );
+#else
+    (void) operation;
+    (void) alg;
+    return( PSA_ERROR_NOT_SUPPORTED );
+#endif /* PSA_SIMD_HAVE_SHA256 */
+}
+
+psa_status_t mbedtls_psa_simd_hash_clone(
+    const mbedtls_psa_simd_hash_operation_t *source_operation,
+    mbedtls_psa_simd_hash_operation_t *target_operation )
+{
+    if( source_operation->alg == 0 )
+        return( PSA_ERROR_BAD_STATE );
+
+    *target_operation = *source_operation;
+    return( PSA_SUCCESS );
+}
+
+psa_status_t mbedtls_psa_simd_hash_update(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    const uint8_t *input,
+    size_t input_length )
+{
+#if defined(PSA_SIMD_HAVE_SHA256)
+    size_t used = (size_t) ( operation->total & 63 );
+    size_t blocks;
+
+    if( operation->alg == 0 )
+        return( PSA_ERROR_BAD_STATE );
+
+    operation->total += input_length;
+
+    if( used != 0 )
+    {
+        size_t fill = 64 - used;
+
+        if( input_length < fill )
+        {
+            memcpy( operation->buffer + used, input, input_length );
+            return( PSA_SUCCESS );
+        }
+
+        memcpy( operation->buffer + used, input, fill );
+        psa_simd_sha256_blocks( operation->state, operation->buffer, 1 );
+        input += fill;
+        input_length -= fill;
+    }
+
+    blocks = input_length / 64;
+    if( blocks > 0 )
+    {
+        psa_simd_sha256_blocks( operation->state, input, blocks );
+        input += blocks * 64;
+        input_length -= blocks * 64;
+    }
+
+    if( input_length > 0 )
+        memcpy( operation->buffer, input, input_length );
+
+    return( PSA_SUCCESS );
+#else
+    (void) operation;
+    (void) input;
+    (void) input_length;
+    return( PSA_ERROR_BAD_STATE );
+#endif /* PSA_SIMD_HAVE_SHA256 */
+}
+
+psa_status_t mbedtls_psa_simd_hash_finish(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    uint8_t *hash,
+    size_t hash_size,
+    size_t *hash_length )
+{
+#if defined(PSA_SIMD_HAVE_SHA256)
+    size_t used = (size_t) ( operation->total & 63 );
+    size_t length;
+    size_t i;
+
+    if( operation->alg == 0 )
+        return( PSA_ERROR_BAD_STATE );
+
+    length = PSA_HASH_LENGTH( operation->alg );
+    if( hash_size < length )
+        return( PSA_ERROR_BUFFER_TOO_SMALL );
+
+    operation->buffer[used++] = 0x80;
+    if( used > 56 )
+    {
+        memset( operation->buffer + used, 0, 64 - used );
+        psa_simd_sha256_blocks( operation->state, operation->buffer, 1 );
+        used = 0;
+    }
+    memset( operation->buffer + used, 0, 56 - used );
+    MBEDTLS_PUT_UINT64_BE( operation->total << 3, operation->buffer, 56 );
+    psa_simd_sha256_blocks( operation->state, operation->buffer, 1 );
+
+    for( i = 0; i < length / 4; i++ )
+        MBEDTLS_PUT_UINT32_BE( operation->state[i], hash, 4 * i );
+
+    *hash_length = length;
+    return( PSA_SUCCESS );
+#else
+    (void) operation;
+    (void) hash;
+    (void) hash_size;
+    (void) hash_length;
+    return( PSA_ERROR_BAD_STATE );
+#endif /* PSA_SIMD_HAVE_SHA256 */
+}
+
+psa_status_t mbedtls_psa_simd_hash_abort(
+    mbedtls_psa_simd_hash_operation_t *operation )
+{
+    mbedtls_platform_zeroize( operation, sizeof( *operation ) );
+    return( PSA_SUCCESS );
+}
+
+psa_status_t mbedtls_psa_simd_hash_compute(
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *hash,
+    size_t hash_size,
+    size_t *hash_length )
+{
+    mbedtls_psa_simd_hash_operation_t operation =
+        MBEDTLS_PSA_SIMD_HASH_OPERATION_INIT;
+    psa_status_t status;
+
+    status = mbedtls_psa_simd_hash_setup( &operation, alg );
+    if( status == PSA_SUCCESS )
+        status = mbedtls_psa_simd_hash_update( &operation,
+                                               input, input_length );
+    if( status == PSA_SUCCESS )
+        status = mbedtls_psa_simd_hash_finish( &operation,
+                                               hash, hash_size, hash_length );
+
+    mbedtls_psa_simd_hash_abort( &operation );
+    return( status );
+}
+
+/****************************************************************/
+/* AES-CTR */
+/****************************************************************/
+
+#if defined(PSA_SIMD_HAVE_AES_CTR)
+
+/* Counter block for the 128-bit big-endian counter (hi, lo). */
+#define PSA_SIMD_CTR_BLOCK( hi, lo )                                        \
+    _mm_set_epi64x( (long long) __builtin_bswap64( lo ),                    \
+                    (long long) __builtin_bswap64( hi ) )
+
+#define PSA_SIMD_CTR_INCREMENT( hi, lo )                                    \
+    do                                                                      \
+    {                                                                       \
+        if( ++( lo ) == 0 )                                                 \
+            ++( hi );                                                       \
+    } while( 0 )
+
+/* Same counter semantics as mbedtls_aes_crypt_ctr(): the whole IV is the
+ * initial counter block, incremented as a 128-bit big-endian integer. */
+__attribute__((target("aes")))
+static void psa_simd_aes_ctr( const mbedtls_aes_context *aes,
+                              const uint8_t iv[16],
+                              const uint8_t *input, uint8_t *output,
+                              size_t length )
+{
+    const uint8_t *rk = (const uint8_t *) aes->rk;
+    int nr = aes->nr;
+    uint64_t hi = MBEDTLS_GET_UINT64_BE( iv, 0 );
+    uint64_t lo = MBEDTLS_GET_UINT64_BE( iv, 8 );
+    __m128i keys[15];
+    __m128i b0, b1, b2, b3;
+    int i;
+
+    for( i = 0; i <= nr; i++ )
+        keys[i] = _mm_loadu_si128( (const __m128i *) ( rk + 16 * i ) );
+
+    /* Four independent blocks keep the AES unit busy. */
+    for( ; length >= 64; length -= 64, input += 64, output += 64 )
+    {
+        b0 = PSA_SIMD_CTR_BLOCK( hi, lo );
+        PSA_SIMD_CTR_INCREMENT( hi, lo );
+        b1 = PSA_SIMD_CTR_BLOCK( hi, lo );
+        PSA_SIMD_CTR_INCREMENT( hi, lo );
+        b2 = PSA_SIMD_CTR_BLOCK( hi, lo );
+        PSA_SIMD_CTR_INCREMENT( hi, lo );
+        b3 = PSA_SIMD_CTR_BLOCK( hi, lo );
+        PSA_SIMD_CTR_INCREMENT( hi, lo );
+
+        b0 = _mm_xor_si128( b0, keys[0] );
+        b1 = _mm_xor_si128( b1, keys[0] );
+        b2 = _mm_xor_si128( b2, keys[0] );
+        b3 = _mm_xor_si128( b3, keys[0] );
+        for( i = 1; i < nr; i++ )
+        {
+            b0 = _mm_aesenc_si128( b0, keys[i] );
+            b1 = _mm_aesenc_si128( b1, keys[i] );
+            b2 = _mm_aesenc_si128( b2, keys[i] );
+            b3 = _mm_aesenc_si128( b3, keys[i] );
+        }
+        b0 = _mm_aesenclast_si128( b0, keys[nr] );
+        b1 = _mm_aesenclast_si128( b1, keys[nr] );
+        b2 = _mm_aesenclast_si128( b2, keys[nr] );
+        b3 = _mm_aesenclast_si128( b3, keys[nr] );
+
+        b0 = _mm_xor_si128( b0, _mm_loadu_si128(
+                 (const __m128i *) ( input + 0 ) ) );
+        b1 = _mm_xor_si128( b1, _mm_loadu_si128(
+                 (const __m128i *) ( input + 16 ) ) );
+        b2 = _mm_xor_si128( b2, _mm_loadu_si128(
+                 (const __m128i *) ( input + 32 ) ) );
+        b3 = _mm_xor_si128( b3, _mm_loadu_si128(
+                 (const __m128i *) ( input + 48 ) ) );
+        _mm_storeu_si128( (__m128i *) ( output + 0 ), b0 );
+        _mm_storeu_si128( (__m128i *) ( output + 16 ), b1 );
+        _mm_storeu_si128( (__m128i *) ( output + 32 ), b2 );
+        _mm_storeu_si128( (__m128i *) ( output + 48 ), b3 );
+    }
+
+    while( length > 0 )
+    {
+        b0 = PSA_SIMD_CTR_BLOCK( hi, lo );
+        PSA_SIMD_CTR_INCREMENT( hi, lo );
+
+        b0 = _mm_xor_si128( b0, keys[0] );
+        for( i = 1; i < nr; i++ )
+            b0 = _mm_aesenc_si128( b0, keys[i] );
+        b0 = _mm_aesenclast_si128( b0, keys[nr] );
+
+        if( length >= 16 )
+        {
+            b0 = _mm_xor_si128( b0, _mm_loadu_si128(
+                     (const __m128i *) input ) );
+            _mm_storeu_si128( (__m128i *) output, b0 );
+            input += 16;
+            output += 16;
+            length -= 16;
+        }
+        else
+        {
+            uint8_t stream_block[16];
+            size_t n;
+
+            _mm_storeu_si128( (__m128i *) stream_block, b0 );
+            for( n = 0; n < length; n++ )
+                output[n] = input[n] ^ stream_block[n];
+            mbedtls_platform_zeroize( stream_block, sizeof( stream_block ) );
+            length = 0;
+        }
+    }
+
+    mbedtls_platform_zeroize( keys, sizeof( keys ) );
+}
+
+#endif /* PSA_SIMD_HAVE_AES_CTR */
+
+/****************************************************************/
+/* ChaCha20 */
+/****************************************************************/
+
+#if defined(PSA_SIMD_HAVE_CHACHA20)
+
+#define PSA_SIMD_ROTL32( v, n )                                             \
+    _mm_or_si128( _mm_slli_epi32( v, n ), _mm_srli_epi32( v, 32 - ( n ) ) )
+
+#define PSA_SIMD_CHACHA20_QR( a, b, c, d )                                  \
+    do                                                                      \
+    {                                                                       \
+        a = _mm_add_epi32( a, b );                                          \
+        d = PSA_SIMD_ROTL32( _mm_xor_si128( d, a ), 16 );                   \
+        c = _mm_add_epi32( c, d );                                          \
+        b = PSA_SIMD_ROTL32( _mm_xor_si128( b, c ), 12 );                   \
+        a = _mm_add_epi32( a, b );                                          \
+        d = PSA_SIMD_ROTL32( _mm_xor_si128( d, a ), 8 );                    \
+        c = _mm_add_epi32( c, d );                                          \
+        b = PSA_SIMD_ROTL32( _mm_xor_si128( b, c ), 7 );                    \
+    } while( 0 )
+
+/* Produce four consecutive keystream blocks starting at the block counter
+ * in state[12]. Each vector holds one state word of the four blocks, so the
+ * rounds need no shuffling; the result is transposed when it is stored. */
+static void psa_simd_chacha20_blocks4( const uint32_t state[16],
+                                       uint8_t keystream[256] )
+{
+    __m128i s[16], x[16];
+    __m128i t0, t1, t2, t3;
+    int i;
+
+    for( i = 0; i < 16; i++ )
+        s[i] = _mm_set1_epi32( (int) state[i] );
+    s[12] = _mm_add_epi32( s[12], _mm_set_epi32( 3, 2, 1, 0 ) );
+
+    for( i = 0; i < 16; i++ )
+        x[i] = s[i];
+
+    for( i = 0; i < 10; i++ )
+    {
+        PSA_SIMD_CHACHA20_QR( x[0], x[4], x[8], x[12] );
+        PSA_SIMD_CHACHA20_QR( x[1], x[5], x[9], x[13] );
+        PSA_SIMD_CHACHA20_QR( x[2], x[6], x[10], x[14] );
+        PSA_SIMD_CHACHA20_QR( x[3], x[7], x[11], x[15] );
+        PSA_SIMD_CHACHA20_QR( x[0], x[5], x[10], x[15] );
+        PSA_SIMD_CHACHA20_QR( x[1], x[6], x[11], x[12] );
+        PSA_SIMD_CHACHA20_QR( x[2], x[7], x[8], x[13] );
+        PSA_SIMD_CHACHA20_QR( x[3], x[4], x[9], x[14] );
+    }
+
+    for( i = 0; i < 16; i++ )
+        x[i] = _mm_add_epi32( x[i], s[i] );
+
+    for( i = 0; i < 4; i++ )
+    {
+        t0 = _mm_unpacklo_epi32( x[4 * i + 0], x[4 * i + 1] );
+        t1 = _mm_unpacklo_epi32( x[4 * i + 2], x[4 * i + 3] );
+        t2 = _mm_unpackhi_epi32( x[4 * i + 0], x[4 * i + 1] );
+        t3 = _mm_unpackhi_epi32( x[4 * i + 2], x[4 * i + 3] );
+
+        _mm_storeu_si128( (__m128i *) ( keystream + 0 + 16 * i ),
+                          _mm_unpacklo_epi64( t0, t1 ) );
+        _mm_storeu_si128( (__m128i *) ( keystream + 64 + 16 * i ),
+                          _mm_unpackhi_epi64( t0, t1 ) );
+        _mm_storeu_si128( (__m128i *) ( keystream + 128 + 16 * i ),
+                          _mm_unpacklo_epi64( t2, t3 ) );
+        _mm_storeu_si128( (__m128i *) ( keystream + 192 + 16 * i ),
+                          _mm_unpackhi_epi64( t2, t3 ) );
+    }
+
+    mbedtls_platform_zeroize( s, sizeof( s ) );
+    mbedtls_platform_zeroize( x, sizeof( x ) );
+}
+
+/* Same conventions as the built-in ChaCha20 cipher: 12-byte nonce and
+ * initial block counter 0. */
+static void psa_simd_chacha20( const uint8_t key[32],
+                               const uint8_t nonce[12],
+                               const uint8_t *input, uint8_t *output,
+                               size_t length )
+{
+    uint32_t state[16];
+    uint8_t keystream[256];
+    size_t chunk;
+    size_t n;
+    int i;
+
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+    for( i = 0; i < 8; i++ )
+        state[4 + i] = MBEDTLS_GET_UINT32_LE( key, 4 * i );
+    state[12] = 0;
+    state[13] = MBEDTLS_GET_UINT32_LE( nonce, 0 );
+    state[14] = MBEDTLS_GET_UINT32_LE( nonce, 4 );
+    state[15] = MBEDTLS_GET_UINT32_LE( nonce, 8 );
+
+    while( length > 0 )
+    {
+        psa_simd_chacha20_blocks4( state, keystream );
+        state[12] += 4;
+
+        chunk = length < sizeof( keystream ) ? length : sizeof( keystream );
+        for( n = 0; n + 16 <= chunk; n += 16 )
+        {
+            _mm_storeu_si128( (__m128i *) ( output + n ), _mm_xor_si128(
+                _mm_loadu_si128( (const __m128i *) ( input + n ) ),
+                _mm_loadu_si128( (const __m128i *) ( keystream + n ) ) ) );
+        }
+        for( ; n < chunk; n++ )
+            output[n] = input[n] ^ keystream[n];
+
+        input += chunk;
+        output += chunk;
+        length -= chunk;
+    }
+
+    mbedtls_platform_zeroize( state, sizeof( state ) );
+    mbedtls_platform_zeroize( keystream, sizeof( keystream ) );
+}
+
+#endif /* PSA_SIMD_HAVE_CHACHA20 */
+
+/****************************************************************/
+/* Cipher entry points */
+/****************************************************************/
+
+/* Return the IV length that the driver handles for the given key type and
+ * algorithm, or 0 if the driver does not handle the combination on this
+ * platform and CPU. */
+static size_t psa_simd_cipher_iv_length( psa_key_type_t key_type,
+                                         psa_algorithm_t alg )
+{
+#if defined(PSA_SIMD_HAVE_AES_CTR)
+    if( key_type == PSA_KEY_TYPE_AES && alg == PSA_ALG_CTR &&
+        ( psa_simd_cpu_features( ) & PSA_SIMD_CPU_AES ) != 0 )
+        return( 16 );
+#endif
+#if defined(PSA_SIMD_HAVE_CHACHA20)
+    if( key_type == PSA_KEY_TYPE_CHACHA20 && alg == PSA_ALG_STREAM_CIPHER )
+        return( 12 );
+#endif
+    (void) key_type;
+    (void) alg;
+    return( 0 );
+}
+
+static psa_status_t psa_simd_cipher_crypt( psa_key_type_t key_type,
+                                           const uint8_t *key_buffer,
+                                           size_t key_buffer_size,
+                                           const uint8_t *iv,
+                                           const uint8_t *input,
+                                           size_t input_length,
+                                           uint8_t *output )
+{
+#if defined(PSA_SIMD_HAVE_AES_CTR)
+    if( key_type == PSA_KEY_TYPE_AES )
+    {
+        mbedtls_aes_context aes;
+        int ret;
+
+        mbedtls_aes_init( &aes );
+        ret = mbedtls_aes_setkey_enc( &aes, key_buffer,
+                                      (unsigned int) key_buffer_size * 8 );
+        if( ret == 0 )
+            psa_simd_aes_ctr( &aes, iv, input, output, input_length );
+        mbedtls_aes_free( &aes );
+
+        return( mbedtls_to_psa_error( ret ) );
+    }
+#endif
+#if defined(PSA_SIMD_HAVE_CHACHA20)
+    if( key_type == PSA_KEY_TYPE_CHACHA20 )
+    {
+        if( key_buffer_size != 32 )
+            return( PSA_ERROR_INVALID_ARGUMENT );
+
+        psa_simd_chacha20( key_buffer, iv, input, output, input_length );
+        return( PSA_SUCCESS );
+    }
+#endif
+    (void) key_buffer;
+    (void) key_buffer_size;
+    (void) iv;
+    (void) input;
+    (void) input_length;
+    (void) output;
+    (void) key_type;
+    return( PSA_ERROR_NOT_SUPPORTED );
+}
+
+psa_status_t mbedtls_psa_simd_cipher_encrypt(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer,
+    size_t key_buffer_size,
+    psa_algorithm_t alg,
+    const uint8_t *iv,
+    size_t iv_length,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *output,
+    size_t output_size,
+    size_t *output_length )
+{
+    psa_status_t status;
+    size_t expected_iv_length =
+        psa_simd_cipher_iv_length( attributes->core.type, alg );
+
+    if( expected_iv_length == 0 || iv_length != expected_iv_length )
+        return( PSA_ERROR_NOT_SUPPORTED );
+
+    if( output_size < input_length )
+        return( PSA_ERROR_BUFFER_TOO_SMALL );
+
+    status = psa_simd_cipher_crypt( attributes->core.type,
+                                    key_buffer, key_buffer_size, iv,
+                                    input, input_length, output );
+    if( status == PSA_SUCCESS )
+        *output_length = input_length;
+
+    return( status );
+}
+
+psa_status_t mbedtls_psa_simd_cipher_decrypt(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer,
+    size_t key_buffer_size,
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *output,
+    size_t output_size,
+    size_t *output_length )
+{
+    psa_status_t status;
+    size_t iv_length =
+        psa_simd_cipher_iv_length( attributes->core.type, alg );
+
+    if( iv_length == 0 || input_length < iv_length )
+        return( PSA_ERROR_NOT_SUPPORTED );
+
+    if( output_size < input_length - iv_length )
+        return( PSA_ERROR_BUFFER_TOO_SMALL );
+
+    status = psa_simd_cipher_crypt( attributes->core.type,
+                                    key_buffer, key_buffer_size, input,
+                                    input + iv_length,
+                                    input_length - iv_length, output );
+    if( status == PSA_SUCCESS )
+        *output_length = input_length - iv_length;
+
+    return( status );
+}
+
+#endif /* MBEDTLS_PSA_SIMD_DRIVER_C */
@@ -0,0 +1,169 @@
+/*
+ *  PSA transparent driver using SIMD instructions
+ */
+/*  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PSA_CRYPTO_SIMD_H
+#define PSA_CRYPTO_SIMD_H
+
+#include <psa/crypto.h>
+
+/*
+ * The SIMD driver is a transparent driver that is registered ahead of the
+ * built-in implementation. It implements:
+ *
+ * - SHA-224 and SHA-256 (one-shot and multipart) with the x86 SHA
+ *   extensions;
+ * - AES-CTR (one-shot cipher) with AES-NI, processing four blocks at a
+ *   time;
+ * - the ChaCha20 stream cipher (one-shot cipher) with SSE2, processing
+ *   four blocks at a time.
+ *
+ * Every entry point returns #PSA_ERROR_NOT_SUPPORTED when the algorithm is
+ * not one of the above, when the library was built for a platform without
+ * the corresponding kernel, or when the CPU it runs on lacks the required
+ * instructions. The driver wrappers then fall back to the next driver, and
+ * ultimately to the built-in implementation. Errors that the built-in
+ * implementation reports for malformed requests (for example a wrong IV
+ * length) are left to it as well.
+ */
+
+/** Calculate the hash (digest) of a message with the SIMD driver.
+ *
+ * \note The signature of this function is that of a PSA driver hash_compute
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t mbedtls_psa_simd_hash_compute(
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *hash,
+    size_t hash_size,
+    size_t *hash_length );
+
+/** Set up a multipart hash operation with the SIMD driver.
+ *
+ * \note The signature of this function is that of a PSA driver hash_setup
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ */
+psa_status_t mbedtls_psa_simd_hash_setup(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    psa_algorithm_t alg );
+
+/** Clone a SIMD driver hash operation.
+ *
+ * \note The signature of this function is that of a PSA driver hash_clone
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BAD_STATE
+ *         \p source_operation is not active.
+ */
+psa_status_t mbedtls_psa_simd_hash_clone(
+    const mbedtls_psa_simd_hash_operation_t *source_operation,
+    mbedtls_psa_simd_hash_operation_t *target_operation );
+
+/** Add a message fragment to a SIMD driver hash operation.
+ *
+ * \note The signature of this function is that of a PSA driver hash_update
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The operation is not active.
+ */
+psa_status_t mbedtls_psa_simd_hash_update(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    const uint8_t *input,
+    size_t input_length );
+
+/** Finish the calculation of a SIMD driver hash operation.
+ *
+ * \note The signature of this function is that of a PSA driver hash_finish
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The operation is not active.
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t mbedtls_psa_simd_hash_finish(
+    mbedtls_psa_simd_hash_operation_t *operation,
+    uint8_t *hash,
+    size_t hash_size,
+    size_t *hash_length );
+
+/** Abort a SIMD driver hash operation.
+ *
+ * \note The signature of this function is that of a PSA driver hash_abort
+ *       entry point.
+ *
+ * \retval #PSA_SUCCESS
+ */
+psa_status_t mbedtls_psa_simd_hash_abort(
+    mbedtls_psa_simd_hash_operation_t *operation );
+
+/** Encrypt a message with the SIMD driver.
+ *
+ * \note The signature of this function is that of a PSA driver
+ *       cipher_encrypt entry point.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t mbedtls_psa_simd_cipher_encrypt(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer,
+    size_t key_buffer_size,
+    psa_algorithm_t alg,
+    const uint8_t *iv,
+    size_t iv_length,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *output,
+    size_t output_size,
+    size_t *output_length );
+
+/** Decrypt a message with the SIMD driver.
+ *
+ * \note The signature of this function is that of a PSA driver
+ *       cipher_decrypt entry point: \p input starts with the IV.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t mbedtls_psa_simd_cipher_decrypt(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer,
+    size_t key_buffer_size,
+    psa_algorithm_t alg,
+    const uint8_t *input,
+    size_t input_length,
+    uint8_t *output,
+    size_t output_size,
+    size_t *output_length );
+
+#endif /* PSA_CRYPTO_SIMD_H */
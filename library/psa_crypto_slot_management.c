@@ -18,6 +18,11 @@
  *  limitations under the License.
  */
 
+/* Ensure that pthread_rwlock_t is declared */
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include "common.h"
 
 #if defined(MBEDTLS_PSA_CRYPTO_C)
@@ -40,17 +45,358 @@
 #define mbedtls_calloc calloc
 #define mbedtls_free   free
 #endif
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
 
 #define ARRAY_LENGTH( array ) ( sizeof( array ) / sizeof( *( array ) ) )
 
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+/* Number of key slots in block k, and index of its first key slot */
+#define PSA_KEY_SLAB_SIZE( k )  ( (size_t) MBEDTLS_PSA_KEY_SLOT_COUNT << ( k ) )
+#define PSA_KEY_SLAB_BASE( k )  ( (size_t) MBEDTLS_PSA_KEY_SLOT_COUNT *    \
+                                  ( ( (size_t) 1 << ( k ) ) - 1 ) )
+
+/* Initial number of buckets in the index of non-volatile key identifiers */
+#define PSA_KEY_INDEX_MIN_BUCKETS   64
+
+#if defined(MBEDTLS_TEST_HOOKS)
+size_t mbedtls_test_hook_psa_key_slab_limit = PSA_KEY_SLOT_SLAB_COUNT;
+#define PSA_KEY_SLAB_LIMIT  ( mbedtls_test_hook_psa_key_slab_limit <      \
+                              PSA_KEY_SLOT_SLAB_COUNT ?                    \
+                              mbedtls_test_hook_psa_key_slab_limit :       \
+                              PSA_KEY_SLOT_SLAB_COUNT )
+#else
+#define PSA_KEY_SLAB_LIMIT  PSA_KEY_SLOT_SLAB_COUNT
+#endif /* MBEDTLS_TEST_HOOKS */
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
 typedef struct
 {
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    /* Key slots are allocated in blocks which never move, so that pointers
+     * to key slots stay valid until psa_wipe_all_key_slots(). */
+    psa_key_slot_t *slabs[PSA_KEY_SLOT_SLAB_COUNT];
+    size_t slab_count;
+    /* Empty key slots, linked through their next field. */
+    psa_key_slot_t *free_slots;
+    /* Hash table of the key slots with a non-volatile key identifier,
+     * chained through their next field. bucket_count is a power of 2. */
+    psa_key_slot_t **buckets;
+    size_t bucket_count;
+    size_t indexed_count;
+#else
     psa_key_slot_t key_slots[MBEDTLS_PSA_KEY_SLOT_COUNT];
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
     unsigned key_slots_initialized : 1;
 } psa_global_data_t;
 
 static psa_global_data_t global_data;
 
+#if defined(MBEDTLS_THREADING_C)
+/*
+ * The key store is protected by a reader-writer lock. Key lookups, and
+ * locking or unlocking a key slot, only need shared access, so threads
+ * using keys do not wait for each other. Adding or removing key slots,
+ * changing the index of key identifiers and changing the state of a key
+ * slot need exclusive access, which is what "the key store lock" means
+ * in the rest of this file.
+ *
+ * With shared access, the lock counter of a key slot is changed while
+ * holding one of PSA_KEY_SLOT_LOCK_STRIPES mutexes, chosen from the
+ * position of the slot in memory.
+ *
+ * With MBEDTLS_THREADING_ALT, the threading abstraction only provides
+ * mutexes, so shared and exclusive access both lock
+ * mbedtls_threading_key_slot_mutex.
+ *
+ * Persistent and built-in keys are loaded from storage without holding the
+ * key store lock. Loads are serialized by mbedtls_threading_key_load_mutex
+ * instead, so that a key wanted by several threads is loaded only once.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#define PSA_KEY_SLOT_LOCK_STRIPES 16
+
+static pthread_rwlock_t psa_key_store_rwlock = PTHREAD_RWLOCK_INITIALIZER;
+
+static pthread_mutex_t psa_key_slot_stripes[PSA_KEY_SLOT_LOCK_STRIPES] =
+{
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+};
+
+static pthread_mutex_t *psa_key_slot_stripe( const psa_key_slot_t *slot )
+{
+    return( &psa_key_slot_stripes[( (uintptr_t) slot / sizeof( *slot ) ) %
+                                  PSA_KEY_SLOT_LOCK_STRIPES] );
+}
+
+psa_status_t psa_lock_key_store( void )
+{
+    if( pthread_rwlock_wrlock( &psa_key_store_rwlock ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+psa_status_t psa_unlock_key_store( void )
+{
+    if( pthread_rwlock_unlock( &psa_key_store_rwlock ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+/** Acquire shared access to the key store. */
+static psa_status_t psa_lock_key_store_shared( void )
+{
+    if( pthread_rwlock_rdlock( &psa_key_store_rwlock ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+/** Release shared access to the key store. */
+static psa_status_t psa_unlock_key_store_shared( void )
+{
+    return( psa_unlock_key_store( ) );
+}
+
+/** Lock the stripe of a key slot. The caller must have shared access. */
+static psa_status_t psa_lock_key_slot_stripe( const psa_key_slot_t *slot )
+{
+    if( pthread_mutex_lock( psa_key_slot_stripe( slot ) ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+static psa_status_t psa_unlock_key_slot_stripe( const psa_key_slot_t *slot )
+{
+    if( pthread_mutex_unlock( psa_key_slot_stripe( slot ) ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+#else /* MBEDTLS_THREADING_PTHREAD */
+psa_status_t psa_lock_key_store( void )
+{
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+psa_status_t psa_unlock_key_store( void )
+{
+    if( mbedtls_mutex_unlock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+static psa_status_t psa_lock_key_store_shared( void )
+{
+    return( psa_lock_key_store( ) );
+}
+
+static psa_status_t psa_unlock_key_store_shared( void )
+{
+    return( psa_unlock_key_store( ) );
+}
+
+/* Shared access is exclusive, so there is nothing more to lock. */
+static psa_status_t psa_lock_key_slot_stripe( const psa_key_slot_t *slot )
+{
+    (void) slot;
+    return( PSA_SUCCESS );
+}
+
+static psa_status_t psa_unlock_key_slot_stripe( const psa_key_slot_t *slot )
+{
+    (void) slot;
+    return( PSA_SUCCESS );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+#if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) || \
+    defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
+static psa_status_t psa_lock_key_load( void )
+{
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_load_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+
+static psa_status_t psa_unlock_key_load( void )
+{
+    if( mbedtls_mutex_unlock( &mbedtls_threading_key_load_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+    return( PSA_SUCCESS );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
+#else /* MBEDTLS_THREADING_C */
+#define psa_lock_key_store_shared           psa_lock_key_store
+#define psa_unlock_key_store_shared         psa_unlock_key_store
+#define psa_lock_key_slot_stripe( slot )    ( (void) ( slot ), PSA_SUCCESS )
+#define psa_unlock_key_slot_stripe( slot )  ( (void) ( slot ), PSA_SUCCESS )
+#define psa_lock_key_load( )                PSA_SUCCESS
+#define psa_unlock_key_load( )              PSA_SUCCESS
+#endif /* MBEDTLS_THREADING_C */
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+static size_t psa_key_slot_count( void )
+{
+    return( PSA_KEY_SLAB_BASE( global_data.slab_count ) );
+}
+
+static psa_key_slot_t *psa_key_slot_at( size_t slot_idx )
+{
+    size_t k;
+
+    for( k = 0; k < global_data.slab_count; k++ )
+    {
+        if( slot_idx < PSA_KEY_SLAB_SIZE( k ) )
+            return( &global_data.slabs[k][slot_idx] );
+        slot_idx -= PSA_KEY_SLAB_SIZE( k );
+    }
+
+    return( NULL );
+}
+
+/* Allocate the next block of key slots and add them to the free list. */
+static psa_status_t psa_grow_key_slots( void )
+{
+    size_t k = global_data.slab_count;
+    size_t i;
+    psa_key_slot_t *slab;
+
+    if( k >= PSA_KEY_SLAB_LIMIT )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+
+    slab = mbedtls_calloc( PSA_KEY_SLAB_SIZE( k ), sizeof( psa_key_slot_t ) );
+    if( slab == NULL )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+
+    /* Push in reverse order, so that lower indexes are used first. */
+    for( i = PSA_KEY_SLAB_SIZE( k ); i-- > 0; )
+    {
+        slab[i].slot_index = PSA_KEY_SLAB_BASE( k ) + i;
+        slab[i].next = global_data.free_slots;
+        global_data.free_slots = &slab[i];
+    }
+
+    global_data.slabs[k] = slab;
+    global_data.slab_count = k + 1;
+
+    return( PSA_SUCCESS );
+}
+
+static size_t psa_key_id_hash( mbedtls_svc_key_id_t key )
+{
+    uint32_t h = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
+
+#if defined(MBEDTLS_PSA_CRYPTO_KEY_ID_ENCODES_OWNER)
+    h ^= (uint32_t) MBEDTLS_SVC_KEY_ID_GET_OWNER_ID( key ) * 0x85EBCA6Bu;
+#endif
+    h *= 0x9E3779B1u;
+    h ^= h >> 15;
+
+    return( h );
+}
+
+static psa_key_slot_t **psa_key_id_bucket( mbedtls_svc_key_id_t key )
+{
+    return( &global_data.buckets[psa_key_id_hash( key ) &
+                                 ( global_data.bucket_count - 1 )] );
+}
+
+/* Double the number of buckets. On allocation failure, keep the current
+ * ones: lookups are then slower, but still correct. */
+static void psa_grow_key_index( void )
+{
+    size_t i;
+    size_t bucket_count = global_data.bucket_count;
+    psa_key_slot_t **old_buckets = global_data.buckets;
+    psa_key_slot_t **bucket, *slot;
+
+    global_data.buckets = mbedtls_calloc( 2 * bucket_count,
+                                          sizeof( psa_key_slot_t * ) );
+    if( global_data.buckets == NULL )
+    {
+        global_data.buckets = old_buckets;
+        return;
+    }
+    global_data.bucket_count = 2 * bucket_count;
+
+    for( i = 0; i < bucket_count; i++ )
+    {
+        while( ( slot = old_buckets[i] ) != NULL )
+        {
+            old_buckets[i] = slot->next;
+            bucket = psa_key_id_bucket( slot->attr.id );
+            slot->next = *bucket;
+            *bucket = slot;
+        }
+    }
+
+    mbedtls_free( old_buckets );
+}
+
+static void psa_insert_key_slot( psa_key_slot_t *slot )
+{
+    psa_key_slot_t **bucket;
+
+    if( global_data.indexed_count >= 2 * global_data.bucket_count )
+        psa_grow_key_index( );
+
+    bucket = psa_key_id_bucket( slot->attr.id );
+    slot->next = *bucket;
+    *bucket = slot;
+    global_data.indexed_count++;
+}
+
+void psa_free_key_slot( psa_key_slot_t *slot )
+{
+    psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( slot->attr.id );
+    size_t slot_idx = slot->slot_index;
+    psa_key_slot_t **p;
+
+    if( key_id != 0 && ! psa_key_id_is_volatile( key_id ) )
+    {
+        for( p = psa_key_id_bucket( slot->attr.id ); *p != NULL;
+             p = &( *p )->next )
+        {
+            if( *p == slot )
+            {
+                *p = slot->next;
+                global_data.indexed_count--;
+                break;
+            }
+        }
+    }
+
+    /* The metadata is not particularly sensitive, so there is no need
+     * to call mbedtls_platform_zeroize(). */
+    memset( slot, 0, sizeof( *slot ) );
+    slot->slot_index = slot_idx;
+    slot->next = global_data.free_slots;
+    global_data.free_slots = slot;
+}
+#else /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+static size_t psa_key_slot_count( void )
+{
+    return( MBEDTLS_PSA_KEY_SLOT_COUNT );
+}
+
+static psa_key_slot_t *psa_key_slot_at( size_t slot_idx )
+{
+    if( slot_idx >= MBEDTLS_PSA_KEY_SLOT_COUNT )
+        return( NULL );
+
+    return( &global_data.key_slots[slot_idx] );
+}
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
 int psa_is_valid_key_id( mbedtls_svc_key_id_t key, int vendor_ok )
 {
     psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
@@ -67,6 +413,98 @@ int psa_is_valid_key_id( mbedtls_svc_key_id_t key, int vendor_ok )
     return( 0 );
 }
 
+/** Find the key slot containing the description of a key.
+ *
+ * For volatile key identifiers, only one key slot is queried as a volatile
+ * key with identifier key_id can only be stored in slot of index
+ * ( key_id - #PSA_KEY_ID_VOLATILE_MIN ).
+ *
+ * A key slot in the #PSA_SLOT_FULL state is preferred. Otherwise, the
+ * function may return a slot where the key is being created, loaded or
+ * destroyed.
+ *
+ * The caller must have shared or exclusive access to the key store.
+ *
+ * \param key           Key identifier to query.
+ *
+ * \return The key slot, or NULL if no key slot has this identifier.
+ */
+static psa_key_slot_t *psa_find_key_slot( mbedtls_svc_key_id_t key )
+{
+    psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
+    psa_key_slot_t *slot, *found = NULL;
+#if !defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    size_t slot_idx;
+#endif
+
+    if( psa_key_id_is_volatile( key_id ) )
+    {
+        slot = psa_key_slot_at( key_id - PSA_KEY_ID_VOLATILE_MIN );
+
+        /*
+         * Check if both the PSA key identifier key_id and the owner
+         * identifier of key match those of the key slot.
+         *
+         * Note that, if the key slot is not occupied, its PSA key identifier
+         * is equal to zero. This is an invalid value for a PSA key identifier
+         * and thus cannot be equal to the valid PSA key identifier key_id.
+         */
+        if( slot != NULL && mbedtls_svc_key_id_equal( key, slot->attr.id ) )
+            found = slot;
+        return( found );
+    }
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    for( slot = *psa_key_id_bucket( key ); slot != NULL; slot = slot->next )
+    {
+        if( ! mbedtls_svc_key_id_equal( key, slot->attr.id ) )
+            continue;
+        found = slot;
+        if( slot->state == PSA_SLOT_FULL )
+            break;
+    }
+#else
+    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+    {
+        slot = &global_data.key_slots[ slot_idx ];
+        if( ! mbedtls_svc_key_id_equal( key, slot->attr.id ) )
+            continue;
+        found = slot;
+        if( slot->state == PSA_SLOT_FULL )
+            break;
+    }
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
+    return( found );
+}
+
+psa_status_t psa_index_key_slot( psa_key_slot_t *slot )
+{
+    /* Volatile key identifiers map directly to their slot. */
+    if( psa_key_id_is_volatile( MBEDTLS_SVC_KEY_ID_GET_KEY_ID(
+                                                        slot->attr.id ) ) )
+        return( PSA_SUCCESS );
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    if( psa_find_key_slot( slot->attr.id ) != NULL )
+        return( PSA_ERROR_ALREADY_EXISTS );
+
+    psa_insert_key_slot( slot );
+#else
+    size_t slot_idx;
+
+    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+    {
+        const psa_key_slot_t *other = &global_data.key_slots[ slot_idx ];
+        if( other != slot &&
+            mbedtls_svc_key_id_equal( slot->attr.id, other->attr.id ) )
+            return( PSA_ERROR_ALREADY_EXISTS );
+    }
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
+    return( PSA_SUCCESS );
+}
+
 /** Get the description in memory of a key given its identifier and lock it.
  *
  * The descriptions of volatile keys and loaded persistent keys are
@@ -76,15 +514,13 @@ int psa_is_valid_key_id( mbedtls_svc_key_id_t key, int vendor_ok )
  * The function searches the key slots containing the description of the key
  * with \p key identifier. The function does only read accesses to the key
  * slots. The function does not load any persistent key thus does not access
- * any storage.
- *
- * For volatile key identifiers, only one key slot is queried as a volatile
- * key with identifier key_id can only be stored in slot of index
- * ( key_id - #PSA_KEY_ID_VOLATILE_MIN ).
+ * any storage. Keys that are being created or destroyed are not found.
  *
  * On success, the function locks the key slot. It is the responsibility of
  * the caller to unlock the key slot when it does not access it anymore.
  *
+ * The caller must have shared or exclusive access to the key store.
+ *
  * \param key           Key identifier to query.
  * \param[out] p_slot   On success, `*p_slot` contains a pointer to the
  *                      key slot containing the description of the key
@@ -103,54 +539,42 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
-    size_t slot_idx;
-    psa_key_slot_t *slot = NULL;
-
-    if( psa_key_id_is_volatile( key_id ) )
-    {
-        slot = &global_data.key_slots[ key_id - PSA_KEY_ID_VOLATILE_MIN ];
+    psa_key_slot_t *slot;
 
-        /*
-         * Check if both the PSA key identifier key_id and the owner
-         * identifier of key match those of the key slot.
-         *
-         * Note that, if the key slot is not occupied, its PSA key identifier
-         * is equal to zero. This is an invalid value for a PSA key identifier
-         * and thus cannot be equal to the valid PSA key identifier key_id.
-         */
-        status = mbedtls_svc_key_id_equal( key, slot->attr.id ) ?
-                 PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
-    }
-    else
-    {
-        if ( !psa_is_valid_key_id( key, 1 ) )
-            return( PSA_ERROR_INVALID_HANDLE );
+    if( ! psa_key_id_is_volatile( key_id ) &&
+        ! psa_is_valid_key_id( key, 1 ) )
+        return( PSA_ERROR_INVALID_HANDLE );
 
-        for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
-        {
-            slot = &global_data.key_slots[ slot_idx ];
-            if( mbedtls_svc_key_id_equal( key, slot->attr.id ) )
-                break;
-        }
-        status = ( slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT ) ?
-                 PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
-    }
+    slot = psa_find_key_slot( key );
+    if( slot == NULL || slot->state != PSA_SLOT_FULL )
+        return( PSA_ERROR_DOES_NOT_EXIST );
 
+    status = psa_lock_key_slot_stripe( slot );
+    if( status != PSA_SUCCESS )
+        return( status );
+    status = psa_lock_key_slot( slot );
+    if( psa_unlock_key_slot_stripe( slot ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
     if( status == PSA_SUCCESS )
-    {
-        status = psa_lock_key_slot( slot );
-        if( status == PSA_SUCCESS )
-            *p_slot = slot;
-    }
+        *p_slot = slot;
 
     return( status );
 }
 
 psa_status_t psa_initialize_key_slots( void )
 {
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    /* Key slots are allocated on demand by psa_get_empty_key_slot(). */
+    global_data.buckets = mbedtls_calloc( PSA_KEY_INDEX_MIN_BUCKETS,
+                                          sizeof( psa_key_slot_t * ) );
+    if( global_data.buckets == NULL )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+    global_data.bucket_count = PSA_KEY_INDEX_MIN_BUCKETS;
+#else
     /* Nothing to do: program startup and psa_wipe_all_key_slots() both
      * guarantee that the key slots are initialized to all-zero, which
      * means that all the key slots are in a valid, empty state. */
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
     global_data.key_slots_initialized = 1;
     return( PSA_SUCCESS );
 }
@@ -158,14 +582,36 @@ psa_status_t psa_initialize_key_slots( void )
 void psa_wipe_all_key_slots( void )
 {
     size_t slot_idx;
+    /* Wipe the key slots even if the key store cannot be locked, since the
+     * library is being shut down anyway. */
+    psa_status_t lock_status = psa_lock_key_store( );
 
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    size_t k;
+
+    /* The whole store is released below, so only the key material needs
+     * to be freed, without returning the slots to the free list. */
+    for( k = 0; k < global_data.slab_count; k++ )
+    {
+        for( slot_idx = 0; slot_idx < PSA_KEY_SLAB_SIZE( k ); slot_idx++ )
+            (void) psa_remove_key_data_from_memory(
+                                        &global_data.slabs[k][slot_idx] );
+        mbedtls_free( global_data.slabs[k] );
+    }
+    mbedtls_free( global_data.buckets );
+    memset( &global_data, 0, sizeof( global_data ) );
+#else
     for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
     {
         psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
         slot->lock_count = 1;
         (void) psa_wipe_key_slot( slot );
     }
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
     global_data.key_slots_initialized = 0;
+
+    if( lock_status == PSA_SUCCESS )
+        (void) psa_unlock_key_store( );
 }
 
 psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
@@ -182,16 +628,33 @@ psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
     }
 
     selected_slot = unlocked_persistent_key_slot = NULL;
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+    /* Grow the store when it is full, and only evict persistent keys when
+     * it cannot grow any more. */
+    if( global_data.free_slots == NULL )
+        (void) psa_grow_key_slots( );
+    selected_slot = global_data.free_slots;
+
+    for( slot_idx = 0;
+         selected_slot == NULL && slot_idx < psa_key_slot_count( );
+         slot_idx++ )
+#else
     for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
     {
-        psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
-        if( ! psa_is_key_slot_occupied( slot ) )
+        psa_key_slot_t *slot = psa_key_slot_at( slot_idx );
+#if !defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+        /* With a dynamic store, empty slots are all on the free list,
+         * which is empty here. */
+        if( slot->state == PSA_SLOT_EMPTY )
         {
             selected_slot = slot;
             break;
         }
+#endif /* !MBEDTLS_PSA_KEY_STORE_DYNAMIC */
 
         if( ( unlocked_persistent_key_slot == NULL ) &&
+            ( slot->state == PSA_SLOT_FULL ) &&
             ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
             ( ! psa_is_key_slot_locked( slot ) ) )
             unlocked_persistent_key_slot = slot;
@@ -214,12 +677,26 @@ psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
 
     if( selected_slot != NULL )
     {
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+        /* Any empty slot is at the head of the free list, including the
+         * one just wiped. */
+        selected_slot = global_data.free_slots;
+        global_data.free_slots = selected_slot->next;
+        selected_slot->next = NULL;
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
        status = psa_lock_key_slot( selected_slot );
        if( status != PSA_SUCCESS )
            goto error;
+        selected_slot->state = PSA_SLOT_FILLING;
 
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+        *volatile_key_id = PSA_KEY_ID_VOLATILE_MIN +
+            ( (psa_key_id_t) selected_slot->slot_index );
+#else
         *volatile_key_id = PSA_KEY_ID_VOLATILE_MIN +
             ( (psa_key_id_t)( selected_slot - global_data.key_slots ) );
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
         *p_slot = selected_slot;
 
         return( PSA_SUCCESS );
@@ -334,9 +811,15 @@ static psa_status_t psa_load_builtin_key_into_slot( psa_key_slot_t *slot )
     if( status != PSA_SUCCESS )
         goto exit;
 
-    /* Copy actual key length and core attributes into the slot on success */
+    /* Copy actual key length and core attributes into the slot on success.
+     * The key identifier is already set, and other threads may be reading
+     * it to look up keys, so leave it alone. */
     slot->key.bytes = key_buffer_length;
-    slot->attr = attributes.core;
+    slot->attr.type = attributes.core.type;
+    slot->attr.bits = attributes.core.bits;
+    slot->attr.lifetime = attributes.core.lifetime;
+    slot->attr.policy = attributes.core.policy;
+    slot->attr.flags = attributes.core.flags;
 
 exit:
     if( status != PSA_SUCCESS )
@@ -345,63 +828,156 @@ exit:
 }
 #endif /* MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 
-psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
-                                        psa_key_slot_t **p_slot )
-{
-    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-
-    *p_slot = NULL;
-    if( ! global_data.key_slots_initialized )
-        return( PSA_ERROR_BAD_STATE );
-
-    /*
-     * On success, the pointer to the slot is passed directly to the caller
-     * thus no need to unlock the key slot here.
-     */
-    status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
-    if( status != PSA_ERROR_DOES_NOT_EXIST )
-        return( status );
-
-    /* Loading keys from storage requires support for such a mechanism */
 #if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) || \
     defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
+/** Load a persistent or built-in key into a key slot and lock it.
+ *
+ * The key is loaded without holding the key store lock, in a key slot in
+ * the #PSA_SLOT_FILLING state which other threads cannot use. Only one key
+ * is loaded at a time, so if several threads ask for the same key, the
+ * first one loads it and the others find it in memory.
+ *
+ * The caller must not have any access to the key store.
+ */
+static psa_status_t psa_load_and_lock_key_slot( mbedtls_svc_key_id_t key,
+                                                psa_key_slot_t **p_slot )
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_id_t volatile_key_id;
+    psa_key_slot_t *slot = NULL;
 
-    status = psa_get_empty_key_slot( &volatile_key_id, p_slot );
+    status = psa_lock_key_load( );
     if( status != PSA_SUCCESS )
         return( status );
 
-    (*p_slot)->attr.id = key;
-    (*p_slot)->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+    status = psa_lock_key_store( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+
+    /* Another thread may have loaded the key while this one was waiting. */
+    status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
+    if( status == PSA_ERROR_DOES_NOT_EXIST )
+    {
+        /* The key is being created or destroyed by another thread: it does
+         * not exist yet, or any more. Loading it from storage would leave
+         * two copies of the key in memory. */
+        if( psa_find_key_slot( key ) != NULL )
+            status = PSA_ERROR_INVALID_HANDLE;
+        else
+            status = psa_get_empty_key_slot( &volatile_key_id, &slot );
+    }
+    if( slot != NULL )
+    {
+        slot->attr.id = key;
+        slot->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+
+        /* This cannot fail: no other slot has this identifier. */
+        status = psa_index_key_slot( slot );
+    }
+
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+    if( status != PSA_SUCCESS || slot == NULL )
+    {
+        /* Either an error, or the key was found in memory. If the key store
+         * could not be unlocked, a slot may stay locked, but the library is
+         * unusable anyway. */
+        if( status != PSA_SUCCESS )
+            *p_slot = NULL;
+        goto exit;
+    }
 
     status = PSA_ERROR_DOES_NOT_EXIST;
+
 #if defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
     /* Load keys in the 'builtin' range through their own interface */
-    status = psa_load_builtin_key_into_slot( *p_slot );
+    status = psa_load_builtin_key_into_slot( slot );
 #endif /* MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 
 #if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C)
     if( status == PSA_ERROR_DOES_NOT_EXIST )
-        status = psa_load_persistent_key_into_slot( *p_slot );
+        status = psa_load_persistent_key_into_slot( slot );
 #endif /* defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) */
 
-    if( status != PSA_SUCCESS )
+    /* Add implicit usage flags. */
+    if( status == PSA_SUCCESS )
+        psa_extend_key_usage_flags( &slot->attr.policy.usage );
+
+    if( psa_lock_key_store( ) != PSA_SUCCESS )
+    {
+        status = PSA_ERROR_BAD_STATE;
+        goto exit;
+    }
+    if( status == PSA_SUCCESS )
+    {
+        slot->state = PSA_SLOT_FULL;
+        *p_slot = slot;
+    }
+    else
     {
-        psa_wipe_key_slot( *p_slot );
+        psa_wipe_key_slot( slot );
         if( status == PSA_ERROR_DOES_NOT_EXIST )
             status = PSA_ERROR_INVALID_HANDLE;
     }
-    else
-        /* Add implicit usage flags. */
-        psa_extend_key_usage_flags( &(*p_slot)->attr.policy.usage );
+    if( psa_unlock_key_store( ) != PSA_SUCCESS && status == PSA_SUCCESS )
+    {
+        status = PSA_ERROR_BAD_STATE;
+        *p_slot = NULL;
+    }
+
+exit:
+    if( psa_unlock_key_load( ) != PSA_SUCCESS && status == PSA_SUCCESS )
+    {
+        /* The slot is locked but the caller will never use it. */
+        status = PSA_ERROR_BAD_STATE;
+        *p_slot = NULL;
+    }
 
     return( status );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
+
+psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
+                                        psa_key_slot_t **p_slot )
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+    *p_slot = NULL;
+    if( ! global_data.key_slots_initialized )
+        return( PSA_ERROR_BAD_STATE );
+
+    status = psa_lock_key_store_shared( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    /*
+     * On success, the pointer to the slot is passed directly to the caller
+     * thus no need to unlock the key slot here.
+     */
+    status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
+
+    if( psa_unlock_key_store_shared( ) != PSA_SUCCESS &&
+        status == PSA_SUCCESS )
+    {
+        /* The slot is locked but the caller will never use it. */
+        status = PSA_ERROR_BAD_STATE;
+        *p_slot = NULL;
+    }
+    if( status != PSA_ERROR_DOES_NOT_EXIST )
+        return( status );
+
+    /* Loading keys from storage requires support for such a mechanism */
+#if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) || \
+    defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
+    return( psa_load_and_lock_key_slot( key, p_slot ) );
 #else /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
     return( PSA_ERROR_INVALID_HANDLE );
 #endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 }
 
-psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
+/** Unlock a key slot. The caller must hold the key store lock, or have
+ * shared access and hold the lock stripe of the slot. */
+static psa_status_t psa_unlock_key_slot_in_store( psa_key_slot_t *slot )
 {
     if( slot == NULL )
         return( PSA_SUCCESS );
@@ -424,6 +1000,47 @@ psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
     return( PSA_ERROR_CORRUPTION_DETECTED );
 }
 
+psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
+{
+    psa_status_t status;
+
+    if( slot == NULL )
+        return( PSA_SUCCESS );
+
+    status = psa_lock_key_store_shared( );
+    if( status != PSA_SUCCESS )
+        return( status );
+    status = psa_lock_key_slot_stripe( slot );
+    if( status == PSA_SUCCESS )
+    {
+        status = psa_unlock_key_slot_in_store( slot );
+        if( psa_unlock_key_slot_stripe( slot ) != PSA_SUCCESS )
+            status = PSA_ERROR_BAD_STATE;
+    }
+
+    if( psa_unlock_key_store_shared( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+
+    return( status );
+}
+
+psa_status_t psa_unlock_filled_key_slot( psa_key_slot_t *slot )
+{
+    psa_status_t status;
+
+    status = psa_lock_key_store( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    slot->state = PSA_SLOT_FULL;
+    status = psa_unlock_key_slot_in_store( slot );
+
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+
+    return( status );
+}
+
 psa_status_t psa_validate_key_location( psa_key_lifetime_t lifetime,
                                         psa_se_drv_table_entry_t **p_drv )
 {
@@ -513,18 +1130,25 @@ psa_status_t psa_close_key( psa_key_handle_t handle )
     if( psa_key_handle_is_null( handle ) )
         return( PSA_SUCCESS );
 
+    status = psa_lock_key_store( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
     status = psa_get_and_lock_key_slot_in_memory( handle, &slot );
     if( status != PSA_SUCCESS )
     {
         if( status == PSA_ERROR_DOES_NOT_EXIST )
             status = PSA_ERROR_INVALID_HANDLE;
-
-        return( status );
     }
-    if( slot->lock_count <= 1 )
-        return( psa_wipe_key_slot( slot ) );
+    else if( slot->lock_count <= 1 )
+        status = psa_wipe_key_slot( slot );
     else
-        return( psa_unlock_key_slot( slot ) );
+        status = psa_unlock_key_slot_in_store( slot );
+
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+
+    return( status );
 }
 
 psa_status_t psa_purge_key( mbedtls_svc_key_id_t key )
@@ -532,15 +1156,24 @@ psa_status_t psa_purge_key( mbedtls_svc_key_id_t key )
     psa_status_t status;
     psa_key_slot_t *slot;
 
-    status = psa_get_and_lock_key_slot_in_memory( key, &slot );
+    status = psa_lock_key_store( );
     if( status != PSA_SUCCESS )
         return( status );
 
-    if( ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
-        ( slot->lock_count <= 1 ) )
-        return( psa_wipe_key_slot( slot ) );
-    else
-        return( psa_unlock_key_slot( slot ) );
+    status = psa_get_and_lock_key_slot_in_memory( key, &slot );
+    if( status == PSA_SUCCESS )
+    {
+        if( ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
+            ( slot->lock_count <= 1 ) )
+            status = psa_wipe_key_slot( slot );
+        else
+            status = psa_unlock_key_slot_in_store( slot );
+    }
+
+    if( psa_unlock_key_store( ) != PSA_SUCCESS )
+        status = PSA_ERROR_BAD_STATE;
+
+    return( status );
 }
 
 void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
@@ -549,9 +1182,12 @@ void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
 
     memset( stats, 0, sizeof( *stats ) );
 
-    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+    if( psa_lock_key_store( ) != PSA_SUCCESS )
+        return;
+
+    for( slot_idx = 0; slot_idx < psa_key_slot_count( ); slot_idx++ )
     {
-        const psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
+        const psa_key_slot_t *slot = psa_key_slot_at( slot_idx );
         if( psa_is_key_slot_locked( slot ) )
         {
             ++stats->locked_slots;
@@ -579,6 +1215,8 @@ void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
                 stats->max_open_external_key_id = id;
         }
     }
+
+    (void) psa_unlock_key_store( );
 }
 
 #endif /* MBEDTLS_PSA_CRYPTO_C */
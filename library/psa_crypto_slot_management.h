@@ -25,22 +25,58 @@
 #include "psa_crypto_core.h"
 #include "psa_crypto_se.h"
 
-/** Range of volatile key identifiers.
+#include <string.h>
+
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+/** The number of blocks of key slots the key store can grow to.
  *
- *  The last #MBEDTLS_PSA_KEY_SLOT_COUNT identifiers of the implementation
- *  range of key identifiers are reserved for volatile key identifiers.
- *  A volatile key identifier is equal to #PSA_KEY_ID_VOLATILE_MIN plus the
- *  index of the key slot containing the volatile key definition.
+ *  Block \c k holds #MBEDTLS_PSA_KEY_SLOT_COUNT << \c k key slots.
  */
+#define PSA_KEY_SLOT_SLAB_COUNT  16
 
-/** The minimum value for a volatile key identifier.
+#if defined(MBEDTLS_TEST_HOOKS)
+/** The number of blocks of key slots the key store may grow to, at most
+ *  #PSA_KEY_SLOT_SLAB_COUNT. Tests lower it to run out of key slots
+ *  without creating millions of keys: with a limit of \c n blocks, the
+ *  key store holds at most #MBEDTLS_PSA_KEY_SLOT_COUNT * (2^n - 1) keys.
+ */
+extern size_t mbedtls_test_hook_psa_key_slab_limit;
+#endif /* MBEDTLS_TEST_HOOKS */
+
+/** The maximum number of key slots.
+ */
+#define PSA_KEY_SLOT_MAX_COUNT   ( (psa_key_id_t) MBEDTLS_PSA_KEY_SLOT_COUNT * \
+                                   ( ( 1u << PSA_KEY_SLOT_SLAB_COUNT ) - 1 ) )
+#else
+#define PSA_KEY_SLOT_MAX_COUNT   MBEDTLS_PSA_KEY_SLOT_COUNT
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
+/** Range of volatile key identifiers.
+ *
+ *  The last #PSA_KEY_SLOT_MAX_COUNT identifiers of the implementation
+ *  range of key identifiers are reserved for volatile key identifiers.
+ *  With a dynamic key store, this range ends just below the range of
+ *  built-in keys. A volatile key identifier is equal to
+ *  #PSA_KEY_ID_VOLATILE_MIN plus the index of the key slot containing the
+ *  volatile key definition.
  */
-#define PSA_KEY_ID_VOLATILE_MIN  ( PSA_KEY_ID_VENDOR_MAX - \
-                                   MBEDTLS_PSA_KEY_SLOT_COUNT + 1 )
 
 /** The maximum value for a volatile key identifier.
  */
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+#define PSA_KEY_ID_VOLATILE_MAX  ( MBEDTLS_PSA_KEY_ID_BUILTIN_MIN - 1 )
+#else
 #define PSA_KEY_ID_VOLATILE_MAX  PSA_KEY_ID_VENDOR_MAX
+#endif
+
+/** The minimum value for a volatile key identifier.
+ */
+#define PSA_KEY_ID_VOLATILE_MIN  ( PSA_KEY_ID_VOLATILE_MAX - \
+                                   PSA_KEY_SLOT_MAX_COUNT + 1 )
 
 /** Test whether a key identifier is a volatile key identifier.
  *
@@ -98,7 +134,7 @@ psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
 /** Initialize the key slot structures.
  *
  * \retval #PSA_SUCCESS
- *         Currently this function always succeeds.
+ * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
  */
 psa_status_t psa_initialize_key_slots( void );
 
@@ -107,12 +143,46 @@ psa_status_t psa_initialize_key_slots( void );
  * This does not affect persistent storage. */
 void psa_wipe_all_key_slots( void );
 
+#if defined(MBEDTLS_THREADING_C) && defined(MBEDTLS_PSA_CRYPTO_C)
+/** Acquire exclusive access to the key store.
+ *
+ * Exclusive access is required to add or remove key slots, to change the
+ * index of key identifiers, and to change the state of a key slot.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The key store lock could not be acquired.
+ */
+psa_status_t psa_lock_key_store( void );
+
+/** Release exclusive access to the key store.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The key store lock could not be released.
+ */
+psa_status_t psa_unlock_key_store( void );
+#else
+static inline psa_status_t psa_lock_key_store( void )
+{
+    return( PSA_SUCCESS );
+}
+
+static inline psa_status_t psa_unlock_key_store( void )
+{
+    return( PSA_SUCCESS );
+}
+#endif /* MBEDTLS_THREADING_C && MBEDTLS_PSA_CRYPTO_C */
+
 /** Find a free key slot.
  *
  * This function returns a key slot that is available for use and is in its
- * ground state (all-bits-zero). On success, the key slot is locked. It is
- * the responsibility of the caller to unlock the key slot when it does not
- * access it anymore.
+ * ground state (all-bits-zero). On success, the key slot is locked and in
+ * the #PSA_SLOT_FILLING state. It is the responsibility of the caller to
+ * call psa_unlock_filled_key_slot() once the key is ready, or
+ * psa_wipe_key_slot() on failure.
+ *
+ * The caller must hold the key store lock (see psa_lock_key_store()).
  *
  * \param[out] volatile_key_id   On success, volatile key identifier
  *                               associated to the returned slot.
@@ -125,10 +195,51 @@ void psa_wipe_all_key_slots( void );
 psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
                                      psa_key_slot_t **p_slot );
 
+/** Make a key slot findable by its key identifier.
+ *
+ * This function must be called after setting the identifier of a key
+ * slot to a non-volatile key identifier. Volatile key identifiers do not
+ * need it, since they map directly to a key slot.
+ *
+ * The caller must hold the key store lock.
+ *
+ * \param[in] slot  The key slot, returned by psa_get_empty_key_slot().
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_ALREADY_EXISTS
+ *         Another key slot has the same key identifier: the key is already
+ *         in memory, or is being created, loaded or destroyed.
+ */
+psa_status_t psa_index_key_slot( psa_key_slot_t *slot );
+
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC)
+
+/** Return a key slot whose key material has been freed to the key store.
+ *
+ * This function clears the metadata of the key slot, and makes it
+ * available to psa_get_empty_key_slot() again.
+ *
+ * The caller must hold the key store lock.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_free_key_slot( psa_key_slot_t *slot );
+#else
+static inline void psa_free_key_slot( psa_key_slot_t *slot )
+{
+    /* The metadata is not particularly sensitive, so there is no need
+     * to call mbedtls_platform_zeroize(). */
+    memset( slot, 0, sizeof( *slot ) );
+}
+#endif /* MBEDTLS_PSA_KEY_STORE_DYNAMIC */
+
 /** Lock a key slot.
  *
  * This function increments the key slot lock counter by one.
  *
+ * The caller must hold the key store lock, or have shared access to the
+ * key store and hold the lock stripe of the slot.
+ *
  * \param[in] slot  The key slot.
  *
  * \retval #PSA_SUCCESS
@@ -149,7 +260,9 @@ static inline psa_status_t psa_lock_key_slot( psa_key_slot_t *slot )
 
 /** Unlock a key slot.
  *
- * This function decrements the key slot lock counter by one.
+ * This function decrements the key slot lock counter by one. It acquires
+ * shared access to the key store itself, so the caller must not hold the
+ * key store lock.
  *
  * \note To ease the handling of errors in retrieving a key slot
  *       a NULL input pointer is valid, and the function returns
@@ -165,6 +278,22 @@ static inline psa_status_t psa_lock_key_slot( psa_key_slot_t *slot )
  */
 psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot );
 
+/** Make a key slot filled after psa_get_empty_key_slot() usable, and
+ * unlock it.
+ *
+ * This function sets the state of the key slot to #PSA_SLOT_FULL, so that
+ * the key can be found by its identifier, then decrements the key slot
+ * lock counter by one. It acquires the key store lock itself.
+ *
+ * \param[in] slot  The key slot.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_CORRUPTION_DETECTED
+ *             The lock counter was equal to 0.
+ * \retval #PSA_ERROR_BAD_STATE
+ */
+psa_status_t psa_unlock_filled_key_slot( psa_key_slot_t *slot );
+
 /** Test whether a lifetime designates a key in an external cryptoprocessor.
  *
  * \param lifetime      The lifetime to test.
@@ -0,0 +1,262 @@
+/*
+ *  PSA operation statistics
+ */
+/*  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/*
+ * The statistics are kept in a fixed table of MBEDTLS_PSA_STATS_MAX_ENTRIES
+ * entries. The last entry is the overflow entry; the others are found by
+ * open addressing on a hash of (operation, algorithm, driver). An entry is
+ * in use when its call count is nonzero, and entries are never removed
+ * except by mbedtls_psa_reset_op_stats(), so a lookup can stop at the first
+ * unused entry.
+ *
+ * The latency histogram has a bucket for durations below 64ns, then four
+ * buckets per power of two: a duration v with 2^e <= v < 2^(e+1) goes to
+ * sub-bucket (v >> (e - 2)) & 3 of the group for e.
+ */
+
+/* For clock_gettime() */
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "common.h"
+
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+
+#include "psa_crypto_stats.h"
+
+#include "mbedtls/threading.h"
+
+#include <string.h>
+
+#if defined(_WIN32) && !defined(EFIX64) && !defined(EFI32)
+#include <windows.h>
+#define PSA_STATS_HAVE_QPC
+#elif defined(unix) || defined(__unix) || defined(__unix__) || \
+    ( defined(__APPLE__) && defined(__MACH__) )
+#include <time.h>
+#include <unistd.h>
+#if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0 && defined(CLOCK_MONOTONIC)
+#define PSA_STATS_HAVE_CLOCK_GETTIME
+#endif
+#endif
+
+/* Durations below 2^PSA_STATS_MIN_SHIFT ns all go to bucket 0. */
+#define PSA_STATS_MIN_SHIFT 6
+#define PSA_STATS_OVERFLOW_INDEX ( MBEDTLS_PSA_STATS_MAX_ENTRIES - 1 )
+
+static mbedtls_psa_op_stats_t psa_stats_table[MBEDTLS_PSA_STATS_MAX_ENTRIES];
+
+uint64_t mbedtls_psa_stats_clock( void )
+{
+#if defined(PSA_STATS_HAVE_CLOCK_GETTIME)
+    struct timespec now;
+
+    if( clock_gettime( CLOCK_MONOTONIC, &now ) != 0 )
+        return( 0 );
+    return( (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec );
+#elif defined(PSA_STATS_HAVE_QPC)
+    LARGE_INTEGER now, frequency;
+    uint64_t ticks, hz;
+
+    if( ! QueryPerformanceCounter( &now ) ||
+        ! QueryPerformanceFrequency( &frequency ) ||
+        frequency.QuadPart <= 0 )
+        return( 0 );
+    ticks = (uint64_t) now.QuadPart;
+    hz = (uint64_t) frequency.QuadPart;
+    return( ticks / hz * 1000000000u + ticks % hz * 1000000000u / hz );
+#else
+    return( 0 );
+#endif
+}
+
+static size_t psa_stats_bucket( uint64_t duration )
+{
+    unsigned e = 0;
+    size_t index;
+
+    if( duration < ( (uint64_t) 1 << PSA_STATS_MIN_SHIFT ) )
+        return( 0 );
+
+    while( ( duration >> e ) > 1 )
+        e++;
+    index = 1 + 4 * ( e - PSA_STATS_MIN_SHIFT ) +
+            (size_t) ( ( duration >> ( e - 2 ) ) & 3 );
+    if( index >= MBEDTLS_PSA_STATS_LATENCY_BUCKETS )
+        index = MBEDTLS_PSA_STATS_LATENCY_BUCKETS - 1;
+    return( index );
+}
+
+uint64_t mbedtls_psa_op_stats_bucket_limit( size_t bucket )
+{
+    unsigned e;
+
+    if( bucket == 0 )
+        return( (uint64_t) 1 << PSA_STATS_MIN_SHIFT );
+    if( bucket >= MBEDTLS_PSA_STATS_LATENCY_BUCKETS - 1 )
+        return( UINT64_MAX );
+
+    e = PSA_STATS_MIN_SHIFT + (unsigned) ( ( bucket - 1 ) / 4 );
+    return( (uint64_t) ( 4 + ( bucket - 1 ) % 4 + 1 ) << ( e - 2 ) );
+}
+
+uint64_t mbedtls_psa_op_stats_percentile( const mbedtls_psa_op_stats_t *stats,
+                                          unsigned permille )
+{
+    uint64_t total = 0;
+    uint64_t target;
+    uint64_t seen = 0;
+    size_t i;
+
+    for( i = 0; i < MBEDTLS_PSA_STATS_LATENCY_BUCKETS; i++ )
+        total += stats->latency[i];
+    if( total == 0 )
+        return( 0 );
+
+    if( permille > 1000 )
+        permille = 1000;
+    /* The rank of the requested sample, rounded up, and at least 1. */
+    target = ( total * permille + 999 ) / 1000;
+    if( target == 0 )
+        target = 1;
+
+    for( i = 0; i < MBEDTLS_PSA_STATS_LATENCY_BUCKETS; i++ )
+    {
+        seen += stats->latency[i];
+        if( seen >= target )
+            break;
+    }
+    return( mbedtls_psa_op_stats_bucket_limit( i ) );
+}
+
+static mbedtls_psa_op_stats_t *psa_stats_find( mbedtls_psa_stats_op_t op,
+                                               psa_algorithm_t alg,
+                                               unsigned int driver )
+{
+    uint32_t h = ( (uint32_t) op * 0x9E3779B1u ) ^ alg ^ ( driver << 24 );
+    size_t i, n;
+    mbedtls_psa_op_stats_t *entry;
+
+    h ^= h >> 15;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+
+    for( n = 0; n < PSA_STATS_OVERFLOW_INDEX; n++ )
+    {
+        i = ( h + n ) % PSA_STATS_OVERFLOW_INDEX;
+        entry = &psa_stats_table[i];
+        if( entry->calls == 0 )
+        {
+            entry->op = op;
+            entry->alg = alg;
+            entry->driver = driver;
+            return( entry );
+        }
+        if( entry->op == op && entry->alg == alg && entry->driver == driver )
+            return( entry );
+    }
+
+    entry = &psa_stats_table[PSA_STATS_OVERFLOW_INDEX];
+    entry->op = MBEDTLS_PSA_STATS_OVERFLOW;
+    entry->alg = 0;
+    entry->driver = 0;
+    return( entry );
+}
+
+void mbedtls_psa_stats_record( mbedtls_psa_stats_op_t op,
+                               psa_algorithm_t alg,
+                               unsigned int driver,
+                               size_t bytes,
+                               psa_status_t status,
+                               uint64_t start )
+{
+    uint64_t end = ( start != 0 ) ? mbedtls_psa_stats_clock( ) : 0;
+    mbedtls_psa_op_stats_t *entry;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_stats_mutex ) != 0 )
+        return;
+#endif
+
+    entry = psa_stats_find( op, alg, driver );
+    entry->calls++;
+    if( status != PSA_SUCCESS )
+        entry->failures++;
+    entry->bytes += bytes;
+    if( end != 0 )
+    {
+        size_t bucket = psa_stats_bucket( end >= start ? end - start : 0 );
+        if( entry->latency[bucket] != UINT32_MAX )
+            entry->latency[bucket]++;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_psa_stats_mutex );
+#endif
+}
+
+psa_status_t mbedtls_psa_get_op_stats( mbedtls_psa_op_stats_t *stats,
+                                       size_t stats_size,
+                                       size_t *stats_length )
+{
+    psa_status_t status = PSA_SUCCESS;
+    size_t i;
+
+    *stats_length = 0;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_stats_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+#endif
+
+    for( i = 0; i < MBEDTLS_PSA_STATS_MAX_ENTRIES; i++ )
+    {
+        if( psa_stats_table[i].calls == 0 )
+            continue;
+        if( *stats_length == stats_size )
+        {
+            status = PSA_ERROR_BUFFER_TOO_SMALL;
+            break;
+        }
+        stats[*stats_length] = psa_stats_table[i];
+        ++*stats_length;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_psa_stats_mutex );
+#endif
+
+    return( status );
+}
+
+void mbedtls_psa_reset_op_stats( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_stats_mutex ) != 0 )
+        return;
+#endif
+
+    memset( psa_stats_table, 0, sizeof( psa_stats_table ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_psa_stats_mutex );
+#endif
+}
+
+#endif /* MBEDTLS_PSA_CRYPTO_INSTRUMENTATION */
@@ -0,0 +1,78 @@
+/*
+ *  PSA operation statistics
+ */
+/*  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PSA_CRYPTO_STATS_H
+#define PSA_CRYPTO_STATS_H
+
+#include "common.h"
+
+#include <psa/crypto.h>
+
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+
+/** Read the clock used to measure the latency of operations.
+ *
+ * \return  A monotonic time in nanoseconds, or 0 if the platform has no
+ *          known monotonic clock.
+ */
+uint64_t mbedtls_psa_stats_clock( void );
+
+/** Account one call of a PSA operation.
+ *
+ * \param op        The kind of operation.
+ * \param alg       The algorithm of the operation.
+ * \param driver    The identifier of the driver that handled the operation,
+ *                  or 0 if it is not known.
+ * \param bytes     The number of input bytes of the call.
+ * \param status    The status that the call returns.
+ * \param start     The value of mbedtls_psa_stats_clock() when the call
+ *                  started. If this is 0, no latency is recorded.
+ */
+void mbedtls_psa_stats_record( mbedtls_psa_stats_op_t op,
+                               psa_algorithm_t alg,
+                               unsigned int driver,
+                               size_t bytes,
+                               psa_status_t status,
+                               uint64_t start );
+
+/* Declare a variable \p start holding the start time of a call. */
+#define PSA_STATS_START( start )                        \
+    uint64_t start = mbedtls_psa_stats_clock( )
+
+/* Account the call started at \p start. */
+#define PSA_STATS_RECORD( op, alg, driver, bytes, status, start )         \
+    mbedtls_psa_stats_record( ( op ), ( alg ), ( driver ), ( bytes ),     \
+                              ( status ), ( start ) )
+
+/* Remember the algorithm of a multipart operation for its later steps. */
+#define PSA_STATS_SET_ALG( operation, alg )             \
+    ( operation )->stats_alg = ( alg )
+
+#else /* MBEDTLS_PSA_CRYPTO_INSTRUMENTATION */
+
+#define PSA_STATS_START( start )                                    \
+    do {} while( 0 )
+#define PSA_STATS_RECORD( op, alg, driver, bytes, status, start )   \
+    do {} while( 0 )
+#define PSA_STATS_SET_ALG( operation, alg )                         \
+    do {} while( 0 )
+
+#endif /* MBEDTLS_PSA_CRYPTO_INSTRUMENTATION */
+
+#endif /* PSA_CRYPTO_STATS_H */
@@ -50,8 +50,11 @@
       16 + /*UID (64-bit number in hex)*/                               \
       sizeof( PSA_ITS_STORAGE_SUFFIX ) - 1 + /*suffix without terminating 0*/ \
       1 /*terminating null byte*/ )
-#define PSA_ITS_STORAGE_TEMP \
-    PSA_ITS_STORAGE_PREFIX "tempfile" PSA_ITS_STORAGE_SUFFIX
+/* Each file has its own temporary file, so that different files can be
+ * written concurrently. */
+#define PSA_ITS_STORAGE_TEMP_SUFFIX ".tmp"
+#define PSA_ITS_STORAGE_TEMP_FILENAME_LENGTH    \
+    ( PSA_ITS_STORAGE_FILENAME_LENGTH + sizeof( PSA_ITS_STORAGE_TEMP_SUFFIX ) - 1 )
 
 /* The maximum value of psa_storage_info_t.size */
 #define PSA_ITS_MAX_SIZE 0xffffffff
@@ -191,6 +194,7 @@ psa_status_t psa_its_set( psa_storage_uid_t uid,
 
     psa_status_t status = PSA_ERROR_STORAGE_FAILURE;
     char filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+    char temp_filename[PSA_ITS_STORAGE_TEMP_FILENAME_LENGTH];
     FILE *stream = NULL;
     psa_its_file_header_t header;
     size_t n;
@@ -200,7 +204,9 @@ psa_status_t psa_its_set( psa_storage_uid_t uid,
     MBEDTLS_PUT_UINT32_LE( create_flags, header.flags, 0 );
 
     psa_its_fill_filename( uid, filename );
-    stream = fopen( PSA_ITS_STORAGE_TEMP, "wb" );
+    mbedtls_snprintf( temp_filename, sizeof( temp_filename ), "%s%s",
+                      filename, PSA_ITS_STORAGE_TEMP_SUFFIX );
+    stream = fopen( temp_filename, "wb" );
     if( stream == NULL )
         goto exit;
 
@@ -225,7 +231,7 @@ exit:
     }
     if( status == PSA_SUCCESS )
     {
-        if( rename_replace_existing( PSA_ITS_STORAGE_TEMP, filename ) != 0 )
+        if( rename_replace_existing( temp_filename, filename ) != 0 )
             status = PSA_ERROR_STORAGE_FAILURE;
     }
     /* The temporary file may still exist, but only in failure cases where
@@ -233,7 +239,7 @@ exit:
      * failure. If the function succeeded, and in some error cases, the
      * temporary file doesn't exist and so remove() is expected to fail.
      * Thus we just ignore the return status of remove(). */
-    (void) remove( PSA_ITS_STORAGE_TEMP );
+    (void) remove( temp_filename );
     return( status );
 }
 
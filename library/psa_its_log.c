@@ -0,0 +1,872 @@
+/*
+ *  PSA ITS over a single append-only log file.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/*
+ * The log is a file header followed by a sequence of records. Each record
+ * either gives a new value for a UID or removes a UID, and carries a CRC-32
+ * so that a record which was only partially written when the system went
+ * down is detected. Such a record can only be the last one: it is dropped
+ * when the log is replayed. An invalid record followed by a valid one means
+ * that the log was damaged some other way, and it is reported as corrupt
+ * rather than silently losing the records after the damage.
+ *
+ * The log is replayed into an in-memory index, sorted by UID, the first
+ * time that it is accessed. After that, reading an entry is a seek and a
+ * read on the already open file, and writing or removing an entry is a
+ * single append. Appends are synchronized to stable storage in batches of
+ * MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL records, except removals, which are
+ * synchronized at once.
+ *
+ * Removing an entry also overwrites its record in place with an erased
+ * record of the same size, whose data is all zero, so that the removed data
+ * does not stay in the log file. The CRC of an erased record only covers
+ * its header, which is written before the data.
+ *
+ * When obsolete records take up more than half of the log, the live
+ * records are copied to a new file which then replaces the log.
+ */
+
+/* For fileno() and fsync() */
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "common.h"
+
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free      free
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <io.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__) || \
+    ( defined(__APPLE__) && defined(__MACH__) )
+#include <unistd.h>
+#define PSA_ITS_LOG_HAVE_FSYNC
+#endif
+
+#include "psa_crypto_its.h"
+
+#include "mbedtls/threading.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(PSA_ITS_STORAGE_PREFIX)
+#define PSA_ITS_STORAGE_PREFIX ""
+#endif
+
+#if !defined(MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL)
+#define MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL 16
+#endif
+
+#define PSA_ITS_LOG_FILENAME PSA_ITS_STORAGE_PREFIX "psa_its.log"
+#define PSA_ITS_LOG_TEMP_FILENAME PSA_ITS_LOG_FILENAME ".tmp"
+
+#define PSA_ITS_LOG_MAGIC_STRING "PSA\0LOG\0"
+#define PSA_ITS_LOG_MAGIC_LENGTH 8
+
+/* Values of psa_its_log_record_header_t::type */
+#define PSA_ITS_LOG_RECORD_SET          1
+#define PSA_ITS_LOG_RECORD_REMOVE       2
+#define PSA_ITS_LOG_RECORD_ERASED       3
+
+/* Results of psa_its_log_read_record() */
+#define PSA_ITS_LOG_READ_VALID          0
+#define PSA_ITS_LOG_READ_INVALID        1
+#define PSA_ITS_LOG_READ_ERROR          2
+
+/* Don't compact the log while obsolete records take up less than this
+ * many bytes, however large a proportion of the log they are. */
+#define PSA_ITS_LOG_COMPACT_THRESHOLD   4096
+
+/* As rename fails on Windows if the new filepath already exists,
+ * use MoveFileExA with the MOVEFILE_REPLACE_EXISTING flag instead.
+ * Returns 0 on success, nonzero on failure. */
+#if defined(_WIN32)
+#define rename_replace_existing( oldpath, newpath ) \
+    ( ! MoveFileExA( oldpath, newpath, MOVEFILE_REPLACE_EXISTING ) )
+#else
+#define rename_replace_existing( oldpath, newpath ) rename( oldpath, newpath )
+#endif
+
+/* Each record starts with this header, followed by \c size bytes of data.
+ * The CRC covers the rest of the header and the data, but not the record's
+ * position, so a record can be copied as is when compacting the log. */
+typedef struct
+{
+    uint8_t crc[sizeof( uint32_t )];
+    uint8_t type[sizeof( uint32_t )];
+    uint8_t uid[sizeof( psa_storage_uid_t )];
+    uint8_t size[sizeof( uint32_t )];
+    uint8_t flags[sizeof( psa_storage_create_flags_t )];
+} psa_its_log_record_header_t;
+
+#define PSA_ITS_LOG_RECORD_HEADER_SIZE                  \
+    ( (long) sizeof( psa_its_log_record_header_t ) )
+
+typedef struct
+{
+    psa_storage_uid_t uid;
+    psa_storage_create_flags_t flags;
+    uint32_t size;
+    long offset;                /* position of the data in the log */
+} psa_its_log_entry_t;
+
+typedef struct
+{
+    FILE *stream;               /* NULL until the log has been replayed */
+    psa_its_log_entry_t *entries; /* live entries, sorted by UID */
+    size_t count;
+    size_t capacity;
+    long end;                   /* end of the last valid record */
+    long dead;                  /* size of the obsolete records */
+    unsigned unsynced;          /* records appended since the last sync */
+} psa_its_log_t;
+
+static psa_its_log_t psa_its_log;
+
+static psa_status_t psa_its_log_lock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_its_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+#endif
+    return( PSA_SUCCESS );
+}
+
+static psa_status_t psa_its_log_unlock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &mbedtls_threading_psa_its_mutex ) != 0 )
+        return( PSA_ERROR_BAD_STATE );
+#endif
+    return( PSA_SUCCESS );
+}
+
+/* CRC-32 as in IEEE 802.3, computed incrementally: start with crc = 0. */
+static uint32_t psa_its_log_crc32( uint32_t crc,
+                                   const unsigned char *buf, size_t len )
+{
+    size_t i;
+    int k;
+
+    crc = ~crc;
+    for( i = 0; i < len; i++ )
+    {
+        crc ^= buf[i];
+        for( k = 0; k < 8; k++ )
+            crc = ( crc >> 1 ) ^ ( 0xEDB88320 & ( 0 - ( crc & 1 ) ) );
+    }
+    return( ~crc );
+}
+
+static uint32_t psa_its_log_header_crc(
+    const psa_its_log_record_header_t *header )
+{
+    return( psa_its_log_crc32( 0, header->type,
+                               sizeof( *header ) - sizeof( header->crc ) ) );
+}
+
+/* Push the data that was written to the log file all the way to
+ * stable storage, as far as the platform lets us. */
+static int psa_its_log_sync_stream( FILE *stream )
+{
+    if( fflush( stream ) != 0 )
+        return( -1 );
+#if defined(PSA_ITS_LOG_HAVE_FSYNC)
+    return( fsync( fileno( stream ) ) );
+#elif defined(_WIN32)
+    return( _commit( _fileno( stream ) ) );
+#else
+    return( 0 );
+#endif
+}
+
+/* Return the position of the first entry whose UID is not less than uid. */
+static size_t psa_its_log_search( psa_storage_uid_t uid )
+{
+    size_t lo = 0, hi = psa_its_log.count, mid;
+
+    while( lo < hi )
+    {
+        mid = lo + ( hi - lo ) / 2;
+        if( psa_its_log.entries[mid].uid < uid )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return( lo );
+}
+
+static psa_its_log_entry_t *psa_its_log_find( psa_storage_uid_t uid )
+{
+    size_t i = psa_its_log_search( uid );
+
+    if( i < psa_its_log.count && psa_its_log.entries[i].uid == uid )
+        return( &psa_its_log.entries[i] );
+    return( NULL );
+}
+
+/* Make room for at least one more entry in the index. */
+static psa_status_t psa_its_log_reserve( void )
+{
+    psa_its_log_entry_t *entries;
+    size_t capacity;
+
+    if( psa_its_log.count < psa_its_log.capacity )
+        return( PSA_SUCCESS );
+
+    capacity = psa_its_log.capacity == 0 ? 16 : 2 * psa_its_log.capacity;
+    if( capacity > SIZE_MAX / sizeof( *entries ) )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+    entries = mbedtls_calloc( capacity, sizeof( *entries ) );
+    if( entries == NULL )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+
+    if( psa_its_log.count != 0 )
+        memcpy( entries, psa_its_log.entries,
+                psa_its_log.count * sizeof( *entries ) );
+    mbedtls_free( psa_its_log.entries );
+    psa_its_log.entries = entries;
+    psa_its_log.capacity = capacity;
+    return( PSA_SUCCESS );
+}
+
+/* Record in the index that the value of uid is now at offset in the log.
+ * The caller must have called psa_its_log_reserve() first. */
+static void psa_its_log_index_set( psa_storage_uid_t uid,
+                                   uint32_t size,
+                                   psa_storage_create_flags_t flags,
+                                   long offset )
+{
+    size_t i = psa_its_log_search( uid );
+    psa_its_log_entry_t *entry = &psa_its_log.entries[i];
+
+    if( i < psa_its_log.count && entry->uid == uid )
+    {
+        psa_its_log.dead += PSA_ITS_LOG_RECORD_HEADER_SIZE + entry->size;
+    }
+    else
+    {
+        memmove( entry + 1, entry,
+                 ( psa_its_log.count - i ) * sizeof( *entry ) );
+        psa_its_log.count++;
+        entry->uid = uid;
+    }
+    entry->size = size;
+    entry->flags = flags;
+    entry->offset = offset;
+}
+
+static void psa_its_log_index_remove( psa_its_log_entry_t *entry )
+{
+    size_t i = entry - psa_its_log.entries;
+
+    psa_its_log.dead += PSA_ITS_LOG_RECORD_HEADER_SIZE + entry->size;
+    memmove( entry, entry + 1,
+             ( psa_its_log.count - i - 1 ) * sizeof( *entry ) );
+    psa_its_log.count--;
+}
+
+static void psa_its_log_reset( void )
+{
+    if( psa_its_log.stream != NULL )
+        fclose( psa_its_log.stream );
+    mbedtls_free( psa_its_log.entries );
+    memset( &psa_its_log, 0, sizeof( psa_its_log ) );
+}
+
+/* Read the record at offset, which must be the current position, and
+ * check it, leaving the stream positioned after the record. Returns
+ * PSA_ITS_LOG_READ_VALID if a valid record was read,
+ * PSA_ITS_LOG_READ_INVALID if the bytes up to file_end do not start with a
+ * complete valid record, and PSA_ITS_LOG_READ_ERROR if the file could not
+ * be read. */
+static int psa_its_log_read_record( FILE *stream, long offset, long file_end,
+                                    psa_its_log_record_header_t *header,
+                                    uint32_t *p_type, uint32_t *p_size )
+{
+    unsigned char buf[256];
+    uint32_t crc, type, size;
+    size_t n;
+
+    if( file_end - offset < PSA_ITS_LOG_RECORD_HEADER_SIZE )
+        return( PSA_ITS_LOG_READ_INVALID );
+    if( fread( header, 1, sizeof( *header ), stream ) != sizeof( *header ) )
+        return( PSA_ITS_LOG_READ_ERROR );
+    type = MBEDTLS_GET_UINT32_LE( header->type, 0 );
+    size = MBEDTLS_GET_UINT32_LE( header->size, 0 );
+    if( type != PSA_ITS_LOG_RECORD_SET && type != PSA_ITS_LOG_RECORD_REMOVE &&
+        type != PSA_ITS_LOG_RECORD_ERASED )
+        return( PSA_ITS_LOG_READ_INVALID );
+    if( type == PSA_ITS_LOG_RECORD_REMOVE && size != 0 )
+        return( PSA_ITS_LOG_READ_INVALID );
+    if( size > (unsigned long) ( file_end - offset -
+                                 PSA_ITS_LOG_RECORD_HEADER_SIZE ) )
+        return( PSA_ITS_LOG_READ_INVALID );
+
+    crc = psa_its_log_header_crc( header );
+    *p_type = type;
+    *p_size = size;
+    while( size > 0 )
+    {
+        n = size < sizeof( buf ) ? size : sizeof( buf );
+        if( fread( buf, 1, n, stream ) != n )
+            return( PSA_ITS_LOG_READ_ERROR );
+        if( type != PSA_ITS_LOG_RECORD_ERASED )
+            crc = psa_its_log_crc32( crc, buf, n );
+        size -= (uint32_t) n;
+    }
+    if( crc != MBEDTLS_GET_UINT32_LE( header->crc, 0 ) )
+        return( PSA_ITS_LOG_READ_INVALID );
+    return( PSA_ITS_LOG_READ_VALID );
+}
+
+/* Look for a valid record starting anywhere after the invalid record at
+ * offset. If there is one, the log was damaged in the middle, rather than
+ * cut short by an interrupted append. Returns 1 if a valid record was
+ * found, 0 if not, and -1 if the file could not be read. */
+static int psa_its_log_find_later_record( FILE *stream, long offset,
+                                          long file_end )
+{
+    psa_its_log_record_header_t header;
+    uint32_t type, size;
+    int ret;
+
+    for( offset++; file_end - offset >= PSA_ITS_LOG_RECORD_HEADER_SIZE;
+         offset++ )
+    {
+        if( fseek( stream, offset, SEEK_SET ) != 0 )
+            return( -1 );
+        ret = psa_its_log_read_record( stream, offset, file_end,
+                                       &header, &type, &size );
+        if( ret == PSA_ITS_LOG_READ_VALID )
+            return( 1 );
+        if( ret == PSA_ITS_LOG_READ_ERROR )
+            return( -1 );
+    }
+    return( 0 );
+}
+
+static psa_status_t psa_its_log_compact( void );
+
+/* Open the log, creating it if necessary, and build the index from it.
+ * Does nothing if the log is already open. */
+static psa_status_t psa_its_log_open( void )
+{
+    psa_status_t status;
+    psa_its_log_record_header_t header;
+    uint8_t magic[PSA_ITS_LOG_MAGIC_LENGTH];
+    uint32_t type, size;
+    long offset, file_end;
+    size_t n;
+    int ret;
+
+    if( psa_its_log.stream != NULL )
+        return( PSA_SUCCESS );
+
+    psa_its_log.stream = fopen( PSA_ITS_LOG_FILENAME, "r+b" );
+    if( psa_its_log.stream == NULL )
+        psa_its_log.stream = fopen( PSA_ITS_LOG_FILENAME, "w+b" );
+    if( psa_its_log.stream == NULL )
+        return( PSA_ERROR_STORAGE_FAILURE );
+
+    n = fread( magic, 1, sizeof( magic ), psa_its_log.stream );
+    if( n == 0 )
+    {
+        /* A new log, or one whose creation was interrupted. */
+        status = PSA_ERROR_STORAGE_FAILURE;
+        if( fseek( psa_its_log.stream, 0, SEEK_SET ) != 0 ||
+            fwrite( PSA_ITS_LOG_MAGIC_STRING, 1, PSA_ITS_LOG_MAGIC_LENGTH,
+                    psa_its_log.stream ) != PSA_ITS_LOG_MAGIC_LENGTH ||
+            psa_its_log_sync_stream( psa_its_log.stream ) != 0 )
+            goto exit;
+        psa_its_log.end = PSA_ITS_LOG_MAGIC_LENGTH;
+        return( PSA_SUCCESS );
+    }
+    status = PSA_ERROR_DATA_CORRUPT;
+    if( n != sizeof( magic ) ||
+        memcmp( magic, PSA_ITS_LOG_MAGIC_STRING,
+                PSA_ITS_LOG_MAGIC_LENGTH ) != 0 )
+        goto exit;
+
+    status = PSA_ERROR_STORAGE_FAILURE;
+    if( fseek( psa_its_log.stream, 0, SEEK_END ) != 0 ||
+        ( file_end = ftell( psa_its_log.stream ) ) < 0 ||
+        fseek( psa_its_log.stream, PSA_ITS_LOG_MAGIC_LENGTH, SEEK_SET ) != 0 )
+        goto exit;
+
+    /* Replay the records until the end of the log, or until an invalid
+     * record. */
+    offset = PSA_ITS_LOG_MAGIC_LENGTH;
+    while( ( ret = psa_its_log_read_record( psa_its_log.stream, offset,
+                                            file_end, &header,
+                                            &type, &size ) ) ==
+           PSA_ITS_LOG_READ_VALID )
+    {
+        psa_storage_uid_t uid = MBEDTLS_GET_UINT64_LE( header.uid, 0 );
+
+        if( type == PSA_ITS_LOG_RECORD_SET )
+        {
+            status = psa_its_log_reserve( );
+            if( status != PSA_SUCCESS )
+                goto exit;
+            psa_its_log_index_set( uid, size,
+                                   MBEDTLS_GET_UINT32_LE( header.flags, 0 ),
+                                   offset + PSA_ITS_LOG_RECORD_HEADER_SIZE );
+        }
+        else
+        {
+            /* An erased record was the value of uid until its removal.
+             * The REMOVE record may come after it, or may have been lost
+             * if the system went down before it reached the disk. */
+            psa_its_log_entry_t *entry = psa_its_log_find( uid );
+            if( entry != NULL )
+                psa_its_log_index_remove( entry );
+            psa_its_log.dead += PSA_ITS_LOG_RECORD_HEADER_SIZE + size;
+        }
+        offset += PSA_ITS_LOG_RECORD_HEADER_SIZE + size;
+    }
+    status = PSA_ERROR_STORAGE_FAILURE;
+    if( ret == PSA_ITS_LOG_READ_ERROR )
+        goto exit;
+    psa_its_log.end = offset;
+    if( offset == file_end )
+        return( PSA_SUCCESS );
+
+    /* The invalid record must be the last one, as only an interrupted
+     * append can leave one behind. */
+    ret = psa_its_log_find_later_record( psa_its_log.stream, offset,
+                                         file_end );
+    if( ret < 0 )
+        goto exit;
+    if( ret > 0 )
+    {
+        status = PSA_ERROR_DATA_CORRUPT;
+        goto exit;
+    }
+
+    /* Get rid of the incomplete record before appending anything: a
+     * shorter record would leave part of it behind, and the log would
+     * then look damaged in the middle. */
+    if( psa_its_log_compact( ) != PSA_SUCCESS )
+        goto exit;
+    return( PSA_SUCCESS );
+
+exit:
+    psa_its_log_reset( );
+    return( status );
+}
+
+/* Append a record to the log. On success, if p_data_offset is not NULL,
+ * it receives the position of the record's data in the log. */
+static psa_status_t psa_its_log_append( uint32_t type,
+                                        psa_storage_uid_t uid,
+                                        uint32_t data_length,
+                                        const void *p_data,
+                                        psa_storage_create_flags_t flags,
+                                        long *p_data_offset )
+{
+    psa_its_log_record_header_t header;
+    uint32_t crc;
+
+    if( data_length > (unsigned long) ( LONG_MAX - psa_its_log.end -
+                                        PSA_ITS_LOG_RECORD_HEADER_SIZE ) )
+        return( PSA_ERROR_INSUFFICIENT_STORAGE );
+
+    MBEDTLS_PUT_UINT32_LE( type, header.type, 0 );
+    MBEDTLS_PUT_UINT64_LE( uid, header.uid, 0 );
+    MBEDTLS_PUT_UINT32_LE( data_length, header.size, 0 );
+    MBEDTLS_PUT_UINT32_LE( flags, header.flags, 0 );
+    crc = psa_its_log_header_crc( &header );
+    crc = psa_its_log_crc32( crc, p_data, data_length );
+    MBEDTLS_PUT_UINT32_LE( crc, header.crc, 0 );
+
+    /* If this fails, part of the record may have been written. Close the
+     * log, so that the next access replays it and drops the incomplete
+     * record before appending anything after it. */
+    if( fseek( psa_its_log.stream, psa_its_log.end, SEEK_SET ) != 0 )
+    {
+        psa_its_log_reset( );
+        return( PSA_ERROR_STORAGE_FAILURE );
+    }
+    if( fwrite( &header, 1, sizeof( header ), psa_its_log.stream ) !=
+        sizeof( header ) ||
+        ( data_length != 0 &&
+          fwrite( p_data, 1, data_length, psa_its_log.stream ) !=
+          data_length ) ||
+        fflush( psa_its_log.stream ) != 0 )
+    {
+        psa_its_log_reset( );
+        return( PSA_ERROR_INSUFFICIENT_STORAGE );
+    }
+
+    if( p_data_offset != NULL )
+        *p_data_offset = psa_its_log.end + PSA_ITS_LOG_RECORD_HEADER_SIZE;
+    psa_its_log.end += PSA_ITS_LOG_RECORD_HEADER_SIZE + data_length;
+
+    /* Group commit: the record is now in the operating system's hands.
+     * Only force it to stable storage once every few records. */
+    psa_its_log.unsynced++;
+#if MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL > 0
+    if( psa_its_log.unsynced >= MBEDTLS_PSA_ITS_LOG_SYNC_INTERVAL )
+    {
+        if( psa_its_log_sync_stream( psa_its_log.stream ) != 0 )
+        {
+            psa_its_log_reset( );
+            return( PSA_ERROR_STORAGE_FAILURE );
+        }
+        psa_its_log.unsynced = 0;
+    }
+#endif
+    return( PSA_SUCCESS );
+}
+
+/* Overwrite the record of entry in place with an erased record of the same
+ * size. The new header is written first: from then on the record is valid
+ * whatever its data, which is then overwritten with zeros. The caller must
+ * synchronize the log afterwards. */
+static int psa_its_log_erase( const psa_its_log_entry_t *entry )
+{
+    psa_its_log_record_header_t header;
+    unsigned char zeros[256];
+    uint32_t size = entry->size;
+    size_t n;
+
+    MBEDTLS_PUT_UINT32_LE( PSA_ITS_LOG_RECORD_ERASED, header.type, 0 );
+    MBEDTLS_PUT_UINT64_LE( entry->uid, header.uid, 0 );
+    MBEDTLS_PUT_UINT32_LE( entry->size, header.size, 0 );
+    MBEDTLS_PUT_UINT32_LE( entry->flags, header.flags, 0 );
+    MBEDTLS_PUT_UINT32_LE( psa_its_log_header_crc( &header ), header.crc, 0 );
+    memset( zeros, 0, sizeof( zeros ) );
+
+    if( fseek( psa_its_log.stream,
+               entry->offset - PSA_ITS_LOG_RECORD_HEADER_SIZE,
+               SEEK_SET ) != 0 ||
+        fwrite( &header, 1, sizeof( header ), psa_its_log.stream ) !=
+        sizeof( header ) ||
+        fflush( psa_its_log.stream ) != 0 )
+        return( -1 );
+    while( size > 0 )
+    {
+        n = size < sizeof( zeros ) ? size : sizeof( zeros );
+        if( fwrite( zeros, 1, n, psa_its_log.stream ) != n )
+            return( -1 );
+        size -= (uint32_t) n;
+    }
+    return( 0 );
+}
+
+/* Copy size bytes from the current position of from to the current
+ * position of to. */
+static int psa_its_log_copy( FILE *from, FILE *to, long size )
+{
+    unsigned char buf[256];
+    size_t n;
+
+    while( size > 0 )
+    {
+        n = size < (long) sizeof( buf ) ? (size_t) size : sizeof( buf );
+        if( fread( buf, 1, n, from ) != n || fwrite( buf, 1, n, to ) != n )
+            return( -1 );
+        size -= (long) n;
+    }
+    return( 0 );
+}
+
+/* Rewrite the log with only the live records. */
+static psa_status_t psa_its_log_compact( void )
+{
+    FILE *stream;
+    long offset;
+    size_t i;
+
+    stream = fopen( PSA_ITS_LOG_TEMP_FILENAME, "wb" );
+    if( stream == NULL )
+        return( PSA_ERROR_STORAGE_FAILURE );
+
+    if( fwrite( PSA_ITS_LOG_MAGIC_STRING, 1, PSA_ITS_LOG_MAGIC_LENGTH,
+                stream ) != PSA_ITS_LOG_MAGIC_LENGTH )
+        goto fail;
+    for( i = 0; i < psa_its_log.count; i++ )
+    {
+        const psa_its_log_entry_t *entry = &psa_its_log.entries[i];
+        if( fseek( psa_its_log.stream,
+                   entry->offset - PSA_ITS_LOG_RECORD_HEADER_SIZE,
+                   SEEK_SET ) != 0 )
+            goto fail;
+        if( psa_its_log_copy( psa_its_log.stream, stream,
+                              PSA_ITS_LOG_RECORD_HEADER_SIZE +
+                              entry->size ) != 0 )
+            goto fail;
+    }
+    if( psa_its_log_sync_stream( stream ) != 0 )
+        goto fail;
+    if( fclose( stream ) != 0 )
+    {
+        stream = NULL;
+        goto fail;
+    }
+
+    /* Once the new log is in place, the old file position of every
+     * record is obsolete, so reopen and reindex. */
+    fclose( psa_its_log.stream );
+    psa_its_log.stream = NULL;
+    if( rename_replace_existing( PSA_ITS_LOG_TEMP_FILENAME,
+                                 PSA_ITS_LOG_FILENAME ) != 0 )
+    {
+        (void) remove( PSA_ITS_LOG_TEMP_FILENAME );
+        psa_its_log_reset( );
+        return( PSA_ERROR_STORAGE_FAILURE );
+    }
+    psa_its_log.stream = fopen( PSA_ITS_LOG_FILENAME, "r+b" );
+    if( psa_its_log.stream == NULL )
+    {
+        psa_its_log_reset( );
+        return( PSA_ERROR_STORAGE_FAILURE );
+    }
+
+    offset = PSA_ITS_LOG_MAGIC_LENGTH;
+    for( i = 0; i < psa_its_log.count; i++ )
+    {
+        offset += PSA_ITS_LOG_RECORD_HEADER_SIZE;
+        psa_its_log.entries[i].offset = offset;
+        offset += psa_its_log.entries[i].size;
+    }
+    psa_its_log.end = offset;
+    psa_its_log.dead = 0;
+    psa_its_log.unsynced = 0;
+    return( PSA_SUCCESS );
+
+fail:
+    if( stream != NULL )
+        fclose( stream );
+    (void) remove( PSA_ITS_LOG_TEMP_FILENAME );
+    return( PSA_ERROR_STORAGE_FAILURE );
+}
+
+/* Compact the log if obsolete records take up more than half of it.
+ * Failing to compact is not an error: the log is still valid. */
+static void psa_its_log_maybe_compact( void )
+{
+    if( psa_its_log.dead > PSA_ITS_LOG_COMPACT_THRESHOLD &&
+        psa_its_log.dead > psa_its_log.end / 2 )
+        (void) psa_its_log_compact( );
+}
+
+psa_status_t psa_its_get_info( psa_storage_uid_t uid,
+                               struct psa_storage_info_t *p_info )
+{
+    psa_status_t status, unlock_status;
+    const psa_its_log_entry_t *entry;
+
+    status = psa_its_log_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    status = psa_its_log_open( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    entry = psa_its_log_find( uid );
+    if( entry == NULL )
+    {
+        status = PSA_ERROR_DOES_NOT_EXIST;
+        goto exit;
+    }
+    p_info->size = entry->size;
+    p_info->flags = entry->flags;
+
+exit:
+    unlock_status = psa_its_log_unlock( );
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
+psa_status_t psa_its_get( psa_storage_uid_t uid,
+                          uint32_t data_offset,
+                          uint32_t data_length,
+                          void *p_data,
+                          size_t *p_data_length )
+{
+    psa_status_t status, unlock_status;
+    const psa_its_log_entry_t *entry;
+
+    status = psa_its_log_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    status = psa_its_log_open( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    entry = psa_its_log_find( uid );
+    if( entry == NULL )
+    {
+        status = PSA_ERROR_DOES_NOT_EXIST;
+        goto exit;
+    }
+
+    status = PSA_ERROR_INVALID_ARGUMENT;
+    if( data_offset + data_length < data_offset )
+        goto exit;
+#if SIZE_MAX < 0xffffffff
+    if( data_offset + data_length > SIZE_MAX )
+        goto exit;
+#endif
+    if( data_offset + data_length > entry->size )
+        goto exit;
+
+    status = PSA_ERROR_STORAGE_FAILURE;
+    if( fseek( psa_its_log.stream, entry->offset + (long) data_offset,
+               SEEK_SET ) != 0 )
+        goto exit;
+    if( fread( p_data, 1, data_length, psa_its_log.stream ) != data_length )
+        goto exit;
+    status = PSA_SUCCESS;
+    if( p_data_length != NULL )
+        *p_data_length = data_length;
+
+exit:
+    unlock_status = psa_its_log_unlock( );
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
+psa_status_t psa_its_set( psa_storage_uid_t uid,
+                          uint32_t data_length,
+                          const void *p_data,
+                          psa_storage_create_flags_t create_flags )
+{
+    psa_status_t status, unlock_status;
+    long offset;
+
+    if( uid == 0 )
+    {
+        return( PSA_ERROR_INVALID_HANDLE );
+    }
+
+    status = psa_its_log_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    status = psa_its_log_open( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    /* Make room in the index first, so that the index can't get out of
+     * sync with the log after a successful append. */
+    status = psa_its_log_reserve( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    status = psa_its_log_append( PSA_ITS_LOG_RECORD_SET, uid,
+                                 data_length, p_data, create_flags,
+                                 &offset );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    psa_its_log_index_set( uid, data_length, create_flags, offset );
+    psa_its_log_maybe_compact( );
+
+exit:
+    unlock_status = psa_its_log_unlock( );
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
+psa_status_t psa_its_remove( psa_storage_uid_t uid )
+{
+    psa_status_t status, unlock_status;
+    psa_its_log_entry_t *entry;
+
+    status = psa_its_log_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    status = psa_its_log_open( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+    entry = psa_its_log_find( uid );
+    if( entry == NULL )
+    {
+        status = PSA_ERROR_DOES_NOT_EXIST;
+        goto exit;
+    }
+    status = psa_its_log_append( PSA_ITS_LOG_RECORD_REMOVE, uid,
+                                 0, NULL, 0, NULL );
+    if( status != PSA_SUCCESS )
+        goto exit;
+
+    /* A removal usually destroys a key: erase the data where it is, and
+     * make both the erasure and the removal durable now rather than with
+     * the next batch. If either fails, close the log so that the next
+     * access replays it. */
+    if( psa_its_log_erase( entry ) != 0 ||
+        psa_its_log_sync_stream( psa_its_log.stream ) != 0 )
+    {
+        psa_its_log_reset( );
+        status = PSA_ERROR_STORAGE_FAILURE;
+        goto exit;
+    }
+    psa_its_log.unsynced = 0;
+    psa_its_log_index_remove( entry );
+    psa_its_log.dead += PSA_ITS_LOG_RECORD_HEADER_SIZE;
+    psa_its_log_maybe_compact( );
+
+exit:
+    unlock_status = psa_its_log_unlock( );
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
+psa_status_t psa_its_log_sync( void )
+{
+    psa_status_t status, unlock_status;
+
+    status = psa_its_log_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    if( psa_its_log.stream != NULL && psa_its_log.unsynced != 0 )
+    {
+        if( psa_its_log_sync_stream( psa_its_log.stream ) != 0 )
+            status = PSA_ERROR_STORAGE_FAILURE;
+        else
+            psa_its_log.unsynced = 0;
+    }
+
+    unlock_status = psa_its_log_unlock( );
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
+void psa_its_log_close( void )
+{
+    if( psa_its_log_lock( ) != PSA_SUCCESS )
+        return;
+
+    if( psa_its_log.stream != NULL && psa_its_log.unsynced != 0 )
+        (void) psa_its_log_sync_stream( psa_its_log.stream );
+    psa_its_log_reset( );
+
+    (void) psa_its_log_unlock( );
+}
+
+#endif /* MBEDTLS_PSA_ITS_LOG_C */
@@ -529,6 +529,106 @@ size_t mbedtls_rsa_get_len( const mbedtls_rsa_context *ctx )
 
 #if defined(MBEDTLS_GENPRIME)
 
+#if defined(MBEDTLS_RSA_GEN_KEY_THREADED)
+/*
+ * Concurrent search for P and Q: the calling thread looks for P while a
+ * worker thread looks for Q. The threading abstraction layer cannot
+ * create threads, so this uses pthread directly.
+ *
+ * The RNG is not required to be thread-safe, so both searches draw from
+ * it under a common lock.
+ */
+typedef struct
+{
+    pthread_mutex_t lock;
+    int (*f_rng)(void *, unsigned char *, size_t);
+    void *p_rng;
+} rsa_gen_rng_t;
+
+typedef struct
+{
+    mbedtls_mpi *X;
+    size_t nbits;
+    int flags;
+    rsa_gen_rng_t *rng;
+    int ret;
+} rsa_gen_prime_job_t;
+
+static int rsa_gen_rng_locked( void *p_rng, unsigned char *output,
+                               size_t output_len )
+{
+    rsa_gen_rng_t *rng = (rsa_gen_rng_t *) p_rng;
+    int ret;
+
+    if( pthread_mutex_lock( &rng->lock ) != 0 )
+        return( MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED );
+    ret = rng->f_rng( rng->p_rng, output, output_len );
+    pthread_mutex_unlock( &rng->lock );
+
+    return( ret );
+}
+
+static void *rsa_gen_prime_thread( void *arg )
+{
+    rsa_gen_prime_job_t *job = (rsa_gen_prime_job_t *) arg;
+
+    job->ret = mbedtls_mpi_gen_prime( job->X, job->nbits, job->flags,
+                                      rsa_gen_rng_locked, job->rng );
+
+    return( NULL );
+}
+#endif /* MBEDTLS_RSA_GEN_KEY_THREADED */
+
+/*
+ * Generate the candidate primes P and Q of nbits bits each
+ */
+static int rsa_gen_primes( mbedtls_mpi *P, mbedtls_mpi *Q, size_t nbits,
+                           int flags,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+#if defined(MBEDTLS_RSA_GEN_KEY_THREADED)
+    rsa_gen_rng_t rng;
+    rsa_gen_prime_job_t job;
+    pthread_t thread;
+
+    if( pthread_mutex_init( &rng.lock, NULL ) == 0 )
+    {
+        rng.f_rng = f_rng;
+        rng.p_rng = p_rng;
+
+        job.X = Q;
+        job.nbits = nbits;
+        job.flags = flags;
+        job.rng = &rng;
+        job.ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+        if( pthread_create( &thread, NULL, rsa_gen_prime_thread, &job ) == 0 )
+        {
+            ret = mbedtls_mpi_gen_prime( P, nbits, flags,
+                                         rsa_gen_rng_locked, &rng );
+
+            /* Wait for Q even if P failed, as the worker uses the RNG. */
+            pthread_join( thread, NULL );
+            pthread_mutex_destroy( &rng.lock );
+
+            return( ret != 0 ? ret : job.ret );
+        }
+
+        pthread_mutex_destroy( &rng.lock );
+    }
+
+    /* No thread could be started: fall back to a sequential search. */
+#endif /* MBEDTLS_RSA_GEN_KEY_THREADED */
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( P, nbits, flags, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( Q, nbits, flags, f_rng, p_rng ) );
+
+cleanup:
+    return( ret );
+}
+
 /*
  * Generate an RSA keypair
  *
@@ -574,11 +674,8 @@ int mbedtls_rsa_gen_key( mbedtls_rsa_context *ctx,
 
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( &ctx->P, nbits >> 1,
-                                                prime_quality, f_rng, p_rng ) );
-
-        MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( &ctx->Q, nbits >> 1,
-                                                prime_quality, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( rsa_gen_primes( &ctx->P, &ctx->Q, nbits >> 1,
+                                         prime_quality, f_rng, p_rng ) );
 
         /* make sure the difference between p and q is not too small (FIPS 186-4 §B.3.3 step 5.4) */
         MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &H, &ctx->P, &ctx->Q ) );
@@ -1962,6 +1962,8 @@ static int ssl_parse_server_hello( mbedtls_ssl_context *ssl )
         ssl->minor_ver == MBEDTLS_SSL_MINOR_VERSION_3 )
     {
         ssl->handshake->ecrs_enabled = 1;
+        mbedtls_pk_restart_set_max_ops( &ssl->handshake->ecrs_ctx.pk,
+                                        ssl->conf->ecp_max_ops );
     }
 #endif
 
@@ -3388,6 +3390,8 @@ static int ssl_write_client_key_exchange( mbedtls_ssl_context *ssl )
                 goto ecdh_calc_secret;
 
             mbedtls_ecdh_enable_restart( &ssl->handshake->ecdh_ctx );
+            mbedtls_ecdh_set_max_ops( &ssl->handshake->ecdh_ctx,
+                                      ssl->conf->ecp_max_ops );
         }
 #endif
 
@@ -0,0 +1,422 @@
+/*
+ *  Pool of pregenerated ephemeral ECDHE keys for TLS servers
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/*
+ * Each configured group owns a fixed-size ring of key pairs. Keys are
+ * generated by mbedtls_ssl_ecdhe_pool_refill() without holding the pool
+ * lock, then pushed at the tail; handshakes pop them from the head and
+ * the slot is wiped, so a key is never handed out twice.
+ */
+
+#include "common.h"
+
+#if defined(MBEDTLS_SSL_ECDHE_POOL_C)
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free      free
+#endif
+
+#include "mbedtls/ssl_ecdhe_pool.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/platform_util.h"
+#include "mbedtls/error.h"
+
+#include <string.h>
+
+void mbedtls_ssl_ecdhe_pool_init( mbedtls_ssl_ecdhe_pool *pool )
+{
+    memset( pool, 0, sizeof( mbedtls_ssl_ecdhe_pool ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &pool->mutex );
+#endif
+}
+
+/*
+ * Exchange the contents of two key pairs without allocating.
+ */
+static void ssl_ecdhe_pool_swap( mbedtls_mpi *d1, mbedtls_ecp_point *Q1,
+                                 mbedtls_mpi *d2, mbedtls_ecp_point *Q2 )
+{
+    mbedtls_mpi_swap( d1, d2 );
+    mbedtls_mpi_swap( &Q1->X, &Q2->X );
+    mbedtls_mpi_swap( &Q1->Y, &Q2->Y );
+    mbedtls_mpi_swap( &Q1->Z, &Q2->Z );
+}
+
+/*
+ * Wipe and release all key slots, leaving the pool empty and unconfigured.
+ */
+static void ssl_ecdhe_pool_free_rings( mbedtls_ssl_ecdhe_pool *pool )
+{
+    size_t i, j;
+    mbedtls_ssl_ecdhe_pool_ring *ring;
+
+    for( i = 0; i < MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS; i++ )
+    {
+        ring = &pool->rings[i];
+        if( ring->slots != NULL )
+        {
+            for( j = 0; j < pool->capacity; j++ )
+            {
+                mbedtls_mpi_free( &ring->slots[j].d );
+                mbedtls_ecp_point_free( &ring->slots[j].Q );
+            }
+            mbedtls_free( ring->slots );
+        }
+        memset( ring, 0, sizeof( *ring ) );
+    }
+
+    pool->ring_count = 0;
+    pool->capacity = 0;
+}
+
+int mbedtls_ssl_ecdhe_pool_setup( mbedtls_ssl_ecdhe_pool *pool,
+                                  int (*f_rng)(void *, unsigned char *, size_t),
+                                  void *p_rng,
+                                  const mbedtls_ecp_group_id *groups,
+                                  size_t capacity )
+{
+    size_t i, j;
+    mbedtls_ssl_ecdhe_pool_ring *ring;
+
+    if( f_rng == NULL || groups == NULL || capacity == 0 ||
+        groups[0] == MBEDTLS_ECP_DP_NONE || pool->ring_count != 0 )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    pool->capacity = capacity;
+
+    for( i = 0; groups[i] != MBEDTLS_ECP_DP_NONE; i++ )
+    {
+        if( i == MBEDTLS_SSL_ECDHE_POOL_MAX_GROUPS ||
+            mbedtls_ecp_curve_info_from_grp_id( groups[i] ) == NULL )
+            goto bad_input;
+
+        ring = &pool->rings[i];
+        ring->grp_id = groups[i];
+        ring->slots = mbedtls_calloc( capacity,
+                                      sizeof( mbedtls_ssl_ecdhe_pool_slot ) );
+        if( ring->slots == NULL )
+        {
+            ssl_ecdhe_pool_free_rings( pool );
+            return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+        }
+
+        for( j = 0; j < capacity; j++ )
+        {
+            mbedtls_mpi_init( &ring->slots[j].d );
+            mbedtls_ecp_point_init( &ring->slots[j].Q );
+        }
+
+        pool->ring_count = i + 1;
+    }
+
+    pool->f_rng = f_rng;
+    pool->p_rng = p_rng;
+
+    return( 0 );
+
+bad_input:
+    ssl_ecdhe_pool_free_rings( pool );
+    return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+}
+
+int mbedtls_ssl_ecdhe_pool_refill( mbedtls_ssl_ecdhe_pool *pool,
+                                   size_t max_keys )
+{
+    int ret = 0;
+    size_t i, generated = 0;
+    int full;
+    mbedtls_ssl_ecdhe_pool_ring *ring;
+    mbedtls_ssl_ecdhe_pool_slot *slot;
+    mbedtls_ecp_group grp;
+    mbedtls_mpi d;
+    mbedtls_ecp_point Q;
+
+    mbedtls_ecp_group_init( &grp );
+    mbedtls_mpi_init( &d );
+    mbedtls_ecp_point_init( &Q );
+
+    for( i = 0; i < pool->ring_count; i++ )
+    {
+        ring = &pool->rings[i];
+
+        /* Use a private copy of the group: the comb precomputation may
+         * write to it, and refills may run concurrently. */
+        mbedtls_ecp_group_free( &grp );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_group_load( &grp, ring->grp_id ) );
+
+        for( ;; )
+        {
+            if( max_keys != 0 && generated == max_keys )
+                goto cleanup;
+
+#if defined(MBEDTLS_THREADING_C)
+            if( ( ret = mbedtls_mutex_lock( &pool->mutex ) ) != 0 )
+                goto cleanup;
+#endif
+            full = ( ring->count == pool->capacity );
+#if defined(MBEDTLS_THREADING_C)
+            if( ( ret = mbedtls_mutex_unlock( &pool->mutex ) ) != 0 )
+                goto cleanup;
+#endif
+            if( full )
+                break;
+
+            /* The expensive part runs without holding the lock. */
+            MBEDTLS_MPI_CHK( mbedtls_ecp_gen_keypair( &grp, &d, &Q,
+                                                      pool->f_rng,
+                                                      pool->p_rng ) );
+            generated++;
+
+#if defined(MBEDTLS_THREADING_C)
+            if( ( ret = mbedtls_mutex_lock( &pool->mutex ) ) != 0 )
+                goto cleanup;
+#endif
+            /* Another refill may have filled the ring meanwhile,
+             * in which case the fresh key is simply discarded. */
+            if( ring->count < pool->capacity )
+            {
+                slot = &ring->slots[( ring->head + ring->count ) %
+                                    pool->capacity];
+                ssl_ecdhe_pool_swap( &slot->d, &slot->Q, &d, &Q );
+                ring->count++;
+            }
+#if defined(MBEDTLS_THREADING_C)
+            if( ( ret = mbedtls_mutex_unlock( &pool->mutex ) ) != 0 )
+                goto cleanup;
+#endif
+        }
+    }
+
+cleanup:
+    mbedtls_ecp_group_free( &grp );
+    mbedtls_mpi_free( &d );
+    mbedtls_ecp_point_free( &Q );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Body of the refill thread: fill the pool, then sleep until a key is
+ * taken or the thread is asked to stop.
+ *
+ * The wake-up flags live under their own pthread mutex rather than the
+ * pool mutex, so that the thread can wait on a condition variable without
+ * going behind the back of the mbedtls_mutex_xxx() abstraction.
+ */
+static void *ssl_ecdhe_pool_refill_thread( void *p_pool )
+{
+    mbedtls_ssl_ecdhe_pool *pool = (mbedtls_ssl_ecdhe_pool *) p_pool;
+    int ret, stop;
+
+    do
+    {
+        ret = mbedtls_ssl_ecdhe_pool_refill( pool, 0 );
+
+        if( pthread_mutex_lock( &pool->refill_lock ) != 0 )
+            break;
+
+        if( ret != 0 )
+            pool->refill_ret = ret;
+
+        while( ret == 0 && ! pool->refill_pending && ! pool->refill_stop )
+            pthread_cond_wait( &pool->refill_cond, &pool->refill_lock );
+
+        /* A take after this point sets the flag again, and the refill
+         * below sees the key it removed. */
+        pool->refill_pending = 0;
+        stop = ( ret != 0 || pool->refill_stop );
+
+        if( pthread_mutex_unlock( &pool->refill_lock ) != 0 )
+            break;
+    }
+    while( ! stop );
+
+    return( NULL );
+}
+
+/*
+ * Record whether takes should wake up the refill thread. Takes read this
+ * under the pool lock, so once it is cleared no take touches refill_lock.
+ */
+static int ssl_ecdhe_pool_set_refill_running( mbedtls_ssl_ecdhe_pool *pool,
+                                              int running )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ( ret = mbedtls_mutex_lock( &pool->mutex ) ) != 0 )
+        return( ret );
+
+    pool->refill_running = running;
+
+    return( mbedtls_mutex_unlock( &pool->mutex ) );
+}
+
+int mbedtls_ssl_ecdhe_pool_start_refill( mbedtls_ssl_ecdhe_pool *pool )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( pool == NULL || pool->ring_count == 0 || pool->refill_running )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( pthread_mutex_init( &pool->refill_lock, NULL ) != 0 )
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+    if( pthread_cond_init( &pool->refill_cond, NULL ) != 0 )
+    {
+        pthread_mutex_destroy( &pool->refill_lock );
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+    }
+
+    pool->refill_pending = 0;
+    pool->refill_stop = 0;
+    pool->refill_ret = 0;
+
+    if( ( ret = ssl_ecdhe_pool_set_refill_running( pool, 1 ) ) != 0 )
+        goto cleanup;
+
+    if( pthread_create( &pool->refill_thread, NULL,
+                        ssl_ecdhe_pool_refill_thread, pool ) != 0 )
+    {
+        (void) ssl_ecdhe_pool_set_refill_running( pool, 0 );
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    return( 0 );
+
+cleanup:
+    pthread_cond_destroy( &pool->refill_cond );
+    pthread_mutex_destroy( &pool->refill_lock );
+    return( ret );
+}
+
+int mbedtls_ssl_ecdhe_pool_stop_refill( mbedtls_ssl_ecdhe_pool *pool )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( pool == NULL || ! pool->refill_running )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = ssl_ecdhe_pool_set_refill_running( pool, 0 ) ) != 0 )
+        return( ret );
+
+    if( pthread_mutex_lock( &pool->refill_lock ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    pool->refill_stop = 1;
+    pthread_cond_signal( &pool->refill_cond );
+    if( pthread_mutex_unlock( &pool->refill_lock ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    pthread_join( pool->refill_thread, NULL );
+    pthread_cond_destroy( &pool->refill_cond );
+    pthread_mutex_destroy( &pool->refill_lock );
+
+    return( pool->refill_ret );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+int mbedtls_ssl_ecdhe_pool_take( void *p_pool,
+                                 mbedtls_ecp_group_id grp_id,
+                                 mbedtls_ecp_keypair *key )
+{
+    int ret = 1;
+    size_t i;
+    mbedtls_ssl_ecdhe_pool *pool = (mbedtls_ssl_ecdhe_pool *) p_pool;
+    mbedtls_ssl_ecdhe_pool_ring *ring;
+    mbedtls_ssl_ecdhe_pool_slot *slot;
+
+    if( pool == NULL || key == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &pool->mutex ) != 0 )
+        return( 1 );
+#endif
+
+    for( i = 0; i < pool->ring_count; i++ )
+    {
+        ring = &pool->rings[i];
+        if( ring->grp_id != grp_id || ring->count == 0 )
+            continue;
+
+        slot = &ring->slots[ring->head];
+        ssl_ecdhe_pool_swap( &key->d, &key->Q, &slot->d, &slot->Q );
+
+        /* The slot now holds whatever the caller passed in: wipe it so
+         * that nothing can be taken from it again. */
+        mbedtls_mpi_free( &slot->d );
+        mbedtls_ecp_point_free( &slot->Q );
+
+        ring->head = ( ring->head + 1 ) % pool->capacity;
+        ring->count--;
+        ret = 0;
+        break;
+    }
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    /* Wake up the refill thread while still holding the pool lock, so
+     * that it cannot be stopped and its lock destroyed in between. */
+    if( ret == 0 && pool->refill_running &&
+        pthread_mutex_lock( &pool->refill_lock ) == 0 )
+    {
+        pool->refill_pending = 1;
+        pthread_cond_signal( &pool->refill_cond );
+        (void) pthread_mutex_unlock( &pool->refill_lock );
+    }
+#endif
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &pool->mutex ) != 0 )
+        ret = 1;
+#endif
+
+    if( ret == 0 )
+    {
+        mbedtls_ecp_group_free( &key->grp );
+        ret = mbedtls_ecp_group_load( &key->grp, grp_id );
+    }
+
+    return( ret );
+}
+
+void mbedtls_ssl_ecdhe_pool_free( mbedtls_ssl_ecdhe_pool *pool )
+{
+    if( pool == NULL )
+        return;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    if( pool->refill_running )
+        (void) mbedtls_ssl_ecdhe_pool_stop_refill( pool );
+#endif
+
+    ssl_ecdhe_pool_free_rings( pool );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &pool->mutex );
+#endif
+
+    mbedtls_platform_zeroize( pool, sizeof( mbedtls_ssl_ecdhe_pool ) );
+}
+
+#endif /* MBEDTLS_SSL_ECDHE_POOL_C */
@@ -981,6 +981,15 @@ struct mbedtls_ssl_transform
     unsigned char out_cid[ MBEDTLS_SSL_CID_OUT_LEN_MAX ];
 #endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 
+#if defined(MBEDTLS_SSL_KTLS)
+    /* Copies of the traffic keys for mbedtls_ssl_get_ktls_info(), kept
+     * only for the ciphers that can be offloaded. */
+    mbedtls_cipher_type_t ktls_cipher;  /*!<  cipher, or NONE         */
+    size_t ktls_keylen;                 /*!<  key length              */
+    unsigned char ktls_key_enc[32];     /*!<  key (encryption)        */
+    unsigned char ktls_key_dec[32];     /*!<  key (decryption)        */
+#endif /* MBEDTLS_SSL_KTLS */
+
 #if defined(MBEDTLS_SSL_CONTEXT_SERIALIZATION)
     /* We need the Hello random bytes in order to re-derive keys from the
      * Master Secret and other session info,
@@ -1244,6 +1253,22 @@ static inline int mbedtls_ssl_write_handshake_msg( mbedtls_ssl_context *ssl )
 
 int mbedtls_ssl_write_record( mbedtls_ssl_context *ssl, uint8_t force_flush );
 int mbedtls_ssl_flush_output( mbedtls_ssl_context *ssl );
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+int mbedtls_ssl_flush_coalesced( mbedtls_ssl_context *ssl );
+#endif
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+int mbedtls_ssl_acquire_buffers( mbedtls_ssl_context *ssl );
+void mbedtls_ssl_auto_release_buffers( mbedtls_ssl_context *ssl );
+#endif
+
+#if defined(MBEDTLS_SSL_KTLS)
+/* Keep a copy of the traffic keys of a transform if kTLS can use them. */
+void mbedtls_ssl_transform_set_ktls_keys( mbedtls_ssl_transform *transform,
+                                          mbedtls_cipher_type_t cipher,
+                                          const unsigned char *key_enc,
+                                          const unsigned char *key_dec,
+                                          size_t keylen );
+#endif
 
 int mbedtls_ssl_parse_certificate( mbedtls_ssl_context *ssl );
 int mbedtls_ssl_write_certificate( mbedtls_ssl_context *ssl );
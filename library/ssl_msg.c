@@ -1714,11 +1714,45 @@ int mbedtls_ssl_decrypt_buf( mbedtls_ssl_context const *ssl,
  *
  * With stream transport (TLS) on success ssl->in_left == nb_want, but
  * with datagram transport (DTLS) on success ssl->in_left >= nb_want,
- * since we always read a whole datagram at once.
+ * since we always read a whole datagram at once. The same holds for TLS
+ * with read-ahead enabled, since we then read as much as fits.
  *
- * For DTLS, it is up to the caller to set ssl->next_record_offset when
- * they're done reading a record.
+ * For DTLS and for TLS with read-ahead, it is up to the caller to set
+ * ssl->next_record_offset when they're done reading a record.
  */
+#if defined(MBEDTLS_SSL_PROTO_DTLS) || defined(MBEDTLS_SSL_READ_AHEAD)
+/*
+ * Move to the next record in the already read data if applicable
+ */
+static int ssl_skip_to_next_record( mbedtls_ssl_context *ssl )
+{
+    if( ssl->next_record_offset == 0 )
+        return( 0 );
+
+    if( ssl->in_left < ssl->next_record_offset )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 1, ( "should never happen" ) );
+        return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+    }
+
+    ssl->in_left -= ssl->next_record_offset;
+
+    if( ssl->in_left != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 2, ( "next record already read, offset: %"
+                                    MBEDTLS_PRINTF_SIZET,
+                                    ssl->next_record_offset ) );
+        memmove( ssl->in_hdr,
+                 ssl->in_hdr + ssl->next_record_offset,
+                 ssl->in_left );
+    }
+
+    ssl->next_record_offset = 0;
+
+    return( 0 );
+}
+#endif /* MBEDTLS_SSL_PROTO_DTLS || MBEDTLS_SSL_READ_AHEAD */
+
 int mbedtls_ssl_fetch_input( mbedtls_ssl_context *ssl, size_t nb_want )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
@@ -1756,31 +1790,8 @@ int mbedtls_ssl_fetch_input( mbedtls_ssl_context *ssl, size_t nb_want )
          * header) and/or some other records in the same datagram.
          */
 
-        /*
-         * Move to the next record in the already read datagram if applicable
-         */
-        if( ssl->next_record_offset != 0 )
-        {
-            if( ssl->in_left < ssl->next_record_offset )
-            {
-                MBEDTLS_SSL_DEBUG_MSG( 1, ( "should never happen" ) );
-                return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
-            }
-
-            ssl->in_left -= ssl->next_record_offset;
-
-            if( ssl->in_left != 0 )
-            {
-                MBEDTLS_SSL_DEBUG_MSG( 2, ( "next record in same datagram, offset: %"
-                                            MBEDTLS_PRINTF_SIZET,
-                                    ssl->next_record_offset ) );
-                memmove( ssl->in_hdr,
-                         ssl->in_hdr + ssl->next_record_offset,
-                         ssl->in_left );
-            }
-
-            ssl->next_record_offset = 0;
-        }
+        if( ( ret = ssl_skip_to_next_record( ssl ) ) != 0 )
+            return( ret );
 
         MBEDTLS_SSL_DEBUG_MSG( 2, ( "in_left: %" MBEDTLS_PRINTF_SIZET
                                     ", nb_want: %" MBEDTLS_PRINTF_SIZET,
@@ -1884,12 +1895,27 @@ int mbedtls_ssl_fetch_input( mbedtls_ssl_context *ssl, size_t nb_want )
     else
 #endif
     {
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+        if( ( ret = ssl_skip_to_next_record( ssl ) ) != 0 )
+            return( ret );
+#endif
+
         MBEDTLS_SSL_DEBUG_MSG( 2, ( "in_left: %" MBEDTLS_PRINTF_SIZET
                                     ", nb_want: %" MBEDTLS_PRINTF_SIZET,
                        ssl->in_left, nb_want ) );
 
         while( ssl->in_left < nb_want )
         {
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+            /*
+             * Ask for as much as fits: the transport may already hold the
+             * rest of this record and further ones.
+             */
+            if( ssl->conf->read_ahead == MBEDTLS_SSL_READ_AHEAD_ENABLED )
+                len = in_buf_len - (size_t)( ssl->in_hdr - ssl->in_buf ) -
+                      ssl->in_left;
+            else
+#endif
             len = nb_want - ssl->in_left;
 
             if( mbedtls_ssl_check_timer( ssl ) != 0 )
@@ -1967,10 +1993,24 @@ int mbedtls_ssl_flush_output( mbedtls_ssl_context *ssl )
                                     ", out_left: %" MBEDTLS_PRINTF_SIZET,
                        mbedtls_ssl_out_hdr_len( ssl ) + ssl->out_msglen, ssl->out_left ) );
 
-        buf = ssl->out_hdr - ssl->out_left;
-        ret = ssl->f_send( ssl->p_bio, buf, ssl->out_left );
+#if defined(MBEDTLS_SSL_KTLS)
+        if( ( ssl->ktls & MBEDTLS_SSL_KTLS_TX ) != 0 )
+        {
+            /* The rest of the plaintext of an offloaded record. */
+            buf = ssl->out_msg + ssl->out_msglen - ssl->out_left;
+            ret = ssl->f_send_record( ssl->p_bio, ssl->out_msgtype,
+                                      buf, ssl->out_left );
+
+            MBEDTLS_SSL_DEBUG_RET( 2, "ssl->f_send_record", ret );
+        }
+        else
+#endif /* MBEDTLS_SSL_KTLS */
+        {
+            buf = ssl->out_hdr - ssl->out_left;
+            ret = ssl->f_send( ssl->p_bio, buf, ssl->out_left );
 
-        MBEDTLS_SSL_DEBUG_RET( 2, "ssl->f_send", ret );
+            MBEDTLS_SSL_DEBUG_RET( 2, "ssl->f_send", ret );
+        }
 
         if( ret <= 0 )
             return( ret );
@@ -2527,6 +2567,29 @@ int mbedtls_ssl_write_record( mbedtls_ssl_context *ssl, uint8_t force_flush )
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write record" ) );
 
+#if defined(MBEDTLS_SSL_KTLS)
+    if( ( ssl->ktls & MBEDTLS_SSL_KTLS_TX ) != 0 )
+    {
+        /* The transport protects the record and sends it right away.
+         * out_left tracks how much of the plaintext is still to be sent,
+         * so that a partial send is finished by mbedtls_ssl_flush_output()
+         * like any other record. */
+        MBEDTLS_SSL_DEBUG_MSG( 3, ( "offloaded record: msgtype = %u, "
+                                    "length = %" MBEDTLS_PRINTF_SIZET,
+                                    (unsigned) ssl->out_msgtype, len ) );
+
+        ssl->out_left = len;
+        if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
+        {
+            MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_flush_output", ret );
+            return( ret );
+        }
+
+        MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= write record" ) );
+        return( 0 );
+    }
+#endif /* MBEDTLS_SSL_KTLS */
+
     if( !done )
     {
         unsigned i;
@@ -4361,11 +4424,227 @@ static int ssl_buffer_future_record( mbedtls_ssl_context *ssl,
 
 #endif /* MBEDTLS_SSL_PROTO_DTLS */
 
+#if defined(MBEDTLS_SSL_KTLS)
+/*
+ * Receive the plaintext of the next record(s) from a transport that
+ * protects them, and set it up like a record that we decrypted.
+ */
+static int ssl_ktls_get_next_record( mbedtls_ssl_context *ssl )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int type = 0;
+    size_t len;
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    size_t in_buf_len = ssl->in_buf_len;
+#else
+    size_t in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
+#endif
+
+    mbedtls_ssl_update_in_pointers( ssl );
+
+    len = in_buf_len - (size_t)( ssl->in_msg - ssl->in_buf );
+    if( len > MBEDTLS_SSL_IN_CONTENT_LEN )
+        len = MBEDTLS_SSL_IN_CONTENT_LEN;
+
+    ret = ssl->f_recv_record( ssl->p_bio, &type, ssl->in_msg, len );
+    if( ret < 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 2, "f_recv_record", ret );
+        return( ret );
+    }
+    if( ret == 0 )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 2, ( "f_recv_record: connection closed" ) );
+        return( MBEDTLS_ERR_SSL_CONN_EOF );
+    }
+    if( (size_t) ret > len || type < 0 || type > 0xFF )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 1, ( "f_recv_record returned invalid data" ) );
+        return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG( 3, ( "offloaded record: msgtype = %d, "
+                                "length = %d", type, ret ) );
+
+    ssl->in_msgtype = type;
+    ssl->in_hdr[0]  = (unsigned char) type;
+    ssl->in_msglen  = (size_t) ret;
+    MBEDTLS_PUT_UINT16_BE( ssl->in_msglen, ssl->in_len, 0 );
+
+    return( 0 );
+}
+#endif /* MBEDTLS_SSL_KTLS */
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+/*
+ * Decrypt the application data records that follow the current one in the
+ * read-ahead data, and append their contents to those of the current one.
+ *
+ * Each record is decrypted in place, then its contents are moved down to
+ * the end of the contents gathered so far, which stays before the records
+ * that are left. The batch stops at the first record that is incomplete,
+ * is not application data, or could make the gathered contents longer than
+ * MBEDTLS_SSL_IN_CONTENT_LEN. Two cases are left for
+ * ssl_batch_get_next_record(): a TLS 1.3 record whose inner content type
+ * is not application data, which is rewritten as a plaintext record, and
+ * a record that fails to decrypt, whose error is kept in ssl->in_batch.
+ */
+static void ssl_batch_decrypt( mbedtls_ssl_context *ssl )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t const hdr_len = mbedtls_ssl_in_hdr_len( ssl );
+    unsigned char *hdr;
+    size_t avail;
+    unsigned nb_records = 1;
+    mbedtls_record rec;
+
+    if( ssl->conf->batch_decrypt != MBEDTLS_SSL_BATCH_DECRYPT_ENABLED ||
+        ssl->conf->transport != MBEDTLS_SSL_TRANSPORT_STREAM ||
+        ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER ||
+        ssl->transform_in == NULL ||
+        ssl->in_msgtype != MBEDTLS_SSL_MSG_APPLICATION_DATA )
+    {
+        return;
+    }
+
+#if defined(MBEDTLS_SSL_RENEGOTIATION)
+    /* Application data records are counted one by one while we wait for
+     * the peer to renegotiate. */
+    if( ssl->renego_status == MBEDTLS_SSL_RENEGOTIATION_PENDING )
+        return;
+#endif
+
+    while( ssl->next_record_offset != 0 )
+    {
+        hdr   = ssl->in_hdr + ssl->next_record_offset;
+        avail = ssl->in_left - ssl->next_record_offset;
+
+        if( avail < hdr_len ||
+            hdr[0] != MBEDTLS_SSL_MSG_APPLICATION_DATA ||
+            avail < hdr_len + MBEDTLS_GET_UINT16_BE( hdr, hdr_len - 2 ) ||
+            ssl->in_msglen + MBEDTLS_GET_UINT16_BE( hdr, hdr_len - 2 ) >
+                MBEDTLS_SSL_IN_CONTENT_LEN )
+        {
+            break;
+        }
+
+        /* A bad header is reported when the record is read on its own. */
+        if( ssl_parse_record_header( ssl, hdr, avail, &rec ) != 0 )
+            break;
+
+        if( ( ret = ssl_prepare_record_content( ssl, &rec ) ) != 0 )
+        {
+            ssl->in_batch = ret;
+            break;
+        }
+
+        if( rec.type != MBEDTLS_SSL_MSG_APPLICATION_DATA )
+        {
+            /* Move the contents to the end of the record and put a
+             * plaintext header in front of them. */
+            memmove( rec.buf + rec.buf_len - rec.data_len,
+                     rec.buf + rec.data_offset, rec.data_len );
+            hdr = rec.buf + rec.buf_len - rec.data_len - hdr_len;
+            hdr[0] = rec.type;
+            hdr[1] = rec.ver[0];
+            hdr[2] = rec.ver[1];
+            MBEDTLS_PUT_UINT16_BE( rec.data_len, hdr, hdr_len - 2 );
+
+            ssl->next_record_offset = (size_t)( hdr - ssl->in_hdr );
+            ssl->in_batch = 1;
+            break;
+        }
+
+        memmove( ssl->in_msg + ssl->in_msglen,
+                 rec.buf + rec.data_offset, rec.data_len );
+        ssl->in_msglen += rec.data_len;
+        nb_records++;
+
+        ssl->next_record_offset += rec.buf_len;
+        if( ssl->next_record_offset == ssl->in_left )
+        {
+            ssl->next_record_offset = 0;
+            ssl->in_left = 0;
+        }
+    }
+
+    if( nb_records > 1 )
+    {
+        MBEDTLS_PUT_UINT16_BE( ssl->in_msglen, ssl->in_len, 0 );
+        MBEDTLS_SSL_DEBUG_MSG( 3, ( "decrypted %u records in a batch, "
+                                    "total length %" MBEDTLS_PRINTF_SIZET,
+                                    nb_records, ssl->in_msglen ) );
+    }
+}
+
+/*
+ * Get the next record when a batch has already processed it.
+ */
+static int ssl_batch_get_next_record( mbedtls_ssl_context *ssl )
+{
+    int ret = ssl->in_batch;
+    size_t const hdr_len = mbedtls_ssl_in_hdr_len( ssl );
+    size_t len;
+
+    ssl->in_batch = 0;
+
+    if( ret < 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "ssl_decrypt_buf (batch)", ret );
+#if defined(MBEDTLS_SSL_ALL_ALERT_MESSAGES)
+        if( ret == MBEDTLS_ERR_SSL_INVALID_MAC )
+        {
+            mbedtls_ssl_send_alert_message( ssl,
+                    MBEDTLS_SSL_ALERT_LEVEL_FATAL,
+                    MBEDTLS_SSL_ALERT_MSG_BAD_RECORD_MAC );
+        }
+#endif
+        return( ret );
+    }
+
+    /* Move the record to the start of the input buffer. */
+    ret = mbedtls_ssl_fetch_input( ssl, hdr_len );
+    if( ret != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_fetch_input", ret );
+        return( ret );
+    }
+
+    len = MBEDTLS_GET_UINT16_BE( ssl->in_hdr, hdr_len - 2 );
+    if( ssl->in_left > hdr_len + len )
+        ssl->next_record_offset = hdr_len + len;
+    else
+        ssl->in_left = 0;
+
+    MBEDTLS_SSL_DEBUG_MSG( 3, ( "record decrypted in a batch: msgtype = %u, "
+                                "msglen = %" MBEDTLS_PRINTF_SIZET,
+                                ssl->in_hdr[0], len ) );
+
+    mbedtls_ssl_update_in_pointers( ssl );
+    ssl->in_iv      = ssl->in_len + 2;
+    ssl->in_msgtype = ssl->in_hdr[0];
+    ssl->in_msg     = ssl->in_hdr + hdr_len;
+    ssl->in_msglen  = len;
+
+    return( 0 );
+}
+#endif /* MBEDTLS_SSL_BATCH_DECRYPT */
+
 static int ssl_get_next_record( mbedtls_ssl_context *ssl )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     mbedtls_record rec;
 
+#if defined(MBEDTLS_SSL_KTLS)
+    if( ( ssl->ktls & MBEDTLS_SSL_KTLS_RX ) != 0 )
+        return( ssl_ktls_get_next_record( ssl ) );
+#endif
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    if( ssl->in_batch != 0 )
+        return( ssl_batch_get_next_record( ssl ) );
+#endif
+
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     /* We might have buffered a future record; if so,
      * and if the epoch matches now, load it.
@@ -4475,6 +4754,15 @@ static int ssl_get_next_record( mbedtls_ssl_context *ssl )
             return( ret );
         }
 
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+        /* Keep any data read ahead beyond this record. */
+        if( ssl->in_left > rec.buf_len )
+        {
+            MBEDTLS_SSL_DEBUG_MSG( 3, ( "more data read ahead after record" ) );
+            ssl->next_record_offset = rec.buf_len;
+        }
+        else
+#endif
         ssl->in_left = 0;
     }
 
@@ -4564,6 +4852,10 @@ static int ssl_get_next_record( mbedtls_ssl_context *ssl )
     ssl->in_msglen = rec.data_len;
     MBEDTLS_PUT_UINT16_BE( rec.data_len, ssl->in_len, 0 );
 
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    ssl_batch_decrypt( ssl );
+#endif
+
     return( 0 );
 }
 
@@ -4722,6 +5014,17 @@ int mbedtls_ssl_send_alert_message( mbedtls_ssl_context *ssl,
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> send alert message" ) );
     MBEDTLS_SSL_DEBUG_MSG( 3, ( "send alert level=%u message=%u", level, message ));
 
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ( ret = mbedtls_ssl_acquire_buffers( ssl ) ) != 0 )
+        return( ret );
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    /* The alert reuses the buffer of the data held back. */
+    if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+        return( ret );
+#endif
+
     ssl->out_msgtype = MBEDTLS_SSL_MSG_ALERT;
     ssl->out_msglen = 2;
     ssl->out_msg[0] = level;
@@ -4969,7 +5272,8 @@ int mbedtls_ssl_check_pending( const mbedtls_ssl_context *ssl )
     }
 
     /*
-     * Case B: Further records are pending in the current datagram.
+     * Case B: Further records are pending in the current datagram,
+     * or a further complete record has been read ahead in TLS.
      */
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
@@ -4981,6 +5285,23 @@ int mbedtls_ssl_check_pending( const mbedtls_ssl_context *ssl )
     }
 #endif /* MBEDTLS_SSL_PROTO_DTLS */
 
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+    if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_STREAM &&
+        ssl->next_record_offset != 0 &&
+        ssl->in_left >= ssl->next_record_offset + mbedtls_ssl_in_hdr_len( ssl ) )
+    {
+        const unsigned char *next = ssl->in_hdr + ssl->next_record_offset;
+        size_t next_len = mbedtls_ssl_in_hdr_len( ssl ) +
+                          MBEDTLS_GET_UINT16_BE( next, 3 );
+
+        if( ssl->in_left - ssl->next_record_offset >= next_len )
+        {
+            MBEDTLS_SSL_DEBUG_MSG( 3, ( "ssl_check_pending: more records read ahead" ) );
+            return( 1 );
+        }
+    }
+#endif /* MBEDTLS_SSL_READ_AHEAD */
+
     /*
      * Case C: A handshake message is being processed.
      */
@@ -5198,6 +5519,9 @@ static int ssl_handle_hs_message_post_handshake( mbedtls_ssl_context *ssl )
 #if defined(MBEDTLS_SSL_RENEGOTIATION)
     /* Determine whether renegotiation attempt should be accepted */
     if( ! ( ssl->conf->disable_renegotiation == MBEDTLS_SSL_RENEGOTIATION_DISABLED ||
+#if defined(MBEDTLS_SSL_KTLS)
+            ssl->ktls != 0 ||
+#endif
             ( ssl->secure_renegotiation == MBEDTLS_SSL_LEGACY_RENEGOTIATION &&
               ssl->conf->allow_legacy_renegotiation ==
               MBEDTLS_SSL_LEGACY_NO_RENEGOTIATION ) ) )
@@ -5248,15 +5572,28 @@ static int ssl_handle_hs_message_post_handshake( mbedtls_ssl_context *ssl )
 /*
  * Receive application data decrypted from the SSL layer
  */
-int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
+/*
+ * Make an application data record available at ssl->in_offt, reading and
+ * processing records as necessary.
+ *
+ * Returns 0 on success, MBEDTLS_ERR_SSL_CONN_EOF at the end of the
+ * underlying transport, or another error code.
+ */
+static int ssl_read_app_data( mbedtls_ssl_context *ssl )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
 
-    if( ssl == NULL || ssl->conf == NULL )
-        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ( ret = mbedtls_ssl_acquire_buffers( ssl ) ) != 0 )
+        return( ret );
+#endif
 
-    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> read" ) );
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    /* Send the data held back first: the peer may be waiting for it
+     * before sending what we are about to read. */
+    if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+        return( ret );
+#endif
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
@@ -5319,7 +5656,7 @@ int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
         if( ( ret = mbedtls_ssl_read_record( ssl, 1 ) ) != 0 )
         {
             if( ret == MBEDTLS_ERR_SSL_CONN_EOF )
-                return( 0 );
+                return( ret );
 
             MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_read_record", ret );
             return( ret );
@@ -5334,7 +5671,7 @@ int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
             if( ( ret = mbedtls_ssl_read_record( ssl, 1 ) ) != 0 )
             {
                 if( ret == MBEDTLS_ERR_SSL_CONN_EOF )
-                    return( 0 );
+                    return( ret );
 
                 MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_read_record", ret );
                 return( ret );
@@ -5428,10 +5765,14 @@ int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
 #endif /* MBEDTLS_SSL_PROTO_DTLS */
     }
 
-    n = ( len < ssl->in_msglen )
-        ? len : ssl->in_msglen;
+    return( 0 );
+}
 
-    memcpy( buf, ssl->in_offt, n );
+/*
+ * Consume n bytes of the current application data record
+ */
+static void ssl_consume_app_data( mbedtls_ssl_context *ssl, size_t n )
+{
     ssl->in_msglen -= n;
 
     /* Zeroising the plaintext buffer to erase unused application data
@@ -5449,53 +5790,339 @@ int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
         /* more data available */
         ssl->in_offt += n;
     }
+}
+
+int mbedtls_ssl_readv( mbedtls_ssl_context *ssl,
+                       const mbedtls_ssl_iovec *iov, size_t iovcnt )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t n, chunk, i;
+
+    if( ssl == NULL || ssl->conf == NULL || ( iov == NULL && iovcnt != 0 ) )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> read" ) );
+
+    if( ( ret = ssl_read_app_data( ssl ) ) != 0 )
+    {
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+        if( ret == MBEDTLS_ERR_SSL_WANT_READ )
+            mbedtls_ssl_auto_release_buffers( ssl );
+#endif
+        return( ret == MBEDTLS_ERR_SSL_CONN_EOF ? 0 : ret );
+    }
+
+    /* Scatter the record contents across the buffers, in order. */
+    n = 0;
+    for( i = 0; i < iovcnt && n < ssl->in_msglen; i++ )
+    {
+        chunk = ( iov[i].len < ssl->in_msglen - n )
+                ? iov[i].len : ssl->in_msglen - n;
+        if( chunk != 0 )
+            memcpy( iov[i].base, ssl->in_offt + n, chunk );
+        n += chunk;
+    }
+
+    ssl_consume_app_data( ssl, n );
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= read" ) );
 
     return( (int) n );
 }
 
-/*
- * Send application data to be encrypted by the SSL layer, taking care of max
- * fragment length and buffer size.
- *
- * According to RFC 5246 Section 6.2.1:
- *
- *      Zero-length fragments of Application data MAY be sent as they are
- *      potentially useful as a traffic analysis countermeasure.
- *
- * Therefore, it is possible that the input message length is 0 and the
- * corresponding return code is 0 on success.
- */
-static int ssl_write_real( mbedtls_ssl_context *ssl,
-                           const unsigned char *buf, size_t len )
+int mbedtls_ssl_read_get( mbedtls_ssl_context *ssl,
+                          const unsigned char **buf, size_t *buflen )
 {
-    int ret = mbedtls_ssl_get_max_out_record_payload( ssl );
-    const size_t max_len = (size_t) ret;
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
-    if( ret < 0 )
-    {
-        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_get_max_out_record_payload", ret );
-        return( ret );
-    }
+    if( ssl == NULL || ssl->conf == NULL || buf == NULL || buflen == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
 
-    if( len > max_len )
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> read get" ) );
+
+    if( ( ret = ssl_read_app_data( ssl ) ) != 0 )
     {
-#if defined(MBEDTLS_SSL_PROTO_DTLS)
-        if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
-        {
-            MBEDTLS_SSL_DEBUG_MSG( 1, ( "fragment larger than the (negotiated) "
-                                "maximum fragment length: %" MBEDTLS_PRINTF_SIZET
-                                " > %" MBEDTLS_PRINTF_SIZET,
-                                len, max_len ) );
-            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
-        }
-        else
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+        if( ret == MBEDTLS_ERR_SSL_WANT_READ )
+            mbedtls_ssl_auto_release_buffers( ssl );
 #endif
-            len = max_len;
+        return( ret );
     }
 
-    if( ssl->out_left != 0 )
+    *buf = ssl->in_offt;
+    *buflen = ssl->in_msglen;
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= read get" ) );
+
+    return( 0 );
+}
+
+int mbedtls_ssl_read_commit( mbedtls_ssl_context *ssl, size_t len )
+{
+    if( ssl == NULL || ssl->conf == NULL ||
+        ( ssl->in_offt == NULL && len != 0 ) ||
+        ( ssl->in_offt != NULL && len > ssl->in_msglen ) )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    if( ssl->in_offt != NULL )
+        ssl_consume_app_data( ssl, len );
+
+    return( 0 );
+}
+
+int mbedtls_ssl_read( mbedtls_ssl_context *ssl, unsigned char *buf, size_t len )
+{
+    mbedtls_ssl_iovec iov;
+
+    iov.base = buf;
+    iov.len = len;
+
+    return( mbedtls_ssl_readv( ssl, &iov, 1 ) );
+}
+
+/*
+ * Copy the first len bytes held in the buffers of iov to dst.
+ */
+static void ssl_iov_gather( unsigned char *dst,
+                            const mbedtls_ssl_iovec *iov, size_t iovcnt,
+                            size_t len )
+{
+    size_t i, chunk;
+
+    for( i = 0; i < iovcnt && len != 0; i++ )
+    {
+        chunk = ( iov[i].len < len ) ? iov[i].len : len;
+        if( chunk != 0 )
+            memcpy( dst, iov[i].base, chunk );
+        dst += chunk;
+        len -= chunk;
+    }
+}
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+static int ssl_write_coalescing( const mbedtls_ssl_context *ssl )
+{
+#if defined(MBEDTLS_SSL_KTLS)
+    /* The transport builds the records. */
+    if( ( ssl->ktls & MBEDTLS_SSL_KTLS_TX ) != 0 )
+        return( 0 );
+#endif
+    return( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_STREAM &&
+            ( ssl->out_corked != 0 || ssl->conf->coalesce_threshold != 0 ) );
+}
+
+/*
+ * Send the application data held back in out_msg, if any.
+ *
+ * While writes are coalesced, any data in the output buffer belongs to
+ * records of held back data, so we can flush it here without breaking the
+ * "call again with the same arguments" contract of mbedtls_ssl_write().
+ */
+int mbedtls_ssl_flush_coalesced( mbedtls_ssl_context *ssl )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ! ssl_write_coalescing( ssl ) )
+        return( 0 );
+
+    if( ssl->out_left != 0 )
+        return( mbedtls_ssl_flush_output( ssl ) );
+
+    if( ssl->out_coalesced == 0 )
+        return( 0 );
+
+    MBEDTLS_SSL_DEBUG_MSG( 3, ( "send %" MBEDTLS_PRINTF_SIZET
+                                " bytes of coalesced application data",
+                                ssl->out_coalesced ) );
+
+    ssl->out_msgtype = MBEDTLS_SSL_MSG_APPLICATION_DATA;
+    ssl->out_msglen  = ssl->out_coalesced;
+    ssl->out_coalesced = 0;
+
+    /* Nothing is held back any more. */
+    if( ssl->out_coalesce_timer != 0 )
+    {
+        mbedtls_ssl_set_timer( ssl, 0 );
+        ssl->out_coalesce_timer = 0;
+    }
+
+    if( ( ret = mbedtls_ssl_write_record( ssl, SSL_FORCE_FLUSH ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_write_record", ret );
+        return( ret );
+    }
+
+    return( 0 );
+}
+
+/*
+ * Start the deadline for data that automatic coalescing holds back, if
+ * there is one. Return 0 if the data must not be held back, because the
+ * deadline cannot be enforced.
+ */
+static int ssl_write_coalesce_deadline( mbedtls_ssl_context *ssl )
+{
+    if( ssl->out_corked != 0 || ssl->conf->coalesce_timeout == 0 ||
+        ssl->out_coalesce_timer != 0 )
+    {
+        return( 1 );
+    }
+
+    /* The timer is shared with the read timeout. */
+    if( ssl->f_get_timer == NULL || ssl->f_get_timer( ssl->p_timer ) != -1 )
+        return( 0 );
+
+    mbedtls_ssl_set_timer( ssl, ssl->conf->coalesce_timeout );
+    ssl->out_coalesce_timer = 1;
+
+    return( 1 );
+}
+
+/*
+ * Append application data to the held back data, and send it as a record
+ * once there is enough of it.
+ */
+static int ssl_write_coalesce( mbedtls_ssl_context *ssl,
+                               const mbedtls_ssl_iovec *iov, size_t iovcnt,
+                               size_t len, size_t max_len )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t threshold = max_len;
+
+    if( ssl->out_corked == 0 && ssl->conf->coalesce_threshold < max_len )
+        threshold = ssl->conf->coalesce_threshold;
+
+    /* Data held back past its deadline goes out before the new data. */
+    if( ssl->out_coalesce_timer != 0 && mbedtls_ssl_check_timer( ssl ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 3, ( "coalescing timeout expired" ) );
+        if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+            return( ret );
+    }
+
+    /* Finish sending the previous record before reusing the buffer. */
+    if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_flush_output", ret );
+        return( ret );
+    }
+
+    if( len > max_len - ssl->out_coalesced )
+        len = max_len - ssl->out_coalesced;
+
+    ssl_iov_gather( ssl->out_msg + ssl->out_coalesced, iov, iovcnt, len );
+    ssl->out_coalesced += len;
+
+    if( ssl->out_coalesced >= threshold ||
+        ! ssl_write_coalesce_deadline( ssl ) )
+    {
+        /* The data is in the record now: if the transport is not ready,
+         * the record goes out at the next write, read or uncork. */
+        ret = mbedtls_ssl_flush_coalesced( ssl );
+        if( ret != 0 && ret != MBEDTLS_ERR_SSL_WANT_WRITE )
+            return( ret );
+    }
+
+    return( (int) len );
+}
+#endif /* MBEDTLS_SSL_WRITE_COALESCING */
+
+#if defined(MBEDTLS_SSL_KTLS)
+/*
+ * Pass application data to a transport that builds the records itself.
+ * Only the first buffer is sent: like with any partial write, the caller
+ * then comes back with the rest.
+ */
+static int ssl_ktls_write( mbedtls_ssl_context *ssl,
+                           const mbedtls_ssl_iovec *iov, size_t iovcnt,
+                           size_t len )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+    for( i = 0; i < iovcnt && iov[i].len == 0; i++ )
+        ;
+    if( i == iovcnt || len == 0 )
+        return( 0 );
+
+    if( len > iov[i].len )
+        len = iov[i].len;
+
+    /* Finish sending a record, such as an alert, that went out partially. */
+    if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_flush_output", ret );
+        return( ret );
+    }
+
+    ret = ssl->f_send( ssl->p_bio, iov[i].base, len );
+    MBEDTLS_SSL_DEBUG_RET( 2, "ssl->f_send(offloaded)", ret );
+
+    return( ret );
+}
+#endif /* MBEDTLS_SSL_KTLS */
+
+/*
+ * Send application data to be encrypted by the SSL layer, taking care of max
+ * fragment length and buffer size.
+ *
+ * According to RFC 5246 Section 6.2.1:
+ *
+ *      Zero-length fragments of Application data MAY be sent as they are
+ *      potentially useful as a traffic analysis countermeasure.
+ *
+ * Therefore, it is possible that the input message length is 0 and the
+ * corresponding return code is 0 on success.
+ */
+static int ssl_write_real( mbedtls_ssl_context *ssl,
+                           const mbedtls_ssl_iovec *iov, size_t iovcnt )
+{
+    int ret = mbedtls_ssl_get_max_out_record_payload( ssl );
+    const size_t max_len = (size_t) ret;
+    size_t len = 0, i;
+
+    if( ret < 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_get_max_out_record_payload", ret );
+        return( ret );
+    }
+
+    for( i = 0; i < iovcnt; i++ )
+    {
+        if( iov[i].len > SIZE_MAX - len )
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+        len += iov[i].len;
+    }
+
+    if( len > max_len )
+    {
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
+        if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
+        {
+            MBEDTLS_SSL_DEBUG_MSG( 1, ( "fragment larger than the (negotiated) "
+                                "maximum fragment length: %" MBEDTLS_PRINTF_SIZET
+                                " > %" MBEDTLS_PRINTF_SIZET,
+                                len, max_len ) );
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+        }
+        else
+#endif
+            len = max_len;
+    }
+
+#if defined(MBEDTLS_SSL_KTLS)
+    if( ( ssl->ktls & MBEDTLS_SSL_KTLS_TX ) != 0 )
+        return( ssl_ktls_write( ssl, iov, iovcnt, len ) );
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    if( ssl_write_coalescing( ssl ) )
+        return( ssl_write_coalesce( ssl, iov, iovcnt, len, max_len ) );
+#endif
+
+    if( ssl->out_left != 0 )
     {
         /*
          * The user has previously tried to send the data and
@@ -5518,7 +6145,7 @@ static int ssl_write_real( mbedtls_ssl_context *ssl,
          */
         ssl->out_msglen  = len;
         ssl->out_msgtype = MBEDTLS_SSL_MSG_APPLICATION_DATA;
-        memcpy( ssl->out_msg, buf, len );
+        ssl_iov_gather( ssl->out_msg, iov, iovcnt, len );
 
         if( ( ret = mbedtls_ssl_write_record( ssl, SSL_FORCE_FLUSH ) ) != 0 )
         {
@@ -5531,16 +6158,16 @@ static int ssl_write_real( mbedtls_ssl_context *ssl,
 }
 
 /*
- * Write application data (public-facing wrapper)
+ * Get the connection ready for sending application data
  */
-int mbedtls_ssl_write( mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len )
+static int ssl_write_prepare( mbedtls_ssl_context *ssl )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
-    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write" ) );
-
-    if( ssl == NULL || ssl->conf == NULL )
-        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ( ret = mbedtls_ssl_acquire_buffers( ssl ) ) != 0 )
+        return( ret );
+#endif
 
 #if defined(MBEDTLS_SSL_RENEGOTIATION)
     if( ( ret = ssl_check_ctr_renegotiate( ssl ) ) != 0 )
@@ -5559,13 +6186,322 @@ int mbedtls_ssl_write( mbedtls_ssl_context *ssl, const unsigned char *buf, size_
         }
     }
 
-    ret = ssl_write_real( ssl, buf, len );
+    return( 0 );
+}
+
+/*
+ * Write application data (public-facing wrapper)
+ */
+int mbedtls_ssl_writev( mbedtls_ssl_context *ssl,
+                        const mbedtls_ssl_iovec *iov, size_t iovcnt )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write" ) );
+
+    if( ssl == NULL || ssl->conf == NULL || ( iov == NULL && iovcnt != 0 ) )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = ssl_write_prepare( ssl ) ) != 0 )
+        return( ret );
+
+    ret = ssl_write_real( ssl, iov, iovcnt );
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ret >= 0 )
+        mbedtls_ssl_auto_release_buffers( ssl );
+#endif
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= write" ) );
 
     return( ret );
 }
 
+int mbedtls_ssl_write( mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len )
+{
+    mbedtls_ssl_iovec iov;
+
+    /* The data is only read from. */
+    iov.base = (unsigned char *) buf;
+    iov.len = len;
+
+    return( mbedtls_ssl_writev( ssl, &iov, 1 ) );
+}
+
+int mbedtls_ssl_write_get( mbedtls_ssl_context *ssl,
+                           unsigned char **buf, size_t *buflen )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ssl == NULL || ssl->conf == NULL || buf == NULL || buflen == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write get" ) );
+
+    if( ( ret = ssl_write_prepare( ssl ) ) != 0 )
+        return( ret );
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    /* The record is built where held back data is kept: send that first. */
+    while( ssl_write_coalescing( ssl ) && ssl->out_coalesced != 0 )
+    {
+        if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+            return( ret );
+    }
+#endif
+
+    if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_flush_output", ret );
+        return( ret );
+    }
+
+    ret = mbedtls_ssl_get_max_out_record_payload( ssl );
+    if( ret < 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_get_max_out_record_payload", ret );
+        return( ret );
+    }
+
+    *buf = ssl->out_msg;
+    *buflen = (size_t) ret;
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= write get" ) );
+
+    return( 0 );
+}
+
+int mbedtls_ssl_write_commit( mbedtls_ssl_context *ssl, size_t len )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ssl == NULL || ssl->conf == NULL ||
+        ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    /* The buffers have been released since mbedtls_ssl_write_get(). */
+    if( ssl->out_buf == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#endif
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write commit" ) );
+
+    if( ssl->out_left != 0 )
+    {
+        /* Retry after MBEDTLS_ERR_SSL_WANT_WRITE: the record is built. */
+        if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
+        {
+            MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_flush_output", ret );
+            return( ret );
+        }
+    }
+    else
+    {
+        ret = mbedtls_ssl_get_max_out_record_payload( ssl );
+        if( ret < 0 )
+        {
+            MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_get_max_out_record_payload", ret );
+            return( ret );
+        }
+        if( len > (size_t) ret )
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+        /* The plaintext is already in place. */
+        ssl->out_msglen  = len;
+        ssl->out_msgtype = MBEDTLS_SSL_MSG_APPLICATION_DATA;
+
+        if( ( ret = mbedtls_ssl_write_record( ssl, SSL_FORCE_FLUSH ) ) != 0 )
+        {
+            MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_write_record", ret );
+            return( ret );
+        }
+    }
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    mbedtls_ssl_auto_release_buffers( ssl );
+#endif
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= write commit" ) );
+
+    return( 0 );
+}
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+int mbedtls_ssl_cork( mbedtls_ssl_context *ssl )
+{
+    if( ssl == NULL || ssl->conf == NULL ||
+        ssl->conf->transport != MBEDTLS_SSL_TRANSPORT_STREAM )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    ssl->out_corked = 1;
+
+    return( 0 );
+}
+
+int mbedtls_ssl_uncork( mbedtls_ssl_context *ssl )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ssl == NULL || ssl->conf == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> uncork" ) );
+
+    /* Stay corked until everything is out, so that a retry still
+     * flushes the output buffer. */
+    while( ssl_write_coalescing( ssl ) &&
+           ( ssl->out_coalesced != 0 || ssl->out_left != 0 ) )
+    {
+        if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+            return( ret );
+    }
+
+    ssl->out_corked = 0;
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "<= uncork" ) );
+
+    return( 0 );
+}
+#endif /* MBEDTLS_SSL_WRITE_COALESCING */
+
+#if defined(MBEDTLS_SSL_KTLS)
+/*
+ * Check that the record protection of one direction can be handed over
+ * to the transport now, and return the transform that it uses.
+ */
+static int ssl_ktls_check( const mbedtls_ssl_context *ssl, int direction,
+                           const mbedtls_ssl_transform **transform )
+{
+    if( ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER ||
+        ssl->conf->transport != MBEDTLS_SSL_TRANSPORT_STREAM ||
+        ( ssl->ktls & direction ) != 0 )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    if( direction == MBEDTLS_SSL_KTLS_TX )
+    {
+        /* Records that are already protected must go out first. */
+        if( ssl->out_left != 0 )
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+        if( ssl->out_coalesced != 0 )
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#endif
+        *transform = ssl->transform_out;
+    }
+    else if( direction == MBEDTLS_SSL_KTLS_RX )
+    {
+        /* Records that we have already read from the transport could not
+         * be decrypted by it. */
+        if( ssl->in_left != 0 )
+            return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+        *transform = ssl->transform_in;
+    }
+    else
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( *transform == NULL ||
+        (*transform)->ktls_cipher == MBEDTLS_CIPHER_NONE )
+    {
+        return( MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE );
+    }
+
+    return( 0 );
+}
+
+int mbedtls_ssl_get_ktls_info( const mbedtls_ssl_context *ssl,
+                               int direction,
+                               mbedtls_ssl_ktls_info *info )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_ssl_transform *transform = NULL;
+
+    if( ssl == NULL || ssl->conf == NULL || info == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = ssl_ktls_check( ssl, direction, &transform ) ) != 0 )
+        return( ret );
+
+    memset( info, 0, sizeof( *info ) );
+
+    info->tls_version = (uint16_t)( ( ssl->major_ver << 8 ) |
+                                    transform->minor_ver );
+    info->cipher = transform->ktls_cipher;
+    info->key_len = transform->ktls_keylen;
+    info->iv_len = transform->fixed_ivlen;
+
+    if( direction == MBEDTLS_SSL_KTLS_TX )
+    {
+        memcpy( info->key, transform->ktls_key_enc, info->key_len );
+        memcpy( info->iv, transform->iv_enc, info->iv_len );
+        memcpy( info->rec_seq, ssl->cur_out_ctr, sizeof( info->rec_seq ) );
+    }
+    else
+    {
+        memcpy( info->key, transform->ktls_key_dec, info->key_len );
+        memcpy( info->iv, transform->iv_dec, info->iv_len );
+        memcpy( info->rec_seq, ssl->in_ctr, sizeof( info->rec_seq ) );
+    }
+
+    return( 0 );
+}
+
+int mbedtls_ssl_set_ktls( mbedtls_ssl_context *ssl,
+                          int directions,
+                          mbedtls_ssl_send_record_t *f_send_record,
+                          mbedtls_ssl_recv_record_t *f_recv_record )
+{
+    const mbedtls_ssl_transform *transform = NULL;
+
+    if( ssl == NULL || ssl->conf == NULL ||
+        ( directions & ~( MBEDTLS_SSL_KTLS_TX | MBEDTLS_SSL_KTLS_RX ) ) != 0 )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    /* Directions that are already offloaded stay as they are. */
+    directions &= ~ssl->ktls;
+
+    if( ( directions & MBEDTLS_SSL_KTLS_TX ) != 0 &&
+        ( f_send_record == NULL || ssl->f_send == NULL ||
+          ssl_ktls_check( ssl, MBEDTLS_SSL_KTLS_TX, &transform ) != 0 ) )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    if( ( directions & MBEDTLS_SSL_KTLS_RX ) != 0 &&
+        ( f_recv_record == NULL ||
+          ssl_ktls_check( ssl, MBEDTLS_SSL_KTLS_RX, &transform ) != 0 ) )
+    {
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+    }
+
+    if( ( directions & MBEDTLS_SSL_KTLS_TX ) != 0 )
+        ssl->f_send_record = f_send_record;
+    if( ( directions & MBEDTLS_SSL_KTLS_RX ) != 0 )
+        ssl->f_recv_record = f_recv_record;
+
+    ssl->ktls |= directions;
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "record protection offloaded: tx %d, rx %d",
+                                ( ssl->ktls & MBEDTLS_SSL_KTLS_TX ) != 0,
+                                ( ssl->ktls & MBEDTLS_SSL_KTLS_RX ) != 0 ) );
+
+    return( 0 );
+}
+
+int mbedtls_ssl_get_ktls( const mbedtls_ssl_context *ssl )
+{
+    return( ssl->ktls );
+}
+#endif /* MBEDTLS_SSL_KTLS */
+
 /*
  * Notify the peer that the connection is being closed
  */
@@ -5578,6 +6514,11 @@ int mbedtls_ssl_close_notify( mbedtls_ssl_context *ssl )
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> write close notify" ) );
 
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+        return( ret );
+#endif
+
     if( ssl->out_left != 0 )
         return( mbedtls_ssl_flush_output( ssl ) );
 
@@ -1307,6 +1307,11 @@ read_record_header:
         if( ssl->conf->transport == MBEDTLS_SSL_TRANSPORT_DATAGRAM )
             ssl->next_record_offset = msg_len + mbedtls_ssl_in_hdr_len( ssl );
         else
+#endif
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+        if( ssl->in_left > msg_len + mbedtls_ssl_in_hdr_len( ssl ) )
+            ssl->next_record_offset = msg_len + mbedtls_ssl_in_hdr_len( ssl );
+        else
 #endif
             ssl->in_left = 0;
     }
@@ -2949,6 +2954,71 @@ static int ssl_resume_server_key_exchange( mbedtls_ssl_context *ssl,
 #endif /* defined(MBEDTLS_KEY_EXCHANGE_WITH_SERVER_SIGNATURE_ENABLED) &&
           defined(MBEDTLS_SSL_ASYNC_PRIVATE) */
 
+#if defined(MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED)
+/*
+ * Write ServerECDHParams using a key pair from the ephemeral key pool set
+ * with mbedtls_ssl_conf_ecdhe_pool(), if any.
+ *
+ * Return 1 if no pregenerated key is available, in which case nothing has
+ * been written and the caller should generate a fresh key.
+ */
+static int ssl_write_pooled_ecdh_params( mbedtls_ssl_context *ssl,
+                                         mbedtls_ecp_group_id grp_id,
+                                         size_t *olen )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char *buf = ssl->out_msg + ssl->out_msglen;
+    size_t blen = MBEDTLS_SSL_OUT_CONTENT_LEN - ssl->out_msglen;
+    size_t grp_len, pt_len;
+    mbedtls_ecp_keypair key;
+
+    if( ssl->conf->f_ecdhe_take == NULL )
+        return( 1 );
+
+#if defined(MBEDTLS_ECDH_VARIANT_EVEREST_ENABLED)
+    /* Everest keeps its own key representation. */
+    if( grp_id == MBEDTLS_ECP_DP_CURVE25519 )
+        return( 1 );
+#endif
+
+    mbedtls_ecp_keypair_init( &key );
+
+    if( ssl->conf->f_ecdhe_take( ssl->conf->p_ecdhe_pool,
+                                 grp_id, &key ) != 0 ||
+        key.grp.id != grp_id )
+    {
+        ret = 1;
+        goto cleanup;
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG( 3, ( "using pregenerated ECDHE key" ) );
+
+    if( ( ret = mbedtls_ecdh_get_params( &ssl->handshake->ecdh_ctx, &key,
+                                         MBEDTLS_ECDH_OURS ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecdh_get_params", ret );
+        goto cleanup;
+    }
+
+    if( ( ret = mbedtls_ecp_tls_write_group( &key.grp, &grp_len,
+                                             buf, blen ) ) != 0 ||
+        ( ret = mbedtls_ecp_tls_write_point( &key.grp, &key.Q,
+                                             MBEDTLS_ECP_PF_UNCOMPRESSED,
+                                             &pt_len, buf + grp_len,
+                                             blen - grp_len ) ) != 0 )
+    {
+        MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecp_tls_write_point", ret );
+        goto cleanup;
+    }
+
+    *olen = grp_len + pt_len;
+
+cleanup:
+    mbedtls_ecp_keypair_free( &key );
+    return( ret );
+}
+#endif /* MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED */
+
 /* Prepare the ServerKeyExchange message, up to and including
  * calculating the signature if any, but excluding formatting the
  * signature and sending the message. */
@@ -3123,15 +3193,22 @@ curve_matching_done:
             return( ret );
         }
 
-        if( ( ret = mbedtls_ecdh_make_params(
-                  &ssl->handshake->ecdh_ctx, &len,
-                  ssl->out_msg + ssl->out_msglen,
-                  MBEDTLS_SSL_OUT_CONTENT_LEN - ssl->out_msglen,
-                  ssl->conf->f_rng, ssl->conf->p_rng ) ) != 0 )
+        ret = ssl_write_pooled_ecdh_params( ssl, (*curve)->grp_id, &len );
+        if( ret == 1 )
         {
-            MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecdh_make_params", ret );
-            return( ret );
+            /* No pregenerated key available, generate one now. */
+            if( ( ret = mbedtls_ecdh_make_params(
+                      &ssl->handshake->ecdh_ctx, &len,
+                      ssl->out_msg + ssl->out_msglen,
+                      MBEDTLS_SSL_OUT_CONTENT_LEN - ssl->out_msglen,
+                      ssl->conf->f_rng, ssl->conf->p_rng ) ) != 0 )
+            {
+                MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecdh_make_params", ret );
+                return( ret );
+            }
         }
+        else if( ret != 0 )
+            return( ret );
 
 #if defined(MBEDTLS_KEY_EXCHANGE_WITH_SERVER_SIGNATURE_ENABLED)
         dig_signed = ssl->out_msg + ssl->out_msglen;
@@ -279,7 +279,8 @@ static void handle_buffer_resizing( mbedtls_ssl_context *ssl, int downsizing,
         iv_offset_in = ssl->in_iv - ssl->in_buf;
         len_offset_in = ssl->in_len - ssl->in_buf;
         if( downsizing ?
-            ssl->in_buf_len > in_buf_new_len && ssl->in_left < in_buf_new_len :
+            ssl->in_buf_len > in_buf_new_len &&
+            (size_t)( ssl->in_hdr - ssl->in_buf ) + ssl->in_left < in_buf_new_len :
             ssl->in_buf_len < in_buf_new_len )
         {
             if( resize_buffer( &ssl->in_buf, in_buf_new_len, &ssl->in_buf_len ) != 0 )
@@ -977,6 +978,136 @@ error:
     return( ret );
 }
 
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+/*
+ * Check that the buffers of a connection hold nothing that is still needed.
+ */
+static int ssl_buffers_are_idle( const mbedtls_ssl_context *ssl )
+{
+    if( ssl->state != MBEDTLS_SSL_HANDSHAKE_OVER || ssl->handshake != NULL )
+        return( 0 );
+
+    /* The current record, if any, must have been processed entirely. */
+    if( ssl->in_left != 0 || ssl->in_offt != NULL ||
+        ssl->keep_current_message != 0 ||
+        ( ssl->in_hslen != 0 && ssl->in_hslen < ssl->in_msglen ) )
+    {
+        return( 0 );
+    }
+
+    if( ssl->out_left != 0 )
+        return( 0 );
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    if( ssl->out_coalesced != 0 )
+        return( 0 );
+#endif
+
+    return( 1 );
+}
+
+int mbedtls_ssl_release_buffers( mbedtls_ssl_context *ssl )
+{
+    size_t in_buf_len, out_buf_len;
+
+    if( ssl == NULL || ssl->conf == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    in_buf_len = ssl->in_buf_len;
+    out_buf_len = ssl->out_buf_len;
+#else
+    in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
+    out_buf_len = MBEDTLS_SSL_OUT_BUFFER_LEN;
+#endif
+
+    if( ssl->in_buf == NULL )
+        return( 0 );
+
+    if( ! ssl_buffers_are_idle( ssl ) )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "release idle buffers" ) );
+
+    /* In TLS, the incoming record sequence number is kept in the input
+     * buffer. */
+    memcpy( ssl->idle_in_ctr, ssl->in_ctr, MBEDTLS_SSL_SEQUENCE_NUMBER_LEN );
+
+    mbedtls_platform_zeroize( ssl->in_buf, in_buf_len );
+    mbedtls_free( ssl->in_buf );
+    mbedtls_platform_zeroize( ssl->out_buf, out_buf_len );
+    mbedtls_free( ssl->out_buf );
+
+    ssl->in_buf = NULL;
+    ssl->out_buf = NULL;
+
+    /* The last record has been processed and goes away with the buffer. */
+    ssl->in_msglen = 0;
+    ssl->in_hslen = 0;
+
+    ssl->in_hdr = NULL;
+    ssl->in_ctr = ssl->idle_in_ctr;
+    ssl->in_len = NULL;
+    ssl->in_iv = NULL;
+    ssl->in_msg = NULL;
+
+    ssl->out_hdr = NULL;
+    ssl->out_ctr = NULL;
+    ssl->out_len = NULL;
+    ssl->out_iv = NULL;
+    ssl->out_msg = NULL;
+
+    return( 0 );
+}
+
+/*
+ * Allocate the buffers again if mbedtls_ssl_release_buffers() freed them.
+ */
+int mbedtls_ssl_acquire_buffers( mbedtls_ssl_context *ssl )
+{
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    size_t in_buf_len = ssl->in_buf_len;
+    size_t out_buf_len = ssl->out_buf_len;
+#else
+    size_t in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
+    size_t out_buf_len = MBEDTLS_SSL_OUT_BUFFER_LEN;
+#endif
+
+    if( ssl->in_buf != NULL )
+        return( 0 );
+
+    ssl->in_buf = mbedtls_calloc( 1, in_buf_len );
+    ssl->out_buf = mbedtls_calloc( 1, out_buf_len );
+    if( ssl->in_buf == NULL || ssl->out_buf == NULL )
+    {
+        MBEDTLS_SSL_DEBUG_MSG( 1, ( "alloc(%" MBEDTLS_PRINTF_SIZET " + %"
+                                    MBEDTLS_PRINTF_SIZET " bytes) failed",
+                                    in_buf_len, out_buf_len ) );
+        mbedtls_free( ssl->in_buf );
+        mbedtls_free( ssl->out_buf );
+        ssl->in_buf = NULL;
+        ssl->out_buf = NULL;
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG( 2, ( "reacquired idle buffers" ) );
+
+    mbedtls_ssl_reset_in_out_pointers( ssl );
+    mbedtls_ssl_update_out_pointers( ssl, ssl->transform_out );
+    memcpy( ssl->in_ctr, ssl->idle_in_ctr, MBEDTLS_SSL_SEQUENCE_NUMBER_LEN );
+
+    return( 0 );
+}
+
+void mbedtls_ssl_auto_release_buffers( mbedtls_ssl_context *ssl )
+{
+    if( ssl->conf->idle_buffer_release ==
+        MBEDTLS_SSL_IDLE_BUFFER_RELEASE_ENABLED )
+    {
+        (void) mbedtls_ssl_release_buffers( ssl );
+    }
+}
+#endif /* MBEDTLS_SSL_IDLE_BUFFER_RELEASE */
+
 /*
  * Reset an initialized and used SSL context for re-use while retaining
  * all application-set variables, function pointers and data.
@@ -1013,8 +1144,13 @@ void mbedtls_ssl_session_reset_msg_layer( mbedtls_ssl_context *ssl,
     ssl->keep_current_message = 0;
     ssl->transform_in  = NULL;
 
-#if defined(MBEDTLS_SSL_PROTO_DTLS)
+#if defined(MBEDTLS_SSL_PROTO_DTLS) || defined(MBEDTLS_SSL_READ_AHEAD)
     ssl->next_record_offset = 0;
+#endif
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    ssl->in_batch = 0;
+#endif
+#if defined(MBEDTLS_SSL_PROTO_DTLS)
     ssl->in_epoch = 0;
 #endif
 
@@ -1029,10 +1165,19 @@ void mbedtls_ssl_session_reset_msg_layer( mbedtls_ssl_context *ssl,
     ssl->out_msgtype = 0;
     ssl->out_msglen  = 0;
     ssl->out_left    = 0;
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    ssl->out_coalesced = 0;
+    ssl->out_corked    = 0;
+    ssl->out_coalesce_timer = 0;
+#endif
     memset( ssl->out_buf, 0, out_buf_len );
     memset( ssl->cur_out_ctr, 0, sizeof( ssl->cur_out_ctr ) );
     ssl->transform_out = NULL;
 
+#if defined(MBEDTLS_SSL_KTLS)
+    ssl->ktls = 0;
+#endif
+
 #if defined(MBEDTLS_SSL_DTLS_ANTI_REPLAY)
     mbedtls_ssl_dtls_replay_reset( ssl );
 #endif
@@ -1069,6 +1214,11 @@ int mbedtls_ssl_session_reset_int( mbedtls_ssl_context *ssl, int partial )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ( ret = mbedtls_ssl_acquire_buffers( ssl ) ) != 0 )
+        return( ret );
+#endif
+
     ssl->state = MBEDTLS_SSL_HELLO_REQUEST;
 
     mbedtls_ssl_session_reset_msg_layer( ssl, partial );
@@ -1143,6 +1293,42 @@ void mbedtls_ssl_conf_dtls_anti_replay( mbedtls_ssl_config *conf, char mode )
 }
 #endif
 
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+void mbedtls_ssl_conf_read_ahead( mbedtls_ssl_config *conf, char mode )
+{
+    conf->read_ahead = mode;
+}
+#endif
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+void mbedtls_ssl_conf_batch_decrypt( mbedtls_ssl_config *conf, char mode )
+{
+    conf->batch_decrypt = mode;
+}
+#endif
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+void mbedtls_ssl_conf_idle_buffer_release( mbedtls_ssl_config *conf,
+                                           char mode )
+{
+    conf->idle_buffer_release = mode;
+}
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+void mbedtls_ssl_conf_write_coalescing( mbedtls_ssl_config *conf,
+                                        size_t threshold )
+{
+    conf->coalesce_threshold = threshold;
+}
+
+void mbedtls_ssl_conf_write_coalescing_timeout( mbedtls_ssl_config *conf,
+                                                uint32_t timeout )
+{
+    conf->coalesce_timeout = timeout;
+}
+#endif
+
 void mbedtls_ssl_conf_dtls_badmac_limit( mbedtls_ssl_config *conf, unsigned limit )
 {
     conf->badmac_limit = limit;
@@ -1250,6 +1436,16 @@ void mbedtls_ssl_conf_session_cache( mbedtls_ssl_config *conf,
     conf->f_get_cache = f_get_cache;
     conf->f_set_cache = f_set_cache;
 }
+
+#if defined(MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED)
+void mbedtls_ssl_conf_ecdhe_pool( mbedtls_ssl_config *conf,
+                                  mbedtls_ssl_ecdhe_take_t *f_ecdhe_take,
+                                  void *p_ecdhe_pool )
+{
+    conf->f_ecdhe_take = f_ecdhe_take;
+    conf->p_ecdhe_pool = p_ecdhe_pool;
+}
+#endif /* MBEDTLS_KEY_EXCHANGE_SOME_ECDHE_ENABLED */
 #endif /* MBEDTLS_SSL_SRV_C */
 
 #if defined(MBEDTLS_SSL_CLI_C)
@@ -1848,6 +2044,17 @@ void mbedtls_ssl_conf_dhm_min_bitlen( mbedtls_ssl_config *conf,
 }
 #endif /* MBEDTLS_DHM_C && MBEDTLS_SSL_CLI_C */
 
+#if defined(MBEDTLS_ECP_RESTARTABLE) && defined(MBEDTLS_SSL_CLI_C)
+/*
+ * Set the restartable ECC budget of handshakes
+ */
+void mbedtls_ssl_conf_ecp_max_ops( mbedtls_ssl_config *conf,
+                                   unsigned int max_ops )
+{
+    conf->ecp_max_ops = max_ops;
+}
+#endif /* MBEDTLS_ECP_RESTARTABLE && MBEDTLS_SSL_CLI_C */
+
 #if defined(MBEDTLS_KEY_EXCHANGE_WITH_CERT_ENABLED)
 #if !defined(MBEDTLS_DEPRECATED_REMOVED) && defined(MBEDTLS_SSL_PROTO_TLS1_2)
 /*
@@ -2728,6 +2935,11 @@ static int ssl_prepare_handshake_step( mbedtls_ssl_context *ssl )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+        return( ret );
+#endif
+
     if( ( ret = mbedtls_ssl_flush_output( ssl ) ) != 0 )
         return( ret );
 
@@ -2929,6 +3141,25 @@ int mbedtls_ssl_renegotiate( mbedtls_ssl_context *ssl )
     if( ssl == NULL || ssl->conf == NULL )
         return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
 
+#if defined(MBEDTLS_SSL_KTLS)
+    /* The new keys could not be passed on to the transport. */
+    if( ssl->ktls != 0 )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+#endif
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    if( ( ret = mbedtls_ssl_acquire_buffers( ssl ) ) != 0 )
+        return( ret );
+    ret = MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+
+#if defined(MBEDTLS_SSL_WRITE_COALESCING)
+    /* The handshake messages reuse the buffer of the data held back. */
+    if( ( ret = mbedtls_ssl_flush_coalesced( ssl ) ) != 0 )
+        return( ret );
+    ret = MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+
 #if defined(MBEDTLS_SSL_SRV_C)
     /* On server, just send the request */
     if( ssl->conf->endpoint == MBEDTLS_SSL_IS_SERVER )
@@ -4088,6 +4319,18 @@ int mbedtls_ssl_config_defaults( mbedtls_ssl_config *conf,
     conf->anti_replay = MBEDTLS_SSL_ANTI_REPLAY_ENABLED;
 #endif
 
+#if defined(MBEDTLS_SSL_READ_AHEAD)
+    conf->read_ahead = MBEDTLS_SSL_READ_AHEAD_DISABLED;
+#endif
+
+#if defined(MBEDTLS_SSL_BATCH_DECRYPT)
+    conf->batch_decrypt = MBEDTLS_SSL_BATCH_DECRYPT_DISABLED;
+#endif
+
+#if defined(MBEDTLS_SSL_IDLE_BUFFER_RELEASE)
+    conf->idle_buffer_release = MBEDTLS_SSL_IDLE_BUFFER_RELEASE_DISABLED;
+#endif
+
 #if defined(MBEDTLS_SSL_SRV_C)
     conf->cert_req_ca_list = MBEDTLS_SSL_CERT_REQ_CA_LIST_ENABLED;
     conf->respect_cli_pref = MBEDTLS_SSL_SRV_CIPHERSUITE_ORDER_SERVER;
@@ -6987,6 +7230,36 @@ static mbedtls_tls_prf_types tls_prf_get_type( mbedtls_ssl_tls_prf_cb *tls_prf )
     return( MBEDTLS_SSL_TLS_PRF_NONE );
 }
 
+#if defined(MBEDTLS_SSL_KTLS)
+void mbedtls_ssl_transform_set_ktls_keys( mbedtls_ssl_transform *transform,
+                                          mbedtls_cipher_type_t cipher,
+                                          const unsigned char *key_enc,
+                                          const unsigned char *key_dec,
+                                          size_t keylen )
+{
+    transform->ktls_cipher = MBEDTLS_CIPHER_NONE;
+
+    if( transform->taglen != 16 ||
+        keylen > sizeof( transform->ktls_key_enc ) )
+        return;
+
+    switch( cipher )
+    {
+        case MBEDTLS_CIPHER_AES_128_GCM:
+        case MBEDTLS_CIPHER_AES_256_GCM:
+        case MBEDTLS_CIPHER_CHACHA20_POLY1305:
+            break;
+        default:
+            return;
+    }
+
+    transform->ktls_cipher = cipher;
+    transform->ktls_keylen = keylen;
+    memcpy( transform->ktls_key_enc, key_enc, keylen );
+    memcpy( transform->ktls_key_dec, key_dec, keylen );
+}
+#endif /* MBEDTLS_SSL_KTLS */
+
 /*
  * Populate a transform structure with session keys and all the other
  * necessary information.
@@ -7312,6 +7585,11 @@ static int ssl_tls12_populate_transform( mbedtls_ssl_transform *transform,
     ((void) mac_dec);
     ((void) mac_enc);
 
+#if defined(MBEDTLS_SSL_KTLS)
+    mbedtls_ssl_transform_set_ktls_keys( transform, cipher_info->type,
+                                         key1, key2, keylen );
+#endif
+
     if( ssl != NULL && ssl->f_export_keys != NULL )
     {
         ssl->f_export_keys( ssl->p_export_keys,
@@ -1054,6 +1054,12 @@ int mbedtls_ssl_tls13_populate_transform( mbedtls_ssl_transform *transform,
     transform->minlen =
         transform->taglen + MBEDTLS_SSL_CID_TLS1_3_PADDING_GRANULARITY;
 
+#if defined(MBEDTLS_SSL_KTLS)
+    mbedtls_ssl_transform_set_ktls_keys( transform, cipher_info->type,
+                                         key_enc, key_dec,
+                                         traffic_keys->key_len );
+#endif
+
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     /*
      * Setup psa keys and alg
@@ -155,6 +155,19 @@ void mbedtls_threading_set_alt( void (*mutex_init)( mbedtls_threading_mutex_t *
 #if defined(THREADING_USE_GMTIME)
     mbedtls_mutex_init( &mbedtls_threading_gmtime_mutex );
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    mbedtls_mutex_init( &mbedtls_threading_key_slot_mutex );
+    mbedtls_mutex_init( &mbedtls_threading_key_load_mutex );
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    mbedtls_mutex_init( &mbedtls_threading_psa_rngdata_mutex );
+#endif
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+    mbedtls_mutex_init( &mbedtls_threading_psa_its_mutex );
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+    mbedtls_mutex_init( &mbedtls_threading_psa_stats_mutex );
+#endif
 }
 
 /*
@@ -168,6 +181,19 @@ void mbedtls_threading_free_alt( void )
 #if defined(THREADING_USE_GMTIME)
     mbedtls_mutex_free( &mbedtls_threading_gmtime_mutex );
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    mbedtls_mutex_free( &mbedtls_threading_key_slot_mutex );
+    mbedtls_mutex_free( &mbedtls_threading_key_load_mutex );
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+    mbedtls_mutex_free( &mbedtls_threading_psa_rngdata_mutex );
+#endif
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+    mbedtls_mutex_free( &mbedtls_threading_psa_its_mutex );
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+    mbedtls_mutex_free( &mbedtls_threading_psa_stats_mutex );
+#endif
 }
 #endif /* MBEDTLS_THREADING_ALT */
 
@@ -183,5 +209,20 @@ mbedtls_threading_mutex_t mbedtls_threading_readdir_mutex MUTEX_INIT;
 #if defined(THREADING_USE_GMTIME)
 mbedtls_threading_mutex_t mbedtls_threading_gmtime_mutex MUTEX_INIT;
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#if !defined(MBEDTLS_THREADING_PTHREAD)
+mbedtls_threading_mutex_t mbedtls_threading_key_slot_mutex MUTEX_INIT;
+#endif
+mbedtls_threading_mutex_t mbedtls_threading_key_load_mutex MUTEX_INIT;
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG)
+mbedtls_threading_mutex_t mbedtls_threading_psa_rngdata_mutex MUTEX_INIT;
+#endif
+#if defined(MBEDTLS_PSA_ITS_LOG_C)
+mbedtls_threading_mutex_t mbedtls_threading_psa_its_mutex MUTEX_INIT;
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_INSTRUMENTATION)
+mbedtls_threading_mutex_t mbedtls_threading_psa_stats_mutex MUTEX_INIT;
+#endif
 
 #endif /* MBEDTLS_THREADING_C */
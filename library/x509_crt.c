@@ -3380,11 +3380,16 @@ void mbedtls_x509_crt_restart_init( mbedtls_x509_crt_restart_ctx *ctx )
  */
 void mbedtls_x509_crt_restart_free( mbedtls_x509_crt_restart_ctx *ctx )
 {
+    unsigned max_ops;
+
     if( ctx == NULL )
         return;
 
+    /* Keep the ops budget, which is a setting rather than state */
+    max_ops = ctx->pk.max_ops;
     mbedtls_pk_restart_free( &ctx->pk );
     mbedtls_x509_crt_restart_init( ctx );
+    mbedtls_pk_restart_set_max_ops( &ctx->pk, max_ops );
 }
 #endif /* MBEDTLS_ECDSA_C && MBEDTLS_ECP_RESTARTABLE */
 
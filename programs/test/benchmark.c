@@ -70,6 +70,10 @@ int main( void )
 
 #include "mbedtls/error.h"
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#include "psa/crypto.h"
+#endif
+
 #ifndef asm
 #define asm __asm
 #endif
@@ -127,7 +131,8 @@ static void mbedtls_set_alarm( int seconds );
     "aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,\n"                 \
     "aes_cmac, des3_cmac, poly1305\n"                                   \
     "ctr_drbg, hmac_drbg\n"                                     \
-    "rsa, dhm, ecdsa, ecdh.\n"
+    "rsa, dhm, ecdsa, ecdh,\n"                                        \
+    "psa_dispatch.\n"
 
 #if defined(MBEDTLS_ERROR_C)
 #define PRINT_ERROR                                                     \
@@ -171,6 +176,40 @@ do {                                                                    \
     }                                                                   \
 } while( 0 )
 
+/* Like TIME_AND_TSC, but for short calls whose cost is dominated by the
+ * call itself rather than by the amount of data processed. */
+#define TIME_CALL( TITLE, CODE )                                        \
+do {                                                                    \
+    unsigned long ii, jj, tsc;                                          \
+    int ret = 0;                                                        \
+                                                                        \
+    mbedtls_printf( HEADER_FORMAT, TITLE );                             \
+    fflush( stdout );                                                   \
+                                                                        \
+    mbedtls_set_alarm( 1 );                                             \
+    for( ii = 1; ret == 0 && ! mbedtls_timing_alarmed; ii++ )           \
+    {                                                                   \
+        ret = CODE;                                                     \
+    }                                                                   \
+                                                                        \
+    tsc = mbedtls_timing_hardclock();                                   \
+    for( jj = 0; ret == 0 && jj < 65536; jj++ )                         \
+    {                                                                   \
+        ret = CODE;                                                     \
+    }                                                                   \
+                                                                        \
+    if( ret != 0 )                                                      \
+    {                                                                   \
+        mbedtls_printf( "FAILED: %d\n", ret );                          \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        mbedtls_printf( "%9lu calls/s, %9lu cycles/call\n",             \
+                         ii,                                            \
+                         ( mbedtls_timing_hardclock() - tsc ) / jj );   \
+    }                                                                   \
+} while( 0 )
+
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C) && defined(MBEDTLS_MEMORY_DEBUG)
 
 /* How much space to reserve for the title when printing heap usage results.
@@ -491,6 +530,22 @@ static int myrand( void *rng_state, unsigned char *output, size_t len )
         }                                                               \
     }
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#define PSA_CHECK_AND_CONTINUE( R )                                     \
+    {                                                                   \
+        psa_status_t PSA_CHECK_AND_CONTINUE_status = ( R );             \
+        if( PSA_CHECK_AND_CONTINUE_status == PSA_ERROR_NOT_SUPPORTED ) { \
+            mbedtls_printf( "Feature not supported. Skipping.\n" );     \
+            continue;                                                   \
+        }                                                               \
+        else if( PSA_CHECK_AND_CONTINUE_status != PSA_SUCCESS ) {       \
+            mbedtls_printf( "PSA call failed: %d\n",                    \
+                            (int) PSA_CHECK_AND_CONTINUE_status );      \
+            mbedtls_exit( 1 );                                          \
+        }                                                               \
+    }
+#endif /* MBEDTLS_PSA_CRYPTO_C */
+
 /*
  * Clear some memory that was used to prepare the context
  */
@@ -540,7 +595,8 @@ typedef struct {
          aria, camellia, chacha20,
          poly1305,
          ctr_drbg, hmac_drbg,
-         rsa, dhm, ecdsa, ecdh;
+         rsa, dhm, ecdsa, ecdh,
+         psa_dispatch;
 } todo_list;
 
 
@@ -623,6 +679,8 @@ int main( int argc, char *argv[] )
                 todo.ecdsa = 1;
             else if( strcmp( argv[i], "ecdh" ) == 0 )
                 todo.ecdh = 1;
+            else if( strcmp( argv[i], "psa_dispatch" ) == 0 )
+                todo.psa_dispatch = 1;
 #if defined(MBEDTLS_ECP_C)
             else if( set_ecp_curve( argv[i], single_curve ) )
                 curve_list = single_curve;
@@ -1290,6 +1348,145 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    if( todo.psa_dispatch )
+    {
+        /* Small inputs, so that the figures mostly reflect the cost of
+         * going through the PSA API and the driver dispatch layer. Each
+         * group is a do-while( 0 ) block so that it can be skipped with
+         * PSA_CHECK_AND_CONTINUE. */
+        psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+        mbedtls_svc_key_id_t key = MBEDTLS_SVC_KEY_ID_INIT;
+        size_t olen;
+
+        if( psa_crypto_init( ) != PSA_SUCCESS )
+        {
+            mbedtls_printf( "psa_crypto_init() failed\n" );
+            mbedtls_exit( 1 );
+        }
+
+#if defined(PSA_WANT_ALG_SHA_256)
+        do
+        {
+            psa_hash_operation_t hash = PSA_HASH_OPERATION_INIT;
+#if defined(MBEDTLS_SHA256_C)
+            mbedtls_sha256_context sha256;
+
+            mbedtls_sha256_init( &sha256 );
+            CHECK_AND_CONTINUE( mbedtls_sha256_starts( &sha256, 0 ) );
+            TIME_CALL( "SHA-256 update 16B",
+                       mbedtls_sha256_update( &sha256, buf, 16 ) );
+            mbedtls_sha256_free( &sha256 );
+#endif
+            PSA_CHECK_AND_CONTINUE( psa_hash_setup( &hash, PSA_ALG_SHA_256 ) );
+            TIME_CALL( "PSA SHA-256 update 16B",
+                       psa_hash_update( &hash, buf, 16 ) );
+            psa_hash_abort( &hash );
+            TIME_CALL( "PSA SHA-256 compute 16B",
+                       psa_hash_compute( PSA_ALG_SHA_256, buf, 16,
+                                         tmp, sizeof( tmp ), &olen ) );
+        }
+        while( 0 );
+#endif
+
+#if defined(PSA_WANT_ALG_HMAC) && defined(PSA_WANT_ALG_SHA_256)
+        do
+        {
+            psa_mac_operation_t mac = PSA_MAC_OPERATION_INIT;
+
+            psa_set_key_usage_flags( &attributes, PSA_KEY_USAGE_SIGN_MESSAGE );
+            psa_set_key_algorithm( &attributes,
+                                   PSA_ALG_HMAC( PSA_ALG_SHA_256 ) );
+            psa_set_key_type( &attributes, PSA_KEY_TYPE_HMAC );
+            PSA_CHECK_AND_CONTINUE( psa_import_key( &attributes, tmp, 32,
+                                                    &key ) );
+            PSA_CHECK_AND_CONTINUE( psa_mac_sign_setup( &mac, key,
+                                        PSA_ALG_HMAC( PSA_ALG_SHA_256 ) ) );
+            TIME_CALL( "PSA HMAC update 16B",
+                       psa_mac_update( &mac, buf, 16 ) );
+            psa_mac_abort( &mac );
+            psa_destroy_key( key );
+        }
+        while( 0 );
+#endif
+
+#if defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_CTR)
+        do
+        {
+            psa_cipher_operation_t cipher = PSA_CIPHER_OPERATION_INIT;
+#if defined(MBEDTLS_AES_C) && defined(MBEDTLS_CIPHER_MODE_CTR)
+            mbedtls_aes_context aes;
+            unsigned char nonce_counter[16] = { 0 };
+            unsigned char stream_block[16];
+            size_t nc_off = 0;
+
+            mbedtls_aes_init( &aes );
+            CHECK_AND_CONTINUE( mbedtls_aes_setkey_enc( &aes, tmp, 128 ) );
+            TIME_CALL( "AES-CTR 16B",
+                       mbedtls_aes_crypt_ctr( &aes, 16, &nc_off, nonce_counter,
+                                              stream_block, buf, tmp + 32 ) );
+            mbedtls_aes_free( &aes );
+#endif
+
+            psa_set_key_usage_flags( &attributes, PSA_KEY_USAGE_ENCRYPT );
+            psa_set_key_algorithm( &attributes, PSA_ALG_CTR );
+            psa_set_key_type( &attributes, PSA_KEY_TYPE_AES );
+            PSA_CHECK_AND_CONTINUE( psa_import_key( &attributes, tmp, 16,
+                                                    &key ) );
+            PSA_CHECK_AND_CONTINUE( psa_cipher_encrypt_setup( &cipher, key,
+                                                              PSA_ALG_CTR ) );
+            PSA_CHECK_AND_CONTINUE( psa_cipher_set_iv( &cipher, tmp, 16 ) );
+            TIME_CALL( "PSA AES-CTR update 16B",
+                       psa_cipher_update( &cipher, buf, 16,
+                                          tmp, sizeof( tmp ), &olen ) );
+            psa_cipher_abort( &cipher );
+            TIME_CALL( "PSA AES-CTR encrypt 16B",
+                       psa_cipher_encrypt( key, PSA_ALG_CTR, buf, 16,
+                                           tmp, sizeof( tmp ), &olen ) );
+            psa_destroy_key( key );
+        }
+        while( 0 );
+#endif
+
+#if defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_CMAC)
+        do
+        {
+            psa_set_key_usage_flags( &attributes, PSA_KEY_USAGE_SIGN_MESSAGE );
+            psa_set_key_algorithm( &attributes, PSA_ALG_CMAC );
+            psa_set_key_type( &attributes, PSA_KEY_TYPE_AES );
+            PSA_CHECK_AND_CONTINUE( psa_import_key( &attributes, tmp, 16,
+                                                    &key ) );
+            TIME_CALL( "PSA AES-CMAC compute 16B",
+                       psa_mac_compute( key, PSA_ALG_CMAC, buf, 16,
+                                        tmp, sizeof( tmp ), &olen ) );
+            psa_destroy_key( key );
+        }
+        while( 0 );
+#endif
+
+#if defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_GCM)
+        do
+        {
+            psa_set_key_usage_flags( &attributes, PSA_KEY_USAGE_ENCRYPT );
+            psa_set_key_algorithm( &attributes, PSA_ALG_GCM );
+            psa_set_key_type( &attributes, PSA_KEY_TYPE_AES );
+            PSA_CHECK_AND_CONTINUE( psa_import_key( &attributes, tmp, 16,
+                                                    &key ) );
+            TIME_CALL( "PSA AES-GCM encrypt 16B",
+                       psa_aead_encrypt( key, PSA_ALG_GCM, tmp, 12, NULL, 0,
+                                         buf, 16, tmp + 32, 32, &olen ) );
+            psa_destroy_key( key );
+        }
+        while( 0 );
+#endif
+
+        (void) attributes;
+        (void) key;
+        (void) olen;
+        mbedtls_psa_crypto_free( );
+    }
+#endif /* MBEDTLS_PSA_CRYPTO_C */
+
     mbedtls_printf( "\n" );
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Purpose
+
+This script dumps the fixed-base comb tables of the generator 2 of the
+RFC 7919 Diffie-Hellman groups. Its output defines `ffdhe<bits>_P` and
+`ffdhe<bits>_T` in dhm.c.
+
+The prime moduli are read from include/mbedtls/dhm.h, so that the tables
+always match the groups that the library exposes.
+"""
+
+# Copyright The Mbed TLS Contributors
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import re
+import sys
+from typing import Dict, List
+
+# Must match DHM_COMB_WIDTH in library/dhm.c.
+COMB_WIDTH = 4
+
+GENERATOR = 2
+
+ALL_GROUPS = [2048, 3072, 4096, 6144, 8192]
+
+
+def join_src_path(*args: str) -> str:
+    return os.path.normpath(os.path.join(os.path.dirname(__file__), "..", *args))
+
+
+def read_primes() -> Dict[int, int]:
+    """Read the RFC 7919 prime moduli from dhm.h, keyed by bit size."""
+    with open(join_src_path("include", "mbedtls", "dhm.h")) as header:
+        content = header.read()
+    primes = {}
+    for match in re.finditer(r'#define MBEDTLS_DHM_RFC7919_FFDHE(\d+)_P_BIN\s*\{'
+                             r'([^}]*)\}', content):
+        data = bytes(int(byte, 16)
+                     for byte in re.findall(r'0x([0-9A-Fa-f]{2})', match.group(2)))
+        primes[int(match.group(1))] = int.from_bytes(data, 'big')
+    return primes
+
+
+def comb_table(prime: int) -> List[int]:
+    """
+    Entry b - 1 of the table is
+    G^(sum of 2^(i * d) for each bit i set in b) mod P, for 0 < b < 2^w.
+    """
+    d = (prime.bit_length() + COMB_WIDTH - 1) // COMB_WIDTH
+    rows = [pow(GENERATOR, 1 << (i * d), prime) for i in range(COMB_WIDTH)]
+    table = []
+    for b in range(1, 1 << COMB_WIDTH):
+        entry = 1
+        for i in range(COMB_WIDTH):
+            if b & (1 << i):
+                entry = entry * rows[i] % prime
+        table.append(entry)
+    return table
+
+
+def dump_mpi_initialize(name: str, value: int, size: int) -> None:
+    data = value.to_bytes(size, 'little')
+    print("static const mbedtls_mpi_uint %s[] = {" % name)
+    for i in range(0, size, 8):
+        print("    MBEDTLS_BYTES_TO_T_UINT_8( %s )," %
+              ", ".join("0x%02X" % byte for byte in data[i:i + 8]))
+    print("};")
+
+
+def dump_group(bits: int, prime: int) -> None:
+    name = "ffdhe%d" % bits
+    size = (prime.bit_length() + 63) // 64 * 8
+    table = comb_table(prime)
+
+    dump_mpi_initialize("%s_p" % name, prime, size)
+    for i, entry in enumerate(table, 1):
+        dump_mpi_initialize("%s_T_%d" % (name, i), entry, size)
+    print("static const mbedtls_mpi %s_P = DHM_MPI_INIT_ARRAY( %s_p );" %
+          (name, name))
+    print("static const mbedtls_mpi %s_T[%d] = {" % (name, len(table)))
+    for i in range(1, len(table) + 1):
+        print("    DHM_MPI_INIT_ARRAY( %s_T_%d )," % (name, i))
+    print("};")
+    print()
+
+
+def usage() -> None:
+    print("""
+Usage: python %s [<bits>...]
+
+Arguments:
+    bits        Sizes of the RFC 7919 groups to dump (default: all of %s)
+""" % (sys.argv[0], " ".join(str(bits) for bits in ALL_GROUPS)))
+
+
+def run_main() -> None:
+    if any(arg.startswith('-') for arg in sys.argv[1:]):
+        usage()
+        return
+    primes = read_primes()
+    groups = [int(arg) for arg in sys.argv[1:]] or ALL_GROUPS
+    for bits in groups:
+        if bits not in primes:
+            print("Unknown group size: %d" % bits, file=sys.stderr)
+            sys.exit(1)
+        dump_group(bits, primes[bits])
+
+
+if __name__ == '__main__':
+    run_main()
@@ -1,9 +1,10 @@
 #!/usr/bin/env python3
 """Generate library/psa_crypto_driver_wrappers.c
+   and library/psa_crypto_driver_wrappers_inline.h
 
    This module is invoked by the build sripts to auto generate the
-   psa_crypto_driver_wrappers.c based on template files in
-   script/data_files/driver_templates/.
+   psa_crypto_driver_wrappers.c and psa_crypto_driver_wrappers_inline.h
+   based on template files in script/data_files/driver_templates/.
 """
 # Copyright The Mbed TLS Contributors
 # SPDX-License-Identifier: Apache-2.0
@@ -37,18 +38,25 @@ def render(template_path: str) -> str:
 
     return template.render()
 
+GENERATED_FILES = [
+    "psa_crypto_driver_wrappers.c",
+    "psa_crypto_driver_wrappers_inline.h",
+]
+
 def generate_driver_wrapper_file(mbedtls_root: str, output_dir: str) -> None:
     """
-    Generate the file psa_crypto_driver_wrapper.c.
+    Generate the files psa_crypto_driver_wrappers.c and
+    psa_crypto_driver_wrappers_inline.h.
     """
-    driver_wrapper_template_filename = \
-        os.path.join(mbedtls_root, \
-        "scripts/data_files/driver_templates/psa_crypto_driver_wrappers.c.jinja")
+    for filename in GENERATED_FILES:
+        driver_wrapper_template_filename = \
+            os.path.join(mbedtls_root, \
+            "scripts/data_files/driver_templates", filename + ".jinja")
 
-    result = render(driver_wrapper_template_filename)
+        result = render(driver_wrapper_template_filename)
 
-    with open(os.path.join(output_dir, "psa_crypto_driver_wrappers.c"), 'w') as out_file:
-        out_file.write(result)
+        with open(os.path.join(output_dir, filename), 'w') as out_file:
+            out_file.write(result)
 
 def main() -> int:
     """
@@ -88,6 +88,30 @@ void mbedtls_test_psa_purge_key_cache( void );
 
 #define PSA_INIT( ) PSA_ASSERT( psa_crypto_init( ) )
 
+#if !defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC) || defined(MBEDTLS_TEST_HOOKS)
+/** Defined when tests can run out of key slots after creating
+ * #MBEDTLS_PSA_KEY_SLOT_COUNT keys, see mbedtls_test_psa_limit_key_store().
+ */
+#define MBEDTLS_TEST_PSA_KEY_STORE_LIMITABLE
+#endif
+
+/** Limit the number of key slots of a dynamic key store.
+ *
+ * With a limit of \p slab_count blocks of key slots, the key store holds
+ * at most #MBEDTLS_PSA_KEY_SLOT_COUNT * (2^\p slab_count - 1) keys. In
+ * particular, a limit of 1 makes it hold #MBEDTLS_PSA_KEY_SLOT_COUNT keys,
+ * like a fixed-size key store. A limit of 0 lets the key store grow to its
+ * normal maximum size again.
+ *
+ * Call this function before the key store grows beyond the limit, and
+ * call it with a limit of 0 in the cleanup code of the test function.
+ * It has no effect on a fixed-size key store, or without
+ * #MBEDTLS_TEST_HOOKS.
+ *
+ * \param slab_count    The number of blocks of key slots, or 0.
+ */
+void mbedtls_test_psa_limit_key_store( size_t slab_count );
+
 /** Check for things that have not been cleaned up properly in the
  * PSA subsystem.
  *
@@ -946,6 +946,39 @@ component_test_psa_crypto_key_id_encodes_owner () {
     make test
 }
 
+component_test_psa_crypto_per_thread_rng () {
+    msg "build: full config + PSA_CRYPTO_PER_THREAD_RNG, cmake, gcc, ASan"
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_PSA_CRYPTO_PER_THREAD_RNG
+    CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+    make
+
+    msg "test: full config + PSA_CRYPTO_PER_THREAD_RNG, cmake, gcc, ASan"
+    make test
+}
+
+component_test_rsa_gen_key_threaded () {
+    msg "build: full config + RSA_GEN_KEY_THREADED, cmake, gcc, ASan"
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_RSA_GEN_KEY_THREADED
+    CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+    make
+
+    msg "test: full config + RSA_GEN_KEY_THREADED, cmake, gcc, ASan"
+    make test
+}
+
+component_test_psa_its_log () {
+    msg "build: default config - PSA_ITS_FILE_C + PSA_ITS_LOG_C, cmake, gcc, ASan"
+    scripts/config.py unset MBEDTLS_PSA_ITS_FILE_C
+    scripts/config.py set MBEDTLS_PSA_ITS_LOG_C
+    CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+    make
+
+    msg "test: default config - PSA_ITS_FILE_C + PSA_ITS_LOG_C, cmake, gcc, ASan"
+    make test
+}
+
 # check_renamed_symbols HEADER LIB
 # Check that if HEADER contains '#define MACRO ...' then MACRO is not a symbol
 # name is LIB.
@@ -1529,6 +1562,8 @@ component_test_no_use_psa_crypto_full_cmake_asan() {
     scripts/config.py unset MBEDTLS_PSA_ITS_FILE_C
     scripts/config.py unset MBEDTLS_PSA_CRYPTO_SE_C
     scripts/config.py unset MBEDTLS_PSA_CRYPTO_STORAGE_C
+    scripts/config.py unset MBEDTLS_PSA_ASYNC_C
+    scripts/config.py unset MBEDTLS_PSA_CRYPTO_INSTRUMENTATION
     CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
     make
 
@@ -2415,6 +2450,22 @@ component_test_psa_crypto_drivers () {
     make test
 }
 
+component_test_psa_simd_driver () {
+    msg "build: full + MBEDTLS_PSA_SIMD_DRIVER_C w/ driver hooks"
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_PSA_CRYPTO_DRIVERS
+    scripts/config.py set MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS
+    scripts/config.py set MBEDTLS_PSA_SIMD_DRIVER_C
+    loc_cflags="$ASAN_CFLAGS -DPSA_CRYPTO_DRIVER_TEST_ALL"
+    loc_cflags="${loc_cflags} '-DMBEDTLS_USER_CONFIG_FILE=\"../tests/configs/user-config-for-test.h\"'"
+    loc_cflags="${loc_cflags} -I../tests/include -O2"
+
+    make CC=gcc CFLAGS="${loc_cflags}" LDFLAGS="$ASAN_CFLAGS"
+
+    msg "test: full + MBEDTLS_PSA_SIMD_DRIVER_C"
+    make test
+}
+
 component_test_make_shared () {
     msg "build/test: make shared" # ~ 40s
     make SHARED=1 all check
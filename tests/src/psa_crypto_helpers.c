@@ -33,7 +33,9 @@
 
 #include <psa_crypto_storage.h>
 
-static mbedtls_svc_key_id_t key_ids_used_in_test[9];
+/* Enough room for the tests that fill the key store with persistent keys. */
+static mbedtls_svc_key_id_t key_ids_used_in_test[
+    9 + 4 * MBEDTLS_PSA_KEY_SLOT_COUNT];
 static size_t num_key_ids_used;
 
 int mbedtls_test_uses_key_id( mbedtls_svc_key_id_t key_id )
@@ -74,6 +76,16 @@ void mbedtls_test_psa_purge_key_cache( void )
 
 #endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C */
 
+void mbedtls_test_psa_limit_key_store( size_t slab_count )
+{
+#if defined(MBEDTLS_PSA_KEY_STORE_DYNAMIC) && defined(MBEDTLS_TEST_HOOKS)
+    mbedtls_test_hook_psa_key_slab_limit =
+        slab_count == 0 ? PSA_KEY_SLOT_SLAB_COUNT : slab_count;
+#else
+    (void) slab_count;
+#endif
+}
+
 const char *mbedtls_test_helper_is_psa_leaking( void )
 {
     mbedtls_psa_stats_t stats;
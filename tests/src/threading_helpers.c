@@ -165,20 +165,27 @@ static int mbedtls_test_wrap_mutex_lock( mbedtls_threading_mutex_t *mutex )
 
 static int mbedtls_test_wrap_mutex_unlock( mbedtls_threading_mutex_t *mutex )
 {
-    int ret = mutex_functions.unlock( mutex );
+    int ret;
     switch( mutex->is_valid )
     {
         case MUTEX_FREED:
+            ret = mutex_functions.unlock( mutex );
             mbedtls_test_mutex_usage_error( mutex, "unlock without init" );
             break;
         case MUTEX_IDLE:
+            ret = mutex_functions.unlock( mutex );
             mbedtls_test_mutex_usage_error( mutex, "unlock without lock" );
             break;
         case MUTEX_LOCKED:
-            if( ret == 0 )
-                mutex->is_valid = MUTEX_IDLE;
+            /* Update the state while the mutex is still held: once it is
+             * released, another thread may lock it and set the state. */
+            mutex->is_valid = MUTEX_IDLE;
+            ret = mutex_functions.unlock( mutex );
+            if( ret != 0 )
+                mutex->is_valid = MUTEX_LOCKED;
             break;
         default:
+            ret = mutex_functions.unlock( mutex );
             mbedtls_test_mutex_usage_error( mutex, "corrupted state" );
             break;
     }